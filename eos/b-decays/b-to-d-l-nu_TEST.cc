@@ -23,6 +23,7 @@
 #include <eos/observable.hh>
 #include <eos/b-decays/b-to-psd-l-nu.hh>
 #include <eos/maths/complex.hh>
+#include <eos/utils/observable_cache.hh>
 #include <eos/utils/wilson-polynomial.hh>
 
 #include <array>
@@ -99,7 +100,7 @@ class BToDLeptonNeutrinoTest :
                 BToPseudoscalarLeptonNeutrino d(p, o);
 
                 const double eps = 1e-3;
-                TEST_CHECK_NEARLY_EQUAL(d.integrated_branching_ratio(0.001, 11.643), 13.462, eps);
+                TEST_CHECK_NEARLY_EQUAL(d.integrated_branching_ratio(d.prepare(0.001, 11.643)), 13.462, eps);
             }
 
             // comparison with Martin Jung in 3/2/1 model
@@ -153,7 +154,7 @@ class BToDLeptonNeutrinoTest :
                 BToPseudoscalarLeptonNeutrino d(p, o);
 
                 const double eps = 1e-3;
-                TEST_CHECK_NEARLY_EQUAL(d.integrated_lepton_polarization(3.157, 11.643), +0.320914, eps);
+                TEST_CHECK_NEARLY_EQUAL(d.integrated_lepton_polarization(d.prepare(3.157, 11.643)), +0.320914, eps);
             }
 
             // SM tests
@@ -189,8 +190,8 @@ class BToDLeptonNeutrinoTest :
                 {
                     BToPseudoscalarLeptonNeutrino d(p, oo);
 
-                    TEST_CHECK_RELATIVE_ERROR(d.normalized_integrated_branching_ratio(0.011164, 11.62), 13.1988, eps);
-                    TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011164, 11.62), -0.0138762, eps);
+                    TEST_CHECK_RELATIVE_ERROR(d.normalized_integrated_branching_ratio(d.prepare(0.011164, 11.62)), 13.1988, eps);
+                    TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(0.011164, 11.62)), -0.0138762, eps);
 
                     oo.declare("l", "tau");
                     auto k_tau = Kinematics{
@@ -289,8 +290,8 @@ class BToDLeptonNeutrinoTest :
                 {
                     BToPseudoscalarLeptonNeutrino d(p, oo);
 
-                    TEST_CHECK_RELATIVE_ERROR(d.normalized_integrated_branching_ratio(0.011164, 11.62), 2615.77, eps);
-                    TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011164, 11.62), -0.621944, eps);
+                    TEST_CHECK_RELATIVE_ERROR(d.normalized_integrated_branching_ratio(d.prepare(0.011164, 11.62)), 2615.77, eps);
+                    TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(0.011164, 11.62)), -0.621944, eps);
 
                     auto k      = Kinematics{
                         { "q2_mu_min",   0.011164 },
@@ -312,5 +313,90 @@ class BToDLeptonNeutrinoTest :
                     TEST_CHECK_RELATIVE_ERROR(1.43554, obs_RD->evaluate(), eps);
                 }
             }
+
+            // gradient tests
+            {
+                Parameters p = Parameters::Defaults();
+                p["cbtaunutau::Re{cVL}"]       = +1.1;
+                p["cbtaunutau::Im{cVR}"]       = -0.2;
+                p["cbtaunutau::Re{cSL}"]       = +0.3;
+                p["cbtaunutau::Im{cSR}"]       = -0.4;
+                p["cbtaunutau::Re{cT}"]        = +0.1;
+                p["cbtaunutau::Im{cT}"]        = -0.2;
+
+                Options oo
+                {
+                    { "model",        "WET"     },
+                    { "form-factors", "BSZ2015" },
+                    { "U",            "c"       },
+                    { "q",            "d"       },
+                    { "I",            "1/2"     },
+                    { "l",            "tau"     }
+                };
+
+                const std::vector<Parameter> parameters
+                {
+                    p["B->D::alpha^f+_0@BSZ2015"],
+                    p["B->D::alpha^f+_1@BSZ2015"],
+                    p["B->D::alpha^f0_1@BSZ2015"],
+                    p["B->D::alpha^fT_0@BSZ2015"],
+                    p["mass::B_d"],
+                    p["mass::tau"],
+                    p["CKM::abs(V_cb)"],
+                    p["cbtaunutau::Re{cSL}"],
+                    p["cbtaunutau::Re{cT}"],
+                };
+
+                BToPseudoscalarLeptonNeutrino d(p, oo);
+                TEST_CHECK(d.differentiable());
+
+                for (const auto & q2 : { 4.0, 7.0, 10.0 })
+                {
+                    const Dual result = d.differential_branching_ratio_with_gradient(parameters, q2);
+                    TEST_CHECK_RELATIVE_ERROR(d.differential_branching_ratio(q2), result.value(), 1.0e-12);
+
+                    for (auto i = 0u ; i < parameters.size() ; ++i)
+                    {
+                        Parameter x = parameters[i];
+                        const double x0 = x.evaluate(), h = 1.0e-5 * std::abs(x0);
+
+                        x = x0 + h;
+                        const double upper = d.differential_branching_ratio(q2);
+                        x = x0 - h;
+                        const double lower = d.differential_branching_ratio(q2);
+                        x = x0;
+
+                        TEST_CHECK_NEARLY_EQUAL((upper - lower) / (2.0 * h), result.derivative(i), 1.0e-6 * std::abs(result.value() / x0));
+                    }
+                }
+
+                // the cache combines the exact gradients with those of its numerical fallback
+                ObservableCache cache(p);
+                auto id_differentiable = cache.add(Observable::make("B->Dlnu::dBR/dq2", p, Kinematics{ { "q2", 7.0 } }, oo));
+                auto id_numerical      = cache.add(Observable::make("B->Dlnu::dBR/dq2", p, Kinematics{ { "q2", 7.0 } },
+                            oo + Options{ { "form-factors", "BCL2008" } }));
+                auto id_expression     = cache.add(Observable::make("B->Dlnu::R_D(q2)", p, Kinematics{ { "q2", 7.0 } }, oo));
+
+                TEST_CHECK(dynamic_cast<const DifferentiableObservable &>(*cache.observable(id_differentiable)).differentiable());
+                TEST_CHECK(! dynamic_cast<const DifferentiableObservable &>(*cache.observable(id_numerical)).differentiable());
+
+                cache.update();
+                const double value_numerical = cache[id_numerical], value_expression = cache[id_expression];
+
+                cache.update_with_gradient(parameters);
+                TEST_CHECK_RELATIVE_ERROR(d.differential_branching_ratio(7.0), cache.prediction_with_gradient(id_differentiable).value(), 1.0e-12);
+                const Dual reference = d.differential_branching_ratio_with_gradient(parameters, 7.0);
+                for (auto i = 0u ; i < parameters.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(reference.derivative(i), cache.prediction_with_gradient(id_differentiable).derivative(i));
+                }
+                TEST_CHECK_RELATIVE_ERROR(2.0 * value_numerical / parameters[6].evaluate(), cache.prediction_with_gradient(id_numerical).derivative(6), 1.0e-6);
+                TEST_CHECK_EQUAL(0.0, cache.prediction_with_gradient(id_numerical).derivative(0));
+                TEST_CHECK(0.0 != cache.prediction_with_gradient(id_expression).derivative(8));
+
+                // the predictions at the original point are restored
+                TEST_CHECK_EQUAL(value_numerical,  cache[id_numerical]);
+                TEST_CHECK_EQUAL(value_expression, cache[id_expression]);
+            }
         }
 } b_to_d_l_nu_test;
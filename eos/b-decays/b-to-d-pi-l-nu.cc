@@ -33,6 +33,10 @@ namespace eos
         // form factors
         std::shared_ptr<FormFactors<PToV>> ff;
 
+        using IntermediateResult = BToDPiLeptonNeutrino::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -176,14 +180,19 @@ namespace eos
             return nf * denom;
         }
 
-        double lepton_polarization(const double & q2_min, const double & q2_max) const
+        const IntermediateResult * prepare(const double & q2_min, const double & q2_max)
         {
             std::function<double (const double &)> integrand_num   = std::bind(&Implementation<BToDPiLeptonNeutrino>::lepton_polarization_numerator,   this, std::placeholders::_1);
             std::function<double (const double &)> integrand_denom = std::bind(&Implementation<BToDPiLeptonNeutrino>::lepton_polarization_denominator, this, std::placeholders::_1);
-            const auto num   = integrate<GSL::QAGS>(integrand_num,   q2_min, q2_max);
-            const auto denom = integrate<GSL::QAGS>(integrand_denom, q2_min, q2_max);
+            intermediate_result.lepton_polarization_numerator   = integrate<GSL::QAGS>(integrand_num,   q2_min, q2_max);
+            intermediate_result.lepton_polarization_denominator = integrate<GSL::QAGS>(integrand_denom, q2_min, q2_max);
 
-            return num / denom;
+            return &intermediate_result;
+        }
+
+        double lepton_polarization(const IntermediateResult * ir) const
+        {
+            return ir->lepton_polarization_numerator / ir->lepton_polarization_denominator;
         }
 
         double dist_q2(const double & q2) const
@@ -453,10 +462,16 @@ namespace eos
     {
     }
 
+    const BToDPiLeptonNeutrino::IntermediateResult *
+    BToDPiLeptonNeutrino::prepare(const double & q2_min, const double & q2_max) const
+    {
+        return _imp->prepare(q2_min, q2_max);
+    }
+
     double
-    BToDPiLeptonNeutrino::integrated_lepton_polarization(const double & q2_min, const double & q2_max) const
+    BToDPiLeptonNeutrino::integrated_lepton_polarization(const IntermediateResult * ir) const
     {
-        return _imp->lepton_polarization(q2_min, q2_max);
+        return _imp->lepton_polarization(ir);
     }
 
     double
@@ -20,6 +20,7 @@
 #ifndef MASTER_GUARD_EOS_B_DECAYS_B_TO_D_PI_L_NU_HH
 #define MASTER_GUARD_EOS_B_DECAYS_B_TO_D_PI_L_NU_HH 1
 
+#include <eos/observable.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
@@ -52,7 +53,12 @@ namespace eos
             double integrated_pdf_chi(const double & chi_min, const double & chi_max) const;
             double integrated_pdf_w(const double & w_min, const double & w_max) const;
 
-            double integrated_lepton_polarization(const double & q2_min, const double & q2_max) const;
+            /*!
+             * q2-integrated observables
+             */
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            double integrated_lepton_polarization(const IntermediateResult *) const;
 
             /*!
              * Descriptions of the process and its kinematics.
@@ -74,6 +80,23 @@ namespace eos
             static std::vector<OptionSpecification>::const_iterator begin_options();
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
+
+    /*!
+     * The q2-integrated numerator and denominator of the lepton polarization in one bin.
+     */
+    class BToDPiLeptonNeutrino::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            double lepton_polarization_numerator;
+            double lepton_polarization_denominator;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
 }
 
 #endif
@@ -86,7 +86,7 @@ class BToDPiLeptonNeutrinoTest :
 
                 const double eps = 1e-5;
 
-                TEST_CHECK_NEARLY_EQUAL(d.integrated_lepton_polarization(3.157, 10.689), 0.484992,     eps);
+                TEST_CHECK_NEARLY_EQUAL(d.integrated_lepton_polarization(d.prepare(3.157, 10.689)), 0.484992,     eps);
             }
 
             {
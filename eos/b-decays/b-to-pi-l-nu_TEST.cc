@@ -71,15 +71,15 @@ class BToPiLeptonNeutrinoTest :
 
                 const double eps = 1e-8;
 
-                TEST_CHECK_NEARLY_EQUAL(1.44047e-05, d.integrated_branching_ratio( 0.01,  2.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.43046e-05, d.integrated_branching_ratio( 2.00,  4.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.40803e-05, d.integrated_branching_ratio( 4.00,  6.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.37941e-05, d.integrated_branching_ratio( 6.00,  8.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.34323e-05, d.integrated_branching_ratio( 8.00, 10.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.29770e-05, d.integrated_branching_ratio(10.00, 12.00), eps);
-
-                TEST_CHECK_NEARLY_EQUAL(8.29930e-5,  d.integrated_branching_ratio( 0.01, 12.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.43035e-4,  d.integrated_branching_ratio( 0.01, 25.00), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.44047e-05, d.integrated_branching_ratio(d.prepare( 0.01,  2.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.43046e-05, d.integrated_branching_ratio(d.prepare( 2.00,  4.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.40803e-05, d.integrated_branching_ratio(d.prepare( 4.00,  6.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.37941e-05, d.integrated_branching_ratio(d.prepare( 6.00,  8.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.34323e-05, d.integrated_branching_ratio(d.prepare( 8.00, 10.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.29770e-05, d.integrated_branching_ratio(d.prepare(10.00, 12.00)), eps);
+
+                TEST_CHECK_NEARLY_EQUAL(8.29930e-5,  d.integrated_branching_ratio(d.prepare( 0.01, 12.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.43035e-4,  d.integrated_branching_ratio(d.prepare( 0.01, 25.00)), eps);
             }
 
             // Consistency check for R_pi
@@ -126,7 +126,7 @@ class BToPiLeptonNeutrinoTest :
 
                 const double eps = 1e-5;
                 TEST_CHECK_RELATIVE_ERROR(
-                    dtau.integrated_branching_ratio(3.154, 10.00) / dmu.integrated_branching_ratio(0.011, 10.00),
+                    dtau.integrated_branching_ratio(dtau.prepare(3.154, 10.00)) / dmu.integrated_branching_ratio(dmu.prepare(0.011, 10.00)),
                     obs_Rpi->evaluate(),
                     eps
                 );
@@ -160,14 +160,14 @@ class BToPiLeptonNeutrinoTest :
 
                 const double eps = 1e-9;
 
-                TEST_CHECK_NEARLY_EQUAL(1.44047e-05 / 2., d.integrated_branching_ratio( 0.01,  2.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.43046e-05 / 2., d.integrated_branching_ratio( 2.00,  4.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.40803e-05 / 2., d.integrated_branching_ratio( 4.00,  6.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.37941e-05 / 2., d.integrated_branching_ratio( 6.00,  8.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.34323e-05 / 2., d.integrated_branching_ratio( 8.00, 10.00), eps);
-                TEST_CHECK_NEARLY_EQUAL(1.29770e-05 / 2., d.integrated_branching_ratio(10.00, 12.00), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.44047e-05 / 2., d.integrated_branching_ratio(d.prepare( 0.01,  2.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.43046e-05 / 2., d.integrated_branching_ratio(d.prepare( 2.00,  4.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.40803e-05 / 2., d.integrated_branching_ratio(d.prepare( 4.00,  6.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.37941e-05 / 2., d.integrated_branching_ratio(d.prepare( 6.00,  8.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.34323e-05 / 2., d.integrated_branching_ratio(d.prepare( 8.00, 10.00)), eps);
+                TEST_CHECK_NEARLY_EQUAL(1.29770e-05 / 2., d.integrated_branching_ratio(d.prepare(10.00, 12.00)), eps);
 
-                TEST_CHECK_NEARLY_EQUAL(8.29930e-5 / 2.,  d.integrated_branching_ratio( 0.01, 12.00), eps);
+                TEST_CHECK_NEARLY_EQUAL(8.29930e-5 / 2.,  d.integrated_branching_ratio(d.prepare( 0.01, 12.00)), eps);
             }
         }
 } b_to_pi_l_nu_test;
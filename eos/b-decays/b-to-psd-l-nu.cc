@@ -22,7 +22,8 @@
 
 #include <eos/b-decays/b-to-psd-l-nu.hh>
 #include <eos/form-factors/form-factors.hh>
-#include <eos/maths/integrate.hh>
+#include <eos/maths/derivative.hh>
+#include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/destringify.hh>
@@ -30,6 +31,8 @@
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <string>
 
@@ -58,6 +61,8 @@ namespace eos
 
         Parameters parameters;
 
+        Options model_options;
+
         SwitchOption opt_U;
         SwitchOption opt_q;
         SwitchOption opt_I;
@@ -80,6 +85,10 @@ namespace eos
 
         UsedParameter mu;
 
+        using IntermediateResult = BToPseudoscalarLeptonNeutrino::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
     	static const std::vector<OptionSpecification> options;
 
         std::function<double (const double &)> m_U_msbar;
@@ -88,6 +97,8 @@ namespace eos
 
         GSL::QAGS::Config int_config;
 
+        static constexpr unsigned int_points = 256;
+
         SpecifiedOption opt_cp_conjugate;
 
         bool cp_conjugate;
@@ -160,6 +171,7 @@ namespace eos
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             model(Model::make(o.get("model", "SM"), p, o)),
             parameters(p),
+            model_options(o),
             opt_U(o, "U", { "c", "u" }), // non-public option: do not list
             opt_q(o, "q", { "u", "d", "s" }, "d"), // non-public option: do not list
             opt_I(o, "I", { "1", "0", "1/2" }), // non-public option: do not list
@@ -281,10 +293,8 @@ namespace eos
         }
 
         // normalized to |V_Ub = 1|, obtained using cf. [DSD:2014A], eq. (12), agrees with Sakaki'13 et al cf. [STTW:2013A]
-        double normalized_differential_decay_width(const double & s) const
+        double normalized_differential_decay_width(const b_to_psd_l_nu::Amplitudes & amp) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
-
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        + 3.0 * std::norm(amp.h_tS) * (1.0 - amp.v)
@@ -293,42 +303,54 @@ namespace eos
                    );
         }
 
-        double normalized_differential_decay_width_p(const double & s) const
+        double normalized_differential_decay_width(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return normalized_differential_decay_width(this->amplitudes(s));
+        }
 
+        double normalized_differential_decay_width_p(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        std::norm(amp.h_0) * (3.0 - amp.v)
                        );
         }
 
-        double normalized_differential_decay_width_0(const double & s) const
+        double normalized_differential_decay_width_p(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return normalized_differential_decay_width_p(this->amplitudes(s));
+        }
 
+        double normalized_differential_decay_width_0(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return 4.0 / 3.0 * amp.NF * amp.p * (
                        3.0 * std::norm(amp.h_t) * (1.0 - amp.v)
                    );
         }
 
+        double normalized_differential_decay_width_0(const double & s) const
+        {
+            return normalized_differential_decay_width_0(this->amplitudes(s));
+        }
+
         // obtained using cf. [DDS:2014A], eq. (12), defined as int_1^0 d^2Gamma - int_0^-1 d^2Gamma
         // in eq. (12) from cf. [DDS:2014A], (H0 * cos(theta) - HtS)^2 we interpret as |H0 * cos(theta) - HtS|^2
         // crosschecked against [BFNT:2019A] and [STTW:2013A]
-        double numerator_differential_a_fb_leptonic(const double & s) const
+        double numerator_differential_a_fb_leptonic(const b_to_psd_l_nu::Amplitudes & amp) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
-
             return - 4.0 * amp.NF * amp.p * (
                        std::real(amp.h_0 * std::conj(amp.h_tS)) * (1.0 - amp.v)
                        - 4.0 * std::sqrt(1.0 - amp.v) * std::real(amp.h_T * std::conj(amp.h_tS))
                    );
         }
 
-        // obtained using cf. [DDS:2014A], eq. (12) and [BHP2007] eq.(1.2)
-        double numerator_differential_flat_term(const double & s) const
+        double numerator_differential_a_fb_leptonic(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return numerator_differential_a_fb_leptonic(this->amplitudes(s));
+        }
 
+        // obtained using cf. [DDS:2014A], eq. (12) and [BHP2007] eq.(1.2)
+        double numerator_differential_flat_term(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             return amp.NF * amp.p * (
                        (std::norm(amp.h_0) + std::norm(amp.h_tS)) * (1.0 - amp.v)
                        + 16.0 * std::norm(amp.h_T)
@@ -336,11 +358,14 @@ namespace eos
                    );
         }
 
-        // obtained using cf. [STTW2013], eq. (49a - 49b)
-        double numerator_differential_lepton_polarization(const double & s) const
+        double numerator_differential_flat_term(const double & s) const
         {
-            b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+            return numerator_differential_flat_term(this->amplitudes(s));
+        }
 
+        // obtained using cf. [STTW2013], eq. (49a - 49b)
+        double numerator_differential_lepton_polarization(const b_to_psd_l_nu::Amplitudes & amp) const
+        {
             const double dGplus = (std::norm(amp.h_0) + 3.0 * std::norm(amp.h_t)) * (1.0 - amp.v) / 2.0
                                 + 3.0 / 2.0 * std::norm(amp.h_S)
                                 + 8.0 * std::norm(amp.h_T)
@@ -353,6 +378,68 @@ namespace eos
             return 8.0 / 3.0 * amp.NF * amp.p * (dGplus - dGminus);
         }
 
+        double numerator_differential_lepton_polarization(const double & s) const
+        {
+            return numerator_differential_lepton_polarization(this->amplitudes(s));
+        }
+
+        // all q^2-differential quantities that enter the integrated observables, from one evaluation of the amplitudes
+        std::array<double, 6> differential_quantities(const double & s) const
+        {
+            const b_to_psd_l_nu::Amplitudes amp(this->amplitudes(s));
+
+            return std::array<double, 6>{
+                normalized_differential_decay_width(amp),
+                normalized_differential_decay_width_0(amp),
+                normalized_differential_decay_width_p(amp),
+                numerator_differential_a_fb_leptonic(amp),
+                numerator_differential_flat_term(amp),
+                numerator_differential_lepton_polarization(amp)
+            };
+        }
+
+        const IntermediateResult * prepare(const double & q2_min, const double & q2_max)
+        {
+            std::function<std::array<double, 6> (const double &)> integrand = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_quantities,
+                    this, std::placeholders::_1);
+            fill(intermediate_result, integrate1D(integrand, int_points, q2_min, q2_max));
+
+            return &intermediate_result;
+        }
+
+        std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const
+        {
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 6>> &)> integrand =
+                [this] (const std::span<const double> & s, const std::span<std::array<double, 6>> & y)
+                {
+                    for (std::size_t i = 0 ; i < s.size() ; ++i)
+                    {
+                        y[i] = this->differential_quantities(s[i]);
+                    }
+                };
+
+            // the integrand is evaluated on the sampling points of all bins at once
+            const auto integrated = integrate1D(integrand, int_points, bins);
+
+            std::vector<IntermediateResult> result(bins.size());
+            for (std::size_t i = 0 ; i < bins.size() ; ++i)
+            {
+                fill(result[i], integrated[i]);
+            }
+
+            return result;
+        }
+
+        static void fill(IntermediateResult & ir, const std::array<double, 6> & integrated)
+        {
+            ir.normalized_decay_width        = integrated[0];
+            ir.normalized_decay_width_0      = integrated[1];
+            ir.normalized_decay_width_p      = integrated[2];
+            ir.numerator_a_fb_leptonic       = integrated[3];
+            ir.numerator_flat_term           = integrated[4];
+            ir.numerator_lepton_polarization = integrated[5];
+        }
+
         // differential decay width
         double differential_decay_width(const double & s) const
         {
@@ -371,6 +458,124 @@ namespace eos
             return normalized_differential_decay_width(s) * tau_B / hbar;
         }
 
+        // the real-valued combinations of the model's predictions that enter the differential branching ratio:
+        // |1 + gV|^2, |gS|^2, Re((1 + gV) gS^*), |gT|^2, Re(gT (1 + gV)^*), |V_Ub|^2, and m_b(mu) - m_U(mu)
+        std::array<double, 7> model_inputs(const Model & model, const double & mu) const
+        {
+            const bool up = ('u' == opt_U.value()[0]);
+            const auto wc = up ? model.wet_ublnu(opt_l.value(), cp_conjugate) : model.wet_cblnu(opt_l.value(), cp_conjugate);
+            const complex<double> v_Ub = up ? model.ckm_ub() : model.ckm_cb();
+            const double m_U_msbar = up ? model.m_u_msbar(mu) : model.m_c_msbar(mu);
+
+            const complex<double> one_plus_gV = wc.cvr() + wc.cvl();
+            const complex<double> gS = wc.csr() + wc.csl();
+            const complex<double> gT = wc.ct();
+
+            return {{
+                std::norm(one_plus_gV),
+                std::norm(gS),
+                std::real(one_plus_gV * std::conj(gS)),
+                std::norm(gT),
+                std::real(gT * std::conj(one_plus_gV)),
+                std::norm(v_Ub),
+                model.m_b_msbar(mu) - m_U_msbar
+            }};
+        }
+
+        // as above, alongside their gradients; the model is not differentiable, so its predictions
+        // are differentiated numerically, but only with respect to the parameters that the model uses.
+        // the parameters are varied in a private copy, since other threads may share our parameters
+        std::array<Dual, 7> model_inputs(const DualParameters & dual_parameters) const
+        {
+            using Stencil = deriv::TwoSidedStencil<1u>;
+
+            const std::array<double, 7> central = model_inputs(*model, mu());
+            std::array<std::vector<double>, 7> gradients;
+            gradients.fill(std::vector<double>(dual_parameters.size(), 0.0));
+
+            Parameters varied_parameters = parameters.clone();
+            const auto varied_model = Model::make(model_options.get("model", "SM"), varied_parameters, model_options);
+
+            for (auto j = 0u ; j < dual_parameters.size() ; ++j)
+            {
+                const Parameter::Id id = dual_parameters[j].id();
+                if ((id != mu.id()) && (model->end() == std::find(model->begin(), model->end(), id)))
+                    continue;
+
+                Parameter p = varied_parameters[id];
+                const double x0 = p.evaluate();
+                const double h = Stencil::step(x0);
+                for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+                {
+                    p.set(x0 + Stencil::offsets[k] * h);
+                    const std::array<double, 7> values = model_inputs(*varied_model, varied_parameters[mu.id()].evaluate());
+
+                    for (auto i = 0u ; i < values.size() ; ++i)
+                    {
+                        gradients[i][j] += Stencil::weights[k] * values[i] / (Stencil::denominator * h);
+                    }
+                }
+                p.set(x0);
+            }
+
+            std::array<Dual, 7> result;
+            for (auto i = 0u ; i < result.size() ; ++i)
+            {
+                result[i] = Dual(central[i], gradients[i]);
+            }
+
+            return result;
+        }
+
+        // differential branching ratio alongside its gradient, cf. amplitudes() and normalized_differential_decay_width();
+        // the helicity amplitudes are factorized into real-valued hadronic parts and the model_inputs()
+        Dual differential_branching_ratio(const double & s, const DualParameters & dual_parameters) const
+        {
+            const Dual m_B = dual_parameters(this->m_B), m_B2 = m_B * m_B;
+            const Dual m_P = dual_parameters(this->m_P), m_P2 = m_P * m_P;
+            const Dual m_l = dual_parameters(this->m_l);
+
+            // vanishes outside of the physical phase space
+            if (s < power_of<2>(m_l.value()) || s > power_of<2>(m_B.value() - m_P.value()))
+                return Dual(0.0);
+
+            const auto ff = form_factors->evaluate_with_gradient(s, dual_parameters);
+            const auto [n_V, n_S, r_VS, n_T, r_TV, n_ckm, m_diff] = model_inputs(dual_parameters);
+
+            const Dual lam = eos::lambda(m_B2, m_P2, Dual(s));
+            const Dual p = sqrt(lam) / (2.0 * m_B);
+
+            // v = lepton velocity in the dilepton rest frame
+            const Dual v = 1.0 - m_l * m_l / s;
+            const Dual ml_hat = sqrt(1.0 - v);
+            const Dual NF = v * v * s * power_of<2>(dual_parameters(g_fermi)) / (256.0 * power_of<3>(M_PI) * m_B2);
+
+            const double isospin = this->isospin_factor;
+            const double sqrt_s = std::sqrt(s);
+
+            // helicity amplitudes without their Wilson coefficients, i.e., h_0 = a_0 (1 + gV), h_t = a_t (1 + gV),
+            // h_S = a_S gS, and h_T = a_T gT
+            const Dual a_0  =   isospin * 2.0 * m_B * p * ff.f_p / sqrt_s;
+            const Dual a_t  =   isospin * (m_B2 - m_P2) * ff.f_0 / sqrt_s;
+            const Dual a_S  = - isospin * (m_B2 - m_P2) * ff.f_0 / m_diff;
+            const Dual a_T  = - isospin * 2.0 * m_B * p * ff.f_t / (m_B + m_P);
+            const Dual a_tS = a_S / ml_hat;
+
+            const Dual norm_h_0    = a_0 * a_0 * n_V;
+            const Dual norm_h_tS   = a_t * a_t * n_V + a_tS * a_tS * n_S - 2.0 * a_t * a_tS * r_VS;
+            const Dual norm_h_T    = a_T * a_T * n_T;
+            const Dual re_h_T_h_0  = a_T * a_0 * r_TV;
+
+            const Dual normalized_width = 4.0 / 3.0 * NF * p * (
+                       norm_h_0 * (3.0 - v)
+                       + 3.0 * norm_h_tS * (1.0 - v)
+                       + 16.0 * norm_h_T * (3.0 - 2.0 * v)
+                       - 24.0 * ml_hat * re_h_T_h_0
+                   );
+
+            return normalized_width * n_ckm * dual_parameters(tau_B) / dual_parameters(hbar);
+        }
+
         double pdf_q2(const double & q2) const
         {
             const double q2_min = power_of<2>(m_l());
@@ -460,13 +665,34 @@ namespace eos
         return _imp->differential_branching_ratio(s);
     }
 
-    double
-    BToPseudoscalarLeptonNeutrino::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    Dual
+    BToPseudoscalarLeptonNeutrino::differential_branching_ratio_with_gradient(const std::vector<Parameter> & parameters, const double & s) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::differential_branching_ratio,
-                _imp.get(), std::placeholders::_1);
+        return _imp->differential_branching_ratio(s, DualParameters(parameters));
+    }
 
-        return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
+    bool
+    BToPseudoscalarLeptonNeutrino::differentiable() const
+    {
+        return _imp->form_factors->differentiable();
+    }
+
+    const BToPseudoscalarLeptonNeutrino::IntermediateResult *
+    BToPseudoscalarLeptonNeutrino::prepare(const double & q2_min, const double & q2_max) const
+    {
+        return _imp->prepare(q2_min, q2_max);
+    }
+
+    std::vector<BToPseudoscalarLeptonNeutrino::IntermediateResult>
+    BToPseudoscalarLeptonNeutrino::prepare_bins(const std::vector<std::array<double, 2>> & bins) const
+    {
+        return _imp->prepare_bins(bins);
+    }
+
+    double
+    BToPseudoscalarLeptonNeutrino::integrated_branching_ratio(const IntermediateResult * ir) const
+    {
+        return ir->normalized_decay_width * std::norm(_imp->v_Ub()) * _imp->tau_B / _imp->hbar;
     }
 
     // normalized_differential_branching_ratio (|V_Ub|=1)
@@ -478,40 +704,28 @@ namespace eos
 
     // normalized (|V_Ub|=1) integrated branching_ratio
     double
-    BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_branching_ratio,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
+        return ir->normalized_decay_width * _imp->tau_B / _imp->hbar;
     }
 
     // normalized (|V_Ub|=1) integrated decay_width
     double
-    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p(const IntermediateResult * ir) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_p,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
+        return ir->normalized_decay_width_p;
     }
 
     double
-    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0(const IntermediateResult * ir) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width_0,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
+        return ir->normalized_decay_width_0;
     }
 
     double
-    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width(const IntermediateResult * ir) const
     {
-        std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                             _imp.get(), std::placeholders::_1);
-
-        return integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
+        return ir->normalized_decay_width;
     }
 
     double
@@ -521,23 +735,9 @@ namespace eos
     }
 
     double
-    BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_a_fb_leptonic,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        return integrated_numerator / integrated_denominator;
+        return ir->numerator_a_fb_leptonic / ir->normalized_decay_width;
     }
 
     double
@@ -547,23 +747,9 @@ namespace eos
     }
 
     double
-    BToPseudoscalarLeptonNeutrino::integrated_flat_term(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::integrated_flat_term(const IntermediateResult * ir) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_flat_term,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        return integrated_numerator / integrated_denominator;
+        return ir->numerator_flat_term / ir->normalized_decay_width;
     }
 
     double
@@ -573,23 +759,9 @@ namespace eos
     }
 
     double
-    BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization(const double & s_min, const double & s_max) const
+    BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization(const IntermediateResult * ir) const
     {
-        double integrated_numerator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::numerator_differential_lepton_polarization,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_numerator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        double integrated_denominator;
-        {
-            std::function<double (const double &)> f = std::bind(&Implementation<BToPseudoscalarLeptonNeutrino>::normalized_differential_decay_width,
-                                                                 _imp.get(), std::placeholders::_1);
-            integrated_denominator = integrate<GSL::QAGS>(f, s_min, s_max, _imp->int_config);
-        }
-
-        return integrated_numerator / integrated_denominator;
+        return ir->numerator_lepton_polarization / ir->normalized_decay_width;
     }
 
     double
@@ -22,11 +22,15 @@
 #ifndef EOS_GUARD_EOS_B_DECAYS_B_TO_PSD_L_NU_HH
 #define EOS_GUARD_EOS_B_DECAYS_B_TO_PSD_L_NU_HH 1
 
+#include <eos/observable.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+#include <vector>
+
 namespace eos
 {
     /*
@@ -52,17 +56,26 @@ namespace eos
             // Single-differential Observables - normalized(|V{c,u}b|=1)
             double normalized_differential_branching_ratio(const double & q2) const;
 
+            // Single-differential Observables, alongside their gradients with respect to the given parameters
+            Dual differential_branching_ratio_with_gradient(const std::vector<Parameter> & parameters, const double & q2) const;
+            /// Whether the gradients are available, i.e., whether the form factor parametrization provides them.
+            bool differentiable() const;
+
             // Integrated Observables
-            double integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_leptonic(const double & q2_min, const double & q2_max) const;
-            double integrated_flat_term(const double & q2_min, const double & q2_max) const;
-            double integrated_lepton_polarization(const double & q2_min, const double & q2_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            /// Prepare the intermediate results of several q^2 bins at once, equivalent to calling prepare() for each bin.
+            std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const;
+            double integrated_branching_ratio(const IntermediateResult *) const;
+            double integrated_a_fb_leptonic(const IntermediateResult *) const;
+            double integrated_flat_term(const IntermediateResult *) const;
+            double integrated_lepton_polarization(const IntermediateResult *) const;
 
             // Integrated Observables - normalized(|Vcb|=1)
-            double normalized_integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
-            double normalized_integrated_decay_width(const double & q2_min, const double & q2_max) const;
-            double normalized_integrated_decay_width_0(const double & q2_min, const double & q2_max) const;
-            double normalized_integrated_decay_width_p(const double & q2_min, const double & q2_max) const;
+            double normalized_integrated_branching_ratio(const IntermediateResult *) const;
+            double normalized_integrated_decay_width(const IntermediateResult *) const;
+            double normalized_integrated_decay_width_0(const IntermediateResult *) const;
+            double normalized_integrated_decay_width_p(const IntermediateResult *) const;
 
             // PDF
             double differential_pdf_q2(const double & q2) const;
@@ -83,12 +96,40 @@ namespace eos
              */
             static const std::set<ReferenceName> references;
 
+            /*!
+             * Regular observables may share one object, since all member functions but
+             * prepare() only read from our implementation.
+             */
+            static constexpr bool shareable = true;
+
             /*!
              * Options used in the computation of our observables.
              */
             static std::vector<OptionSpecification>::const_iterator begin_options();
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
+
+    /*!
+     * The q^2-integrated decay widths and numerators of the ratio observables in one bin,
+     * normalized to |V_Ub| = 1.
+     */
+    class BToPseudoscalarLeptonNeutrino::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            double normalized_decay_width;
+            double normalized_decay_width_0;
+            double normalized_decay_width_p;
+            double numerator_a_fb_leptonic;
+            double numerator_flat_term;
+            double numerator_lepton_polarization;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
 }
 
 #endif
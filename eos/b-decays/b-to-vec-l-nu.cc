@@ -208,13 +208,14 @@ namespace eos
             const complex<double> TL = wc.ct();
 
             // form factors
-            const double aff0  = form_factors->a_0(q2);
-            const double aff1  = form_factors->a_1(q2);
-            const double aff12 = form_factors->a_12(q2);
-            const double vff   = form_factors->v(q2);
-            const double tff1  = form_factors->t_1(q2);
-            const double tff2  = form_factors->t_2(q2);
-            const double tff3  = form_factors->t_3(q2);
+            const auto ff = form_factors->evaluate_all(q2);
+            const double aff0  = ff.a_0;
+            const double aff1  = ff.a_1;
+            const double aff12 = ff.a_12;
+            const double vff   = ff.v;
+            const double tff1  = ff.t_1;
+            const double tff2  = ff.t_2;
+            const double tff3  = ff.t_3;
             // meson & lepton masses
             const double m_l = this->m_l();
             const double m_B = this->m_B();
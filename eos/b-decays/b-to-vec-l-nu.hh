@@ -116,6 +116,12 @@ namespace eos
              */
             static const std::set<ReferenceName> references;
 
+            /*!
+             * Regular observables may share one object, since all member functions but
+             * prepare() only read from our implementation.
+             */
+            static constexpr bool shareable = true;
+
             /*!
              * Options used in the computation of our observables.
              */
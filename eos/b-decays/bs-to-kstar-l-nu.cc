@@ -70,6 +70,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<PToV>> form_factors;
 
+        using IntermediateResult = BsToKstarLeptonNeutrino::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -139,13 +143,28 @@ namespace eos
             return AngularCoefficients(angular_coefficients_array(amplitudes(s)));
         }
 
-        AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 12> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
         {
             std::function<std::array<double, 12> (const double &)> integrand =
                     std::bind(&Implementation<BsToKstarLeptonNeutrino>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
 
-            return AngularCoefficients(integrated_angular_coefficients_array);
+            return integrate1D(integrand, 64, s_min, s_max);
+        }
+
+        AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        {
+            return AngularCoefficients(integrated_angular_coefficients_array(s_min, s_max));
+        }
+
+        AngularCoefficients integrated_angular_coefficients(const IntermediateResult * ir) const
+        {
+            return AngularCoefficients(ir->ac);
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.ac = integrated_angular_coefficients_array(s_min, s_max);
+            return &intermediate_result;
         }
 
         double Ftime(const double & s)
@@ -334,186 +353,192 @@ namespace eos
         return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
     }
 
+    const BsToKstarLeptonNeutrino::IntermediateResult *
+    BsToKstarLeptonNeutrino::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    BsToKstarLeptonNeutrino::integrated_decay_width(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_decay_width(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return integrated_decay_width(s_min, s_max) * _imp->tau() / _imp->hbar();
+        return integrated_decay_width(ir) * _imp->tau() / _imp->hbar();
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.8), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return a_c.j6s / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_longitudinal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], p. 5, eq. (3.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return (a_c.j1c - a_c.j2c / 3.0) / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transversal_polarisation(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transversal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], p. 5, eq. (3.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.10), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.5 * a_c.j3 / a_c.j2s;
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.11), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_4(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.12), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_5(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (34), p. 9 for the massless case
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
             / 8.0 / a_c.j2s;
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_re(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (38), p. 10
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.25 * a_c.j6s / a_c.j2s;
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_im(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (30), p. 8
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.5 * a_c.j9 / a_c.j2s;
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_h_1(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_h_1(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.13)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_h_2(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_h_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_h_3(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_h_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_h_4(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_h_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_h_5(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_h_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_1s(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_1s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j1s / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_1c(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_1c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j1c / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_2s(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_2s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j2s / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_2c(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_2c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j2c / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_3(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_3(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j3 / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_4(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j4 / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_5(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j5 / decay_width(a_c);
     }
 
     double
-    BsToKstarLeptonNeutrino::integrated_s_6s(const double & s_min, const double & s_max) const
+    BsToKstarLeptonNeutrino::integrated_s_6s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j6s / decay_width(a_c);
     }
 
@@ -634,7 +659,7 @@ namespace eos
     {
         AngularCoefficients a_c = _imp->bstokstarlnu._imp->integrated_angular_coefficients(0.02, 19.71);
 
-        return 4.0 / 9.0 * (2.0 * a_c.j1s + 3.0 * a_c.j3) * _imp->tau() / _imp->hbar() / _imp->btopilnu.integrated_branching_ratio(0.02, 12.0);
+        return 4.0 / 9.0 * (2.0 * a_c.j1s + 3.0 * a_c.j3) * _imp->tau() / _imp->hbar() / _imp->btopilnu.integrated_branching_ratio(_imp->btopilnu.prepare(0.02, 12.0));
     }
 
     const std::string
@@ -20,6 +20,7 @@
 #ifndef EOS_GUARD_EOS_B_DECAYS_BS_TO_KSTAR_L_NU_HH
 #define EOS_GUARD_EOS_B_DECAYS_BS_TO_KSTAR_L_NU_HH 1
 
+#include <eos/observable.hh>
 #include <eos/rare-b-decays/decays.hh>
 #include <eos/maths/complex.hh>
 #include <eos/utils/options.hh>
@@ -27,6 +28,8 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+
 namespace eos
 {
     class BsToKstarLeptonNeutrinoRatios;
@@ -72,30 +75,32 @@ namespace eos
             double differential_h_5(const double & s) const;
 
             // Integrated Observables, cf. [FMvD2015]
-            double integrated_decay_width(const double & s_min, const double & s_max) const;
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
-            double integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const;
-            double integrated_transversal_polarisation(const double & s_min, const double & s_max) const;
-            double integrated_h_1(const double & s_min, const double & s_max) const;
-            double integrated_h_2(const double & s_min, const double & s_max) const;
-            double integrated_h_3(const double & s_min, const double & s_max) const;
-            double integrated_h_4(const double & s_min, const double & s_max) const;
-            double integrated_h_5(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const;
-            double integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const;
-            double integrated_s_1s(const double & s_min, const double & s_max) const;
-            double integrated_s_1c(const double & s_min, const double & s_max) const;
-            double integrated_s_2s(const double & s_min, const double & s_max) const;
-            double integrated_s_2c(const double & s_min, const double & s_max) const;
-            double integrated_s_3(const double & s_min, const double & s_max) const;
-            double integrated_s_4(const double & s_min, const double & s_max) const;
-            double integrated_s_5(const double & s_min, const double & s_max) const;
-            double integrated_s_6s(const double & s_min, const double & s_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+            double integrated_decay_width(const IntermediateResult * ir) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult * ir) const;
+            double integrated_longitudinal_polarisation(const IntermediateResult * ir) const;
+            double integrated_transversal_polarisation(const IntermediateResult * ir) const;
+            double integrated_h_1(const IntermediateResult * ir) const;
+            double integrated_h_2(const IntermediateResult * ir) const;
+            double integrated_h_3(const IntermediateResult * ir) const;
+            double integrated_h_4(const IntermediateResult * ir) const;
+            double integrated_h_5(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_2(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_3(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_4(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_5(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_re(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_im(const IntermediateResult * ir) const;
+            double integrated_s_1s(const IntermediateResult * ir) const;
+            double integrated_s_1c(const IntermediateResult * ir) const;
+            double integrated_s_2s(const IntermediateResult * ir) const;
+            double integrated_s_2c(const IntermediateResult * ir) const;
+            double integrated_s_3(const IntermediateResult * ir) const;
+            double integrated_s_4(const IntermediateResult * ir) const;
+            double integrated_s_5(const IntermediateResult * ir) const;
+            double integrated_s_6s(const IntermediateResult * ir) const;
 
             /*!
              * Descriptions of the process and its kinematics.
@@ -118,6 +123,23 @@ namespace eos
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
 
+    /*!
+     * The q^2-integrated angular coefficients J_i, from which all integrated observables
+     * in one bin are derived.
+     */
+    class BsToKstarLeptonNeutrino::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 12> ac;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
+
     class BsToKstarLeptonNeutrinoRatios :
         public ParameterUser,
         public PrivateImplementationPattern<BsToKstarLeptonNeutrinoRatios>
@@ -71,37 +71,37 @@ class BsToKstarLeptonNeutrinoTest :
                 {
                     const double eps = 1e-4;
 
-                    TEST_CHECK_NEARLY_EQUAL(-0.4125863683, d.integrated_forward_backward_asymmetry(14.00, 19.21), eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.3482936714, d.integrated_longitudinal_polarisation(14.00, 19.21),  eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.5132406718, d.integrated_transverse_asymmetry_2(14.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 1.7577913835, d.integrated_transverse_asymmetry_3(14.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.5655315082, d.integrated_transverse_asymmetry_4(14.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.0775462723, d.integrated_transverse_asymmetry_5(14.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.8441151078, d.integrated_transverse_asymmetry_re(14.00, 19.21),    eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_transverse_asymmetry_im(14.00, 19.21),    eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.9969214819, d.integrated_h_1(14.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.9940864123, d.integrated_h_2(14.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.9835366074, d.integrated_h_3(14.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_h_4(14.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0,            d.integrated_h_5(14.00, 19.21),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.4125863683, d.integrated_forward_backward_asymmetry(d.prepare(14.00, 19.21)), eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.3482936714, d.integrated_longitudinal_polarisation(d.prepare(14.00, 19.21)),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.5132406718, d.integrated_transverse_asymmetry_2(d.prepare(14.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 1.7577913835, d.integrated_transverse_asymmetry_3(d.prepare(14.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.5655315082, d.integrated_transverse_asymmetry_4(d.prepare(14.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.0775462723, d.integrated_transverse_asymmetry_5(d.prepare(14.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.8441151078, d.integrated_transverse_asymmetry_re(d.prepare(14.00, 19.21)),    eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_transverse_asymmetry_im(d.prepare(14.00, 19.21)),    eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.9969214819, d.integrated_h_1(d.prepare(14.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.9940864123, d.integrated_h_2(d.prepare(14.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.9835366074, d.integrated_h_3(d.prepare(14.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_h_4(d.prepare(14.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0,            d.integrated_h_5(d.prepare(14.00, 19.21)),                        eps);
                 }
 
                 /* q^2 = [16.00, 19.21] */
                 {
                     const double eps = 1e-4;
-                    TEST_CHECK_NEARLY_EQUAL(-0.3959778457, d.integrated_forward_backward_asymmetry(16.00, 19.21), eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.3354919677, d.integrated_longitudinal_polarisation(16.00, 19.21),  eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.5932022373, d.integrated_transverse_asymmetry_2(16.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 1.9770010813, d.integrated_transverse_asymmetry_3(16.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.5022878134, d.integrated_transverse_asymmetry_4(16.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.0648764771, d.integrated_transverse_asymmetry_5(16.00, 19.21),     eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.7945283357, d.integrated_transverse_asymmetry_re(16.00, 19.21),    eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_transverse_asymmetry_im(16.00, 19.21),    eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0.9989890567, d.integrated_h_1(16.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.9930235503, d.integrated_h_2(16.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0.9869261553, d.integrated_h_3(16.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_h_4(16.00, 19.21),                        eps);
-                    TEST_CHECK_NEARLY_EQUAL(-0,            d.integrated_h_5(16.00, 19.21),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.3959778457, d.integrated_forward_backward_asymmetry(d.prepare(16.00, 19.21)), eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.3354919677, d.integrated_longitudinal_polarisation(d.prepare(16.00, 19.21)),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.5932022373, d.integrated_transverse_asymmetry_2(d.prepare(16.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 1.9770010813, d.integrated_transverse_asymmetry_3(d.prepare(16.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.5022878134, d.integrated_transverse_asymmetry_4(d.prepare(16.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.0648764771, d.integrated_transverse_asymmetry_5(d.prepare(16.00, 19.21)),     eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.7945283357, d.integrated_transverse_asymmetry_re(d.prepare(16.00, 19.21)),    eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_transverse_asymmetry_im(d.prepare(16.00, 19.21)),    eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0.9989890567, d.integrated_h_1(d.prepare(16.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.9930235503, d.integrated_h_2(d.prepare(16.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0.9869261553, d.integrated_h_3(d.prepare(16.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL( 0,            d.integrated_h_4(d.prepare(16.00, 19.21)),                        eps);
+                    TEST_CHECK_NEARLY_EQUAL(-0,            d.integrated_h_5(d.prepare(16.00, 19.21)),                        eps);
                 }
             }
         }
@@ -276,6 +276,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        using IntermediateResult = LambdaBToLambdaCLeptonNeutrino::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -324,16 +328,17 @@ namespace eos
             const complex<double> ct  = wc.ct();
 
             // baryonic form factors (10)
-            const double fftV  = form_factors->f_time_v(s);
-            const double ff0V  = form_factors->f_long_v(s);
-            const double ffpV  = form_factors->f_perp_v(s);
-            const double fftA  = form_factors->f_time_a(s);
-            const double ff0A  = form_factors->f_long_a(s);
-            const double ffpA  = form_factors->f_perp_a(s);
-            const double ff0T  = form_factors->f_long_t(s);
-            const double ff0T5 = form_factors->f_long_t5(s);
-            const double ffpT  = form_factors->f_perp_t(s);
-            const double ffpT5 = form_factors->f_perp_t5(s);
+            const auto ff = form_factors->evaluate_all(s);
+            const double fftV  = ff.f_time_v;
+            const double ff0V  = ff.f_long_v;
+            const double ffpV  = ff.f_perp_v;
+            const double fftA  = ff.f_time_a;
+            const double ff0A  = ff.f_long_a;
+            const double ffpA  = ff.f_perp_a;
+            const double ff0T  = ff.f_long_t;
+            const double ff0T5 = ff.f_long_t5;
+            const double ffpT  = ff.f_perp_t;
+            const double ffpT5 = ff.f_perp_t5;
             // running quark masses
             const double mbatmu = model->m_b_msbar(mu);
             const double mcatmu = model->m_c_msbar(mu);
@@ -386,9 +391,15 @@ namespace eos
             return lambdab_to_lambdac_l_nu::AngularObservables{ _differential_angular_observables(q2) };
         }
 
-        inline lambdab_to_lambdac_l_nu::AngularObservables integrated_angular_observables(const double & q2_min, const double & q2_max)
+        inline lambdab_to_lambdac_l_nu::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
+        {
+            return lambdab_to_lambdac_l_nu::AngularObservables{ ir->k };
+        }
+
+        const IntermediateResult * prepare(const double & q2_min, const double & q2_max)
         {
-            return lambdab_to_lambdac_l_nu::AngularObservables{ _integrated_angular_observables(q2_min, q2_max) };
+            intermediate_result.k = _integrated_angular_observables(q2_min, q2_max);
+            return &intermediate_result;
         }
     };
 
@@ -415,10 +426,16 @@ namespace eos
         return _imp->differential_angular_observables(q2).d4gamma(c_lep, c_lam, phi);
     }
 
+    const LambdaBToLambdaCLeptonNeutrino::IntermediateResult *
+    LambdaBToLambdaCLeptonNeutrino::prepare(const double & q2_min, const double & q2_max) const
+    {
+        return _imp->prepare(q2_min, q2_max);
+    }
+
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_decay_width(const double & q2_min, const double & q2_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_decay_width(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(q2_min, q2_max).decay_width();
+        return _imp->integrated_angular_observables(ir).decay_width();
     }
 
     /* q^2-differential observables */
@@ -456,102 +473,102 @@ namespace eos
     /* q^2-integrated observables */
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        return _imp->integrated_angular_observables(ir).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k1c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k1c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k2c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k2c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k3sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k3sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k3s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k3s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k4sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k4sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaCLeptonNeutrino::integrated_k4s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaCLeptonNeutrino::integrated_k4s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4s() / o.decay_width();
     }
 
@@ -21,12 +21,15 @@
 #ifndef EOS_GUARD_EOS_B_DECAYS_BARYONIC_B_TO_C_LEPTON_NEUTRINO_HH
 #define EOS_GUARD_EOS_B_DECAYS_BARYONIC_B_TO_C_LEPTON_NEUTRINO_HH 1
 
+#include <eos/observable.hh>
 #include <eos/rare-b-decays/decays.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+
 namespace eos
 {
     /*
@@ -41,7 +44,9 @@ namespace eos
             ~LambdaBToLambdaCLeptonNeutrino();
 
             double four_differential_decay_width(const double & q2, const double & c_lep, const double & c_lam, const double & phi) const;
-            double integrated_decay_width(const double & q2_min, const double & q2_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            double integrated_decay_width(const IntermediateResult * ir) const;
 
             double differential_branching_ratio(const double & q2) const;
             double differential_a_fb_leptonic(const double & q2) const;
@@ -49,21 +54,21 @@ namespace eos
             double differential_a_fb_combined(const double & q2) const;
             double differential_fzero(const double & q2) const;
 
-            double integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_leptonic(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_hadronic(const double & q2_min, const double & q2_max) const;
-            double integrated_a_fb_combined(const double & q2_min, const double & q2_max) const;
-            double integrated_fzero(const double & q2_min, const double & q2_max) const;
-            double integrated_k1ss(const double & q2_min, const double & q2_max) const;
-            double integrated_k1cc(const double & q2_min, const double & q2_max) const;
-            double integrated_k1c(const double & q2_min, const double & q2_max) const;
-            double integrated_k2ss(const double & q2_min, const double & q2_max) const;
-            double integrated_k2cc(const double & q2_min, const double & q2_max) const;
-            double integrated_k2c(const double & q2_min, const double & q2_max) const;
-            double integrated_k3sc(const double & q2_min, const double & q2_max) const;
-            double integrated_k3s(const double & q2_min, const double & q2_max) const;
-            double integrated_k4sc(const double & q2_min, const double & q2_max) const;
-            double integrated_k4s(const double & q2_min, const double & q2_max) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_a_fb_leptonic(const IntermediateResult * ir) const;
+            double integrated_a_fb_hadronic(const IntermediateResult * ir) const;
+            double integrated_a_fb_combined(const IntermediateResult * ir) const;
+            double integrated_fzero(const IntermediateResult * ir) const;
+            double integrated_k1ss(const IntermediateResult * ir) const;
+            double integrated_k1cc(const IntermediateResult * ir) const;
+            double integrated_k1c(const IntermediateResult * ir) const;
+            double integrated_k2ss(const IntermediateResult * ir) const;
+            double integrated_k2cc(const IntermediateResult * ir) const;
+            double integrated_k2c(const IntermediateResult * ir) const;
+            double integrated_k3sc(const IntermediateResult * ir) const;
+            double integrated_k3s(const IntermediateResult * ir) const;
+            double integrated_k4sc(const IntermediateResult * ir) const;
+            double integrated_k4s(const IntermediateResult * ir) const;
 
             /*!
             * Descriptions of the process and its kinematics.
@@ -85,6 +90,23 @@ namespace eos
             static std::vector<OptionSpecification>::const_iterator begin_options();
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
+
+    /*!
+     * The q^2-integrated angular observables K_1ss through K_4s, from which all integrated
+     * observables in one bin are derived.
+     */
+    class LambdaBToLambdaCLeptonNeutrino::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 10> k;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
 }
 
 #endif
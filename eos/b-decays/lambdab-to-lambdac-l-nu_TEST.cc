@@ -68,10 +68,10 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1), -0.20167, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  0.32745, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1), -0.11727, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),          0.58742, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(0.011, 11.1)), -0.20167, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(d.prepare(0.011, 11.1)),  0.32745, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(d.prepare(0.011, 11.1)), -0.11727, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(d.prepare(0.011, 11.1)),          0.58742, eps);
             }
 
             // tests for SM observables, Re{cVL}=1.0 in the SM and all other couplings are zero, l = mu
@@ -96,10 +96,10 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(3.154, 11.1), +0.02447,  eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(3.154, 11.1),  0.29600,  eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(3.154, 11.1), -0.022086, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(3.154, 11.1),          0.38041,  eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(3.154, 11.1)), +0.02447,  eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(d.prepare(3.154, 11.1)),  0.29600,  eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(d.prepare(3.154, 11.1)), -0.022086, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(d.prepare(3.154, 11.1)),          0.38041,  eps);
             }
 
             // Consistency check for R_lambda
@@ -134,7 +134,7 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
 
                 auto obs_Rlambda = Observable::make("Lambda_b->Lambda_clnu::R(Lambda_c)", p, k, oo);
                 TEST_CHECK_RELATIVE_ERROR(
-                    dtau.integrated_branching_ratio(3.154, 11.1) / dmu.integrated_branching_ratio(0.011, 11.1),
+                    dtau.integrated_branching_ratio(dtau.prepare(3.154, 11.1)) / dmu.integrated_branching_ratio(dmu.prepare(0.011, 11.1)),
                     obs_Rlambda->evaluate(),
                     1e-5
                 );
@@ -174,10 +174,10 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-4;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1),   0.04665,  eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  -0.01808,  eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1),  -0.015045, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),           0.401858, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(0.011, 11.1)),   0.04665,  eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(d.prepare(0.011, 11.1)),  -0.01808,  eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(d.prepare(0.011, 11.1)),  -0.015045, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(d.prepare(0.011, 11.1)),           0.401858, eps);
             }
 
             // tests for NP observables (no tensors)
@@ -213,10 +213,10 @@ class LambdaBToLambdaCLeptonNeutrinoTest :
                 const double eps = 1e-2;
 
                 // the full phase-space region for muon
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(0.011, 11.1),   0.1336, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(0.011, 11.1),  -0.0147, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(0.011, 11.1),  -0.1180, eps);
-                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(0.011, 11.1),           0.3742, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_leptonic(d.prepare(0.011, 11.1)),   0.1336, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_hadronic(d.prepare(0.011, 11.1)),  -0.0147, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_a_fb_combined(d.prepare(0.011, 11.1)),  -0.1180, eps);
+                TEST_CHECK_RELATIVE_ERROR(d.integrated_fzero(d.prepare(0.011, 11.1)),           0.3742, eps);
             }
         }
 } lambdab_to_lambdac_l_nu_test;
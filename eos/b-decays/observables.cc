@@ -162,29 +162,34 @@ namespace eos
                 make_observable("B->pilnu::dBR/dq2", R"(d\mathcal{B}(B\to\pi\ell^-\bar\nu)/dq^2)",
                         Unit::InverseGeV2(),
                         &BToPseudoscalarLeptonNeutrino::differential_branching_ratio,
+                        &BToPseudoscalarLeptonNeutrino::differential_branching_ratio_with_gradient,
                         std::make_tuple("q2"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::BR", R"(\mathcal{B}(B\to\pi\ell^-\bar\nu))",
+                make_cacheable_observable("B->pilnu::BR", R"(\mathcal{B}(B\to\pi\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::width", R"(\Gamma(B\to\pi\ell^-\bar\nu))",
+                make_cacheable_observable("B->pilnu::width", R"(\Gamma(B\to\pi\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::width_p", R"(\Gamma(B\to\pi\ell^-\bar\nu)_p)",
+                make_cacheable_observable("B->pilnu::width_p", R"(\Gamma(B\to\pi\ell^-\bar\nu)_p)",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_p,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::width_0", R"(\Gamma(B\to\pi\ell^-\bar\nu)_0)",
+                make_cacheable_observable("B->pilnu::width_0", R"(\Gamma(B\to\pi\ell^-\bar\nu)_0)",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width_0,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
@@ -227,8 +232,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::A_FB", R"(A_{\mathrm{FB}}(B\to \pi\ell^-\bar\nu))",
+                make_cacheable_observable("B->pilnu::A_FB", R"(A_{\mathrm{FB}}(B\to \pi\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
@@ -245,20 +251,23 @@ namespace eos
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::A_l",
+                make_cacheable_observable("B->pilnu::A_l", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::F_H",
+                make_cacheable_observable("B->pilnu::F_H", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_flat_term,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
 
-                make_observable("B->pilnu::zeta",
+                make_cacheable_observable("B->pilnu::zeta", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, { "I", "1" } }),
@@ -282,11 +291,13 @@ namespace eos
                 make_observable("B->Dlnu::dBR/dq2", R"(d\mathcal{B}(B\to \bar{D}\ell^-\bar\nu)/dq^2)",
                         Unit::InverseGeV2(),
                         &BToPseudoscalarLeptonNeutrino::differential_branching_ratio,
+                        &BToPseudoscalarLeptonNeutrino::differential_branching_ratio_with_gradient,
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
 
-                make_observable("B->Dlnu::BR", R"(\mathcal{B}(B\to \bar{D}\ell^-\bar\nu))",
+                make_cacheable_observable("B->Dlnu::BR", R"(\mathcal{B}(B\to \bar{D}\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
@@ -297,8 +308,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
 
-                make_observable("B->Dlnu::normBR",
+                make_cacheable_observable("B->Dlnu::normBR", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
@@ -325,8 +337,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
 
-                make_observable("B->Dlnu::A_FB", R"(A_{\mathrm{FB}}(B\to \bar{D}\ell^-\bar\nu))",
+                make_cacheable_observable("B->Dlnu::A_FB", R"(A_{\mathrm{FB}}(B\to \bar{D}\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
@@ -343,8 +356,9 @@ namespace eos
                         std::make_tuple("w_min", "w_max"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
 
-                make_observable("B->Dlnu::A_l",
+                make_cacheable_observable("B->Dlnu::A_l", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, { "I", "1/2" } }),
@@ -368,11 +382,13 @@ namespace eos
                 make_observable("B_s->Klnu::dBR/dq2", R"(d\mathcal{B}(\bar{B}_s\to K\ell^-\bar\nu)/dq^2)",
                         Unit::InverseGeV2(),
                         &BToPseudoscalarLeptonNeutrino::differential_branching_ratio,
+                        &BToPseudoscalarLeptonNeutrino::differential_branching_ratio_with_gradient,
                         std::make_tuple("q2"),
                         Options{ { "U", "u" }, {"q", "s"}, { "I", "1/2" } }),
 
-                make_observable("B_s->Klnu::BR", R"(\mathcal{B}(\bar{B}_s\to K\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->Klnu::BR", R"(\mathcal{B}(\bar{B}_s\to K\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, {"q", "s"}, { "I", "1/2" } }),
@@ -383,8 +399,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "u" }, {"q", "s"}, { "I", "1/2" } }),
 
-                make_observable("B_s->Klnu::normBR",
+                make_cacheable_observable("B_s->Klnu::normBR", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "u" }, {"q", "s"}, { "I", "1/2" } }),
@@ -408,11 +425,13 @@ namespace eos
                 make_observable("B_s->D_slnu::dBR/dq2", R"(d\mathcal{B}(B_s\to \bar{D}_s\ell^-\bar\nu)/dq^2)",
                         Unit::InverseGeV2(),
                         &BToPseudoscalarLeptonNeutrino::differential_branching_ratio,
+                        &BToPseudoscalarLeptonNeutrino::differential_branching_ratio_with_gradient,
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
 
-                make_observable("B_s->D_slnu::BR", R"(\mathcal{B}(B_s\to \bar{D}_s\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->D_slnu::BR", R"(\mathcal{B}(B_s\to \bar{D}_s\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
@@ -423,8 +442,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
 
-                make_observable("B_s->D_slnu::normBR",
+                make_cacheable_observable("B_s->D_slnu::normBR", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::normalized_integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
@@ -451,8 +471,9 @@ namespace eos
                         std::make_tuple("q2"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
 
-                make_observable("B_s->D_slnu::A_FB", R"(A_{\mathrm{FB}}(B_s\to \bar{D}_s\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->D_slnu::A_FB", R"(A_{\mathrm{FB}}(B_s\to \bar{D}_s\ell^-\bar\nu))",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
@@ -469,8 +490,9 @@ namespace eos
                         std::make_tuple("w_min", "w_max"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
 
-                make_observable("B_s->D_slnu::A_l",
+                make_cacheable_observable("B_s->D_slnu::A_l", R"()",
                         Unit::None(),
+                        &BToPseudoscalarLeptonNeutrino::prepare,
                         &BToPseudoscalarLeptonNeutrino::integrated_lepton_polarization,
                         std::make_tuple("q2_min", "q2_max"),
                         Options{ { "U", "c" }, {"q", "s"}, { "I", "0" } }),
@@ -1244,8 +1266,9 @@ namespace eos
                                 &BToDPiLeptonNeutrino::differential_pdf_q2,
                                 std::make_tuple("q2")),
 
-                make_observable("B->Dpilnu::A_l",
+                make_cacheable_observable("B->Dpilnu::A_l", R"()",
                                 Unit::None(),
+                                &BToDPiLeptonNeutrino::prepare,
                                 &BToDPiLeptonNeutrino::integrated_lepton_polarization,
                                 std::make_tuple("q2_min", "q2_max")),
 
@@ -1591,53 +1614,63 @@ namespace eos
                         &BsToKstarLeptonNeutrino::differential_forward_backward_asymmetry,
                         std::make_tuple("q2")),
 
-                make_observable("B_s->K^*lnu::BR", R"(\mathcal{B}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::BR", R"(\mathcal{B}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::A_FB", R"(A_\mathrm{FB}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::A_FB", R"(A_\mathrm{FB}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_forward_backward_asymmetry,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_1s", R"(\hat{S}_{1s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_1s", R"(\hat{S}_{1s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_1s,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_1c", R"(\hat{S}_{1c}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_1c", R"(\hat{S}_{1c}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_1c,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_2s", R"(\hat{S}_{2s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_2s", R"(\hat{S}_{2s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_2s,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_2c", R"(\hat{S}_{2c}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_2c", R"(\hat{S}_{2c}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_2c,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_3", R"(\hat{S}_3(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_3", R"(\hat{S}_3(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_3,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_4", R"(\hat{S}_4(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_4", R"(\hat{S}_4(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_4,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_5", R"(\hat{S}_5(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_5", R"(\hat{S}_5(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_5,
                         std::make_tuple("s_min", "s_max")),
 
-                make_observable("B_s->K^*lnu::Shat_6s", R"(\hat{S}_{6s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::Shat_6s", R"(\hat{S}_{6s}(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_s_6s,
                         std::make_tuple("s_min", "s_max")),
 
@@ -1706,68 +1739,81 @@ namespace eos
                         &BsToKstarLeptonNeutrino::differential_h_5,
                         std::make_tuple("q2")),
 
-                make_observable("B_s->K^*lnu::F_L", R"(F_L(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::F_L", R"(F_L(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_longitudinal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::F_T", R"(F_T(B_s\to \bar{K}^*\ell^-\bar\nu))",
+                make_cacheable_observable("B_s->K^*lnu::F_T", R"(F_T(B_s\to \bar{K}^*\ell^-\bar\nu))",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transversal_polarisation,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^2",
+                make_cacheable_observable("B_s->K^*lnu::A_T^2", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^3",
+                make_cacheable_observable("B_s->K^*lnu::A_T^3", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^4",
+                make_cacheable_observable("B_s->K^*lnu::A_T^4", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^5",
+                make_cacheable_observable("B_s->K^*lnu::A_T^5", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_5,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^re",
+                make_cacheable_observable("B_s->K^*lnu::A_T^re", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_re,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::A_T^im",
+                make_cacheable_observable("B_s->K^*lnu::A_T^im", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_transverse_asymmetry_im,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::H_T^1",
+                make_cacheable_observable("B_s->K^*lnu::H_T^1", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_h_1,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::H_T^2",
+                make_cacheable_observable("B_s->K^*lnu::H_T^2", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_h_2,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::H_T^3",
+                make_cacheable_observable("B_s->K^*lnu::H_T^3", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_h_3,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::H_T^4",
+                make_cacheable_observable("B_s->K^*lnu::H_T^4", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_h_4,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("B_s->K^*lnu::H_T^5",
+                make_cacheable_observable("B_s->K^*lnu::H_T^5", R"()",
                         Unit::None(),
+                        &BsToKstarLeptonNeutrino::prepare,
                         &BsToKstarLeptonNeutrino::integrated_h_5,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1944,8 +1990,9 @@ namespace eos
                         &LambdaBToLambdaCLeptonNeutrino::differential_fzero,
                         std::make_tuple("q2")),
 
-                make_observable("Lambda_b->Lambda_clnu::BR", R"(\mathcal{B}(\Lambda_b\to\Lambda_c \ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::BR", R"(\mathcal{B}(\Lambda_b\to\Lambda_c \ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_branching_ratio,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1957,13 +2004,15 @@ namespace eos
                         <<Lambda_b->Lambda_clnu::BR;l=mu>>[q2_max=>q2_mu_max,q2_min=>q2_mu_min]
                         )"),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^l",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^l", R"()",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_leptonic,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^h",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^h", R"()",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_hadronic,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -1983,63 +2032,75 @@ namespace eos
                         <<Lambda_b->Lambda_clnu::A_FB^h;l=mu>>[q2_max=>q2_mu_max,q2_min=>q2_mu_min]
                         )"),
 
-                make_observable("Lambda_b->Lambda_clnu::A_FB^c",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::A_FB^c", R"()",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_a_fb_combined,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::F_0",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::F_0", R"()",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_fzero,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1ss", R"(K_{1ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1ss", R"(K_{1ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1cc", R"(K_{1cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1cc", R"(K_{1cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_1c", R"(K_{1c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_1c", R"(K_{1c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k1c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2ss", R"(K_{2ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2ss", R"(K_{2ss}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2ss,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2cc", R"(K_{2cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2cc", R"(K_{2cc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2cc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_2c", R"(K_{2c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_2c", R"(K_{2c}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k2c,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_3sc", R"(K_{3sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_3sc", R"(K_{3sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k3sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_3s", R"(K_{3s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_3s", R"(K_{3s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k3s,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_4sc", R"(K_{4sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_4sc", R"(K_{4sc}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k4sc,
                         std::make_tuple("q2_min", "q2_max")),
 
-                make_observable("Lambda_b->Lambda_clnu::K_4s", R"(K_{4s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
+                make_cacheable_observable("Lambda_b->Lambda_clnu::K_4s", R"(K_{4s}(\Lambda_b\to\Lambda_c(\to \Lambda\pi)\ell^-\bar\nu))",
                         Unit::None(),
+                        &LambdaBToLambdaCLeptonNeutrino::prepare,
                         &LambdaBToLambdaCLeptonNeutrino::integrated_k4s,
                         std::make_tuple("q2_min", "q2_max")),
 
@@ -22,6 +22,7 @@
 #include <eos/constraint.hh>
 #include <eos/maths/gsl-interface.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/signal-pdf.hh>
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/exception.hh>
@@ -1834,6 +1835,213 @@ namespace eos
     };
     /// }}}
 
+    /// {{{ UnbinnedConstraintEntry
+    struct UnbinnedConstraintEntry :
+        public ConstraintEntryBase
+    {
+        QualifiedName signal_pdf;
+
+        Kinematics kinematics;
+
+        Options options;
+
+        std::string events;
+
+        std::vector<QualifiedName> yield;
+
+        UnbinnedConstraintEntry(const std::string & name,
+                const QualifiedName & signal_pdf,
+                const Kinematics & kinematics, const Options & options,
+                const std::string & events,
+                const std::vector<QualifiedName> & yield) :
+            ConstraintEntryBase(name, yield),
+            signal_pdf(signal_pdf),
+            kinematics(kinematics),
+            options(options),
+            events(events),
+            yield(yield)
+        {
+        }
+
+        virtual ~UnbinnedConstraintEntry() = default;
+
+        virtual const std::string & type() const
+        {
+            static const std::string type("Unbinned");
+
+            return type;
+        }
+
+        virtual Constraint make(const QualifiedName & name, const Options & options) const
+        {
+            Parameters parameters(Parameters::Defaults());
+            ObservableCache cache(parameters);
+
+            for (const auto & [key, value] : this->options)
+            {
+                if (options.has(key) && (value != options[key]))
+                {
+                    Log::instance()->message("[UnbinnedConstraintEntry.make]", ll_debug)
+                        << "Constraint '" << name << "' provides option key '" << key << "' with value '" << value << "'; user is overriding this preset with '" << options[key] << "'";
+                }
+            }
+
+            SignalPDFPtr pdf = SignalPDF::make(this->signal_pdf, parameters, this->kinematics, this->options + options);
+            if (! pdf.get())
+                throw InternalError("make_unbinned_constraint: " + name.str() + ": '" + this->signal_pdf.str() + "' is not a valid signal PDF name");
+
+            std::vector<ObservablePtr> observables;
+            for (const auto & y : this->yield)
+            {
+                observables.push_back(Observable::make(y, parameters, this->kinematics, this->options + options));
+                if (! observables.back().get())
+                    throw InternalError("make_unbinned_constraint: " + name.str() + ": '" + y.str() + "' is not a valid observable name");
+            }
+
+            LogLikelihoodBlockPtr block = LogLikelihoodBlock::Unbinned(cache, pdf, this->events, observables.empty() ? nullptr : observables.front());
+
+            return Constraint(name, observables, { block });
+        }
+
+        virtual LogPriorPtr make_prior(const Parameters & parameters, const Options & options) const
+        {
+            throw InternalError("UnbinnedConstraintEntry::make_prior: not yet implemented");
+            return nullptr;
+        }
+
+        virtual std::ostream & insert(std::ostream & os) const
+        {
+            os << _name.full() << ":" << std::endl;
+            os << "    type: Unbinned" << std::endl;
+            os << "    signal-pdf: " << signal_pdf << std::endl;
+            os << "    events: " << events << std::endl;
+
+            return os;
+        }
+
+        virtual void serialize(YAML::Emitter & out) const
+        {
+            out << YAML::DoublePrecision(9);
+            out << YAML::BeginMap;
+            out << YAML::Key << "type" << YAML::Value << "Unbinned";
+            out << YAML::Key << "signal-pdf" << YAML::Value << signal_pdf.full();
+            out << YAML::Key << "kinematics" << YAML::Value << YAML::Flow << YAML::BeginMap;
+            for (const auto & k : kinematics)
+            {
+                out << YAML::Key << k.name() << YAML::Value << k.evaluate();
+            }
+            out << YAML::EndMap;
+            out << YAML::Key << "options" << YAML::Value << YAML::Flow << YAML::BeginMap;
+            for (const auto & o : options)
+            {
+                out << YAML::Key << o.first << YAML::Value << o.second;
+            }
+            out << YAML::EndMap;
+            out << YAML::Key << "events" << YAML::Value << events;
+            if (! yield.empty())
+            {
+                out << YAML::Key << "yield" << YAML::Value << yield.front().full();
+            }
+            out << YAML::EndMap;
+        }
+
+        static ConstraintEntry * deserialize(const QualifiedName & name, const YAML::Node & n)
+        {
+            static const std::string required_keys[] =
+            {
+                "signal-pdf", "kinematics", "options", "events"
+            };
+
+            for (auto && k : required_keys)
+            {
+                if (! n[k].IsDefined())
+                {
+                    throw ConstraintDeserializationError(name, "required key '" + k + "' not specified");
+                }
+            }
+
+            static const std::string scalar_keys[] =
+            {
+                "signal-pdf", "events"
+            };
+
+            for (auto && k : scalar_keys)
+            {
+                if (YAML::NodeType::Scalar != n[k].Type())
+                {
+                    throw ConstraintDeserializationError(name, "required key '" + k + "' not mapped to a scalar value");
+                }
+            }
+
+            static const std::string map_keys[] =
+            {
+                "kinematics", "options"
+            };
+
+            for (auto && k : map_keys)
+            {
+                if (YAML::NodeType::Map != n[k].Type())
+                {
+                    throw ConstraintDeserializationError(name, "required key '" + k + "' not mapped to a map");
+                }
+            }
+
+            if (n["yield"].IsDefined() && (YAML::NodeType::Scalar != n["yield"].Type()))
+            {
+                throw ConstraintDeserializationError(name, "optional key 'yield' not mapped to a scalar value");
+            }
+
+            try
+            {
+                QualifiedName signal_pdf(n["signal-pdf"].as<std::string>());
+                std::string events = n["events"].as<std::string>();
+
+                Kinematics kinematics;
+                std::list<std::pair<YAML::Node, YAML::Node>> kinematics_nodes(n["kinematics"].begin(), n["kinematics"].end());
+                // yaml-cpp does not guarantee loading of a map in the order it is written. Circumvent this problem
+                // by sorting the entries lexicographically.
+                kinematics_nodes.sort(&impl::less);
+                std::set<std::string> kinematics_keys;
+                for (auto && k : kinematics_nodes)
+                {
+                    std::string key = k.first.as<std::string>();
+                    if (! kinematics_keys.insert(key).second)
+                        throw ConstraintDeserializationError(name, "kinematics key '" + key + "' encountered more than once");
+
+                    kinematics.declare(key, k.second.as<double>());
+                }
+
+                Options options;
+                std::list<std::pair<YAML::Node, YAML::Node>> options_nodes(n["options"].begin(), n["options"].end());
+                // yaml-cpp does not guarantee loading of a map in the order it is written. Circumvent this problem
+                // by sorting the entries lexicographically.
+                options_nodes.sort(&impl::less);
+                std::set<std::string> options_keys;
+                for (auto && o : options_nodes)
+                {
+                    std::string key = o.first.as<std::string>();
+                    if (! options_keys.insert(key).second)
+                        throw ConstraintDeserializationError(name, "options key '" + key + "' encountered more than once");
+
+                    options.declare(key, o.second.as<std::string>());
+                }
+
+                std::vector<QualifiedName> yield;
+                if (n["yield"].IsDefined())
+                {
+                    yield.push_back(QualifiedName(n["yield"].as<std::string>()));
+                }
+
+                return new UnbinnedConstraintEntry(name.str(), signal_pdf, kinematics, options, events, yield);
+            }
+            catch (QualifiedNameSyntaxError & e)
+            {
+                throw ConstraintDeserializationError(name, "'" + n["signal-pdf"].as<std::string>() + "' is not a valid signal PDF or observable name (" + e.what() + ")");
+            }
+        }
+    };
+    /// }}}
+
     /// {{{ MixtureConstraintEntry
     struct MixtureConstraintEntry :
         public ConstraintEntryBase
@@ -2289,6 +2497,7 @@ namespace eos
             { "MultivariateGaussian",             &MultivariateGaussianConstraintEntry::deserialize           },
             { "MultivariateGaussian(Covariance)", &MultivariateGaussianCovarianceConstraintEntry::deserialize },
             { "UniformBound",                     &UniformBoundConstraintEntry::deserialize                   },
+            { "Unbinned",                         &UnbinnedConstraintEntry::deserialize                       },
             { "Mixture",                          &MixtureConstraintEntry::deserialize,                       },
         };
 
@@ -25,6 +25,9 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -1181,6 +1184,66 @@ class ConstraintDeserializationTest :
             }
             // }}}
 
+            // {{{ Unbinned (correct order)
+            {
+                static const std::string input(
+                    "type: Unbinned\n"
+                    "signal-pdf: Test::Legendre1D\n"
+                    "kinematics: {z_max: 1, z_min: -1}\n"
+                    "options: {}\n"
+                    "events: constraint_TEST-unbinned.bin\n"
+                    "yield: mass::tau"
+                );
+
+                YAML::Node node = YAML::Load(input);
+
+                std::shared_ptr<ConstraintEntry> entry(ConstraintEntry::FromYAML("Test::Unbinned", node));
+                TEST_CHECK(nullptr != entry.get());
+
+                YAML::Emitter out;
+                entry->serialize(out);
+
+                std::string output(out.c_str());
+
+                TEST_CHECK(input == output);
+            }
+            // }}}
+
+            // {{{ Unbinned (value)
+            {
+                static const std::string input(
+                    "type: Unbinned\n"
+                    "signal-pdf: Test::Legendre1D\n"
+                    "kinematics: {z_max: 1, z_min: -1}\n"
+                    "options: {}\n"
+                    "events: constraint_TEST-unbinned.bin\n"
+                    "yield: mass::tau"
+                );
+
+                const std::vector<double> events{ -0.5, 0.0, 0.5 };
+                {
+                    std::ofstream file("constraint_TEST-unbinned.bin", std::ios::binary);
+                    file.write(reinterpret_cast<const char *>(events.data()), events.size() * sizeof(double));
+                }
+
+                YAML::Node node = YAML::Load(input);
+
+                std::shared_ptr<ConstraintEntry> entry(ConstraintEntry::FromYAML("Test::Unbinned", node));
+                TEST_CHECK(nullptr != entry.get());
+
+                Constraint c = entry->make("Test::Unbinned", Options{ });
+                std::remove("constraint_TEST-unbinned.bin");
+
+                Parameters p = Parameters::Defaults();
+                LogLikelihood llh(p);
+                llh.add(c);
+
+                // the PDF (9 + 8 z + 9 z^2) is normalized to 24 on [-1, +1]
+                p["mass::tau"] = 2.0;
+                TEST_CHECK_NEARLY_EQUAL(llh(), std::log(7.25 / 24.0) + std::log(9.0 / 24.0) + std::log(15.25 / 24.0) + 3.0 * std::log(2.0) - 2.0 - std::log(6.0), 1e-12);
+            }
+            // }}}
+
             // {{{ Mixture (correct order)
             {
                 static const std::string input(
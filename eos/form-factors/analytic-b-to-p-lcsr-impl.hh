@@ -25,8 +25,10 @@
 #include <eos/form-factors/analytic-b-to-p-lcsr.hh>
 #include <eos/form-factors/b-lcdas.hh>
 #include <eos/utils/exception.hh>
+#include <eos/maths/chebyshev-surrogate-memoiser.hh>
 #include <eos/maths/integrate.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/options-impl.hh>
@@ -83,6 +85,18 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_fT_2pt;
         bool switch_borel;
 
+        // polynomial approximations of the sum rules and their moments in q2, rebuilt on first use after a parameter change
+        enum class SumRule
+        {
+            f_p, f_pm, f_t,
+            moment_1_f_p, moment_1_f_pm, moment_1_f_t
+        };
+        SwitchOption opt_surrogate;
+        bool switch_surrogate;
+        double surrogate_q2_min;
+        double surrogate_q2_max;
+        ChebyshevSurrogateMemoiser<SumRule> surrogates;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -106,10 +120,18 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            opt_surrogate(o, "surrogate", { "off", "chebyshev" }, "off"),
+            switch_surrogate(opt_surrogate.value() == "chebyshev"),
+            surrogate_q2_min(destringify<double>(o.get("surrogate-q2-min", "-5.0"))),
+            surrogate_q2_max(destringify<double>(o.get("surrogate-q2-max", "10.0"))),
+            surrogates(p, switch_surrogate, surrogate_q2_min, surrogate_q2_max)
         {
             u.uses(*b_lcdas);
 
+            if (switch_surrogate && (surrogate_q2_min >= surrogate_q2_max))
+                throw InvalidOptionValueError("surrogate-q2-max", o.get("surrogate-q2-max", "10.0"), "values larger than surrogate-q2-min");
+
             switch (Process_::q_v)
             {
                 case 'u':
@@ -168,6 +190,42 @@ namespace eos
 
         ~Implementation() = default;
 
+        // evaluate one of the sum rules, or its polynomial approximation if requested
+        double approximated(double (Implementation::* f)(const double &) const, const SumRule & sum_rule, const double & q2) const
+        {
+            return surrogates.approximated([this, f] (const double & q2) { return (this->*f)(q2); }, sum_rule, q2);
+        }
+
+        double f_p(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_p, SumRule::f_p, q2);
+        }
+
+        double f_pm(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_pm, SumRule::f_pm, q2);
+        }
+
+        double f_t(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_t, SumRule::f_t, q2);
+        }
+
+        double normalized_moment_1_f_p(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_normalized_moment_1_f_p, SumRule::moment_1_f_p, q2);
+        }
+
+        double normalized_moment_1_f_pm(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_normalized_moment_1_f_pm, SumRule::moment_1_f_pm, q2);
+        }
+
+        double normalized_moment_1_f_t(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_normalized_moment_1_f_t, SumRule::moment_1_f_t, q2);
+        }
+
         /* quark masses for the propagating quark */
 
         double m_u() const
@@ -2716,7 +2774,7 @@ namespace eos
 
         /* f_+ : form factor and moments */
         // {{{
-        double f_p(const double & q2) const
+        double evaluate_f_p(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
@@ -2746,7 +2804,7 @@ namespace eos
             return f_B() * m_B() / f_P() * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
         }
 
-        double normalized_moment_1_f_p(const double & q2) const
+        double evaluate_normalized_moment_1_f_p(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_p(), s0_1_p());
 
@@ -5455,7 +5513,7 @@ namespace eos
 
         /* f_+ : form factor and moments */
         // {{{
-        double f_pm(const double & q2) const
+        double evaluate_f_pm(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
@@ -5485,7 +5543,7 @@ namespace eos
             return f_B() * m_B() / f_P() * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
         }
 
-        double normalized_moment_1_f_pm(const double & q2) const
+        double evaluate_normalized_moment_1_f_pm(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_pm(), s0_1_pm());
 
@@ -8330,7 +8388,7 @@ namespace eos
 
         /* fT : form factor and moments */
         // {{{
-        double f_t(const double & q2) const
+        double evaluate_f_t(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
@@ -8360,7 +8418,7 @@ namespace eos
             return f_B() * power_of<2>(m_B()) * (m_B() + m_P()) / (f_P() * (power_of<2>(m_B()) - power_of<2>(m_P()) - q2)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
         }
 
-        double normalized_moment_1_f_t(const double & q2) const
+        double evaluate_normalized_moment_1_f_t(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_t(), s0_1_t());
 
@@ -9489,9 +9547,12 @@ namespace eos
     const std::vector<OptionSpecification>
     Implementation<AnalyticFormFactorBToPLCSR<Process_>>::options
     {
-        { "2pt",    { "tw2+3", "all", "off" }, "all"   },
-        { "3pt",    { "tw3+4", "all", "off" }, "all"   },
-        { "method", { "borel", "dispersive" }, "borel" }
+        { "2pt",              { "tw2+3", "all", "off" }, "all"   },
+        { "3pt",              { "tw3+4", "all", "off" }, "all"   },
+        { "method",           { "borel", "dispersive" }, "borel" },
+        { "surrogate",        { "off", "chebyshev" },    "off"   },
+        { "surrogate-q2-min", { },                       "-5.0"  },
+        { "surrogate-q2-max", { },                       "10.0"  }
     };
 
     template <typename Process_>
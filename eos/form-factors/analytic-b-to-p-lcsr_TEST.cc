@@ -1373,6 +1373,19 @@ class LCSRFormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR( 0.643604, ff->f_t( 0.0), 2.0 * eps);
                 TEST_CHECK_RELATIVE_ERROR( 0.862329, ff->f_t(+5.0), 5.0 * eps);
 
+                // the polynomial approximations reproduce the sum rules
+                Options o_surrogate = o + Options{ { "surrogate", "chebyshev" }, { "surrogate-q2-max", "5.0" } };
+                std::shared_ptr<FormFactors<PToP>> ff_surrogate = FormFactorFactory<PToP>::create("B_s->D_s::B-LCSR", p, o_surrogate);
+
+                for (const double & q2 : { -4.5, -1.3, 0.7, 3.1, 5.0 })
+                {
+                    TEST_CHECK_RELATIVE_ERROR(ff->f_p(q2), ff_surrogate->f_p(q2), eps);
+                    TEST_CHECK_RELATIVE_ERROR(ff->f_0(q2), ff_surrogate->f_0(q2), eps);
+                    TEST_CHECK_RELATIVE_ERROR(ff->f_t(q2), ff_surrogate->f_t(q2), eps);
+                }
+
+                // outside of the surrogate's range, the sum rules are evaluated directly
+                TEST_CHECK_EQUAL(ff->f_p(-6.0), ff_surrogate->f_p(-6.0));
             }
         }
 } kmo2006_form_factors_test;
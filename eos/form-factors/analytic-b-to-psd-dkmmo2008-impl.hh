@@ -24,11 +24,13 @@
 
 #include <eos/form-factors/analytic-b-to-psd-dkmmo2008.hh>
 #include <eos/form-factors/pi-lcdas.hh>
+#include <eos/maths/chebyshev-surrogate-memoiser.hh>
 #include <eos/maths/derivative.hh>
 #include <eos/maths/integrate.hh>
 #include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/models/model.hh>
+#include <eos/utils/destringify.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/options-impl.hh>
@@ -38,6 +40,7 @@
 
 #include <functional>
 #include <limits>
+#include <memory>
 
 #include <gsl/gsl_sf_gamma.h>
 
@@ -337,6 +340,17 @@ namespace eos
         // Parameter for the estimation of NNLO corrections
         UsedParameter zeta_nnlo;
 
+        // polynomial approximations of the form factors in q2, rebuilt on first use after a parameter change
+        enum class SumRule
+        {
+            f_p, f_0, f_t
+        };
+        SwitchOption opt_surrogate;
+        bool switch_surrogate;
+        double surrogate_q2_min;
+        double surrogate_q2_max;
+        ChebyshevSurrogateMemoiser<SumRule> surrogates;
+
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             DKMMO2008Base<q1_, q2_, qs_>(p, o, u),
             opt_rescale_borel(o, "rescale-borel", { "1", "0" }, "1"),
@@ -351,10 +365,18 @@ namespace eos
             _s0_T_p(p[prefix + "::s_0^T'(0)@DKMMO2008"], u),
             _s0_T_pp(p[prefix + "::s_0^T''(0)@DKMMO2008"], u),
             opt_decay_constant(o, options, "decay-constant"),
-            zeta_nnlo(p[prefix + "::zeta(NNLO)@DKMMO2008"], u)
+            zeta_nnlo(p[prefix + "::zeta(NNLO)@DKMMO2008"], u),
+            opt_surrogate(o, "surrogate", { "off", "chebyshev" }, "off"),
+            switch_surrogate(opt_surrogate.value() == "chebyshev"),
+            surrogate_q2_min(destringify<double>(o.get("surrogate-q2-min", "-5.0"))),
+            surrogate_q2_max(destringify<double>(o.get("surrogate-q2-max", "10.0"))),
+            surrogates(p, switch_surrogate, surrogate_q2_min, surrogate_q2_max)
         {
             using namespace std::placeholders;
 
+            if (switch_surrogate && (surrogate_q2_min >= surrogate_q2_max))
+                throw InvalidOptionValueError("surrogate-q2-max", o.get("surrogate-q2-max", "10.0"), "values larger than surrogate-q2-min");
+
             if ('1' == opt_rescale_borel.value()[0])
             {
                 rescale_factor_p = std::bind(&Implementation::_rescale_factor_p, this, _1);
@@ -386,6 +408,27 @@ namespace eos
             u.uses(*model);
         }
 
+        // evaluate one of the form factors, or its polynomial approximation if requested
+        double approximated(double (Implementation::* f)(const double &) const, const SumRule & sum_rule, const double & q2) const
+        {
+            return surrogates.approximated([this, f] (const double & q2) { return (this->*f)(q2); }, sum_rule, q2);
+        }
+
+        double f_p(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_p, SumRule::f_p, q2);
+        }
+
+        double f_0(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_0, SumRule::f_0, q2);
+        }
+
+        double f_t(const double & q2) const
+        {
+            return approximated(&Implementation::evaluate_f_t, SumRule::f_t, q2);
+        }
+
         inline double m_b_msbar(const double & mu) const
         {
             return model->m_b_msbar(mu);
@@ -2138,7 +2181,7 @@ namespace eos
             return std::sqrt(MB2);
         }
 
-        double f_p(const double & q2) const
+        double evaluate_f_p(const double & q2) const
         {
             const double MB2 = MB * MB;
             const double M2_rescaled = this->M2() * this->rescale_factor_p(q2);
@@ -2155,11 +2198,11 @@ namespace eos
             return std::exp(MB2 / M2_rescaled) / (2.0 * MB2 * fB) * (F_lo + alpha_s / (3.0 * M_PI) * F_nlo + alpha_s * alpha_s / (9.0 * M_PI * M_PI) * F_nnlo);
         }
 
-        double f_0(const double & q2) const
+        double evaluate_f_0(const double & q2) const
         {
 
             if (std::abs(q2) < 1e-6)
-                return f_p(q2);
+                return evaluate_f_p(q2);
 
             const double MB2 = MB * MB, mP2 = mP * mP;
             const double M2_rescaled = this->M2() * this->rescale_factor_0(q2);
@@ -2174,7 +2217,7 @@ namespace eos
             return std::exp(MB2 / M2_rescaled) / (2.0 * MB2 * fB) * (2.0 * q2 / (MB2 - mP2) * (Ftil_lo + alpha_s / (3.0 * M_PI) * Ftil_nlo) + (1.0 - q2 / (MB2 - mP2)) * (F_lo + alpha_s / (3.0 * M_PI) * F_nlo));
         }
 
-        double f_t(const double & q2) const
+        double evaluate_f_t(const double & q2) const
         {
             const double MB2 = MB * MB;
             const double M2_rescaled = this->M2() * this->rescale_factor_T(q2);
@@ -2227,8 +2270,11 @@ namespace eos
     const std::vector<OptionSpecification>
     Implementation<AnalyticFormFactorBToPseudoscalarDKMMO2008<q1_, q2_, qs_>>::options
     {
-        { "rescale-borel",  { "1", "0" },                "1"         },
-        { "decay-constant", { "parameter", "sum-rule" }, "parameter" }
+        { "rescale-borel",    { "1", "0" },                "1"         },
+        { "decay-constant",   { "parameter", "sum-rule" }, "parameter" },
+        { "surrogate",        { "off", "chebyshev" },      "off"       },
+        { "surrogate-q2-min", { },                         "-5.0"      },
+        { "surrogate-q2-max", { },                         "10.0"      }
     };
 
     template <QuarkFlavor q1_, QuarkFlavor q2_, QuarkFlavor qs_>
@@ -25,11 +25,14 @@
 #include <eos/form-factors/analytic-b-to-v-lcsr.hh>
 #include <eos/form-factors/b-lcdas.hh>
 #include <eos/utils/exception.hh>
+#include <eos/maths/chebyshev-surrogate-memoiser.hh>
 #include <eos/maths/integrate-impl.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/models/model.hh>
 #include <eos/utils/options-impl.hh>
+#include <eos/utils/parameter-memoiser.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/qcd.hh>
 #include <eos/utils/stringify.hh>
@@ -96,6 +99,20 @@ namespace eos
         std::function<double (const Implementation *, const double &, const double &)> integrand_t23B_2pt;
         bool switch_borel;
 
+        // the sum rules and their moments for the present parameter point, keyed by q2
+        enum class SumRule
+        {
+            a_1, a_2, a_30, v, t_1, t_23A, t_23B,
+            moment_1_a_1, moment_1_a_2, moment_1_a_30, moment_1_v, moment_1_t_1, moment_1_t_23A, moment_1_t_23B
+        };
+
+        // polynomial approximations of the sum rules and their moments in q2, rebuilt on first use after a parameter change
+        SwitchOption opt_surrogate;
+        bool switch_surrogate;
+        double surrogate_q2_min;
+        double surrogate_q2_max;
+        ChebyshevSurrogateMemoiser<SumRule> surrogates;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -127,10 +144,18 @@ namespace eos
             switch_2pt_g(1.0),
             switch_3pt(1.0),
             opt_method(o, "method", { "borel", "dispersive" }, "borel"),
-            switch_borel(opt_method.value() == "borel")
+            switch_borel(opt_method.value() == "borel"),
+            opt_surrogate(o, "surrogate", { "off", "chebyshev" }, "off"),
+            switch_surrogate(opt_surrogate.value() == "chebyshev"),
+            surrogate_q2_min(destringify<double>(o.get("surrogate-q2-min", "-5.0"))),
+            surrogate_q2_max(destringify<double>(o.get("surrogate-q2-max", "10.0"))),
+            surrogates(p, switch_surrogate, surrogate_q2_min, surrogate_q2_max)
         {
             u.uses(*b_lcdas);
 
+            if (switch_surrogate && (surrogate_q2_min >= surrogate_q2_max))
+                throw InvalidOptionValueError("surrogate-q2-max", o.get("surrogate-q2-max", "10.0"), "values larger than surrogate-q2-min");
+
             switch (Process_::q_v)
             {
                 case 'u':
@@ -222,6 +247,12 @@ namespace eos
 
         ~Implementation() = default;
 
+        // evaluate one of the sum rules only once per parameter point and value of q2
+        double memoised(double (Implementation::* f)(const double &) const, const SumRule & sum_rule, const double & q2) const
+        {
+            return surrogates.memoised([this, f] (const double & q2) { return (this->*f)(q2); }, sum_rule, q2);
+        }
+
         /* quark masses for the propagating quark */
 
         double m_u() const
@@ -3703,7 +3734,7 @@ namespace eos
 
         /* A1 : form factor and moments */
         // {{{
-        double a_1(const double & q2) const
+        double sum_rule_a_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1());
 
@@ -3730,17 +3761,49 @@ namespace eos
                              - surface_A1_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * power_of<3>(m_B()) / (2.0 * f_V() * m_V * (m_B + m_V)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_a_1(const double & q2) const
+        double a_1(const double & q2) const
+        {
+            return f_B() * power_of<3>(m_B()) / (2.0 * f_V() * m_V * (m_B + m_V)) * memoised(&Implementation::sum_rule_a_1, SumRule::a_1, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_a_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A1_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A1_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_A1_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A1_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A1_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_A1_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_a_1(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_A1(), s0_1_A1()) ;
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A1_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_A1_2pt_m1(sigma_0, q2);
@@ -3764,30 +3827,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A1_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A1_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A1_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_a_1, SumRule::a_1, q2) : sum_rule_borel_a_1(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_a_1(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_a_1, SumRule::moment_1_a_1, q2);
+        }
         // }}}
 
         /* A_2 */
@@ -6459,7 +6508,7 @@ namespace eos
 
         /* A2 : form factor and moments */
         // {{{
-        double a_2(const double & q2) const
+        double sum_rule_a_2(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
@@ -6486,17 +6535,49 @@ namespace eos
                              - surface_A2_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * m_B() * (m_B + m_V) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_a_2(const double & q2) const
+        double a_2(const double & q2) const
+        {
+            return f_B() * m_B() * (m_B + m_V) / (2.0 * f_V() * m_V) * memoised(&Implementation::sum_rule_a_2, SumRule::a_2, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_a_2(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A2_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A2_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_A2_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A2_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A2_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A2_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A2_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A2_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_A2_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_a_2(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_A2(), s0_1_A2());
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A2_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_A2_2pt_m1(sigma_0, q2);
@@ -6520,30 +6601,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A2_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A2_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A2_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A2_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A2_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A2_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_a_2, SumRule::a_2, q2) : sum_rule_borel_a_2(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_a_2(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_a_2, SumRule::moment_1_a_2, q2);
+        }
         // }}}
 
         /* A_3 - A_0 */
@@ -9211,7 +9278,7 @@ namespace eos
 
         /* A30 : form factor and moments */
         // {{{
-        double a_30(const double & q2) const
+        double sum_rule_a_30(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
@@ -9238,17 +9305,49 @@ namespace eos
                              - surface_A30_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * q2 * m_B / (4.0 * f_V() * power_of<2>(m_V)) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_a_30(const double & q2) const
+        double a_30(const double & q2) const
+        {
+            return f_B() * q2 * m_B / (4.0 * f_V() * power_of<2>(m_V)) * memoised(&Implementation::sum_rule_a_30, SumRule::a_30, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_a_30(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A30_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A30_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_A30_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_A30_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A30_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A30_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A30_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A30_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_A30_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_a_30(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_A30(), s0_1_A30());
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_A30_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_A30_2pt_m1(sigma_0, q2);
@@ -9272,30 +9371,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_A30_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_A30_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_A30_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_A30_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_A30_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_A30_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_a_30, SumRule::a_30, q2) : sum_rule_borel_a_30(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_a_30(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_a_30, SumRule::moment_1_a_30, q2);
+        }
         // }}}
 
         /* V : 2-particle functions */
@@ -11540,7 +11625,7 @@ namespace eos
 
         /* V : form factor and moments */
         // {{{
-        double v(const double & q2) const
+        double sum_rule_v(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
@@ -11567,17 +11652,49 @@ namespace eos
                              - surface_V_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * power_of<2>(m_B) * (m_B + m_V) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_v(const double & q2) const
+        double v(const double & q2) const
+        {
+            return f_B() * power_of<2>(m_B) * (m_B + m_V) / (2.0 * f_V() * m_V) * memoised(&Implementation::sum_rule_v, SumRule::v, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_v(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_V_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_V_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_V_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_V_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_V_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_V_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_V_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_V_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_V_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_v(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_V(), s0_1_V());
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_V_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_V_2pt_m1(sigma_0, q2);
@@ -11601,30 +11718,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_V_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_V_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_V_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_V_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_V_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_V_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_v, SumRule::v, q2) : sum_rule_borel_v(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_v(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_v, SumRule::moment_1_v, q2);
+        }
         // }}}
 
         /* T_1 : 2-particle functions */
@@ -14189,7 +14292,7 @@ namespace eos
 
         /* T1 : form factor and moments */
         // {{{
-        double t_1(const double & q2) const
+        double sum_rule_t_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1());
 
@@ -14216,17 +14319,49 @@ namespace eos
                              - surface_T1_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_t_1(const double & q2) const
+        double t_1(const double & q2) const
+        {
+            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * memoised(&Implementation::sum_rule_t_1, SumRule::t_1, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_t_1(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T1_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T1_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_T1_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T1_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T1_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_T1_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_t_1(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_T1(), s0_1_T1()) ;
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T1_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_T1_2pt_m1(sigma_0, q2);
@@ -14250,30 +14385,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T1_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T1_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T1_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T1_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T1_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T1_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_t_1, SumRule::t_1, q2) : sum_rule_borel_t_1(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_t_1(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_t_1, SumRule::moment_1_t_1, q2);
+        }
         // }}}
 
         /* T_23A : 2-particle functions */
@@ -17079,7 +17200,7 @@ namespace eos
 
         /* T23A : form factor and moments */
         // {{{
-        double t_23A(const double & q2) const
+        double sum_rule_t_23A(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A());
 
@@ -17106,17 +17227,49 @@ namespace eos
                              - surface_T23A_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_t_23A(const double & q2) const
+        double t_23A(const double & q2) const
+        {
+            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * memoised(&Implementation::sum_rule_t_23A, SumRule::t_23A, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_t_23A(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23A_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23A_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_T23A_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23A_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23A_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23A_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23A_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23A_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_T23A_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_t_23A(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_T23A(), s0_1_T23A()) ;
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23A_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_T23A_2pt_m1(sigma_0, q2);
@@ -17140,30 +17293,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T23A_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23A_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23A_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23A_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23A_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23A_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_t_23A, SumRule::t_23A, q2) : sum_rule_borel_t_23A(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_t_23A(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_t_23A, SumRule::moment_1_t_23A, q2);
+        }
         // }}}
 
         /* T_23B : 2-particle functions */
@@ -20262,7 +20401,7 @@ namespace eos
 
         /* T23B : form factor and moments */
         // {{{
-        double t_23B(const double & q2) const
+        double sum_rule_t_23B(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B());
 
@@ -20289,17 +20428,49 @@ namespace eos
                              - surface_T23B_3pt_D(sigma_0, q2);
             }
 
-            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * (integral_2pt + surface_2pt + integral_3pt + surface_3pt) / ( Process_::chi2);
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
         }
 
-        double normalized_moment_1_t_23B(const double & q2) const
+        double t_23B(const double & q2) const
+        {
+            return f_B() * power_of<2>(m_B()) / (2.0 * f_V() * m_V) * memoised(&Implementation::sum_rule_t_23B, SumRule::t_23B, q2) / ( Process_::chi2);
+        }
+
+        // denominator of the normalized moment, i.e. the Borel-transformed sum rule
+        double sum_rule_borel_t_23B(const double & q2) const
         {
             const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B()) ;
 
-            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23B_2pt_borel_m1, this, std::placeholders::_1, q2);
+            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23B_2pt_borel, this, std::placeholders::_1, q2);
 
+            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
+            const double surface_2pt     = 0.0 - surface_T23B_2pt(sigma_0, q2);
 
-            const std::function<double (const double &)> integrand_2pt    = std::bind(&Implementation::integrand_T23B_2pt_borel, this, std::placeholders::_1, q2);
+            double integral_3pt    = 0.0;
+            double surface_3pt     = 0.0;
+
+            if (switch_3pt != 0.0)
+            {
+                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23B_3pt_B, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23B_3pt_C, this, std::placeholders::_1, sigma_0, q2);
+                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23B_3pt, this, std::placeholders::_1, q2);
+                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23B_3pt_A, this, std::placeholders::_1, sigma_0, q2);
+
+                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
+                surface_3pt     = 0.0
+                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
+                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
+                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
+                                - surface_T23B_3pt_D(sigma_0, q2);
+            }
+            return integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+        }
+
+        double evaluate_normalized_moment_1_t_23B(const double & q2) const
+        {
+            const double sigma_0 = this->sigma_0(q2, s0_0_T23B(), s0_1_T23B()) ;
+
+            const std::function<double (const double &)> integrand_2pt_m1 = std::bind(&Implementation::integrand_T23B_2pt_borel_m1, this, std::placeholders::_1, q2);
 
             const double integral_2pt_m1 = integrate<GSL::QAGS>(integrand_2pt_m1, 0.0, sigma_0);
             const double surface_2pt_m1  = 0.0 - surface_T23B_2pt_m1(sigma_0, q2);
@@ -20323,30 +20494,16 @@ namespace eos
             }
             const double numerator       = integral_2pt_m1 + surface_2pt_m1 + integral_3pt_m1 + surface_3pt_m1;
 
-            const double integral_2pt    = integrate<GSL::QAGS>(integrand_2pt, 0.0, sigma_0);
-            const double surface_2pt     = 0.0 - surface_T23B_2pt(sigma_0, q2);
-
-            double integral_3pt    = 0.0;
-            double surface_3pt     = 0.0;
-
-            if (switch_3pt != 0.0)
-            {
-                const std::function<double (const double &)> surface_3pt_B    = std::bind(&Implementation::surface_T23B_3pt_B, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const double &)> surface_3pt_C    = std::bind(&Implementation::surface_T23B_3pt_C, this, std::placeholders::_1, sigma_0, q2);
-                const std::function<double (const std::array<double, 3> &)> integrand_3pt = std::bind(&Implementation::integrand_T23B_3pt, this, std::placeholders::_1, q2);
-                const std::function<double (const std::array<double, 2> &)> surface_3pt_A = std::bind(&Implementation::surface_T23B_3pt_A, this, std::placeholders::_1, sigma_0, q2);
-
-                integral_3pt    = integrate(integrand_3pt, { 0.0, 0.0, 0.0 }, { sigma_0, 1.0, 1.0 }, cubature::Config());
-                surface_3pt     = 0.0
-                                - integrate(surface_3pt_A, { 0.0, 0.0 }, { 1.0, 1.0 }, cubature::Config()) // integrate over x_1 and x_2
-                                - integrate<GSL::QAGS>(surface_3pt_B, 0.0, 1.0)                            // integrate over x_1
-                                - integrate<GSL::QAGS>(surface_3pt_C, 0.0, 1.0)                            // integrate over x_2
-                                - surface_T23B_3pt_D(sigma_0, q2);
-            }
-            const double denominator     = integral_2pt + surface_2pt + integral_3pt + surface_3pt;
+            // the Borel-transformed sum rule coincides with the form factor's sum rule, which is likely memoised already
+            const double denominator     = switch_borel ? memoised(&Implementation::sum_rule_t_23B, SumRule::t_23B, q2) : sum_rule_borel_t_23B(q2);
 
             return numerator / denominator;
         }
+
+        double normalized_moment_1_t_23B(const double & q2) const
+        {
+            return memoised(&Implementation::evaluate_normalized_moment_1_t_23B, SumRule::moment_1_t_23B, q2);
+        }
         // }}}
 
         /* Diagnostics */
@@ -23124,9 +23281,12 @@ namespace eos
     const std::vector<OptionSpecification>
     Implementation<AnalyticFormFactorBToVLCSR<Process_>>::options
     {
-        { "2pt",    { "tw2+3", "all", "off" }, "all"   },
-        { "3pt",    { "tw3+4", "all", "off" }, "all"   },
-        { "method", { "borel", "dispersive" }, "borel" }
+        { "2pt",              { "tw2+3", "all", "off" }, "all"   },
+        { "3pt",              { "tw3+4", "all", "off" }, "all"   },
+        { "method",           { "borel", "dispersive" }, "borel" },
+        { "surrogate",        { "off", "chebyshev" },    "off"   },
+        { "surrogate-q2-min", { },                       "-5.0"  },
+        { "surrogate-q2-max", { },                       "10.0"  }
     };
 
     template <typename Process_>
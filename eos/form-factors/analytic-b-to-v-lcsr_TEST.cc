@@ -3275,6 +3275,14 @@ class LCSRFormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR( 0.279428, ff->t_3(-5.0),         eps);
                 TEST_CHECK_RELATIVE_ERROR( 0.286126, ff->t_3( 0.0),         eps);
                 TEST_CHECK_RELATIVE_ERROR( 0.150783, ff->t_3(+5.0),         eps);
+
+                // the memoised sum rules follow changes of the parameters
+                const double s0_A1 = p["B_s->D_s^*::s_0^A1,0@B-LCSR"]();
+                p["B_s->D_s^*::s_0^A1,0@B-LCSR"] = s0_A1 + 1.0;
+                TEST_CHECK(std::abs(ff->a_1(0.0) - 0.630581) > 1.0e-2);
+
+                p["B_s->D_s^*::s_0^A1,0@B-LCSR"] = s0_A1;
+                TEST_CHECK_RELATIVE_ERROR( 0.630581, ff->a_1( 0.0),         eps);
             }
         }
 } kmo2006_form_factors_test;
@@ -50,6 +50,37 @@ namespace eos
     {
     }
 
+    FormFactors<OneHalfPlusToOneHalfPlus>::Values
+    FormFactors<OneHalfPlusToOneHalfPlus>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        result.f_time_v  = this->f_time_v(s);
+        result.f_long_v  = this->f_long_v(s);
+        result.f_perp_v  = this->f_perp_v(s);
+        result.f_time_a  = this->f_time_a(s);
+        result.f_long_a  = this->f_long_a(s);
+        result.f_perp_a  = this->f_perp_a(s);
+        result.f_long_t  = this->f_long_t(s);
+        result.f_perp_t  = this->f_perp_t(s);
+        result.f_long_t5 = this->f_long_t5(s);
+        result.f_perp_t5 = this->f_perp_t5(s);
+
+        return result;
+    }
+
+    void
+    FormFactors<OneHalfPlusToOneHalfPlus>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("FormFactors<OneHalfPlusToOneHalfPlus>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            values[i] = this->evaluate_all(s[i]);
+        }
+    }
+
     const std::map<FormFactorFactory<OneHalfPlusToOneHalfPlus>::KeyType, FormFactorFactory<OneHalfPlusToOneHalfPlus>::ValueType>
     FormFactorFactory<OneHalfPlusToOneHalfPlus>::form_factors
     {
@@ -160,6 +191,41 @@ namespace eos
         return { };
     }
 
+    FormFactors<OneHalfPlusToThreeHalfMinus>::Values
+    FormFactors<OneHalfPlusToThreeHalfMinus>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        result.f_time12_v  = this->f_time12_v(s);
+        result.f_long12_v  = this->f_long12_v(s);
+        result.f_perp12_v  = this->f_perp12_v(s);
+        result.f_perp32_v  = this->f_perp32_v(s);
+        result.f_time12_a  = this->f_time12_a(s);
+        result.f_long12_a  = this->f_long12_a(s);
+        result.f_perp12_a  = this->f_perp12_a(s);
+        result.f_perp32_a  = this->f_perp32_a(s);
+        result.f_long12_t  = this->f_long12_t(s);
+        result.f_perp12_t  = this->f_perp12_t(s);
+        result.f_perp32_t  = this->f_perp32_t(s);
+        result.f_long12_t5 = this->f_long12_t5(s);
+        result.f_perp12_t5 = this->f_perp12_t5(s);
+        result.f_perp32_t5 = this->f_perp32_t5(s);
+
+        return result;
+    }
+
+    void
+    FormFactors<OneHalfPlusToThreeHalfMinus>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("FormFactors<OneHalfPlusToThreeHalfMinus>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            values[i] = this->evaluate_all(s[i]);
+        }
+    }
+
     const std::map<FormFactorFactory<OneHalfPlusToThreeHalfMinus>::KeyType, FormFactorFactory<OneHalfPlusToThreeHalfMinus>::ValueType>
     FormFactorFactory<OneHalfPlusToThreeHalfMinus>::form_factors
     {
@@ -28,6 +28,7 @@
 
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace eos
@@ -69,6 +70,26 @@ namespace eos
 
             virtual double f_long_t5(const double & s) const = 0;
             virtual double f_perp_t5(const double & s) const = 0;
+
+            // values of all form factors at one point in q2
+            struct Values
+            {
+                double f_time_v, f_long_v, f_perp_v;
+
+                double f_time_a, f_long_a, f_perp_a;
+
+                double f_long_t, f_perp_t;
+
+                double f_long_t5, f_perp_t5;
+            };
+
+            // evaluate all form factors at once; parametrisations can override this to share
+            // the z variable, pole factors, and further intermediate results
+            virtual Values evaluate_all(const double & s) const;
+
+            // evaluate all form factors at each point of a grid in q2; parametrisations can override
+            // this to read their parameters once, and to evaluate the grid in a vectorisable loop
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <>
@@ -140,6 +161,25 @@ namespace eos
             virtual double f_perp12_t5(const double & s) const = 0;
             virtual double f_perp32_t5(const double & s) const = 0;
 
+            // values of all form factors at one point in q2
+            struct Values
+            {
+                double f_time12_v, f_long12_v, f_perp12_v, f_perp32_v;
+
+                double f_time12_a, f_long12_a, f_perp12_a, f_perp32_a;
+
+                double f_long12_t, f_perp12_t, f_perp32_t;
+
+                double f_long12_t5, f_perp12_t5, f_perp32_t5;
+            };
+
+            // evaluate all form factors at once
+            virtual Values evaluate_all(const double & s) const;
+
+            // evaluate all form factors at each point of a grid in q2; parametrisations can override
+            // this to read their parameters once, and to evaluate the grid in a vectorisable loop
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
             virtual Diagnostics diagnostics() const;
     };
 
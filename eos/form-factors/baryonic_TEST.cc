@@ -22,6 +22,9 @@
 #include <eos/models/model.hh>
 #include <eos/maths/power-of.hh>
 
+#include <array>
+#include <string>
+
 using namespace test;
 using namespace eos;
 
@@ -44,6 +47,49 @@ class OneHalfPlusToOneHalfPlusFormFactorsTest :
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Foo->Bar::DM2015",         parameter, options));
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<OneHalfPlusToOneHalfPlus>::create("Lambda_b->Lambda::FooBar", parameter, options));
             }
+
+            // evaluate_all and evaluate_batch agree with the individual form factors
+            {
+                static const double eps = 1e-8;
+
+                auto parameter = Parameters::Defaults();
+
+                for (const std::string name : { "Lambda_b->Lambda::BFvD2014", "Lambda_b->Lambda::DM2016", "Lambda_b->Lambda::BMRvD2022", "Lambda_b->Lambda_c::DKMR2017" })
+                {
+                    auto ff = FormFactorFactory<OneHalfPlusToOneHalfPlus>::create(name, parameter);
+
+                    const std::array<double, 3> q2 { 0.5, 4.0, 8.0 };
+                    std::array<FormFactors<OneHalfPlusToOneHalfPlus>::Values, 3> values;
+                    ff->evaluate_batch(q2, values);
+
+                    for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                    {
+                        const auto value = ff->evaluate_all(q2[i]);
+
+                        TEST_CHECK_NEARLY_EQUAL(value.f_time_v,  ff->f_time_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long_v,  ff->f_long_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp_v,  ff->f_perp_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_time_a,  ff->f_time_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long_a,  ff->f_long_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp_a,  ff->f_perp_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long_t,  ff->f_long_t(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp_t,  ff->f_perp_t(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long_t5, ff->f_long_t5(q2[i]), eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp_t5, ff->f_perp_t5(q2[i]), eps);
+
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_time_v,  value.f_time_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long_v,  value.f_long_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp_v,  value.f_perp_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_time_a,  value.f_time_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long_a,  value.f_long_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp_a,  value.f_perp_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long_t,  value.f_long_t,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp_t,  value.f_perp_t,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long_t5, value.f_long_t5, eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp_t5, value.f_perp_t5, eps);
+                    }
+                }
+            }
         }
 } one_half_plus_to_one_half_plus_form_factor_test;
 
@@ -88,5 +134,56 @@ class OneHalfPlusToThreeHalfMinusFormFactorsTest :
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<OneHalfPlusToThreeHalfMinus>::create("Foo->Bar::ABR2022",              parameter, options));
                 TEST_CHECK_THROWS(NoSuchFormFactorError, FormFactorFactory<OneHalfPlusToThreeHalfMinus>::create("Lambda_b->Lambda(1520)::FooBar", parameter, options));
             }
+
+            // evaluate_all and evaluate_batch agree with the individual form factors
+            {
+                static const double eps = 1e-8;
+
+                auto parameter = Parameters::Defaults();
+
+                for (const std::string name : { "Lambda_b->Lambda_c(2625)::HQET", "Lambda_b->Lambda(1520)::ABR2022" })
+                {
+                    auto ff = FormFactorFactory<OneHalfPlusToThreeHalfMinus>::create(name, parameter);
+
+                    const std::array<double, 3> q2 { 0.5, 4.0, 8.0 };
+                    std::array<FormFactors<OneHalfPlusToThreeHalfMinus>::Values, 3> values;
+                    ff->evaluate_batch(q2, values);
+
+                    for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                    {
+                        const auto value = ff->evaluate_all(q2[i]);
+
+                        TEST_CHECK_NEARLY_EQUAL(value.f_time12_v,  ff->f_time12_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long12_v,  ff->f_long12_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp12_v,  ff->f_perp12_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp32_v,  ff->f_perp32_v(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_time12_a,  ff->f_time12_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long12_a,  ff->f_long12_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp12_a,  ff->f_perp12_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp32_a,  ff->f_perp32_a(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long12_t,  ff->f_long12_t(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp12_t,  ff->f_perp12_t(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp32_t,  ff->f_perp32_t(q2[i]),  eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_long12_t5, ff->f_long12_t5(q2[i]), eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp12_t5, ff->f_perp12_t5(q2[i]), eps);
+                        TEST_CHECK_NEARLY_EQUAL(value.f_perp32_t5, ff->f_perp32_t5(q2[i]), eps);
+
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_time12_v,  value.f_time12_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_v,  value.f_long12_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_v,  value.f_perp12_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_v,  value.f_perp32_v,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_time12_a,  value.f_time12_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_a,  value.f_long12_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_a,  value.f_perp12_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_a,  value.f_perp32_a,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_t,  value.f_long12_t,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_t,  value.f_perp12_t,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_t,  value.f_perp32_t,  eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_t5, value.f_long12_t5, eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_t5, value.f_perp12_t5, eps);
+                        TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_t5, value.f_perp32_t5, eps);
+                    }
+                }
+            }
         }
 } one_half_plus_to_three_half_minus_form_factor_test;
@@ -74,6 +74,36 @@ namespace eos
         { "B_s->D_s^*::B-LCSR",   &AnalyticFormFactorBToVLCSR<lcsr::BsToDsstar>::make }
     };
 
+    FormFactors<PToV>::Values
+    FormFactors<PToV>::evaluate_all(const double & q2) const
+    {
+        Values result;
+
+        result.v    = this->v(q2);
+        result.a_0  = this->a_0(q2);
+        result.a_1  = this->a_1(q2);
+        result.a_2  = this->a_2(q2);
+        result.a_12 = this->a_12(q2);
+        result.t_1  = this->t_1(q2);
+        result.t_2  = this->t_2(q2);
+        result.t_3  = this->t_3(q2);
+        result.t_23 = this->t_23(q2);
+
+        return result;
+    }
+
+    void
+    FormFactors<PToV>::evaluate_batch(const std::span<const double> & q2, const std::span<Values> & values) const
+    {
+        if (q2.size() != values.size())
+            throw InternalError("FormFactors<PToV>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            values[i] = this->evaluate_all(q2[i]);
+        }
+    }
+
     complex<double>
     FormFactors<PToV>::v(const complex<double> &) const
     {
@@ -297,6 +327,42 @@ namespace eos
         return derivative<2u, deriv::TwoSided>(f, s);
     }
 
+    FormFactors<PToP>::Values
+    FormFactors<PToP>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        result.f_p = this->f_p(s);
+        result.f_0 = this->f_0(s);
+        result.f_t = this->f_t(s);
+
+        return result;
+    }
+
+    void
+    FormFactors<PToP>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("FormFactors<PToP>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            values[i] = this->evaluate_all(s[i]);
+        }
+    }
+
+    bool
+    FormFactors<PToP>::differentiable() const
+    {
+        return false;
+    }
+
+    FormFactors<PToP>::DualValues
+    FormFactors<PToP>::evaluate_with_gradient(const double &, const DualParameters &) const
+    {
+        throw InternalError("FormFactors<PToP>::evaluate_with_gradient: not implemented for this parametrisation");
+    }
+
     const std::map<FormFactorFactory<PToP>::KeyType, FormFactorFactory<PToP>::ValueType>
     FormFactorFactory<PToP>::form_factors
     {
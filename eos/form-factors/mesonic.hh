@@ -26,12 +26,14 @@
 
 #include <eos/form-factors/form-factors-fwd.hh>
 #include <eos/maths/complex.hh>
+#include <eos/utils/dual-parameters.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/qualified-name.hh>
 
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 
 namespace eos
@@ -85,6 +87,24 @@ namespace eos
             virtual double f_para_T(const double & q2) const = 0;
             virtual double f_long_T(const double & q2) const = 0;
 
+            // values of all form factors at one point in q2
+            struct Values
+            {
+                double v;
+
+                double a_0, a_1, a_2, a_12;
+
+                double t_1, t_2, t_3, t_23;
+            };
+
+            // evaluate all form factors at once; parametrisations can override this to share
+            // the z variable, pole and Blaschke factors, and further intermediate results
+            virtual Values evaluate_all(const double & q2) const;
+
+            // evaluate all form factors at each point of a grid in q2; parametrisations can override
+            // this to read their parameters once, and to evaluate the grid in a vectorisable loop
+            virtual void evaluate_batch(const std::span<const double> & q2, const std::span<Values> & values) const;
+
             // for access in the complex q2 plane
             virtual complex<double> v(const complex<double> & q2) const;
 
@@ -199,6 +219,32 @@ namespace eos
             virtual double f_p_d1(const double & s) const;
             virtual double f_p_d2(const double & s) const;
 
+            // values of all form factors at one point in q2
+            struct Values
+            {
+                double f_p, f_0, f_t;
+            };
+
+            // evaluate all form factors at once; parametrisations can override this to share
+            // the z variable, pole and Blaschke factors, and further intermediate results
+            virtual Values evaluate_all(const double & s) const;
+
+            // evaluate all form factors at each point of a grid in q2; parametrisations can override
+            // this to read their parameters once, and to evaluate the grid in a vectorisable loop
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
+            // values and gradients of all form factors at one point in q2
+            struct DualValues
+            {
+                Dual f_p, f_0, f_t;
+            };
+
+            // whether the parametrisation implements evaluate_with_gradient()
+            virtual bool differentiable() const;
+
+            // evaluate all form factors at once, alongside their gradients with respect to the independent parameters
+            virtual DualValues evaluate_with_gradient(const double & s, const DualParameters & parameters) const;
+
             // for access in the complex q2 plane
             virtual complex<double> f_p(const complex<double> & q2) const;
             virtual complex<double> f_0(const complex<double> & q2) const;
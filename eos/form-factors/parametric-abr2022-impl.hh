@@ -23,6 +23,7 @@
 #include <eos/form-factors/parametric-abr2022.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/diagnostics.hh>
+#include <eos/utils/exception.hh>
 
 #include <numeric>
 
@@ -682,6 +683,88 @@ namespace eos
     }
 
 
+    template <typename Process_>
+    typename ABR2022FormFactors<Process_>::Values
+    ABR2022FormFactors<Process_>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    ABR2022FormFactors<Process_>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("ABR2022FormFactors::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        // the coefficients, including those fixed by the end-point relations, are independent of s
+        // and are therefore computed only once
+        const auto coefficients = [] (const double & a_0, const std::array<UsedParameter, 4> & a)
+        {
+            std::array<double, 5> result;
+            result[0] = a_0;
+            std::copy(a.begin(), a.end(), result.begin() + 1);
+
+            return result;
+        };
+
+        const std::array<double, 5> c_time12_v  = coefficients(_a_time12_v_0(),  _a_time12_v);
+        const std::array<double, 5> c_long12_v  = coefficients(_a_long12_v_0(),  _a_long12_v);
+        const std::array<double, 5> c_perp12_v  = coefficients(_a_perp12_v_0(),  _a_perp12_v);
+        const std::array<double, 5> c_perp32_v  { _a_perp32_v[0], _a_perp32_v[1], _a_perp32_v[2], _a_perp32_v[3], _a_perp32_v[4] };
+        const std::array<double, 5> c_time12_a  = coefficients(_a_time12_a_0(),  _a_time12_a);
+        const std::array<double, 5> c_long12_a  = coefficients(_a_long12_a_0(),  _a_long12_a);
+        const std::array<double, 5> c_perp12_a  = coefficients(_a_perp12_a_0(),  _a_perp12_a);
+        const std::array<double, 5> c_perp32_a  { _a_perp32_a[0], _a_perp32_a[1], _a_perp32_a[2], _a_perp32_a[3], _a_perp32_a[4] };
+        const std::array<double, 5> c_long12_t  = coefficients(_a_long12_t_0(),  _a_long12_t);
+        const std::array<double, 5> c_perp12_t  = coefficients(_a_perp12_t_0(),  _a_perp12_t);
+        const std::array<double, 5> c_perp32_t  { _a_perp32_t[0], _a_perp32_t[1], _a_perp32_t[2], _a_perp32_t[3], _a_perp32_t[4] };
+        const std::array<double, 5> c_long12_t5 = coefficients(_a_long12_t5_0(), _a_long12_t5);
+        const std::array<double, 5> c_perp12_t5 = coefficients(_a_perp12_t5_0(), _a_perp12_t5);
+        const std::array<double, 5> c_perp32_t5 = coefficients(_a_perp32_t5_0(), _a_perp32_t5);
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            const double q2 = s[i];
+
+            // the orthonormal polynomials and the Blaschke factors are shared among the form factors
+            const auto   polynomials = Process_::orthonormal_polynomials(_z(q2, _t_0));
+            const auto   series      = [&polynomials] (const std::array<double, 5> & c)
+            {
+                return std::inner_product(c.begin(), c.end(), polynomials.begin(), 0.0);
+            };
+
+            const double blaschke_0p = _z(q2, Process_::mR2_0p);
+            const double blaschke_1m = _z(q2, Process_::mR2_1m);
+            const double blaschke_0m = _z(q2, Process_::mR2_0m);
+            const double blaschke_1p = _z(q2, Process_::mR2_1p);
+
+            Values & result = values[i];
+
+            result.f_time12_v  = series(c_time12_v)  / _phi_time12_v(q2)  / blaschke_0p;
+            result.f_long12_v  = series(c_long12_v)  / _phi_long12_v(q2)  / blaschke_1m;
+            result.f_perp12_v  = series(c_perp12_v)  / _phi_perp12_v(q2)  / blaschke_1m;
+            result.f_perp32_v  = series(c_perp32_v)  / _phi_perp32_v(q2)  / blaschke_1m;
+
+            result.f_time12_a  = series(c_time12_a)  / _phi_time12_a(q2)  / blaschke_0m;
+            result.f_long12_a  = series(c_long12_a)  / _phi_long12_a(q2)  / blaschke_1p;
+            result.f_perp12_a  = series(c_perp12_a)  / _phi_perp12_a(q2)  / blaschke_1p;
+            result.f_perp32_a  = series(c_perp32_a)  / _phi_perp32_a(q2)  / blaschke_1p;
+
+            result.f_long12_t  = series(c_long12_t)  / _phi_long12_t(q2)  / blaschke_1m;
+            result.f_perp12_t  = series(c_perp12_t)  / _phi_perp12_t(q2)  / blaschke_1m;
+            result.f_perp32_t  = series(c_perp32_t)  / _phi_perp32_t(q2)  / blaschke_1m;
+
+            result.f_long12_t5 = series(c_long12_t5) / _phi_long12_t5(q2) / blaschke_1p;
+            result.f_perp12_t5 = series(c_perp12_t5) / _phi_perp12_t5(q2) / blaschke_1p;
+            result.f_perp32_t5 = series(c_perp32_t5) / _phi_perp32_t5(q2) / blaschke_1p;
+        }
+    }
+
     template <typename Process_>
     double
     ABR2022FormFactors<Process_>::saturation_0p_v() const
@@ -109,6 +109,10 @@ namespace eos
             virtual double f_perp12_t5(const double & s) const;
             virtual double f_perp32_t5(const double & s) const;
 
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
             double saturation_0p_v() const;
             double saturation_1m_v() const;
             double saturation_0m_a() const;
@@ -160,6 +160,28 @@ class ABR2022FormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL( ff.saturation_1p_a(),  0.0564762 , eps);
                 TEST_CHECK_NEARLY_EQUAL( ff.saturation_1m_t(),  0.0588784 , eps);
                 TEST_CHECK_NEARLY_EQUAL( ff.saturation_1p_t5(), 0.150838  , eps);
+
+                const std::array<double, 3> q2 { 1.0, 4.0, 8.0 };
+                std::array<FormFactors<OneHalfPlusToThreeHalfMinus>::Values, 3> values;
+                ff.evaluate_batch(q2, values);
+
+                for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_time12_v,  ff.f_time12_v(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_v,  ff.f_long12_v(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_v,  ff.f_perp12_v(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_v,  ff.f_perp32_v(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_time12_a,  ff.f_time12_a(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_a,  ff.f_long12_a(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_a,  ff.f_perp12_a(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_a,  ff.f_perp32_a(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_t,  ff.f_long12_t(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_t,  ff.f_perp12_t(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_t,  ff.f_perp32_t(q2[i]),  1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_long12_t5, ff.f_long12_t5(q2[i]), 1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp12_t5, ff.f_perp12_t5(q2[i]), 1e-10);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_perp32_t5, ff.f_perp32_t5(q2[i]), 1e-10);
+                }
             }
         }
 } abr2022_form_factor_test;
@@ -23,8 +23,57 @@
 #include <eos/form-factors/parametric-bcl2008.hh>
 #include <eos/utils/exception.hh>
 
+#include <limits>
+
 namespace eos
 {
+    namespace bcl2008
+    {
+        // zbar^k = z^k - z(0)^k for k = 1, ..., K
+        template <unsigned K_>
+        inline std::array<double, K_> zbar(const double & z, const double & z0)
+        {
+            std::array<double, K_> result;
+            double zk = 1.0, z0k = 1.0;
+            for (unsigned k = 0 ; k < K_ ; ++k)
+            {
+                zk *= z;
+                z0k *= z0;
+                result[k] = zk - z0k;
+            }
+
+            return result;
+        }
+
+        // f(0) [1 + sum_{k=1}^{K-1} b_k (zbar^k - (-1)^(k-K) k/K zbar^K)] for c = (f(0), b_1, ..., b_{K-1}),
+        // where b_K has been eliminated by means of [BCL2008], eq. (14)
+        template <unsigned K_>
+        inline double constrained_series(const std::array<double, K_> & zbar, const std::array<double, K_> & c)
+        {
+            double result = 1.0;
+            for (unsigned k = 1 ; k < K_ ; ++k)
+            {
+                const double sign = ((K_ - k) % 2 == 0) ? +1.0 : -1.0;
+                result += c[k] * (zbar[k - 1] - sign * k / K_ * zbar[K_ - 1]);
+            }
+
+            return c[0] * result;
+        }
+
+        // f(0) [1 + sum_{k=1}^{K} b_k zbar^k] for c = (f(0), b_1, ..., b_K)
+        template <unsigned K_>
+        inline double series(const std::array<double, K_> & zbar, const std::array<double, K_ + 1> & c)
+        {
+            double result = 1.0;
+            for (unsigned k = 1 ; k <= K_ ; ++k)
+            {
+                result += c[k] * zbar[k - 1];
+            }
+
+            return c[0] * result;
+        }
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 3u, false>::_z(const double & s) const
@@ -92,6 +141,53 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 3u, false>::_evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 3u> & c_t) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BCL2008FormFactors::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        static const double z0 = _z(0.0);
+
+        // read all parameters once; the loop over s below only involves plain doubles
+        const std::array<double, 3u> c_p{ _f_plus_0(), _b_plus_1(), _b_plus_2() };
+        // note that f_0(0) = f_+(0)!
+        const std::array<double, 4u> c_0{ _f_plus_0(), _b_zero_1(), _b_zero_2(), _b_zero_3() };
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            // the powers of z are shared among the form factors
+            const auto zbar = bcl2008::zbar<3u>(_z(s[i]), z0);
+
+            values[i].f_p = bcl2008::constrained_series<3u>(zbar, c_p) / (1.0 - s[i] / Process_::mR2_1m);
+            values[i].f_0 = bcl2008::series<3u>(zbar, c_0)             / (1.0 - s[i] / Process_::mR2_0p);
+            values[i].f_t = bcl2008::constrained_series<3u>(zbar, c_t) / (1.0 - s[i] / Process_::mR2_1m);
+        }
+    }
+
+    template <typename Process_>
+    typename BCL2008FormFactorBase<Process_, 3u, false>::Values
+    BCL2008FormFactorBase<Process_, 3u, false>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 3u, false>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        // this form factor parametrization has no inputs for tensor form factors
+        std::array<double, 3u> c_t;
+        c_t.fill(std::numeric_limits<double>::quiet_NaN());
+
+        _evaluate_batch(s, values, c_t);
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 4u, false>::_z(const double & s) const
@@ -161,6 +257,53 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 4u, false>::_evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 4u> & c_t) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BCL2008FormFactors::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        static const double z0 = _z(0.0);
+
+        // read all parameters once; the loop over s below only involves plain doubles
+        const std::array<double, 4u> c_p{ _f_plus_0(), _b_plus_1(), _b_plus_2(), _b_plus_3() };
+        // note that f_0(0) = f_+(0)!
+        const std::array<double, 5u> c_0{ _f_plus_0(), _b_zero_1(), _b_zero_2(), _b_zero_3(), _b_zero_4() };
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            // the powers of z are shared among the form factors
+            const auto zbar = bcl2008::zbar<4u>(_z(s[i]), z0);
+
+            values[i].f_p = bcl2008::constrained_series<4u>(zbar, c_p) / (1.0 - s[i] / Process_::mR2_1m);
+            values[i].f_0 = bcl2008::series<4u>(zbar, c_0)             / (1.0 - s[i] / Process_::mR2_0p);
+            values[i].f_t = bcl2008::constrained_series<4u>(zbar, c_t) / (1.0 - s[i] / Process_::mR2_1m);
+        }
+    }
+
+    template <typename Process_>
+    typename BCL2008FormFactorBase<Process_, 4u, false>::Values
+    BCL2008FormFactorBase<Process_, 4u, false>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 4u, false>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        // this form factor parametrization has no inputs for tensor form factors
+        std::array<double, 4u> c_t;
+        c_t.fill(std::numeric_limits<double>::quiet_NaN());
+
+        _evaluate_batch(s, values, c_t);
+    }
+
     template <typename Process_>
     double
     BCL2008FormFactorBase<Process_, 5u, false>::_z(const double & s) const
@@ -233,6 +376,53 @@ namespace eos
         return 0.0;
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 5u, false>::_evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 5u> & c_t) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BCL2008FormFactors::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        static const double z0 = _z(0.0);
+
+        // read all parameters once; the loop over s below only involves plain doubles
+        const std::array<double, 5u> c_p{ _f_plus_0(), _b_plus_1(), _b_plus_2(), _b_plus_3(), _b_plus_4() };
+        // note that f_0(0) = f_+(0)!
+        const std::array<double, 6u> c_0{ _f_plus_0(), _b_zero_1(), _b_zero_2(), _b_zero_3(), _b_zero_4(), _b_zero_5() };
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            // the powers of z are shared among the form factors
+            const auto zbar = bcl2008::zbar<5u>(_z(s[i]), z0);
+
+            values[i].f_p = bcl2008::constrained_series<5u>(zbar, c_p) / (1.0 - s[i] / Process_::mR2_1m);
+            values[i].f_0 = bcl2008::series<5u>(zbar, c_0)             / (1.0 - s[i] / Process_::mR2_0p);
+            values[i].f_t = bcl2008::constrained_series<5u>(zbar, c_t) / (1.0 - s[i] / Process_::mR2_1m);
+        }
+    }
+
+    template <typename Process_>
+    typename BCL2008FormFactorBase<Process_, 5u, false>::Values
+    BCL2008FormFactorBase<Process_, 5u, false>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 5u, false>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        // this form factor parametrization has no inputs for tensor form factors
+        std::array<double, 5u> c_t;
+        c_t.fill(std::numeric_limits<double>::quiet_NaN());
+
+        _evaluate_batch(s, values, c_t);
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 3u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 3u, false>(p, o),
@@ -253,6 +443,13 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z3bar / 3.0) + _b_t_2 * (z2bar + 2.0 * z3bar / 3.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 3u, true>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        this->_evaluate_batch(s, values, { _f_t_0(), _b_t_1(), _b_t_2() });
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 4u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 4u, false>(p, o),
@@ -275,6 +472,13 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar + z4bar / 4.0) + _b_t_2 * (z2bar - z4bar / 2.0) + _b_t_3 * (z3bar + 3.0 * z4bar / 4.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 4u, true>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        this->_evaluate_batch(s, values, { _f_t_0(), _b_t_1(), _b_t_2(), _b_t_3() });
+    }
+
     template <typename Process_>
     BCL2008FormFactorBase<Process_, 5u, true>::BCL2008FormFactorBase(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, 5u, false>(p, o),
@@ -298,6 +502,13 @@ namespace eos
         return _f_t_0 / (1.0 - s / Process_::mR2_1m) * (1.0 + _b_t_1 * (zbar - z5bar / 5.0) + _b_t_2 * (z2bar + 2.0 * z5bar / 5.0) + _b_t_3 * (z3bar - 3.0 * z5bar / 5.0) + _b_t_4 * (z4bar + 4.0 * z5bar / 5.0));
     }
 
+    template <typename Process_>
+    void
+    BCL2008FormFactorBase<Process_, 5u, true>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        this->_evaluate_batch(s, values, { _f_t_0(), _b_t_1(), _b_t_2(), _b_t_3(), _b_t_4() });
+    }
+
     template <typename Process_, unsigned K_>
     BCL2008FormFactors<Process_, K_>::BCL2008FormFactors(const Parameters & p, const Options & o) :
         BCL2008FormFactorBase<Process_, K_, Process_::uses_tensor_form_factors>(p, o)
@@ -25,6 +25,9 @@
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/options.hh>
 
+#include <array>
+#include <span>
+
 namespace eos
 {
     /* Form Factors according to [BCL2008] */
@@ -50,8 +53,14 @@ namespace eos
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3;
 
         protected:
+            using Values = typename FormFactors<typename Process_::Transition>::Values;
+
             double _z(const double & s) const;
 
+            // f_+, f_0 and f_T at each point in s; the coefficients c_t = (f_T(0), b_T^1, ..., b_T^2)
+            // are provided by the variants with tensor form factors
+            void _evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 3u> & c_t) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -62,6 +71,10 @@ namespace eos
             virtual double f_t(const double &) const;
 
             virtual double f_plus_T(const double &) const;
+
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 4u, false> :
@@ -78,8 +91,14 @@ namespace eos
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4;
 
         protected:
+            using Values = typename FormFactors<typename Process_::Transition>::Values;
+
             double _z(const double & s) const;
 
+            // f_+, f_0 and f_T at each point in s; the coefficients c_t = (f_T(0), b_T^1, ..., b_T^3)
+            // are provided by the variants with tensor form factors
+            void _evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 4u> & c_t) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -90,6 +109,10 @@ namespace eos
             virtual double f_t(const double &) const;
 
             virtual double f_plus_T(const double &) const;
+
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 5u, false> :
@@ -106,8 +129,14 @@ namespace eos
             UsedParameter            _b_zero_1, _b_zero_2, _b_zero_3, _b_zero_4, _b_zero_5;
 
         protected:
+            using Values = typename FormFactors<typename Process_::Transition>::Values;
+
             double _z(const double & s) const;
 
+            // f_+, f_0 and f_T at each point in s; the coefficients c_t = (f_T(0), b_T^1, ..., b_T^4)
+            // are provided by the variants with tensor form factors
+            void _evaluate_batch(const std::span<const double> & s, const std::span<Values> & values, const std::array<double, 5u> & c_t) const;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options &);
 
@@ -118,6 +147,10 @@ namespace eos
             virtual double f_t(const double &) const;
 
             virtual double f_plus_T(const double &) const;
+
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 3u, true> :
@@ -134,10 +167,15 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2;
 
+        protected:
+            using typename BCL2008FormFactorBase<Process_, 3u, false>::Values;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
             virtual double f_t(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 4u, true> :
@@ -154,10 +192,15 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3;
 
+        protected:
+            using typename BCL2008FormFactorBase<Process_, 4u, false>::Values;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
             virtual double f_t(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     template <typename Process_> class BCL2008FormFactorBase<Process_, 5u, true> :
@@ -174,10 +217,15 @@ namespace eos
              */
             UsedParameter _f_t_0,    _b_t_1,    _b_t_2,    _b_t_3,    _b_t_4;
 
+        protected:
+            using typename BCL2008FormFactorBase<Process_, 5u, false>::Values;
+
         public:
             BCL2008FormFactorBase(const Parameters & p, const Options & o);
 
             virtual double f_t(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
 
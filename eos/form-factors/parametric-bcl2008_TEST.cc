@@ -458,3 +458,37 @@ class BCL2008K5FormFactorsTest :
             }
         }
 } bcl2008_k5_form_factors_k5_test;
+
+class BCL2008EvaluateBatchTest :
+    public TestCase
+{
+    public:
+        BCL2008EvaluateBatchTest() :
+            TestCase("bcl2008_evaluate_batch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-10;
+
+            Parameters p = Parameters::Defaults();
+
+            const std::vector<double> q2 { 0.0, 5.0, 10.0, 15.0, 20.0, 25.0 };
+            std::vector<FormFactors<PToP>::Values> values(q2.size());
+
+            for (const auto & name : { "B->pi::BCL2008", "B->pi::BCL2008-4", "B->pi::BCL2008-5" })
+            {
+                std::shared_ptr<FormFactors<PToP>> ff = FormFactorFactory<PToP>::create(name, p, Options{ });
+
+                ff->evaluate_batch(q2, values);
+
+                for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_p, ff->f_p(q2[i]), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_0, ff->f_0(q2[i]), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_t, ff->f_t(q2[i]), eps);
+                }
+            }
+        }
+} bcl2008_evaluate_batch_test;
@@ -178,6 +178,53 @@ namespace eos
         return result * xi;
     }
 
+    template <typename Process_>
+    std::array<double, 3>
+    HQETFormFactors<Process_, PToP>::_h_all(const double & q2) const
+    {
+        const double m_b_pole = _m_b_pole();
+        const double m_c_pole = _m_c_pole();
+
+        const double w = this->_w(q2);
+        const double z = m_c_pole / m_b_pole;
+
+        const double as = _alpha_s() / M_PI;
+
+        const double xi  = _xi(q2);
+        const double eta = _eta(q2);
+        const double chi2 = _chi2(q2);
+        const double chi3 = _chi3(q2);
+
+        const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
+        const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+
+        // chi_1 is absorbed into def. of xi for LP and LV
+        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+        const double L4 = 2.0 * eta - 1.0;
+
+        const double l1 = _l1(w), l4 = _l4(w);
+
+        const double CV1 = _CV1(w, z), CV2 = _CV2(w, z), CV3 = _CV3(w, z);
+        const double CT1 = _CT1(w, z), CT2 = _CT2(w, z), CT3 = _CT3(w, z);
+
+        double h_p = 1.0 + as * (CV1 + (w + 1.0) / 2.0 * (CV2 + CV3));
+        h_p += eps_c * (L1);
+        h_p += eps_b * (L1);
+        h_p += eps_c * eps_c * l1;
+
+        double h_m = (0.0 + as * (w + 1.0) / 2.0 * (CV2 - CV3));
+        h_m += eps_c * L4;
+        h_m -= eps_b * L4;
+        h_m += eps_c * eps_c * l4;
+
+        double h_T = 1.0 + as * (CT1 - CT2 + CT3);
+        h_T += eps_c * (L1 - L4);
+        h_T += eps_b * (L1 - L4);
+        h_T += eps_c * eps_c * (l1 - l4);
+
+        return std::array<double, 3>{{ h_p * xi, h_m * xi, h_T * xi }};
+    }
+
 
     template <typename Process_>
     HQETFormFactors<Process_, PToP>::HQETFormFactors(const Parameters & p, const Options & o) :
@@ -242,6 +289,30 @@ namespace eos
         return f_t(q2) * q2 / _m_B / (_m_B + _m_P);
     }
 
+    template <typename Process_>
+    FormFactors<PToP>::Values
+    HQETFormFactors<Process_, PToP>::evaluate_all(const double & q2) const
+    {
+        const double m_B = _m_B(), m_P = _m_P();
+        const double r = m_P / m_B;
+
+        const auto [h_p, h_m, h_T] = _h_all(q2);
+
+        // cf. [FKKM2008], eq. (22)
+        const double f_p = 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * h_p - (1.0 - r) * h_m);
+        const double f_m = 1.0 / (2.0 * sqrt(r)) * ((1.0 + r) * h_m - (1.0 - r) * h_p);
+
+        Values result;
+
+        result.f_p = f_p;
+        // We do not use the relation between f_0 and the (scale-dependent) h_S.
+        result.f_0 = f_p + q2 / (m_B * m_B - m_P * m_P) * f_m;
+        // cf. [BJvD2019], eq. (A7)
+        result.f_t = (1.0 + r) / (2.0 * sqrt(r)) * h_T;
+
+        return result;
+    }
+
     template <typename Process_>
     Diagnostics
     HQETFormFactors<Process_, PToP>::diagnostics() const
@@ -642,6 +713,84 @@ namespace eos
         return result * xi;
     }
 
+    template <typename Process_>
+    typename HQETFormFactors<Process_, PToV>::HValues
+    HQETFormFactors<Process_, PToV>::_h_all(const double & q2) const
+    {
+        const double m_b_pole = _m_b_pole();
+        const double m_c_pole = _m_c_pole();
+
+        const double w = this->_w(q2);
+        const double z = m_c_pole / m_b_pole;
+
+        const double as = _alpha_s() / M_PI;
+
+        const double xi  = _xi(q2);
+        const double eta = _eta(q2);
+        const double chi2 = _chi2(q2);
+        const double chi3 = _chi3(q2);
+
+        const double eps_b = _LambdaBar() / (2.0 * m_b_pole);
+        const double eps_c = _LambdaBar() / (2.0 * m_c_pole);
+
+        // chi_1 is absorbed into def. of xi for LP and LV
+        const double L1 = -4.0 * (w - 1.0) * chi2 + 12.0 * chi3;
+        const double L2 = -4.0 * chi3;
+        const double L3 = 4.0 * chi2;
+        const double L4 = 2.0 * eta - 1.0;
+        const double L5 = -1.0;
+        const double L6 = -2.0 * (1.0 + eta) / (w + 1.0);
+
+        const double l2 = _l2(w), l3 = _l3(w), l5 = _l5(w), l6 = _l6(w);
+
+        const double CA1 = _CA1(w, z), CA2 = _CA2(w, z), CA3 = _CA3(w, z), CV1 = _CV1(w, z);
+        const double CT1 = _CT1(w, z), CT2 = _CT2(w, z), CT3 = _CT3(w, z);
+
+        HValues result;
+
+        result.h_a1  = (1.0 + as * CA1);
+        result.h_a1 += eps_c * (L2 - L5 * (w - 1.0) / (w + 1.0));
+        result.h_a1 += eps_b * (L1 - L4 * (w - 1.0) / (w + 1.0));
+        result.h_a1 += eps_c * eps_c * (l2 - (w - 1.0) / (w + 1.0) * l5);
+        result.h_a1 *= xi;
+
+        result.h_a2  = (0.0 + as * CA2);
+        result.h_a2 += eps_c * (L3 + L6);
+        result.h_a2 += eps_c * eps_c * (l3 + l6);
+        result.h_a2 *= xi;
+
+        result.h_a3  = (1.0 + as * (CA1 + CA3));
+        result.h_a3 += eps_c * (L2 - L3 + L6 - L5);
+        result.h_a3 += eps_b * (L1 - L4);
+        result.h_a3 += eps_c * eps_c * (l2 - l3 + l6 - l5);
+        result.h_a3 *= xi;
+
+        result.h_v  = (1.0 + as * CV1);
+        result.h_v += eps_c * (L2 - L5);
+        result.h_v += eps_b * (L1 - L4);
+        result.h_v += eps_c * eps_c * (l2 - l5);
+        result.h_v *= xi;
+
+        result.h_t1  = (1.0 + as * (CT1 + (w - 1.0) / 2.0 * (CT2 - CT3)));
+        result.h_t1 += eps_c * L2;
+        result.h_t1 += eps_b * L1;
+        result.h_t1 += eps_c * eps_c * l2;
+        result.h_t1 *= xi;
+
+        result.h_t2  = (0.0 + as * (w + 1.0) / 2.0 * (CT2 + CT3));
+        result.h_t2 += eps_c * L5;
+        result.h_t2 -= eps_b * L4;
+        result.h_t2 += eps_c * eps_c * l5;
+        result.h_t2 *= xi;
+
+        result.h_t3  = (0.0 + as * CT2);
+        result.h_t3 += eps_c * (L6 - L3);
+        result.h_t3 += eps_c * eps_c * (l6 - l3);
+        result.h_t3 *= xi;
+
+        return result;
+    }
+
     template <typename Process_>
     HQETFormFactors<Process_, PToV>::HQETFormFactors(const Parameters & p, const Options & o) :
         HQETFormFactorBase(p, o, Process_::hqe_prefix),
@@ -782,6 +931,36 @@ namespace eos
         return ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - q2) * t_2(q2) - lambda * t_3(q2)) / (8.0 * m_B * m_V2 * (m_B - m_V));
     }
 
+    template <typename Process_>
+    FormFactors<PToV>::Values
+    HQETFormFactors<Process_, PToV>::evaluate_all(const double & q2) const
+    {
+        const double m_B = this->_m_B(), m_B2 = power_of<2>(m_B);
+        const double m_V = this->_m_V(), m_V2 = power_of<2>(m_V);
+        const double lambda = eos::lambda(m_B2, m_V2, q2);
+
+        const double r = m_V / m_B, sqrt_r = sqrt(r);
+        const double w = _w(q2);
+
+        const HValues h = _h_all(q2);
+
+        Values result;
+
+        // cf. [FKKM2008], eq. (22)
+        result.v    = (1.0 + r) / 2.0 / sqrt_r * h.h_v;
+        result.a_0  = 1.0 / (2.0 * sqrt_r) * ((1.0 + w) * h.h_a1 + (r * w - 1.0) * h.h_a2 + (r - w) * h.h_a3);
+        result.a_1  = sqrt_r * (1.0 + w) / (1.0 + r) * h.h_a1;
+        result.a_2  = (1.0 + r) / (2.0 * sqrt_r) * (r * h.h_a2 + h.h_a3);
+        result.a_12 = ((m_B + m_V) * (m_B + m_V) * (m_B2 - m_V2 - q2) * result.a_1 - lambda * result.a_2) / (16.0 * m_B * m_V2 * (m_B + m_V));
+
+        result.t_1  = -1.0 / (2.0 * sqrt_r) * ((1.0 - r) * h.h_t2 - (1.0 + r) * h.h_t1);
+        result.t_2  = +1.0 / (2.0 * sqrt_r) * (2.0 * r * (w + 1.0) / (1.0 + r) * h.h_t1 - 2.0 * r * (w - 1.0) / (1.0 - r) * h.h_t2);
+        result.t_3  = +1.0 / (2.0 * sqrt_r) * ((1.0 - r) * h.h_t1 - (1.0 + r) * h.h_t2 + (1.0 - r * r) * h.h_t3);
+        result.t_23 = ((m_B2 - m_V2) * (m_B2 + 3.0 * m_V2 - q2) * result.t_2 - lambda * result.t_3) / (8.0 * m_B * m_V2 * (m_B - m_V));
+
+        return result;
+    }
+
     template <typename Process_>
     double
     HQETFormFactors<Process_, PToV>::f_perp(const double &) const
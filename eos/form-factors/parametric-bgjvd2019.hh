@@ -32,6 +32,7 @@
 #include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
 
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -250,6 +251,9 @@ namespace eos
             double _h_S(const double & q2) const;
             double _h_T(const double & q2) const;
 
+            /* the HQET form factors h_+, h_- and h_T at once, sharing the IW functions and Wilson coefficients */
+            std::array<double, 3> _h_all(const double & q2) const;
+
         public:
             HQETFormFactors(const Parameters & p, const Options & o);
             ~HQETFormFactors();
@@ -262,6 +266,8 @@ namespace eos
             virtual double f_plus_T(const double & q2) const override;
             double f_m(const double & q2) const;
 
+            virtual Values evaluate_all(const double & q2) const override;
+
             /* HQET form factors h_i */
             inline double h_p(const double & q2) const { return _h_p(q2); };
             inline double h_m(const double & q2) const { return _h_m(q2); };
@@ -307,6 +313,13 @@ namespace eos
             double _h_t2(const double & q2) const;
             double _h_t3(const double & q2) const;
 
+            /* all HQET form factors h_i at once, sharing the IW functions and Wilson coefficients */
+            struct HValues
+            {
+                double h_a1, h_a2, h_a3, h_v, h_t1, h_t2, h_t3;
+            };
+            HValues _h_all(const double & q2) const;
+
         public:
             HQETFormFactors(const Parameters & p, const Options & o);
             ~HQETFormFactors();
@@ -323,6 +336,8 @@ namespace eos
             virtual double t_3(const double & q2) const override;
             virtual double t_23(const double & q2) const override;
 
+            virtual Values evaluate_all(const double & q2) const override;
+
             double a_3(const double & q2) const;
 
             /* HQET form factors h_i */
@@ -359,6 +359,15 @@ class BToDHQETFormFactorsTest :
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t( 4.0), -0.043808, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t( 8.0), +0.514150, eps);
                 TEST_CHECK_NEARLY_EQUAL(ff.f_t(10.0), +0.952830, eps);
+
+                for (const double q2 : { 4.0, 8.0, 10.0 })
+                {
+                    const auto values = ff.evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.f_p, ff.f_p(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_0, ff.f_0(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_t, ff.f_t(q2), eps);
+                }
             }
 
             // using z_* with a = 1.0 and LP z-order = 4 and SLP z-order 2
@@ -1040,6 +1049,21 @@ class BToDstarHQETFormFactorsTest :
                 };
 
                 TEST_CHECK_DIAGNOSTICS(diag, ref);
+
+                for (const double q2 : { 4.0, 8.0, 10.0 })
+                {
+                    const auto values = ff.evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.v,    ff.v(q2),    eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_0,  ff.a_0(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_1,  ff.a_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_2,  ff.a_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_12, ff.a_12(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_1,  ff.t_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_2,  ff.t_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_3,  ff.t_3(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_23, ff.t_23(q2), eps);
+                }
             }
 
             // using z_* with a = 1.0 and LP z-order = 3 and SLP z-order 1
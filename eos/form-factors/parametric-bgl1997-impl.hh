@@ -33,6 +33,84 @@
 
 namespace eos
 {
+    namespace bgl1997
+    {
+        // sqrt(t_+ - m_R^2) for each of the resonances with masses m_R
+        template <std::size_t N_>
+        inline std::array<double, N_> sqrt_tp_minus(const double & t_p, const std::array<double, N_> & m_R)
+        {
+            std::array<double, N_> result;
+            for (std::size_t n = 0 ; n < N_ ; ++n)
+            {
+                result[n] = std::sqrt(t_p - m_R[n] * m_R[n]);
+            }
+
+            return result;
+        }
+
+        // z(s, t_0) in terms of sqrt(t_+ - s) and sqrt(t_+ - t_0)
+        inline double z(const double & sqrt_tp_s, const double & sqrt_tp_t0)
+        {
+            return (sqrt_tp_s - sqrt_tp_t0) / (sqrt_tp_s + sqrt_tp_t0);
+        }
+
+        // product of z(s, m_R^2) over the resonances, in terms of sqrt(t_+ - s) and sqrt(t_+ - m_R^2)
+        template <std::size_t N_>
+        inline double blaschke(const double & sqrt_tp_s, const std::array<double, N_> & sqrt_tp_m2_R)
+        {
+            double result = 1.0;
+            for (std::size_t n = 0 ; n < N_ ; ++n)
+            {
+                result *= z(sqrt_tp_s, sqrt_tp_m2_R[n]);
+            }
+
+            return result;
+        }
+
+        // the s-dependent factors of the outer functions [BGL:1997A] eq. (4.14), shared among the form factors
+        struct OuterFunction
+        {
+            double common;
+            double root_a;
+            double root_b;
+            double inverse_c;
+
+            OuterFunction(const double & sqrt_tp_s, const double & sqrt_tp_t0, const double & sqrt_tp_tm, const double & sqrt_tp) :
+                common((sqrt_tp_s + sqrt_tp_t0) * std::sqrt(sqrt_tp_s / sqrt_tp_t0)),
+                root_a(std::sqrt(sqrt_tp_s)),
+                root_b(std::sqrt(sqrt_tp_s + sqrt_tp_tm)),
+                inverse_c(1.0 / (sqrt_tp_s + sqrt_tp))
+            {
+            }
+
+            // the outer function for a given prefactor sqrt(1 / (K pi chi))
+            template <unsigned a_, unsigned b_, unsigned c_>
+            double phi(const double & prefactor) const
+            {
+                return prefactor * common * power_of<a_>(root_a) * power_of<b_>(root_b) * power_of<c_ + 3>(inverse_c);
+            }
+        };
+
+        // the s-independent prefactor sqrt(1 / (K pi chi)) of the outer functions
+        inline double outer_prefactor(const double & K, const double & chi)
+        {
+            return std::sqrt(1.0 / (K * M_PI * chi));
+        }
+
+        // the series in z, evaluated with Horner's scheme
+        template <std::size_t K_>
+        inline double series(const std::array<double, K_> & a, const double & z)
+        {
+            double result = a[K_ - 1];
+            for (std::size_t k = K_ - 1 ; k > 0 ; --k)
+            {
+                result = result * z + a[k - 1];
+            }
+
+            return result;
+        }
+    }
+
     BGL1997FormFactorBase::BGL1997FormFactorBase(const Parameters &, const Options &, ParameterUser &, const double t_p, const double t_m) :
         _t_p(t_p),
         _t_m(t_m),
@@ -191,6 +269,12 @@ namespace eos
 
     double
     BGL1997FormFactors<BToDstar>::a_F2_0() const
+    {
+        return _a_F2_0(a_F1_0());
+    }
+
+    double
+    BGL1997FormFactors<BToDstar>::_a_F2_0(const double & a_F1_0) const
     {
         const double r    = _mV / _mB;
         const double wmax = (_mB2 + _mV2) / (2.0 * _mB * _mV);
@@ -200,7 +284,7 @@ namespace eos
         const double z = _z(0.0, _t_0);
         std::array<double, 4> an, zn;
         zn[0] = 1.0;
-        an[0]  = x_F2 * this->a_F1_0() * zn[0]; // a_F1[0] is the linear coefficient; we need the constant part
+        an[0]  = x_F2 * a_F1_0 * zn[0]; // a_F1[0] is the linear coefficient; we need the constant part
         for (unsigned i = 1 ; i < an.size() ; ++i)
         {
             an[i] = x_F2 * this->_a_F1[i - 1] - x_F1 * this->_a_F2[i - 1];
@@ -304,6 +388,12 @@ namespace eos
 
     double
     BGL1997FormFactors<BToDstar>::a_T23_0() const
+    {
+        return _a_T23_0(a_T2_0());
+    }
+
+    double
+    BGL1997FormFactors<BToDstar>::_a_T23_0(const double & a_T2_0) const
     {
         const double x_T2  = _z(_t_m, 6.739 * 6.739) * _z(_t_m, 6.750 * 6.750) * _z(_t_m, 7.145 * 7.145) * _z(_t_m, 7.150 * 7.150) * _phi(_t_m, _t_0, 24.0 / (_t_p * _t_m),       1, 1, 2, _chi_T_1p);
         const double x_T23 = _z(_t_m, 6.739 * 6.739) * _z(_t_m, 6.750 * 6.750) * _z(_t_m, 7.145 * 7.145) * _z(_t_m, 7.150 * 7.150) * _phi(_t_m, _t_0, 3.0 * _t_p / (_mB2 * _mV2), 1, 1, 1, _chi_T_1p)
@@ -311,7 +401,7 @@ namespace eos
         const double z = _z(_t_m, _t_0);
         std::array<double, 4> an, zn;
         zn[0] = 1.0;
-        an[0]  = x_T23 * this->a_T2_0() * zn[0]; // a_T2[0] is the linear coefficient; we need the constant part
+        an[0]  = x_T23 * a_T2_0 * zn[0]; // a_T2[0] is the linear coefficient; we need the constant part
         for (unsigned i = 1 ; i < an.size() ; ++i)
         {
             an[i] = x_T23 * this->_a_T2[i - 1] - x_T2 * this->_a_T23[i - 1];
@@ -367,6 +457,89 @@ namespace eos
     {
         return 0.0;  //  TODO
     }
+
+    FormFactors<PToV>::Values
+    BGL1997FormFactors<BToDstar>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    void
+    BGL1997FormFactors<BToDstar>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BGL1997FormFactors<BToDstar>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        // the constrained coefficients are independent of s, and are therefore computed only once
+        const double a_F1_0  = this->a_F1_0();
+        const double a_F2_0  = this->_a_F2_0(a_F1_0);
+        const double a_T2_0  = this->a_T2_0();
+        const double a_T23_0 = this->_a_T23_0(a_T2_0);
+
+        const std::array<double, 4> a_g   { _a_g[0],  _a_g[1],  _a_g[2],  _a_g[3]  };
+        const std::array<double, 4> a_f   { _a_f[0],  _a_f[1],  _a_f[2],  _a_f[3]  };
+        const std::array<double, 4> a_F1  { a_F1_0,   _a_F1[0], _a_F1[1], _a_F1[2] };
+        const std::array<double, 4> a_F2  { a_F2_0,   _a_F2[0], _a_F2[1], _a_F2[2] };
+        const std::array<double, 4> a_T1  { _a_T1[0], _a_T1[1], _a_T1[2], _a_T1[3] };
+        const std::array<double, 4> a_T2  { a_T2_0,   _a_T2[0], _a_T2[1], _a_T2[2] };
+        const std::array<double, 4> a_T23 { a_T23_0,  _a_T23[0], _a_T23[1], _a_T23[2] };
+
+        const double sqrt_tp_t0 = std::sqrt(_t_p - _t_0);
+        const double sqrt_tp_tm = std::sqrt(_t_p - _t_m);
+        const double sqrt_tp    = std::sqrt(_t_p);
+        const auto sqrt_tp_1m = bgl1997::sqrt_tp_minus(_t_p, std::array<double, 3>{ 6.329, 6.910, 7.020 });
+        const auto sqrt_tp_1p = bgl1997::sqrt_tp_minus(_t_p, std::array<double, 4>{ 6.739, 6.750, 7.145, 7.150 });
+        const auto sqrt_tp_0m = bgl1997::sqrt_tp_minus(_t_p, std::array<double, 3>{ 6.275, 6.871, 7.250 });
+
+        const double prefactor_g   = bgl1997::outer_prefactor(96.0, _chi_1m);
+        const double prefactor_f   = bgl1997::outer_prefactor(24.0, _chi_1p);
+        const double prefactor_F1  = bgl1997::outer_prefactor(48.0, _chi_1p);
+        const double prefactor_F2  = bgl1997::outer_prefactor(64.0, _chi_0m);
+        const double prefactor_T1  = bgl1997::outer_prefactor(24.0, _chi_T_1m);
+        const double prefactor_T2  = bgl1997::outer_prefactor(24.0 / (_t_p * _t_m), _chi_T_1p);
+        const double prefactor_T23 = bgl1997::outer_prefactor(3.0 * _t_p / (_mB2 * _mV2), _chi_T_1p);
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            const double q2 = s[i];
+
+            // the z variable and the Blaschke factors are shared among the form factors
+            const double sqrt_tp_s = std::sqrt(_t_p - q2);
+            const double z = bgl1997::z(sqrt_tp_s, sqrt_tp_t0);
+
+            const double blaschke_1m = bgl1997::blaschke(sqrt_tp_s, sqrt_tp_1m);
+            const double blaschke_1p = bgl1997::blaschke(sqrt_tp_s, sqrt_tp_1p);
+            const double blaschke_0m = bgl1997::blaschke(sqrt_tp_s, sqrt_tp_0m);
+
+            // so are the s-dependent factors of the outer functions
+            const bgl1997::OuterFunction outer(sqrt_tp_s, sqrt_tp_t0, sqrt_tp_tm, sqrt_tp);
+
+            const double g    = bgl1997::series(a_g,  z) / outer.phi<3, 3, 1>(prefactor_g)  / blaschke_1m;
+            const double f    = bgl1997::series(a_f,  z) / outer.phi<1, 1, 1>(prefactor_f)  / blaschke_1p;
+            const double F1   = bgl1997::series(a_F1, z) / outer.phi<1, 1, 2>(prefactor_F1) / blaschke_1p;
+            const double F2   = bgl1997::series(a_F2, z) / outer.phi<3, 3, 1>(prefactor_F2) / blaschke_0m;
+
+            const double lambda = eos::lambda(_mB2, _mV2, q2);
+
+            Values & result = values[i];
+
+            result.v    = (_mB + _mV) / 2.0 * g;
+            result.a_0  = F2 / 2.0;
+            result.a_1  = 1.0 / (_mB + _mV) * f;
+            result.a_2  = (_mB + _mV) / lambda * ((_mB2 - _mV2 - q2) * f - 2.0 * _mV * F1);
+            result.a_12 = F1 / (8.0 * _mB * _mV);
+
+            result.t_1  = bgl1997::series(a_T1,  z) / outer.phi<3, 3, 2>(prefactor_T1)  / blaschke_1m;
+            result.t_2  = bgl1997::series(a_T2,  z) / outer.phi<1, 1, 2>(prefactor_T2)  / blaschke_1p;
+            result.t_23 = bgl1997::series(a_T23, z) / outer.phi<1, 1, 1>(prefactor_T23) / blaschke_1p;
+            result.t_3  = ((_mB2 - _mV2) * (_mB2 + 3.0 * _mV2 - q2) * result.t_2 - 8.0 * _mB * _mV2 * (_mB - _mV) * result.t_23) / lambda;
+        }
+    }
+
     std::vector<OptionSpecification>::const_iterator
     BGL1997FormFactors<BToDstar>::begin_options()
     {
@@ -458,6 +631,56 @@ namespace eos
         return 0.0; //  TODO
     }
 
+    FormFactors<PToP>::Values
+    BGL1997FormFactors<BToD>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    void
+    BGL1997FormFactors<BToD>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BGL1997FormFactors<BToD>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        const std::array<double, 4> a_f_p { _a_f_p[0], _a_f_p[1], _a_f_p[2], _a_f_p[3] };
+        const std::array<double, 4> a_f_0 { _a_f_0[0], _a_f_0[1], _a_f_0[2], _a_f_0[3] };
+        const std::array<double, 4> a_f_t { _a_f_t[0], _a_f_t[1], _a_f_t[2], _a_f_t[3] };
+
+        const double sqrt_tp_t0 = std::sqrt(_t_p - _t_0);
+        const double sqrt_tp_tm = std::sqrt(_t_p - _t_m);
+        const double sqrt_tp    = std::sqrt(_t_p);
+        const auto sqrt_tp_1m = bgl1997::sqrt_tp_minus(_t_p, std::array<double, 3>{ 6.329, 6.910, 7.020 });
+        const auto sqrt_tp_0p = bgl1997::sqrt_tp_minus(_t_p, std::array<double, 2>{ 6.704, 7.122 });
+
+        const double prefactor_f_p = bgl1997::outer_prefactor(48.0, _chi_1m);
+        const double prefactor_f_0 = bgl1997::outer_prefactor(16.0, _chi_0p);
+        const double prefactor_f_t = bgl1997::outer_prefactor(48.0 * _t_p, _chi_T_1m);
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            const double q2 = s[i];
+
+            // the z variable and the Blaschke factors are shared among the form factors
+            const double sqrt_tp_s = std::sqrt(_t_p - q2);
+            const double z = bgl1997::z(sqrt_tp_s, sqrt_tp_t0);
+
+            const double blaschke_1m = bgl1997::blaschke(sqrt_tp_s, sqrt_tp_1m);
+            const double blaschke_0p = bgl1997::blaschke(sqrt_tp_s, sqrt_tp_0p);
+
+            // so are the s-dependent factors of the outer functions
+            const bgl1997::OuterFunction outer(sqrt_tp_s, sqrt_tp_t0, sqrt_tp_tm, sqrt_tp);
+
+            values[i].f_p = bgl1997::series(a_f_p, z) / outer.phi<3, 3, 2>(prefactor_f_p) / blaschke_1m;
+            values[i].f_0 = bgl1997::series(a_f_0, z) / outer.phi<1, 1, 1>(prefactor_f_0) / blaschke_0p;
+            values[i].f_t = bgl1997::series(a_f_t, z) / outer.phi<3, 3, 1>(prefactor_f_t) / blaschke_1m;
+        }
+    }
+
     std::vector<OptionSpecification>::const_iterator
     BGL1997FormFactors<BToD>::begin_options()
     {
@@ -66,6 +66,10 @@ namespace eos
 
             static const std::vector<OptionSpecification> _options;
 
+            // constant coefficients that depend on the constant coefficient of another form factor
+            double _a_F2_0(const double & a_F1_0) const;
+            double _a_T23_0(const double & a_T2_0) const;
+
         public:
             BGL1997FormFactors(const Parameters &, const Options &);
             ~BGL1997FormFactors();
@@ -100,6 +104,10 @@ namespace eos
             virtual double f_para_T(const double & s) const;
             virtual double f_long_T(const double & s) const;
 
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
             /*!
              * References used in the computation of our (pseudo)observables.
              */
@@ -141,6 +149,10 @@ namespace eos
 
             virtual double f_plus_T(const double & s) const;
 
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
             /*!
              * References used in the computation of our (pseudo)observables.
              */
@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <limits>
+#include <string>
 #include <vector>
 
 using namespace test;
@@ -290,3 +291,74 @@ class BGL1997FormFactorsTest :
             }
         }
 } BGL1997_form_factor_test;
+
+class BGL1997EvaluateAllTest :
+    public TestCase
+{
+    public:
+        BGL1997EvaluateAllTest() :
+            TestCase("BGL1997_evaluate_all_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-8;
+
+            Parameters p = Parameters::Defaults();
+
+            /* B -> D^* FFs */
+            {
+                BGL1997FormFactors<BToDstar> ff(p, Options{ });
+
+                /* the leading coefficients of F1, F2, T2 and T23 are determined by the kinematic identities */
+                for (const std::string ff_name : { "g", "f", "T1" })
+                {
+                    p["B->D^*::a^" + ff_name + "_0@BGL1997"] = 0.1e-02;
+                }
+                for (const std::string ff_name : { "g", "f", "F1", "F2", "T1", "T2", "T23" })
+                {
+                    p["B->D^*::a^" + ff_name + "_1@BGL1997"] = 0.2e-02;
+                    p["B->D^*::a^" + ff_name + "_2@BGL1997"] = 0.3e-02;
+                    p["B->D^*::a^" + ff_name + "_3@BGL1997"] = 0.4e-02;
+                }
+
+                for (const double q2 : { -2.0, 1.0, 4.0, 8.0 })
+                {
+                    const auto values = ff.evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.v,    ff.v(q2),    eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_0,  ff.a_0(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_1,  ff.a_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_2,  ff.a_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_12, ff.a_12(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_1,  ff.t_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_2,  ff.t_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_3,  ff.t_3(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_23, ff.t_23(q2), eps);
+                }
+            }
+
+            /* B -> D FFs*/
+            {
+                BGL1997FormFactors<BToD> ff(p, Options{ });
+
+                for (const std::string ff_name : { "f+", "f0", "fT" })
+                {
+                    p["B->D::a^" + ff_name + "_0@BGL1997"] = 0.4e-02;
+                    p["B->D::a^" + ff_name + "_1@BGL1997"] = 0.3e-02;
+                    p["B->D::a^" + ff_name + "_2@BGL1997"] = 0.2e-02;
+                    p["B->D::a^" + ff_name + "_3@BGL1997"] = 0.1e-02;
+                }
+
+                for (const double q2 : { -2.0, 1.0, 4.0, 8.0 })
+                {
+                    const auto values = ff.evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.f_p, ff.f_p(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_0, ff.f_0(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_t, ff.f_t(q2), eps);
+                }
+            }
+        }
+} BGL1997_evaluate_all_test;
@@ -22,9 +22,44 @@
 
 #include <eos/form-factors/parametric-bsz2015.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
 
 namespace eos
 {
+    namespace bsz2015
+    {
+        // the conformal variable z(s) for s <= t_+, written in terms of real arithmetic only;
+        // above t_+ its real part is returned, as in BSZ2015FormFactorTraits::calc_z
+        template <typename T_>
+        inline T_ z(const double & s, const T_ & tp, const T_ & sqrt_tp_t0)
+        {
+            using std::abs;
+            using std::sqrt;
+
+            const T_ d = tp - s;
+            const T_ sqrt_d = sqrt(abs(d));
+
+            return (d >= 0.0)
+                ? (sqrt_d - sqrt_tp_t0) / (sqrt_d + sqrt_tp_t0)
+                : (-d - power_of<2>(sqrt_tp_t0)) / (-d + power_of<2>(sqrt_tp_t0));
+        }
+
+        // the series in z - z(0) of [BSZ2015], eq. (4.1), evaluated with Horner's scheme
+        template <typename T_, std::size_t K_>
+        inline T_ series(const std::array<T_, K_> & a, const T_ & diff_z)
+        {
+            T_ result = a[K_ - 1];
+            for (std::size_t k = K_ - 1 ; k > 0 ; --k)
+            {
+                result = result * diff_z + a[k - 1];
+            }
+
+            return result;
+        }
+    }
+
     template <typename Process_>
     const std::map<std::tuple<QuarkFlavor, QuarkFlavor>, std::string>
     BSZ2015FormFactorTraits<Process_, PToV>::resonance_0m_names
@@ -305,6 +340,71 @@ namespace eos
                 - s * lambda / (2 * power_of<3>(_mB) * _mV * (power_of<2>(_mB) - power_of<2>(_mV))) * t_3(s);
     }
 
+    template <typename Process_>
+    FormFactors<PToV>::Values
+    BSZ2015FormFactors<Process_, PToV>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToV>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BSZ2015FormFactors<PToV>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        // read all parameters once; the loop over s below only involves plain doubles
+        const double mB = _mB, mB2 = power_of<2>(mB);
+        const double mV = _mV, mV2 = power_of<2>(mV);
+
+        const double tp = _traits.tp(), sqrt_tp_t0 = std::sqrt(tp - _traits.t0());
+        const double z_0 = bsz2015::z(0.0, tp, sqrt_tp_t0);
+
+        const double inv_m2_R_0m = 1.0 / power_of<2>(_traits.m_R_0m());
+        const double inv_m2_R_1m = 1.0 / power_of<2>(_traits.m_R_1m());
+        const double inv_m2_R_1p = 1.0 / power_of<2>(_traits.m_R_1p());
+
+        const std::array<double, 3> a_V   { _a_V[0],   _a_V[1],   _a_V[2]   };
+        const std::array<double, 3> a_A0  { _a_A0[0],  _a_A0[1],  _a_A0[2]  };
+        const std::array<double, 3> a_A1  { _a_A1[0],  _a_A1[1],  _a_A1[2]  };
+        // use constraint (B.6) in [BSZ2015] to remove A_12(0)
+        const std::array<double, 3> a_A12 { (mB2 - mV2) / (8.0 * mB * mV) * a_A0[0], _a_A12[1 - 1], _a_A12[2 - 1] };
+        const std::array<double, 3> a_T1  { _a_T1[0],  _a_T1[1],  _a_T1[2]  };
+        // use constraint T_1(0) = T_2(0) to replace T_2(0)
+        const std::array<double, 3> a_T2  { a_T1[0],   _a_T2[1 - 1], _a_T2[2 - 1] };
+        const std::array<double, 3> a_T23 { _a_T23[0], _a_T23[1], _a_T23[2] };
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            const double q2 = s[i];
+
+            // the z variable and the pole factors are shared among the form factors
+            const double diff_z  = bsz2015::z(q2, tp, sqrt_tp_t0) - z_0;
+            const double pole_0m = 1.0 / (1.0 - q2 * inv_m2_R_0m);
+            const double pole_1m = 1.0 / (1.0 - q2 * inv_m2_R_1m);
+            const double pole_1p = 1.0 / (1.0 - q2 * inv_m2_R_1p);
+
+            const double inv_lambda = 1.0 / eos::lambda(mB2, mV2, q2);
+
+            Values & result = values[i];
+
+            result.v    = pole_1m * bsz2015::series(a_V,   diff_z);
+            result.a_0  = pole_0m * bsz2015::series(a_A0,  diff_z);
+            result.a_1  = pole_1p * bsz2015::series(a_A1,  diff_z);
+            result.a_12 = pole_1p * bsz2015::series(a_A12, diff_z);
+            result.a_2  = (power_of<2>(mB + mV) * (mB2 - mV2 - q2) * result.a_1 - 16.0 * mB * mV2 * (mB + mV) * result.a_12) * inv_lambda;
+
+            result.t_1  = pole_1m * bsz2015::series(a_T1,  diff_z);
+            result.t_2  = pole_1p * bsz2015::series(a_T2,  diff_z);
+            result.t_23 = pole_1p * bsz2015::series(a_T23, diff_z);
+            result.t_3  = ((mB2 - mV2) * (mB2 + 3.0 * mV2 - q2) * result.t_2 - 8.0 * mB * mV2 * (mB - mV) * result.t_23) * inv_lambda;
+        }
+    }
 
     // P -> P
     template <typename Process_>
@@ -437,6 +537,85 @@ namespace eos
     {
         return real(f_plus_T(complex<double>(s)));
     }
+
+    template <typename Process_>
+    FormFactors<PToP>::Values
+    BSZ2015FormFactors<Process_, PToP>::evaluate_all(const double & s) const
+    {
+        Values result;
+
+        this->evaluate_batch(std::span<const double>(&s, 1), std::span<Values>(&result, 1));
+
+        return result;
+    }
+
+    template <typename Process_>
+    void
+    BSZ2015FormFactors<Process_, PToP>::evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const
+    {
+        if (s.size() != values.size())
+            throw InternalError("BSZ2015FormFactors<PToP>::evaluate_batch: the number of points in q2 and the number of values differ");
+
+        // read all parameters once; the loop over s below only involves plain doubles
+        const double tp = _traits.tp(), sqrt_tp_t0 = std::sqrt(tp - _traits.t0());
+        const double z_0 = bsz2015::z(0.0, tp, sqrt_tp_t0);
+
+        const double inv_m2_R_0p = 1.0 / power_of<2>(_traits.m_R_0p());
+        const double inv_m2_R_1m = 1.0 / power_of<2>(_traits.m_R_1m());
+
+        const std::array<double, 3> a_fp { _a_fp[0], _a_fp[1], _a_fp[2] };
+        const std::array<double, 3> a_ft { _a_ft[0], _a_ft[1], _a_ft[2] };
+        // use equation of motion to replace f_0(0) by f_+(0)
+        const std::array<double, 3> a_fz { a_fp[0],  _a_fz[1 - 1], _a_fz[2 - 1] };
+
+        for (std::size_t i = 0 ; i < s.size() ; ++i)
+        {
+            const double q2 = s[i];
+
+            // the z variable and the pole factors are shared among the form factors
+            const double diff_z  = bsz2015::z(q2, tp, sqrt_tp_t0) - z_0;
+            const double pole_0p = 1.0 / (1.0 - q2 * inv_m2_R_0p);
+            const double pole_1m = 1.0 / (1.0 - q2 * inv_m2_R_1m);
+
+            values[i].f_p = pole_1m * bsz2015::series(a_fp, diff_z);
+            values[i].f_t = pole_1m * bsz2015::series(a_ft, diff_z);
+            values[i].f_0 = pole_0p * bsz2015::series(a_fz, diff_z);
+        }
+    }
+
+    template <typename Process_>
+    bool
+    BSZ2015FormFactors<Process_, PToP>::differentiable() const
+    {
+        return true;
+    }
+
+    template <typename Process_>
+    FormFactors<PToP>::DualValues
+    BSZ2015FormFactors<Process_, PToP>::evaluate_with_gradient(const double & s, const DualParameters & parameters) const
+    {
+        // the same arithmetic as in evaluate_batch(), carried out with dual numbers
+        const Dual m_B = parameters(_traits.m_B), m_P = parameters(_traits.m_P);
+        const Dual tp = power_of<2>(m_B + m_P), tm = power_of<2>(m_B - m_P);
+        const Dual t0 = tp * (1.0 - sqrt(1.0 - tm / tp));
+        const Dual sqrt_tp_t0 = sqrt(tp - t0);
+
+        const Dual diff_z  = bsz2015::z(s, tp, sqrt_tp_t0) - bsz2015::z(0.0, tp, sqrt_tp_t0);
+        const Dual pole_0p = 1.0 / (1.0 - s / power_of<2>(parameters(_traits.m_R_0p)));
+        const Dual pole_1m = 1.0 / (1.0 - s / power_of<2>(parameters(_traits.m_R_1m)));
+
+        const std::array<Dual, 3> a_fp { parameters(_a_fp[0]), parameters(_a_fp[1]), parameters(_a_fp[2]) };
+        const std::array<Dual, 3> a_ft { parameters(_a_ft[0]), parameters(_a_ft[1]), parameters(_a_ft[2]) };
+        // use equation of motion to replace f_0(0) by f_+(0)
+        const std::array<Dual, 3> a_fz { a_fp[0], parameters(_a_fz[1 - 1]), parameters(_a_fz[2 - 1]) };
+
+        DualValues result;
+        result.f_p = pole_1m * bsz2015::series(a_fp, diff_z);
+        result.f_0 = pole_0p * bsz2015::series(a_fz, diff_z);
+        result.f_t = pole_1m * bsz2015::series(a_ft, diff_z);
+
+        return result;
+    }
 }
 
 #endif
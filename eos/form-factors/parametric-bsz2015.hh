@@ -156,6 +156,10 @@ namespace eos
             virtual double f_para_T(const double & s) const;
 
             virtual double f_long_T(const double & s) const;
+
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
     };
 
     extern template class BSZ2015FormFactors<BToRho, PToV>;
@@ -249,6 +253,14 @@ namespace eos
             virtual double f_t(const double & s) const;
             virtual double f_0(const double & s) const;
             virtual double f_plus_T(const double & s) const;
+
+            virtual Values evaluate_all(const double & s) const;
+
+            virtual void evaluate_batch(const std::span<const double> & s, const std::span<Values> & values) const;
+
+            virtual bool differentiable() const;
+
+            virtual DualValues evaluate_with_gradient(const double & s, const DualParameters & parameters) const;
     };
 
     extern template class BSZ2015FormFactors<BToPi, PToP>;
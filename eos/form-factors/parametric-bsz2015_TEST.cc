@@ -315,3 +315,82 @@ public:
         TEST_CHECK_NEARLY_EQUAL(0.238325, ff->t_3(6.1), eps);
     }
 } b_to_rho_bsz2015_form_factors_test;
+
+class BSZ2015EvaluateAllTest :
+    public TestCase
+{
+    public:
+        BSZ2015EvaluateAllTest() :
+            TestCase("bsz2015_evaluate_all_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-8;
+
+            Parameters p = Parameters::Defaults();
+
+            /* B -> K^* */
+            {
+                std::shared_ptr<FormFactors<PToV>> ff = FormFactorFactory<PToV>::create("B->K^*::BSZ2015", p, Options{ });
+
+                for (const double q2 : { 0.1, 2.1, 6.1, 12.1, 18.1 })
+                {
+                    const auto values = ff->evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.v,    ff->v(q2),    eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_0,  ff->a_0(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_1,  ff->a_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_2,  ff->a_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.a_12, ff->a_12(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_1,  ff->t_1(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_2,  ff->t_2(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_3,  ff->t_3(q2),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.t_23, ff->t_23(q2), eps);
+                }
+
+                const std::array<double, 5> q2 { 0.1, 2.1, 6.1, 12.1, 18.1 };
+                std::array<FormFactors<PToV>::Values, 5> values;
+                ff->evaluate_batch(q2, values);
+
+                for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(values[i].v,    ff->v(q2[i]),    eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].a_0,  ff->a_0(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].a_1,  ff->a_1(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].a_2,  ff->a_2(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].a_12, ff->a_12(q2[i]), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].t_1,  ff->t_1(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].t_2,  ff->t_2(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].t_3,  ff->t_3(q2[i]),  eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].t_23, ff->t_23(q2[i]), eps);
+                }
+            }
+
+            /* B -> K */
+            {
+                std::shared_ptr<FormFactors<PToP>> ff = FormFactorFactory<PToP>::create("B->K::BSZ2015", p, Options{ });
+
+                for (const double q2 : { 0.1, 2.1, 6.1, 12.1, 18.1 })
+                {
+                    const auto values = ff->evaluate_all(q2);
+
+                    TEST_CHECK_NEARLY_EQUAL(values.f_p, ff->f_p(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_0, ff->f_0(q2), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values.f_t, ff->f_t(q2), eps);
+                }
+
+                const std::array<double, 5> q2 { 0.1, 2.1, 6.1, 12.1, 18.1 };
+                std::array<FormFactors<PToP>::Values, 5> values;
+                ff->evaluate_batch(q2, values);
+
+                for (std::size_t i = 0 ; i < q2.size() ; ++i)
+                {
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_p, ff->f_p(q2[i]), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_0, ff->f_0(q2[i]), eps);
+                    TEST_CHECK_NEARLY_EQUAL(values[i].f_t, ff->f_t(q2[i]), eps);
+                }
+            }
+        }
+} bsz2015_evaluate_all_test;
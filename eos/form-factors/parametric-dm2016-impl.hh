@@ -195,6 +195,34 @@ namespace eos
         return 1.0 / (1.0 - s / mR2) * (_alpha_0_long_t5() + _alpha_1_perp_t5() * z + _alpha_2_perp_t5() * z2);
     }
 
+    template <typename Process_>
+    FormFactors<OneHalfPlusToOneHalfPlus>::Values
+    DM2016FormFactors<Process_>::evaluate_all(const double & s) const
+    {
+        const double z = _z(s, Process_::tp, Process_::tm), z2 = z * z;
+
+        // one pole factor per resonance
+        const double p_0p = 1.0 / (1.0 - s / Process_::mR2_0p);
+        const double p_0m = 1.0 / (1.0 - s / Process_::mR2_0m);
+        const double p_1m = 1.0 / (1.0 - s / Process_::mR2_1m);
+        const double p_1p = 1.0 / (1.0 - s / Process_::mR2_1p);
+
+        Values result;
+
+        result.f_time_v  = p_0p * (_alpha_0_time_v()  + _alpha_1_time_v()  * z + _alpha_2_time_v()  * z2);
+        result.f_long_v  = p_1m * (_alpha_0_long_v()  + _alpha_1_long_v()  * z + _alpha_2_long_v()  * z2);
+        result.f_perp_v  = p_1m * (_alpha_0_perp_v()  + _alpha_1_perp_v()  * z + _alpha_2_perp_v()  * z2);
+        result.f_time_a  = p_0m * (_alpha_0_time_a()  + _alpha_1_time_a()  * z + _alpha_2_time_a()  * z2);
+        result.f_long_a  = p_1p * (_alpha_0_long_a()  + _alpha_1_long_a()  * z + _alpha_2_long_a()  * z2);
+        result.f_perp_a  = p_1p * (_alpha_0_long_a()  + _alpha_1_perp_a()  * z + _alpha_2_perp_a()  * z2);
+        result.f_long_t  = p_1m * (_alpha_0_long_t()  + _alpha_1_long_t()  * z + _alpha_2_long_t()  * z2);
+        result.f_perp_t  = p_1m * (_alpha_0_perp_t()  + _alpha_1_perp_t()  * z + _alpha_2_perp_t()  * z2);
+        result.f_long_t5 = p_1p * (_alpha_0_long_t5() + _alpha_1_long_t5() * z + _alpha_2_long_t5() * z2);
+        result.f_perp_t5 = p_1p * (_alpha_0_long_t5() + _alpha_1_perp_t5() * z + _alpha_2_perp_t5() * z2);
+
+        return result;
+    }
+
     template <typename Process_>
     const std::set<ReferenceName> DM2016FormFactors<Process_>::references
     {
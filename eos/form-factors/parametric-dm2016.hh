@@ -74,6 +74,8 @@ namespace eos
             virtual double f_long_t5(const double & s) const;
             virtual double f_perp_t5(const double & s) const;
 
+            virtual Values evaluate_all(const double & s) const;
+
             /*!
              * References used in the computation of our observables.
              */
@@ -123,5 +123,22 @@ public:
         TEST_CHECK_NEARLY_EQUAL(0.2202553997, ff->f_perp_t5( 5.0), eps);
         TEST_CHECK_NEARLY_EQUAL(0.3221610388, ff->f_perp_t5(10.0), eps);
         TEST_CHECK_NEARLY_EQUAL(0.4985526705, ff->f_perp_t5(15.0), eps);
+
+        // evaluate_all agrees with the ten individual form factors
+        for (const double q2 : { 0.0, 5.0, 10.0, 15.0 })
+        {
+            const auto values = ff->evaluate_all(q2);
+
+            TEST_CHECK_NEARLY_EQUAL(values.f_time_v,  ff->f_time_v(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_long_v,  ff->f_long_v(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_perp_v,  ff->f_perp_v(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_time_a,  ff->f_time_a(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_long_a,  ff->f_long_a(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_perp_a,  ff->f_perp_a(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_long_t,  ff->f_long_t(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_perp_t,  ff->f_perp_t(q2),  1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_long_t5, ff->f_long_t5(q2), 1e-8);
+            TEST_CHECK_NEARLY_EQUAL(values.f_perp_t5, ff->f_perp_t5(q2), 1e-8);
+        }
     }
 } dm2016_form_factors_test;
@@ -24,10 +24,12 @@
 #include <eos/utils/options.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/parameter-memoiser.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 
 #include <gsl/gsl_sf_dilog.h>
 
+#include <array>
 #include <cmath>
 
 #include <iostream>
@@ -1588,13 +1590,17 @@ namespace eos
 
         std::shared_ptr<BGLCoefficients> bgl;
 
+        // saturations of the bounds in the order 0^+, 0^-, 1^+, 1^-
+        ParameterMemoiser<std::array<double, 4>> saturations;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
             opt_zorder_bound(o, "z-order-bound", { "1", "2" }, "2"),
             nf(p["B(*)->D(*)::n_f@HQET"], u),
             ns(p["B_s(*)->D_s(*)::n_s@HQET"], u),
-            bgl(new BGLCoefficients(p, o))
+            bgl(new BGLCoefficients(p, o)),
+            saturations(p)
         {
             if ("1" == opt_zorder_bound.value())
             {
@@ -1612,13 +1618,36 @@ namespace eos
 
         ~Implementation() = default;
 
+        // sum of the squares of the first zorder_bound + 1 coefficients of all form factors
+        template <std::size_t n_>
+        double sum_of_squares(const std::array<std::array<double, 3>, n_> & coeffs) const
+        {
+            // accumulate per power of z first; the inner loop has a fixed trip count and vectorises
+            std::array<double, 3> partial_sums{{ 0.0, 0.0, 0.0 }};
+            for (const auto & ff : coeffs)
+            {
+                for (unsigned i = 0 ; i < 3 ; ++i)
+                {
+                    partial_sums[i] += ff[i] * ff[i];
+                }
+            }
+
+            double result = 0.0;
+            for (unsigned i = 0 ; i <= zorder_bound ; ++i)
+            {
+                result += partial_sums[i];
+            }
+
+            return result;
+        }
+
         // bounds up to z^2
         // {{{
-        double bound_0p() const
+        std::array<double, 4> evaluate_saturations() const
         {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
+            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud_0p
             {{
                 // B -> D S_1
                 { bgl->S1_a0(), bgl->S1_a1(), bgl->S1_a2() },
@@ -1628,18 +1657,9 @@ namespace eos
                 { bgl->S3_a0(), bgl->S3_a1(), bgl->S3_a2() }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_s
+            const std::array<std::array<double, 3>, 3> bgl_coeffs_s_0p
             {{
                 // B_s -> D_s S_1
                 { bgl->S1s_a0(), bgl->S1s_a1(), bgl->S1s_a2() },
@@ -1649,22 +1669,9 @@ namespace eos
                 { bgl->S3s_a0(), bgl->S3s_a1(), bgl->S3s_a2() }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
-        }
-
-        double bound_0m() const
-        {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud
+            const std::array<std::array<double, 3>, 3> bgl_coeffs_ud_0m
             {{
                 // B -> D^* P_1
                 { bgl->P1_a0(), bgl->P1_a1(), bgl->P1_a2() },
@@ -1674,18 +1681,9 @@ namespace eos
                 { bgl->P3_a0(), bgl->P3_a1(), bgl->P3_a2() }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 3> bgl_coeffs_s
+            const std::array<std::array<double, 3>, 3> bgl_coeffs_s_0m
             {{
                 // B_s -> D_s S_1
                 { bgl->P1s_a0(), bgl->P1s_a1(), bgl->P1s_a2() },
@@ -1695,22 +1693,9 @@ namespace eos
                 { bgl->P3s_a0(), bgl->P3s_a1(), bgl->P3s_a2() }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
-        }
-
-        double bound_1p() const
-        {
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud_1p
             {{
                 // B -> D V_1
                 { bgl->V1_a0(), bgl->V1_a1(), bgl->V1_a2() },
@@ -1728,18 +1713,9 @@ namespace eos
                 { bgl->V7_a0(), bgl->V7_a1(), bgl->V7_a2() }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            const std::array<std::array<double, 3>, 7> bgl_coeffs_s_1p
             {{
                 // B_s -> D_s V_1
                 { bgl->V1s_a0(), bgl->V1s_a1(), bgl->V1s_a2() },
@@ -1757,22 +1733,9 @@ namespace eos
                 { bgl->V7s_a0(), bgl->V7s_a1(), bgl->V7s_a2() }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
-        }
-
-        double bound_1m() const
-        {
             // 3 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=u,d
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud
+            const std::array<std::array<double, 3>, 7> bgl_coeffs_ud_1m
             {{
                 // B -> D^* A_1
                 { bgl->A1_a0(), bgl->A1_a1(), bgl->A1_a2() },
@@ -1790,18 +1753,9 @@ namespace eos
                 { bgl->A7_a0(), bgl->A7_a1(), bgl->A7_a2() }
             }};
 
-            double result = 0.0;
-            for (const auto & ff : bgl_coeffs_ud)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * nf; // to account for flavor symmetry
-                }
-            }
-
             // 7 rows of form factors with 3 columns (one column per z coefficient)
             // for spectator quark q=s
-            const std::array<std::array<double, 3>, 7> bgl_coeffs_s
+            const std::array<std::array<double, 3>, 7> bgl_coeffs_s_1m
             {{
                 // B_s -> D_s^* A_1
                 { bgl->A1s_a0(), bgl->A1s_a1(), bgl->A1s_a2() },
@@ -1819,17 +1773,41 @@ namespace eos
                 { bgl->A7s_a0(), bgl->A7s_a1(), bgl->A7s_a2() }
             }};
 
-            for (const auto & ff : bgl_coeffs_s)
-            {
-                for (unsigned i = 0 ; i <= zorder_bound ; ++i)
-                {
-                    result += power_of<2>(ff[i]) * ns;
-                }
-            }
-
-            return result;
+            // the contributions for q=u,d are multiplied by nf to account for flavor symmetry
+            return std::array<double, 4>{{
+                nf * sum_of_squares(bgl_coeffs_ud_0p) + ns * sum_of_squares(bgl_coeffs_s_0p),
+                nf * sum_of_squares(bgl_coeffs_ud_0m) + ns * sum_of_squares(bgl_coeffs_s_0m),
+                nf * sum_of_squares(bgl_coeffs_ud_1p) + ns * sum_of_squares(bgl_coeffs_s_1p),
+                nf * sum_of_squares(bgl_coeffs_ud_1m) + ns * sum_of_squares(bgl_coeffs_s_1m)
+            }};
         }
         // }}}
+
+        // all bounds are evaluated together, once per parameter point
+        std::array<double, 4> bounds() const
+        {
+            return saturations([this] () { return this->evaluate_saturations(); });
+        }
+
+        double bound_0p() const
+        {
+            return bounds()[0];
+        }
+
+        double bound_0m() const
+        {
+            return bounds()[1];
+        }
+
+        double bound_1p() const
+        {
+            return bounds()[2];
+        }
+
+        double bound_1m() const
+        {
+            return bounds()[3];
+        }
     };
 
     const std::vector<OptionSpecification>
@@ -1846,6 +1824,12 @@ namespace eos
 
     HQETUnitarityBounds::~HQETUnitarityBounds() = default;
 
+    std::array<double, 4>
+    HQETUnitarityBounds::bounds() const
+    {
+        return _imp->bounds();
+    }
+
     double
     HQETUnitarityBounds::bound_0p() const
     {
@@ -26,6 +26,8 @@
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+
 namespace eos
 {
     class BGLCoefficients :
@@ -241,6 +243,9 @@ namespace eos
             HQETUnitarityBounds(const Parameters &, const Options &);
             ~HQETUnitarityBounds();
 
+            // saturations of all four bounds in the order 0^+, 0^-, 1^+, 1^-, evaluated in one pass
+            std::array<double, 4> bounds() const;
+
             // unitarity bounds as pseudo observables
             double bound_0p() const;
 
@@ -255,6 +260,14 @@ namespace eos
              */
             static const std::set<ReferenceName> references;
 
+            /*!
+             * All bound_* pseudo observables with the same parameters and options share one
+             * object, and hence one evaluation of the saturations per parameter point. This is
+             * safe since the saturations are memoised in a thread-safe manner, and since the
+             * BGL coefficients are only read.
+             */
+            static constexpr bool shareable = true;
+
             /*!
              * Options used in the computation of our observables.
              */
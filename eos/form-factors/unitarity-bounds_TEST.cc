@@ -257,6 +257,28 @@ class HQETUnitarityBoundsTest :
 
                 //throw std::string("foo");
             }
+
+            // all bounds in one pass, and updates of the parameters
+            {
+                Parameters p = Parameters::Defaults();
+
+                HQETUnitarityBounds bounds(p, Options{ });
+
+                const auto saturations = bounds.bounds();
+                TEST_CHECK_EQUAL(saturations[0], bounds.bound_0p());
+                TEST_CHECK_EQUAL(saturations[1], bounds.bound_0m());
+                TEST_CHECK_EQUAL(saturations[2], bounds.bound_1p());
+                TEST_CHECK_EQUAL(saturations[3], bounds.bound_1m());
+
+                p["B(*)->D(*)::xi'(1)@HQET"] = p["B(*)->D(*)::xi'(1)@HQET"].evaluate() - 0.5;
+
+                HQETUnitarityBounds reference(p, Options{ });
+                TEST_CHECK(saturations[2] != bounds.bound_1p());
+                TEST_CHECK_NEARLY_EQUAL(reference.bound_0p(), bounds.bound_0p(), 1.0e-15);
+                TEST_CHECK_NEARLY_EQUAL(reference.bound_0m(), bounds.bound_0m(), 1.0e-15);
+                TEST_CHECK_NEARLY_EQUAL(reference.bound_1p(), bounds.bound_1p(), 1.0e-15);
+                TEST_CHECK_NEARLY_EQUAL(reference.bound_1m(), bounds.bound_1m(), 1.0e-15);
+            }
         }
 } unitarity_bounds_test;
 
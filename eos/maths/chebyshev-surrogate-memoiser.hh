@@ -0,0 +1,122 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_CHEBYSHEV_SURROGATE_MEMOISER_HH
+#define EOS_GUARD_EOS_MATHS_CHEBYSHEV_SURROGATE_MEMOISER_HH 1
+
+#include <eos/maths/chebyshev-surrogate.hh>
+#include <eos/utils/parameter-memoiser.hh>
+#include <eos/utils/parameters.hh>
+
+#include <memory>
+
+namespace eos
+{
+    /*!
+     * ChebyshevSurrogateMemoiser evaluates a family of parameter-dependent functions of one
+     * variable x, each identified by a key, either directly or through their ChebyshevSurrogate
+     * approximations on an interval [x_min, x_max].
+     *
+     * The surrogate of each function is built on its first use for the present parameter point,
+     * and discarded as soon as any parameter changes. Concurrent requests for the same surrogate
+     * are coalesced, cf. ParameterMemoiser. If a surrogate fails to meet its targeted accuracy,
+     * this failure is remembered for the present parameter point, and the function is evaluated
+     * directly without any further attempts to build its surrogate.
+     */
+    template <typename Key_>
+    class ChebyshevSurrogateMemoiser
+    {
+        private:
+            bool _enabled;
+
+            double _x_min, _x_max;
+
+            // holds nullptr for surrogates that failed their certification
+            ParameterMemoiser<std::shared_ptr<const ChebyshevSurrogate>, Key_> _surrogates;
+
+            ParameterMemoiser<double, Key_, double> _values;
+
+            template <typename Function_>
+            std::shared_ptr<const ChebyshevSurrogate> surrogate(const Function_ & f, const Key_ & key, const double & x) const
+            {
+                if ((! _enabled) || (x < _x_min) || (_x_max < x))
+                    return nullptr;
+
+                return _surrogates([this, &f] (const Key_ &) -> std::shared_ptr<const ChebyshevSurrogate>
+                {
+                    auto s = std::make_shared<const ChebyshevSurrogate>(f, _x_min, _x_max);
+
+                    return s->certified() ? s : nullptr;
+                }, key);
+            }
+
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param parameters The parameters on which the functions depend.
+             * @param enabled    Whether the surrogates shall be used at all.
+             * @param x_min      The lower end of the interval of the surrogates.
+             * @param x_max      The upper end of the interval of the surrogates.
+             */
+            ChebyshevSurrogateMemoiser(const Parameters & parameters, const bool & enabled, const double & x_min, const double & x_max) :
+                _enabled(enabled),
+                _x_min(x_min),
+                _x_max(x_max),
+                _surrogates(parameters),
+                _values(parameters)
+            {
+            }
+
+            /*!
+             * Evaluate f at x by means of its surrogate, if possible, or directly otherwise.
+             *
+             * @param f   The function; it is called as f(x).
+             * @param key The key that identifies f.
+             * @param x   The point of evaluation.
+             */
+            template <typename Function_>
+            double approximated(const Function_ & f, const Key_ & key, const double & x) const
+            {
+                if (const auto s = surrogate(f, key, x))
+                    return (*s)(x);
+
+                return f(x);
+            }
+
+            /*!
+             * Evaluate f at x by means of its surrogate, if possible, or directly otherwise.
+             * Direct evaluations are memoised per parameter point and value of x.
+             *
+             * @param f   The function; it is called as f(x).
+             * @param key The key that identifies f.
+             * @param x   The point of evaluation.
+             */
+            template <typename Function_>
+            double memoised(const Function_ & f, const Key_ & key, const double & x) const
+            {
+                if (const auto s = surrogate(f, key, x))
+                    return (*s)(x);
+
+                return _values([&f] (const Key_ &, const double & x) { return f(x); }, key, x);
+            }
+    };
+}
+
+#endif
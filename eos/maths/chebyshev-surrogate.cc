@@ -0,0 +1,144 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/maths/chebyshev-surrogate.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/stringify.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace eos
+{
+    ChebyshevSurrogate::ChebyshevSurrogate(const std::function<double (const double &)> & f, const double & a, const double & b,
+            const double & tolerance, const unsigned & min_degree, const unsigned & max_degree) :
+        _a(a),
+        _b(b),
+        _error_estimate(0.0),
+        _certified(false)
+    {
+        if (! (a < b))
+            throw InternalError("ChebyshevSurrogate: the interval [" + stringify(a) + ", " + stringify(b) + "] is empty");
+
+        if (! (tolerance > 0.0))
+            throw InternalError("ChebyshevSurrogate: the tolerance must be positive");
+
+        if ((min_degree < 2) || (max_degree < min_degree))
+            throw InternalError("ChebyshevSurrogate: the degrees must fulfill 2 <= min_degree <= max_degree");
+
+        const double center = (b + a) / 2.0, half_width = (b - a) / 2.0;
+        const auto node = [&] (const unsigned & k, const unsigned & n) { return center + half_width * std::cos(M_PI * k / n); };
+
+        unsigned n = min_degree;
+        std::vector<double> values(n + 1);
+        for (unsigned k = 0 ; k <= n ; ++k)
+        {
+            values[k] = f(node(k, n));
+        }
+
+        while (true)
+        {
+            // the interpolating polynomial at the Chebyshev-Lobatto nodes, by means of a discrete cosine transform
+            _coefficients.assign(n + 1, 0.0);
+            for (unsigned j = 0 ; j <= n ; ++j)
+            {
+                double sum = 0.5 * (values[0] + ((j % 2 == 0) ? values[n] : -values[n]));
+                for (unsigned k = 1 ; k < n ; ++k)
+                {
+                    sum += values[k] * std::cos(M_PI * ((j * k) % (2 * n)) / n);
+                }
+
+                _coefficients[j] = 2.0 * sum / n;
+            }
+            _coefficients[0] /= 2.0;
+            _coefficients[n] /= 2.0;
+
+            double scale = 0.0;
+            bool finite = true;
+            for (const auto & v : values)
+            {
+                finite = finite && std::isfinite(v);
+                scale = std::max(scale, std::abs(v));
+            }
+
+            _error_estimate = std::abs(_coefficients[n - 1]) + std::abs(_coefficients[n]);
+            _certified = finite && (_error_estimate <= tolerance * scale);
+
+            if (_certified || (2 * n > max_degree))
+                break;
+
+            // the nodes of degree n are the even-numbered nodes of degree 2 n
+            std::vector<double> refined(2 * n + 1);
+            for (unsigned k = 0 ; k <= n ; ++k)
+            {
+                refined[2 * k] = values[k];
+            }
+            for (unsigned k = 1 ; k < 2 * n ; k += 2)
+            {
+                refined[k] = f(node(k, 2 * n));
+            }
+
+            values.swap(refined);
+            n *= 2;
+        }
+    }
+
+    double
+    ChebyshevSurrogate::operator() (const double & x) const
+    {
+        if (! contains(x))
+            throw InternalError("ChebyshevSurrogate: x = " + stringify(x) + " lies outside the interval [" + stringify(_a) + ", " + stringify(_b) + "]");
+
+        // Clenshaw recurrence
+        const double t = (2.0 * x - _a - _b) / (_b - _a);
+        double b_1 = 0.0, b_2 = 0.0;
+        for (unsigned j = _coefficients.size() - 1 ; j > 0 ; --j)
+        {
+            const double b_0 = _coefficients[j] + 2.0 * t * b_1 - b_2;
+            b_2 = b_1;
+            b_1 = b_0;
+        }
+
+        return _coefficients[0] + t * b_1 - b_2;
+    }
+
+    bool
+    ChebyshevSurrogate::contains(const double & x) const
+    {
+        return (_a <= x) && (x <= _b);
+    }
+
+    bool
+    ChebyshevSurrogate::certified() const
+    {
+        return _certified;
+    }
+
+    double
+    ChebyshevSurrogate::error_estimate() const
+    {
+        return _error_estimate;
+    }
+
+    unsigned
+    ChebyshevSurrogate::degree() const
+    {
+        return _coefficients.size() - 1;
+    }
+}
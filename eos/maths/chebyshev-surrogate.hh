@@ -0,0 +1,80 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_CHEBYSHEV_SURROGATE_HH
+#define EOS_GUARD_EOS_MATHS_CHEBYSHEV_SURROGATE_HH 1
+
+#include <functional>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * ChebyshevSurrogate approximates a smooth real-valued function on an interval [a, b]
+     * by a polynomial, expanded in Chebyshev polynomials of the first kind.
+     *
+     * The function is evaluated at the n + 1 Chebyshev-Lobatto nodes of the interval. The
+     * degree n is doubled until the sum of the magnitudes of the two highest coefficients,
+     * which serves as the estimate of the truncation error, falls below the requested
+     * tolerance relative to the largest function value at the nodes. Since the nodes are
+     * nested, each doubling reuses all previous function evaluations.
+     */
+    class ChebyshevSurrogate
+    {
+        private:
+            double _a, _b;
+
+            std::vector<double> _coefficients;
+
+            double _error_estimate;
+
+            bool _certified;
+
+        public:
+            /*!
+             * Constructor.
+             *
+             * @param f          The function that shall be approximated.
+             * @param a          The lower end of the interval.
+             * @param b          The upper end of the interval.
+             * @param tolerance  The targeted relative accuracy of the approximation.
+             * @param min_degree The initial degree of the polynomial.
+             * @param max_degree The maximal degree of the polynomial.
+             */
+            ChebyshevSurrogate(const std::function<double (const double &)> & f, const double & a, const double & b,
+                    const double & tolerance = 1.0e-4, const unsigned & min_degree = 8, const unsigned & max_degree = 16);
+
+            /// Evaluate the approximation at x within [a, b].
+            double operator() (const double & x) const;
+
+            /// Return true if x lies within the interval of the approximation.
+            bool contains(const double & x) const;
+
+            /// Return true if the error estimate meets the targeted accuracy.
+            bool certified() const;
+
+            /// Retrieve the estimate of the absolute truncation error.
+            double error_estimate() const;
+
+            /// Retrieve the degree of the polynomial.
+            unsigned degree() const;
+    };
+}
+
+#endif
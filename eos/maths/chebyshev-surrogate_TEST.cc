@@ -0,0 +1,130 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/chebyshev-surrogate.hh>
+#include <eos/maths/chebyshev-surrogate-memoiser.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class ChebyshevSurrogateTest :
+    public TestCase
+{
+    public:
+        ChebyshevSurrogateTest() :
+            TestCase("chebyshev_surrogate_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // polynomials are reproduced exactly
+            {
+                unsigned evaluations = 0;
+                const auto f = [&evaluations] (const double & x) { ++evaluations; return 1.0 - 2.0 * x + 0.5 * x * x * x; };
+
+                ChebyshevSurrogate s(f, -2.0, 3.0);
+
+                TEST_CHECK(s.certified());
+                TEST_CHECK_EQUAL(8u, s.degree());
+                TEST_CHECK_EQUAL(9u, evaluations);
+                TEST_CHECK_NEARLY_EQUAL(f(-2.0), s(-2.0), 1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(f( 0.3), s( 0.3), 1.0e-13);
+                TEST_CHECK_NEARLY_EQUAL(f( 3.0), s( 3.0), 1.0e-13);
+            }
+
+            // a pole-like function close to the interval requires refinement
+            {
+                unsigned evaluations = 0;
+                const auto f = [&evaluations] (const double & q2) { ++evaluations; return 0.3 / (1.0 - q2 / 28.0); };
+
+                ChebyshevSurrogate s(f, -5.0, 10.0, 1.0e-6);
+
+                TEST_CHECK(s.certified());
+                TEST_CHECK_EQUAL(16u, s.degree());
+                TEST_CHECK_EQUAL(17u, evaluations);
+                TEST_CHECK(s.error_estimate() < 1.0e-6 * 0.3 / (1.0 - 10.0 / 28.0));
+
+                for (double q2 = -5.0 ; q2 <= 10.0 ; q2 += 0.7)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(f(q2), s(q2), 1.0e-6);
+                }
+            }
+
+            // a kink cannot be approximated to high accuracy
+            {
+                ChebyshevSurrogate s([] (const double & x) { return std::abs(x - 0.1); }, -1.0, 1.0, 1.0e-6);
+
+                TEST_CHECK(! s.certified());
+                TEST_CHECK_EQUAL(16u, s.degree());
+            }
+
+            // evaluation outside of the interval and invalid arguments
+            {
+                ChebyshevSurrogate s([] (const double & x) { return x; }, 0.0, 1.0);
+
+                TEST_CHECK(  s.contains(0.0));
+                TEST_CHECK(! s.contains(1.5));
+                TEST_CHECK_THROWS(InternalError, s(1.5));
+
+                TEST_CHECK_THROWS(InternalError, ChebyshevSurrogate([] (const double & x) { return x; }, 1.0, 0.0));
+                TEST_CHECK_THROWS(InternalError, ChebyshevSurrogate([] (const double & x) { return x; }, 0.0, 1.0, 1.0e-4, 8, 4));
+            }
+
+            // surrogates are built once per parameter point, and failed certifications are remembered
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_B = p["mass::B_d"];
+
+                ChebyshevSurrogateMemoiser<unsigned> surrogates(p, true, -1.0, 1.0);
+
+                unsigned smooth_evaluations = 0, kink_evaluations = 0;
+                const auto smooth = [&smooth_evaluations, &m_B] (const double & x) { ++smooth_evaluations; return m_B.evaluate() * (1.0 + x * x); };
+                const auto kink   = [&kink_evaluations,   &m_B] (const double & x) { ++kink_evaluations;   return m_B.evaluate() * std::abs(x - 0.1); };
+
+                TEST_CHECK_NEARLY_EQUAL(smooth(0.5), surrogates.approximated(smooth, 0u, 0.5), 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(smooth(0.7), surrogates.approximated(smooth, 0u, 0.7), 1.0e-12);
+                TEST_CHECK_EQUAL(9u + 2u, smooth_evaluations);
+
+                // the failed surrogate costs 17 evaluations once; afterwards, the function is evaluated directly
+                TEST_CHECK_EQUAL(kink(0.5), surrogates.approximated(kink, 1u, 0.5));
+                TEST_CHECK_EQUAL(17u + 2u, kink_evaluations);
+                TEST_CHECK_EQUAL(kink(0.7), surrogates.approximated(kink, 1u, 0.7));
+                TEST_CHECK_EQUAL(17u + 4u, kink_evaluations);
+
+                // direct evaluations can be memoised as well
+                TEST_CHECK_EQUAL(kink(0.7), surrogates.memoised(kink, 1u, 0.7));
+                TEST_CHECK_EQUAL(kink(0.7), surrogates.memoised(kink, 1u, 0.7));
+                TEST_CHECK_EQUAL(17u + 7u, kink_evaluations);
+
+                // outside of the interval, the function is always evaluated directly
+                TEST_CHECK_EQUAL(smooth(1.5), surrogates.approximated(smooth, 0u, 1.5));
+                TEST_CHECK_EQUAL(9u + 4u, smooth_evaluations);
+
+                // a parameter change discards the surrogates
+                m_B = m_B.evaluate() + 0.1;
+                TEST_CHECK_NEARLY_EQUAL(smooth(0.5), surrogates.approximated(smooth, 0u, 0.5), 1.0e-12);
+                TEST_CHECK_EQUAL(9u + 4u + 10u, smooth_evaluations);
+            }
+        }
+} chebyshev_surrogate_test;
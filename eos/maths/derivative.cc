@@ -24,47 +24,65 @@
 
 namespace eos
 {
-    template <>
-    double derivative<1u, deriv::TwoSided>(const std::function<double (const double &)> & f, const double & x0)
+    namespace deriv
     {
-        static const double eps = std::numeric_limits<double>::epsilon(), sqrteps = std::sqrt(eps);
-
-        double h;
-        if (x0 > 4.0 * sqrteps)
+        double
+        TwoSidedStencil<1u>::step(const double & x0)
         {
-            h = sqrteps * x0;
-        }
-        else
-        {
-            h = 4.0 * sqrteps;
+            static const double eps = std::numeric_limits<double>::epsilon(), sqrteps = std::sqrt(eps);
+
+            if (std::abs(x0) > 4.0 * sqrteps)
+            {
+                return sqrteps * std::abs(x0);
+            }
+            else
+            {
+                return 4.0 * sqrteps;
+            }
         }
 
-        // use a 5-point stencil for the central difference quotient
-        double numerator = f(x0 - 2.0 * h) - 8.0 * f(x0 - h) + 8.0 * f(x0 + h) - f(x0 + 2.0 * h);
-        double denominator = 12.0 * h;
+        double
+        TwoSidedStencil<2u>::step(const double & x0)
+        {
+            static const double eps = std::numeric_limits<double>::epsilon(), sqrteps = std::sqrt(eps), sqrt2eps = std::sqrt(sqrteps);
 
-        return numerator / denominator;
+            if (std::abs(x0) > 4.0 * sqrt2eps)
+            {
+                return sqrt2eps * std::abs(x0);
+            }
+            else
+            {
+                return 4.0 * sqrt2eps;
+            }
+        }
     }
 
-    template <>
-    double derivative<2u, deriv::TwoSided>(const std::function<double (const double &)> & f, const double & x0)
+    template <unsigned order_>
+    static double
+    two_sided_derivative(const std::function<double (const double &)> & f, const double & x0)
     {
-        static const double eps = std::numeric_limits<double>::epsilon(), sqrteps = std::sqrt(eps), sqrt2eps = std::sqrt(sqrteps);
+        using Stencil = deriv::TwoSidedStencil<order_>;
 
-        double h;
-        if (x0 > 4.0 * sqrt2eps)
-        {
-            h = sqrt2eps * x0;
-        }
-        else
+        const double h = Stencil::step(x0);
+
+        double numerator = 0.0;
+        for (auto i = 0u ; i < Stencil::offsets.size() ; ++i)
         {
-            h = 4.0 * sqrt2eps;
+            numerator += Stencil::weights[i] * f(x0 + Stencil::offsets[i] * h);
         }
 
-        // use a 5-point stencil for the central difference quotient
-        double numerator = -f(x0 - 2.0 * h) + 16.0 * f(x0 - h) - 30.0 * f(x0) + 16.0 * f(x0 + h) - f(x0 + 2.0 * h);
-        double denominator = 12.0 * h * h;
+        return numerator / (Stencil::denominator * std::pow(h, order_));
+    }
 
-        return numerator / denominator;
+    template <>
+    double derivative<1u, deriv::TwoSided>(const std::function<double (const double &)> & f, const double & x0)
+    {
+        return two_sided_derivative<1u>(f, x0);
+    }
+
+    template <>
+    double derivative<2u, deriv::TwoSided>(const std::function<double (const double &)> & f, const double & x0)
+    {
+        return two_sided_derivative<2u>(f, x0);
     }
 }
@@ -20,6 +20,7 @@
 #ifndef EOS_GUARD_EOS_MATHS_DERIVATIVE_HH
 #define EOS_GUARD_EOS_MATHS_DERIVATIVE_HH 1
 
+#include <array>
 #include <functional>
 
 namespace eos
@@ -35,6 +36,35 @@ namespace eos
     namespace deriv
     {
         class TwoSided{ };
+
+        /*
+         * Five-point stencils for the two-sided derivatives of a given order.
+         *
+         * The derivative at point x0 is approximated by
+         *
+         *   sum_i weights[i] * f(x0 + offsets[i] * h) / (denominator * h^order),
+         *
+         * with the step size h = step(x0).
+         */
+        template <unsigned order_> struct TwoSidedStencil;
+
+        template <> struct TwoSidedStencil<1u>
+        {
+            static constexpr std::array<double, 4> offsets{ -2.0, -1.0, +1.0, +2.0 };
+            static constexpr std::array<double, 4> weights{ +1.0, -8.0, +8.0, -1.0 };
+            static constexpr double denominator = 12.0;
+
+            static double step(const double & x0);
+        };
+
+        template <> struct TwoSidedStencil<2u>
+        {
+            static constexpr std::array<double, 5> offsets{ -2.0, -1.0, 0.0, +1.0, +2.0 };
+            static constexpr std::array<double, 5> weights{ -1.0, +16.0, -30.0, +16.0, -1.0 };
+            static constexpr double denominator = 12.0;
+
+            static double step(const double & x0);
+        };
     }
 
     template <>
@@ -0,0 +1,265 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_MATHS_DUAL_HH
+#define EOS_GUARD_EOS_MATHS_DUAL_HH 1
+
+#include <cmath>
+#include <vector>
+
+namespace eos
+{
+    // The elementary functions for dual numbers are found via argument-dependent lookup.
+    // They live in their own namespace to avoid clashing with the namespace eos::exp.
+    namespace ad
+    {
+        /*!
+         * Dual number for forward-mode automatic differentiation.
+         *
+         * A Dual holds a value and its gradient with respect to a set of independent
+         * variables. The number of independent variables is fixed at run time. An empty
+         * gradient represents a constant, i.e., a gradient of zeros of any size.
+         */
+        class Dual
+        {
+            private:
+                double _value;
+
+                std::vector<double> _gradient;
+
+                // apply f(x) -> f(x) + f'(x) dx to our gradient
+                inline Dual & chain(const double & value, const double & derivative)
+                {
+                    _value = value;
+                    for (auto & g : _gradient)
+                    {
+                        g *= derivative;
+                    }
+
+                    return *this;
+                }
+
+            public:
+                ///@name Basic Functions
+                ///@{
+                /// Constructor for a constant.
+                Dual(const double & value = 0.0) :
+                    _value(value)
+                {
+                }
+
+                /// Constructor for a value with a known gradient.
+                Dual(const double & value, const std::vector<double> & gradient) :
+                    _value(value),
+                    _gradient(gradient)
+                {
+                }
+
+                /*!
+                 * Named constructor for one of the independent variables.
+                 *
+                 * @param value The value of the variable.
+                 * @param index The index of the variable among all independent variables.
+                 * @param size  The number of independent variables.
+                 */
+                static Dual variable(const double & value, const unsigned & index, const unsigned & size)
+                {
+                    Dual result(value, std::vector<double>(size, 0.0));
+                    result._gradient[index] = 1.0;
+
+                    return result;
+                }
+                ///@}
+
+                ///@name Access
+                ///@{
+                inline const double & value() const { return _value; }
+
+                inline const std::vector<double> & gradient() const { return _gradient; }
+
+                /// Retrieve the partial derivative with respect to the i-th independent variable.
+                inline double derivative(const unsigned & i) const
+                {
+                    return i < _gradient.size() ? _gradient[i] : 0.0;
+                }
+                ///@}
+
+                ///@name Arithmetic
+                ///@{
+                inline Dual & operator+= (const Dual & rhs)
+                {
+                    if (_gradient.size() < rhs._gradient.size())
+                        _gradient.resize(rhs._gradient.size(), 0.0);
+
+                    for (auto i = 0u ; i < rhs._gradient.size() ; ++i)
+                        _gradient[i] += rhs._gradient[i];
+
+                    _value += rhs._value;
+
+                    return *this;
+                }
+
+                inline Dual & operator-= (const Dual & rhs)
+                {
+                    if (_gradient.size() < rhs._gradient.size())
+                        _gradient.resize(rhs._gradient.size(), 0.0);
+
+                    for (auto i = 0u ; i < rhs._gradient.size() ; ++i)
+                        _gradient[i] -= rhs._gradient[i];
+
+                    _value -= rhs._value;
+
+                    return *this;
+                }
+
+                inline Dual & operator*= (const Dual & rhs)
+                {
+                    // d(a b) = a db + b da
+                    for (auto & g : _gradient)
+                        g *= rhs._value;
+
+                    if (_gradient.size() < rhs._gradient.size())
+                        _gradient.resize(rhs._gradient.size(), 0.0);
+
+                    for (auto i = 0u ; i < rhs._gradient.size() ; ++i)
+                        _gradient[i] += _value * rhs._gradient[i];
+
+                    _value *= rhs._value;
+
+                    return *this;
+                }
+
+                inline Dual & operator/= (const Dual & rhs)
+                {
+                    // d(a / b) = (da - (a / b) db) / b
+                    const double quotient = _value / rhs._value;
+
+                    if (_gradient.size() < rhs._gradient.size())
+                        _gradient.resize(rhs._gradient.size(), 0.0);
+
+                    for (auto i = 0u ; i < rhs._gradient.size() ; ++i)
+                        _gradient[i] -= quotient * rhs._gradient[i];
+
+                    for (auto & g : _gradient)
+                        g /= rhs._value;
+
+                    _value = quotient;
+
+                    return *this;
+                }
+
+                inline Dual operator- () const
+                {
+                    Dual result(*this);
+
+                    return result.chain(-_value, -1.0);
+                }
+                ///@}
+
+                ///@name Elementary Functions
+                ///@{
+                friend inline Dual exp(Dual x)
+                {
+                    const double e = std::exp(x._value);
+
+                    return x.chain(e, e);
+                }
+
+                friend inline Dual log(Dual x)
+                {
+                    return x.chain(std::log(x._value), 1.0 / x._value);
+                }
+
+                friend inline Dual sqrt(Dual x)
+                {
+                    const double s = std::sqrt(x._value);
+
+                    return x.chain(s, 0.5 / s);
+                }
+
+                friend inline Dual pow(Dual x, const double & a)
+                {
+                    return x.chain(std::pow(x._value, a), a * std::pow(x._value, a - 1.0));
+                }
+
+                friend inline Dual sin(Dual x)
+                {
+                    return x.chain(std::sin(x._value), std::cos(x._value));
+                }
+
+                friend inline Dual cos(Dual x)
+                {
+                    return x.chain(std::cos(x._value), -std::sin(x._value));
+                }
+
+                friend inline Dual atan(Dual x)
+                {
+                    return x.chain(std::atan(x._value), 1.0 / (1.0 + x._value * x._value));
+                }
+
+                friend inline Dual abs(Dual x)
+                {
+                    return x.chain(std::abs(x._value), x._value < 0.0 ? -1.0 : 1.0);
+                }
+                ///@}
+
+                friend Dual operator* (const double &, Dual);
+        };
+
+        ///@name Arithmetic Operators
+        ///@{
+        inline Dual operator+ (Dual lhs, const Dual & rhs) { return lhs += rhs; }
+        inline Dual operator- (Dual lhs, const Dual & rhs) { return lhs -= rhs; }
+        inline Dual operator* (Dual lhs, const Dual & rhs) { return lhs *= rhs; }
+        inline Dual operator/ (Dual lhs, const Dual & rhs) { return lhs /= rhs; }
+
+        inline Dual operator* (const double & lhs, Dual rhs) { return rhs.chain(lhs * rhs._value, lhs); }
+
+        inline Dual operator+ (Dual lhs, const double & rhs) { return lhs += Dual(rhs); }
+        inline Dual operator- (Dual lhs, const double & rhs) { return lhs -= Dual(rhs); }
+        inline Dual operator* (Dual lhs, const double & rhs) { return rhs * lhs; }
+        inline Dual operator/ (Dual lhs, const double & rhs) { return lhs /= Dual(rhs); }
+
+        inline Dual operator+ (const double & lhs, Dual rhs) { return rhs += Dual(lhs); }
+        inline Dual operator- (const double & lhs, const Dual & rhs) { return Dual(lhs) -= rhs; }
+        inline Dual operator/ (const double & lhs, const Dual & rhs) { return Dual(lhs) /= rhs; }
+        ///@}
+
+        // make the friend functions visible to ordinary lookup
+        Dual exp(Dual x);
+        Dual log(Dual x);
+
+        inline Dual pow(const Dual & x, const Dual & a)
+        {
+            return exp(a * log(x));
+        }
+
+        ///@name Comparison Operators
+        ///@{
+        inline bool operator<  (const Dual & lhs, const Dual & rhs) { return lhs.value() <  rhs.value(); }
+        inline bool operator>  (const Dual & lhs, const Dual & rhs) { return lhs.value() >  rhs.value(); }
+        inline bool operator<= (const Dual & lhs, const Dual & rhs) { return lhs.value() <= rhs.value(); }
+        inline bool operator>= (const Dual & lhs, const Dual & rhs) { return lhs.value() >= rhs.value(); }
+        ///@}
+    }
+
+    using ad::Dual;
+}
+
+#endif
@@ -0,0 +1,97 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/maths/derivative.hh>
+#include <eos/maths/dual.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class DualTest :
+    public TestCase
+{
+    public:
+        DualTest() :
+            TestCase("dual_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-12;
+
+            // constants and variables
+            {
+                Dual c(3.0);
+                TEST_CHECK_EQUAL(c.value(),         3.0);
+                TEST_CHECK_EQUAL(c.gradient().size(), 0u);
+                TEST_CHECK_EQUAL(c.derivative(1),   0.0);
+
+                Dual x = Dual::variable(2.0, 1, 3);
+                TEST_CHECK_EQUAL(x.value(),         2.0);
+                TEST_CHECK_EQUAL(x.gradient().size(), 3u);
+                TEST_CHECK_EQUAL(x.derivative(0),   0.0);
+                TEST_CHECK_EQUAL(x.derivative(1),   1.0);
+                TEST_CHECK_EQUAL(x.derivative(2),   0.0);
+            }
+
+            // arithmetic in two variables
+            {
+                const Dual x = Dual::variable(2.0, 0, 2);
+                const Dual y = Dual::variable(0.5, 1, 2);
+
+                // f(x, y) = x^2 y - 3 x / y + 7
+                const Dual f = x * x * y - 3.0 * x / y + 7.0;
+                TEST_CHECK_NEARLY_EQUAL(f.value(),          2.0 - 12.0 + 7.0,  eps);
+                TEST_CHECK_NEARLY_EQUAL(f.derivative(0),    2.0 * 2.0 * 0.5 - 3.0 / 0.5, eps);
+                TEST_CHECK_NEARLY_EQUAL(f.derivative(1),    4.0 + 3.0 * 2.0 / 0.25, eps);
+
+                // g(x, y) = (1 - x) / (y + x) - y
+                const Dual g = (1.0 - x) / (y + x) - y;
+                TEST_CHECK_NEARLY_EQUAL(g.value(),          -1.0 / 2.5 - 0.5, eps);
+                TEST_CHECK_NEARLY_EQUAL(g.derivative(0),    (-2.5 - (1.0 - 2.0)) / 6.25, eps);
+                TEST_CHECK_NEARLY_EQUAL(g.derivative(1),    -(1.0 - 2.0) / 6.25 - 1.0, eps);
+
+                TEST_CHECK(x > y);
+                TEST_CHECK(y < 1.0);
+            }
+
+            // elementary functions compared against numerical derivatives
+            {
+                const std::function<double (const double &)> f = [] (const double & x) { return std::exp(-x) * std::sqrt(x) + std::log(x) * std::sin(x) - std::pow(x, 2.5) / std::cos(x) + std::atan(x); };
+                const std::function<Dual (const Dual &)> f_dual = [] (const Dual & x) { return exp(-x) * sqrt(x) + log(x) * sin(x) - pow(x, 2.5) / cos(x) + atan(x); };
+
+                for (double x0 : { 0.3, 0.7, 1.2 })
+                {
+                    const Dual result = f_dual(Dual::variable(x0, 0, 1));
+                    const double reference = derivative<1u, deriv::TwoSided>(f, x0);
+                    TEST_CHECK_NEARLY_EQUAL(result.value(),         f(x0),     eps);
+                    TEST_CHECK_NEARLY_EQUAL(result.derivative(0),   reference, 1e-7);
+                }
+
+                const Dual x = Dual::variable(-1.5, 0, 1);
+                TEST_CHECK_NEARLY_EQUAL(abs(x).value(),                  1.5, eps);
+                TEST_CHECK_NEARLY_EQUAL(abs(x).derivative(0),           -1.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(pow(-x, Dual(2.0)).derivative(0), -3.0, eps);
+            }
+        }
+} dual_test;
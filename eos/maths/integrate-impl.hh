@@ -31,65 +31,65 @@
 
 namespace eos
 {
-    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
+    namespace impl
     {
-        if (n & 0x1)
-            n += 1;
+        // the number of sampling intervals used by integrate1D, which must be even and at least 16
+        inline unsigned simpson_intervals(unsigned n)
+        {
+            if (n & 0x1)
+                n += 1;
 
-        if (n < 16)
-            n = 16;
+            if (n < 16)
+                n = 16;
 
-        // step width
-        double h = (b - a) / n;
+            return n;
+        }
 
-        // evaluate function for every sampling point
-        std::vector<std::array<double, k>> y;
-        for (unsigned i = 0 ; i < n + 1 ; ++i)
+        // Simpson's rule on n + 1 equidistant points y with step width h, including a correction from
+        // the results on the coarser grids; returns false if the correction is too large
+        template <std::size_t k> bool simpson(const std::array<double, k> * y, const unsigned & n, const double & h, std::array<double, k> & result)
         {
-            y.push_back(f(a + i * h));
-        }
+            std::array<double, k> Q0; Q0.fill(0.0);
+            std::array<double, k> Q1; Q1.fill(0.0);
+            std::array<double, k> Q2; Q2.fill(0.0);
 
-        std::array<double, k> Q0; Q0.fill(0.0);
-        std::array<double, k> Q1; Q1.fill(0.0);
-        std::array<double, k> Q2; Q2.fill(0.0);
+            for (unsigned i = 0 ; i < n / 8 ; ++i)
+            {
+                Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 4 ; ++i)
+            {
+                Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
+            }
+            for (unsigned i = 0 ; i < n / 2 ; ++i)
+            {
+                Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
+            }
 
-        for (unsigned i = 0 ; i < n / 8 ; ++i)
-        {
-            Q0 = Q0 + y[8 * i] + 4.0 * y[8 * i + 4] + y[8 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 4 ; ++i)
-        {
-            Q1 = Q1 + y[4 * i] + 4.0 * y[4 * i + 2] + y[4 * i + 4];
-        }
-        for (unsigned i = 0 ; i < n / 2 ; ++i)
-        {
-            Q2 = Q2 + y[2 * i] + 4.0 * y[2 * i + 1] + y[2 * i + 2];
-        }
+            Q0 = (h / 3.0 * 4.0) * Q0;
+            Q1 = (h / 3.0 * 2.0) * Q1;
+            Q2 = (h / 3.0) * Q2;
 
-        Q0 = (h / 3.0 * 4.0) * Q0;
-        Q1 = (h / 3.0 * 2.0) * Q1;
-        Q2 = (h / 3.0) * Q2;
+            std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
+            std::array<double, k> num = Q2 - Q1;
+            std::array<double, k> correction = divide(mult(num, num), denom);
 
-        std::array<double, k> denom = Q0 + Q2 - 2.0 * Q1;
-        std::array<double, k> num = Q2 - Q1;
-        std::array<double, k> correction = divide(mult(num, num), denom);
+            bool correction_valid = true;
+            for (unsigned i = 0 ; i < k ; ++i)
+            {
+                if (std::isnan(correction[i]))
+                {
+                    correction_valid = false;
+                    break;
+                }
+            }
 
-        bool correction_valid = true;
-        for (unsigned i = 0 ; i < k ; ++i)
-        {
-            if (std::isnan(correction[i]))
+            if (!correction_valid)
             {
-                correction_valid = false;
-                break;
+                result = Q2;
+                return true;
             }
-        }
 
-        if (!correction_valid)
-        {
-            return Q2;
-        }
-        else
-        {
             bool correction_small = true;
 
             for (unsigned i = 0 ; i < k ; ++i)
@@ -103,19 +103,85 @@ namespace eos
 
             if (correction_small)
             {
-                return Q2 - correction;
+                result = Q2 - correction;
             }
-            else
+
+            return correction_small;
+        }
+    }
+
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<void (const std::span<const double> &, const std::span<std::array<double, k>> &)> & f, unsigned n, const double & a, const double & b)
+    {
+        n = impl::simpson_intervals(n);
+
+        // step width
+        double h = (b - a) / n;
+
+        // evaluate function for all sampling points at once
+        std::vector<double> x(n + 1);
+        for (unsigned i = 0 ; i < n + 1 ; ++i)
+        {
+            x[i] = a + i * h;
+        }
+
+        std::vector<std::array<double, k>> y(n + 1);
+        f(x, y);
+
+        std::array<double, k> result;
+        if (impl::simpson(y.data(), n, h, result))
+            return result;
+
+        // reintegrate with twice the number of data points
+        return integrate1D(f, 2 * n, a, b);
+    }
+
+    template <std::size_t k> std::vector<std::array<double, k>> integrate1D(const std::function<void (const std::span<const double> &, const std::span<std::array<double, k>> &)> & f, unsigned n, const std::vector<std::array<double, 2>> & intervals)
+    {
+        n = impl::simpson_intervals(n);
+
+        // evaluate function for all sampling points of all intervals at once
+        std::vector<double> x;
+        x.reserve(intervals.size() * (n + 1));
+        for (const auto & interval : intervals)
+        {
+            const double h = (interval[1] - interval[0]) / n;
+
+            for (unsigned i = 0 ; i < n + 1 ; ++i)
             {
-#if 0
-                std::cerr << "Q0 = " << Q0 << std::endl;
-                std::cerr << "Q1 = " << Q1 << std::endl;
-                std::cerr << "Q2 = " << Q2 << std::endl;
-                std::cerr << "Reintegrating with twice the number of data points" << std::endl;
-#endif
-                return integrate1D(f, 2 * n, a, b);
+                x.push_back(interval[0] + i * h);
             }
         }
+
+        std::vector<std::array<double, k>> y(x.size());
+        f(x, y);
+
+        std::vector<std::array<double, k>> result(intervals.size());
+        for (std::size_t j = 0 ; j < intervals.size() ; ++j)
+        {
+            const double h = (intervals[j][1] - intervals[j][0]) / n;
+
+            if (impl::simpson(y.data() + j * (n + 1), n, h, result[j]))
+                continue;
+
+            // reintegrate this interval with twice the number of data points, as integrate1D(f, n, a, b) does
+            result[j] = integrate1D(f, 2 * n, intervals[j][0], intervals[j][1]);
+        }
+
+        return result;
+    }
+
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b)
+    {
+        const std::function<void (const std::span<const double> &, const std::span<std::array<double, k>> &)> g =
+            [&f] (const std::span<const double> & x, const std::span<std::array<double, k>> & y)
+            {
+                for (std::size_t i = 0 ; i < x.size() ; ++i)
+                {
+                    y[i] = f(x[i]);
+                }
+            };
+
+        return integrate1D(g, n, a, b);
     }
 
     namespace cubature
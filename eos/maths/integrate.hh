@@ -32,6 +32,8 @@
 
 #include <array>
 #include <functional>
+#include <span>
+#include <vector>
 
 namespace eos
 {
@@ -50,6 +52,28 @@ namespace eos
     complex<double> integrate1D(const std::function<complex<double> (const double &)> & f, unsigned n, const double & a, const double & b);
 
     template <std::size_t k> std::array<double, k> integrate1D(const std::function<std::array<double, k> (const double &)> & f, unsigned n, const double & a, const double & b);
+
+    /*!
+     * Numerically integrate functions of one real-valued parameter, evaluating the integrand
+     * on all sampling points at once.
+     *
+     * The integrand receives the sampling points and must fill one result per point.
+     * This allows it to share work across sampling points, e.g., parameter lookups.
+     */
+    template <std::size_t k> std::array<double, k> integrate1D(const std::function<void (const std::span<const double> &, const std::span<std::array<double, k>> &)> & f, unsigned n, const double & a, const double & b);
+
+    /*!
+     * As above, over several intervals at once.
+     *
+     * Each interval is integrated with the same rule and the same number of sampling points as in
+     * integrate1D(f, n, a, b), and the result for each interval is identical. The sampling points
+     * of all intervals are evaluated in a single call of f.
+     *
+     * @param f         Batched integrand, see above.
+     * @param n         Number of sampling intervals per interval of integration.
+     * @param intervals Lower and upper boundaries of each interval of integration.
+     */
+    template <std::size_t k> std::vector<std::array<double, k>> integrate1D(const std::function<void (const std::span<const double> &, const std::span<std::array<double, k>> &)> & f, unsigned n, const std::vector<std::array<double, 2>> & intervals);
     /// @}
 
 namespace GSL
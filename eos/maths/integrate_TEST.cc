@@ -78,6 +78,33 @@ class IntegrateTest :
             std::cout << "\\int_0.0^exp(1) f4(x) dx = " << q4 << ", eps = " << std::abs(i4 - q4) / q4 << " over 16 points" << std::endl;
             TEST_CHECK_RELATIVE_ERROR(i4, q4, eps);
 
+            // batched integrand yielding f1 and f3 on all sampling points at once
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 2>> &)> f13 =
+                [] (const std::span<const double> & x, const std::span<std::array<double, 2>> & y)
+                {
+                    for (std::size_t i = 0 ; i < x.size() ; ++i)
+                    {
+                        y[i] = std::array<double, 2>{ f1(x[i]), f3(x[i]) };
+                    }
+                };
+            auto q13 = integrate1D(f13, 16, 0.0, 1.0);
+            TEST_CHECK_RELATIVE_ERROR(i1,                  q13[0], eps);
+            TEST_CHECK_RELATIVE_ERROR(1.0 - std::exp(-1.0), q13[1], eps);
+
+            // several intervals with the same rule as for a single interval
+            {
+                const std::vector<std::array<double, 2>> intervals{ { 0.0, 1.0 }, { 0.5, 2.0 }, { 0.25, 0.5 } };
+                auto q = integrate1D(f13, 64, intervals);
+                TEST_CHECK_EQUAL(q.size(), 3u);
+
+                for (auto i = 0u ; i < intervals.size() ; ++i)
+                {
+                    const auto single = integrate1D(f13, 64, intervals[i][0], intervals[i][1]);
+                    TEST_CHECK_EQUAL(q[i][0], single[0]);
+                    TEST_CHECK_EQUAL(q[i][1], single[1]);
+                }
+            }
+
             auto config_QNG = GSL::QNG::Config().epsrel(eps);
             q4 = integrate<GSL::QNG>(f4obj, 1.0, std::exp(1), config_QNG);
             std::cout << "\\int_0.0^exp(1) f4(x) dx = " << q4 << ", eps = " << std::abs(i4 - q4) / q4 << " with QNG" << std::endl;
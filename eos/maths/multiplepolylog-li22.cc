@@ -1054,4 +1054,17 @@ namespace eos
 
         return li22_impl::li22basic(x2,y2);
     }
+
+    void
+    li22(const std::span<const complex<double>> & x, const std::span<const complex<double>> & y, const std::span<complex<double>> & result)
+    {
+        if ((x.size() != y.size()) || (x.size() != result.size()))
+            throw InternalError("li22: the sizes of the arguments and of the results do not match");
+
+        // the algorithm depends strongly on the region of (x, y), and does not lend itself to a branch-free formulation
+        for (std::size_t i = 0 ; i < x.size() ; ++i)
+        {
+            result[i] = li22(x[i], y[i]);
+        }
+    }
 }
@@ -22,9 +22,20 @@
 
 #include <eos/maths/complex.hh>
 
+#include <span>
+
 namespace eos
 {
     complex<double> li22(const complex<double> & x, const complex<double> & y) __attribute__ ((pure));
+
+    /*!
+     * Evaluate Li_{2,2}(x, y) for many pairs of arguments at once.
+     *
+     * @param x      The first arguments.
+     * @param y      The second arguments; must have the same size as x.
+     * @param result The values of Li_{2,2}; must have the same size as x.
+     */
+    void li22(const std::span<const complex<double>> & x, const std::span<const complex<double>> & y, const std::span<complex<double>> & result);
 }
 
 #endif
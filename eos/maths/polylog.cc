@@ -19,11 +19,14 @@
  */
 
 #include <eos/maths/complex.hh>
+#include <eos/maths/polylog.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/utils/exception.hh>
 
 #include <array>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include <iostream>
 
@@ -410,4 +413,180 @@ namespace eos
 
         return quadlog_impl::f1(z);
     }
+
+    namespace polylog_batch_impl
+    {
+        // number of terms of the series around the origin; for |z| < 0.5 the remainder is smaller than 2^-48 relative to the leading term
+        static const unsigned number_of_terms_f0 = 48;
+
+        // the coefficients of the series around the origin, 1 / k^n for k = 0 to number_of_terms_f0
+        template <unsigned n_>
+        std::array<double, number_of_terms_f0 + 1> series_coefficients_f0()
+        {
+            std::array<double, number_of_terms_f0 + 1> result;
+
+            result[0] = 0.0;
+            for (unsigned k = 1 ; k <= number_of_terms_f0 ; ++k)
+            {
+                result[k] = 1.0 / power_of<n_>(double(k));
+            }
+
+            return result;
+        }
+
+        // the real parts of the coefficients of the series in ln(z); their imaginary parts vanish
+        std::array<double, max_iterations> series_coefficients_f1(const std::array<complex<double>, max_iterations> & coefficients)
+        {
+            std::array<double, max_iterations> result;
+
+            for (int i = 0 ; i < max_iterations ; ++i)
+            {
+                result[i] = coefficients[i].real();
+            }
+
+            return result;
+        }
+
+        // Horner scheme for a polynomial with real coefficients c, evaluated at complex arguments x that are
+        // stored as separate arrays of real and imaginary parts. The inner loop over the arguments is free of
+        // branches and can be vectorised by the compiler.
+        template <std::size_t m_>
+        void horner(const std::array<double, m_> & c, const std::vector<double> & x_re, const std::vector<double> & x_im,
+                std::vector<double> & p_re, std::vector<double> & p_im)
+        {
+            const std::size_t size = x_re.size();
+
+            p_re.assign(size, c[m_ - 1]);
+            p_im.assign(size, 0.0);
+
+            for (std::size_t i = m_ - 1 ; i-- > 0 ; )
+            {
+                const double c_i = c[i];
+
+                for (std::size_t j = 0 ; j < size ; ++j)
+                {
+                    const double re = p_re[j] * x_re[j] - p_im[j] * x_im[j] + c_i;
+                    const double im = p_re[j] * x_im[j] + p_im[j] * x_re[j];
+                    p_re[j] = re;
+                    p_im[j] = im;
+                }
+            }
+        }
+
+        // Batched evaluation of the polylogarithm Li_n, using the same regions as the scalar implementations.
+        // The series in each region are evaluated with a fixed number of terms for all arguments at once.
+        template <unsigned n_>
+        void polylog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result,
+                complex<double> (* scalar)(const complex<double> &),
+                complex<double> (* g)(const complex<double> &),
+                const std::array<double, max_iterations> & coefficients_f1,
+                const char * name)
+        {
+            static const std::array<double, number_of_terms_f0 + 1> coefficients_f0 = series_coefficients_f0<n_>();
+
+            // the harmonic number H_{n - 1} and the factor 1 / (n - 1)! of the logarithmic term in the series in ln(z)
+            static const double harmonic_number = (n_ == 2) ? 1.0 : (n_ == 3) ? 3.0 / 2.0 : 11.0 / 6.0;
+            static const double inverse_factorial = (n_ == 2) ? 1.0 : (n_ == 3) ? 1.0 / 2.0 : 1.0 / 6.0;
+
+            // sign of Li_n(1 / z) in the reflection formula
+            static const double sign_reflection = (n_ % 2 == 0) ? -1.0 : +1.0;
+
+            if (z.size() != result.size())
+                throw InternalError(std::string(name) + ": the sizes of the arguments and of the results do not match");
+
+            std::vector<std::size_t> indices_f0, indices_f1;
+            std::vector<double> x_re, x_im, y_re, y_im, p_re, p_im;
+            std::vector<complex<double>> offsets_f0, lnz_f1;
+            std::vector<double> signs_f0;
+
+            indices_f0.reserve(z.size());
+            x_re.reserve(z.size());
+            x_im.reserve(z.size());
+
+            // sort the arguments into the regions of the scalar implementation
+            for (std::size_t i = 0 ; i < z.size() ; ++i)
+            {
+                const double abs_z = std::abs(z[i]);
+
+                if ((z[i] == complex<double>(1.0, 0.0)) || (z[i] == complex<double>(-1.0, 0.0)))
+                {
+                    result[i] = scalar(z[i]);
+                }
+                else if (abs_z < 0.5)
+                {
+                    indices_f0.push_back(i);
+                    x_re.push_back(z[i].real());
+                    x_im.push_back(z[i].imag());
+                    offsets_f0.push_back(0.0);
+                    signs_f0.push_back(+1.0);
+                }
+                else if (abs_z > 2.0)
+                {
+                    const complex<double> w = 1.0 / z[i];
+                    indices_f0.push_back(i);
+                    x_re.push_back(w.real());
+                    x_im.push_back(w.imag());
+                    offsets_f0.push_back(g(z[i]));
+                    signs_f0.push_back(sign_reflection);
+                }
+                else
+                {
+                    const complex<double> lnz = std::log(z[i]);
+                    indices_f1.push_back(i);
+                    y_re.push_back(lnz.real());
+                    y_im.push_back(lnz.imag());
+                    lnz_f1.push_back(lnz);
+                }
+            }
+
+            // series around the origin, also used for the reflection formula
+            horner(coefficients_f0, x_re, x_im, p_re, p_im);
+            for (std::size_t j = 0 ; j < indices_f0.size() ; ++j)
+            {
+                result[indices_f0[j]] = offsets_f0[j] + signs_f0[j] * complex<double>(p_re[j], p_im[j]);
+            }
+
+            // series in ln(z)
+            horner(coefficients_f1, y_re, y_im, p_re, p_im);
+            for (std::size_t j = 0 ; j < indices_f1.size() ; ++j)
+            {
+                const complex<double> & lnz = lnz_f1[j];
+                complex<double> lnlnz = std::log(-lnz);
+
+                // cf. the branch fix in the scalar implementations of f1
+                if ((lnz.imag() == 0.0) && (lnz.real() > 0.0))
+                    lnlnz = std::conj(lnlnz);
+
+                result[indices_f1[j]] = complex<double>(p_re[j], p_im[j])
+                    + inverse_factorial * power_of<n_ - 1>(lnz) * (harmonic_number - lnlnz);
+            }
+        }
+    }
+
+    void
+    dilog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result)
+    {
+        static const std::array<double, max_iterations> coefficients_f1 = polylog_batch_impl::series_coefficients_f1(dilog_impl::series_coefficient_f1);
+
+        complex<double> (* scalar)(const complex<double> &) = &dilog;
+        polylog_batch_impl::polylog<2>(z, result, scalar, &dilog_impl::g, coefficients_f1, "dilog");
+    }
+
+    void
+    trilog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result)
+    {
+        static const std::array<double, max_iterations> coefficients_f1 = polylog_batch_impl::series_coefficients_f1(trilog_impl::series_coefficient_f1);
+
+        complex<double> (* scalar)(const complex<double> &) = &trilog;
+        polylog_batch_impl::polylog<3>(z, result, scalar, &trilog_impl::g, coefficients_f1, "trilog");
+    }
+
+    void
+    quadlog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result)
+    {
+        static const std::array<double, max_iterations> coefficients_f1 = polylog_batch_impl::series_coefficients_f1(quadlog_impl::series_coefficient_f1);
+
+        complex<double> (* scalar)(const complex<double> &) = &quadlog;
+        polylog_batch_impl::polylog<4>(z, result, scalar, &quadlog_impl::g, coefficients_f1, "quadlog");
+    }
 }
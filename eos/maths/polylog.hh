@@ -23,6 +23,8 @@
 
 #include <eos/maths/complex.hh>
 
+#include <span>
+
 namespace eos
 {
     complex<double> dilog(const complex<double> & z) __attribute__ ((pure));
@@ -30,6 +32,25 @@ namespace eos
     complex<double> trilog(const complex<double> & z) __attribute__ ((pure));
 
     complex<double> quadlog(const complex<double> & z) __attribute__ ((pure));
+
+    ///@name Batched evaluation
+    ///@{
+    /*!
+     * Evaluate the di-, tri- or quadlogarithm for many arguments at once.
+     *
+     * The arguments are sorted into the regions of the scalar implementation. Within each
+     * region, the series are evaluated with a fixed number of terms for all arguments at once,
+     * which allows the compiler to vectorise them.
+     *
+     * @param z      The arguments.
+     * @param result The values of the polylogarithm; must have the same size as z.
+     */
+    void dilog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result);
+
+    void trilog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result);
+
+    void quadlog(const std::span<const complex<double>> & z, const std::span<complex<double>> & result);
+    ///@}
 }
 
 #endif
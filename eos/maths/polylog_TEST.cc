@@ -24,6 +24,7 @@
 #include <fstream>
 
 #include <iomanip>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -101,3 +102,62 @@ class PolylogarithmTest :
             TEST_CHECK_RELATIVE_ERROR(real(quadlog(-c05)), +real(quadlog(zbar)), eps); // has no imaginary part
         }
 } polylogarithm_test;
+
+class PolylogarithmBatchTest :
+    public TestCase
+{
+    public:
+        PolylogarithmBatchTest() :
+            TestCase("polylogarithm_batch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-13;
+
+            // arguments in all regions of the scalar implementation, including the special cases and the real axis
+            std::vector<complex<double>> z = {
+                { 0.0, 0.0 }, { 1.0, 0.0 }, { -1.0, 0.0 }, { 2.0, 0.0 }, { -2.0, -0.0 }, { 0.5, 0.0 }, { -0.5, -0.0 },
+                { 1.5, 0.0 }, { 3.0, 0.0 }, { 1.0, -0.0 }, { 1e-8, 1e-8 }, { 1e-3, -2e-3 }
+            };
+            for (int i = 0 ; i < 30 ; ++i)
+            {
+                const double phi = 2.0 * M_PI * (i + 0.5) / 30.0;
+                for (const double r : { 0.05, 0.3, 0.49, 0.51, 0.9, 1.0, 1.1, 1.9, 2.1, 7.0, 150.0 })
+                {
+                    z.push_back(std::polar(r, phi));
+                }
+            }
+
+            std::vector<complex<double>> result(z.size());
+
+            dilog(z, result);
+            for (std::size_t i = 0 ; i < z.size() ; ++i)
+            {
+                const complex<double> reference = dilog(z[i]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(result[i]), eps * std::max(1.0, abs(reference)));
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(result[i]), eps * std::max(1.0, abs(reference)));
+            }
+
+            trilog(z, result);
+            for (std::size_t i = 0 ; i < z.size() ; ++i)
+            {
+                const complex<double> reference = trilog(z[i]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(result[i]), eps * std::max(1.0, abs(reference)));
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(result[i]), eps * std::max(1.0, abs(reference)));
+            }
+
+            quadlog(z, result);
+            for (std::size_t i = 0 ; i < z.size() ; ++i)
+            {
+                const complex<double> reference = quadlog(z[i]);
+                TEST_CHECK_NEARLY_EQUAL(real(reference), real(result[i]), eps * std::max(1.0, abs(reference)));
+                TEST_CHECK_NEARLY_EQUAL(imag(reference), imag(result[i]), eps * std::max(1.0, abs(reference)));
+            }
+
+            // mismatched sizes are rejected
+            std::vector<complex<double>> too_short(z.size() - 1);
+            TEST_CHECK_THROWS(InternalError, dilog(z, too_short));
+        }
+} polylogarithm_batch_test;
@@ -23,11 +23,6 @@
 #include <eos/maths/power-of.hh>
 
 #include <array>
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_complex_math.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_matrix.h>
 
 namespace eos
 {
@@ -46,6 +41,8 @@ namespace eos
 
             const std::array<double, order_ + 1> _norms;
 
+            const std::array<std::array<double, order_ + 1>, order_ + 1> _coefficient_matrix;
+
             std::array<double, order_ + 1> _calculate_norms() const
             {
                 std::array<double, order_ + 1> result;
@@ -65,11 +62,54 @@ namespace eos
                 return result;
             }
 
+            // The coefficients are computed by induction as derivative evaluated at zero.
+            std::array<std::array<double, order_ + 1>, order_ + 1> _calculate_coefficient_matrix() const
+            {
+                std::array<std::array<double, order_ + 1>, order_ + 1> coefficients{};
+                std::array<std::array<double, order_ + 1>, order_ + 1> coefficients_star{};
+
+                // Fill first column
+                coefficients[0][0]      = 1.0;
+                coefficients_star[0][0] = 1.0;
+
+                // Fill first row, cf. [S:2004B], eq. (1.4), p.2
+                for (unsigned k = 1 ; k <= order_ ; ++k)
+                {
+                    coefficients[0][k]      = - _verblunsky_coefficients[k - 1];
+                    coefficients_star[0][k] = 1.0;
+                }
+
+                // Fill the matrix of derivatives. We use real-valued Verblunsky coefficients only.
+                // The relation is derived from [S:2004B], eq. (1.4-5), p.2
+                for (unsigned k = 1 ; k <= order_ ; ++k)
+                {
+                    for (unsigned i = 1 ; i <= order_ ; ++i)
+                    {
+                        coefficients[i][k]      = i * coefficients[i - 1][k - 1] - _verblunsky_coefficients[k - 1] * coefficients_star[i][k - 1];
+                        coefficients_star[i][k] = coefficients_star[i][k - 1] - i * _verblunsky_coefficients[k - 1] * coefficients[i - 1][k - 1];
+                    }
+                }
+
+                // Normalize all coefficients
+                for (unsigned k = 0 ; k <= order_ ; ++k)
+                {
+                    unsigned factorial_i = 1;
+                    for (unsigned i = 0 ; i <= order_ ; ++i)
+                    {
+                        coefficients[i][k] = coefficients[i][k] / _norms[k] / factorial_i;
+                        factorial_i *= (i + 1);
+                    }
+                }
+
+                return coefficients;
+            }
+
         public:
             SzegoPolynomial(const double & norm_measure, std::array<double, order_> && verblunsky_coefficients) :
                 _norm_measure(norm_measure),
                 _verblunsky_coefficients(verblunsky_coefficients),
-                _norms(_calculate_norms())
+                _norms(_calculate_norms()),
+                _coefficient_matrix(_calculate_coefficient_matrix())
             {
             }
 
@@ -181,86 +221,58 @@ namespace eos
 
             // Table A of the coefficients of the Szego polynomials P_j = A_{i,j} z^i.
             // It can be used e.g. to decompose a polynomial on the orthonormal basis.
-            // The coefficients are computed by induction as derivative evaluated at zero.
             // The result is an upper triangle matrix.
-            gsl_matrix * coefficient_matrix() const
+            const std::array<std::array<double, order_ + 1>, order_ + 1> & coefficient_matrix() const
             {
-                gsl_matrix * coefficients(gsl_matrix_calloc(order_ + 1, order_ + 1));
-                gsl_matrix * coefficients_star(gsl_matrix_calloc(order_ + 1, order_ + 1));
-
-                // Fill first column
-                gsl_matrix_set(coefficients,      0, 0, 1.);
-                gsl_matrix_set(coefficients_star, 0, 0, 1.);
-
-                for (unsigned i = 1 ; i <= order_ ; ++i)
-                {
-                    gsl_matrix_set(coefficients,      i, 0, 0.);
-                    gsl_matrix_set(coefficients_star, i, 0, 0.);
-                }
+                return _coefficient_matrix;
+            }
 
-                // Fill first row, cf. [S:2004B], eq. (1.4), p.2
-                for (unsigned k = 1 ; k <= order_ ; ++k)
-                {
-                    gsl_matrix_set(coefficients,      0, k, - _verblunsky_coefficients[k - 1]);
-                    gsl_matrix_set(coefficients_star, 0, k,                                1.);
-                }
+            // Decompose a polynomial on the orthonormal basis, i.e., solve A . x = c for x,
+            // where c are the coefficients of the polynomial in the monomial basis.
+            std::array<complex<double>, order_ + 1> orthonormal_coefficients(const std::array<complex<double>, order_ + 1> & c) const
+            {
+                std::array<complex<double>, order_ + 1> result;
 
-                // Fill the matrix of derivatives. We use real-valued Verblunsky coefficients only.
-                // The relation is derived from [S:2004B], eq. (1.4-5), p.2
-                for (unsigned k = 1 ; k <= order_ ; ++k)
+                // back substitution, using that A is an upper triangle matrix
+                for (int i = order_ ; i >= 0 ; --i)
                 {
-                    for (unsigned i = 1 ; i <= order_ ; ++i)
+                    complex<double> sum = c[i];
+                    for (unsigned k = i + 1 ; k <= order_ ; ++k)
                     {
-                        gsl_matrix_set(coefficients,      i, k, i * gsl_matrix_get(coefficients, i - 1, k - 1)
-                                        - _verblunsky_coefficients[k - 1] * gsl_matrix_get(coefficients_star, i, k - 1));
-                        gsl_matrix_set(coefficients_star, i, k, gsl_matrix_get(coefficients_star, i, k - 1)
-                                        - i * _verblunsky_coefficients[k - 1] * gsl_matrix_get(coefficients, i - 1, k - 1));
+                        sum -= _coefficient_matrix[i][k] * result[k];
                     }
-                }
 
-                // Normalize all coefficients
-                for (unsigned k = 0 ; k <= order_ ; ++k)
-                {
-                    unsigned factorial_i = 1;
-                    for (unsigned i = 0 ; i <= order_ ; ++i)
-                    {
-                        gsl_matrix_set(coefficients, i, k, gsl_matrix_get(coefficients, i, k) / _norms[k] / factorial_i);
-                        factorial_i *= (i + 1);
-                    }
+                    result[i] = sum / _coefficient_matrix[i][i];
                 }
 
-                return coefficients;
+                return result;
             }
 
             std::array<complex<double>, order_ + 1> derivatives(const complex<double> & z) const
             {
-                gsl_matrix * coefficient_matrix = this->coefficient_matrix();
-
                 // Vector of monomial derivatives: V = [0, 1, 2 z, 3 z^2, ...]
-                // Store real and imaginary part separately for simplicity
-                gsl_vector * monomial_derivatives_real(gsl_vector_calloc(order_ + 1));
-                gsl_vector * monomial_derivatives_imag(gsl_vector_calloc(order_ + 1));
-                complex<double> power_of_z(1.0 , 0.0);
-                gsl_vector_set(monomial_derivatives_real, 0, 0.0);
-                gsl_vector_set(monomial_derivatives_imag, 0, 0.0);
+                std::array<complex<double>, order_ + 1> monomial_derivatives;
+                complex<double> power_of_z(1.0, 0.0);
+                monomial_derivatives[0] = 0.0;
 
                 for (unsigned i = 1 ; i <= order_ ; ++i)
-                    {
-                        gsl_vector_set(monomial_derivatives_real, i, i * real(power_of_z));
-                        gsl_vector_set(monomial_derivatives_imag, i, i * imag(power_of_z));
-                        power_of_z *= z;
-                    }
+                {
+                    monomial_derivatives[i] = static_cast<double>(i) * power_of_z;
+                    power_of_z *= z;
+                }
 
                 // Matrix product result = coefficient_matrix.T * monomial_derivatives
                 // coefficient_matrix is an upper triangular matrix
-                gsl_blas_dtrmv(CblasUpper, CblasTrans, CblasNonUnit, coefficient_matrix, monomial_derivatives_real);
-                gsl_blas_dtrmv(CblasUpper, CblasTrans, CblasNonUnit, coefficient_matrix, monomial_derivatives_imag);
-                std::array<complex<double>, order_ + 1>  result;
+                std::array<complex<double>, order_ + 1> result;
 
-                for (unsigned i = 0 ; i <= order_ ; ++i)
+                for (unsigned k = 0 ; k <= order_ ; ++k)
+                {
+                    result[k] = 0.0;
+                    for (unsigned i = 0 ; i <= k ; ++i)
                     {
-                        result[i] = complex<double>(gsl_vector_get(monomial_derivatives_real, i), gsl_vector_get(monomial_derivatives_imag, i));
+                        result[k] += _coefficient_matrix[i][k] * monomial_derivatives[i];
                     }
+                }
 
                 return result;
             }
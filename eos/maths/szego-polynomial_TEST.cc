@@ -90,12 +90,34 @@ class SzegoPolynomialTest :
             {
                 const auto p = SzegoPolynomial<5u>::FlatMeasure(2.47895); // norm of the measure
 
-                gsl_matrix * coefficient_matrix = p.coefficient_matrix();
+                const auto & coefficient_matrix = p.coefficient_matrix();
 
-                TEST_CHECK_RELATIVE_ERROR(gsl_matrix_get(coefficient_matrix, 0, 0),  0.6351351032391984,  1.0e-5);
-                TEST_CHECK_RELATIVE_ERROR(gsl_matrix_get(coefficient_matrix, 1, 2), -2.24105,  1.0e-5);
-                TEST_CHECK_RELATIVE_ERROR(gsl_matrix_get(coefficient_matrix, 1, 5),  24.1447,  1.0e-5);
-                TEST_CHECK_RELATIVE_ERROR(gsl_matrix_get(coefficient_matrix, 3, 4), -12.6392,  1.0e-5);
+                TEST_CHECK_RELATIVE_ERROR(coefficient_matrix[0][0],  0.6351351032391984,  1.0e-5);
+                TEST_CHECK_RELATIVE_ERROR(coefficient_matrix[1][2], -2.24105,  1.0e-5);
+                TEST_CHECK_RELATIVE_ERROR(coefficient_matrix[1][5],  24.1447,  1.0e-5);
+                TEST_CHECK_RELATIVE_ERROR(coefficient_matrix[3][4], -12.6392,  1.0e-5);
+            }
+
+            // Test the decomposition on the orthonormal basis
+            {
+                const auto p = SzegoPolynomial<5u>::FlatMeasure(2.47895); // norm of the measure
+                const auto & coefficient_matrix = p.coefficient_matrix();
+
+                // the monomial coefficients of 2 P_1 - i P_4
+                std::array<complex<double>, 6> c;
+                for (unsigned i = 0 ; i < 6 ; ++i)
+                {
+                    c[i] = 2.0 * coefficient_matrix[i][1] - complex<double>(0.0, 1.0) * coefficient_matrix[i][4];
+                }
+
+                const auto x = p.orthonormal_coefficients(c);
+
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[0]),                                0.0, 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[1] - complex<double>(2.0,  0.0)), 0.0, 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[2]),                                0.0, 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[3]),                                0.0, 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[4] - complex<double>(0.0, -1.0)), 0.0, 1.0e-12);
+                TEST_CHECK_NEARLY_EQUAL(std::abs(x[5]),                                0.0, 1.0e-12);
             }
 
             // Test the derivatives
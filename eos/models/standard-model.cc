@@ -182,12 +182,21 @@ namespace implementation
         _m_s_MSbar__qcd(p["mass::s(2GeV)"], u),
         _m_d_MSbar__qcd(p["mass::d(2GeV)"], u),
         _m_u_MSbar__qcd(p["mass::u(2GeV)"], u),
-        _m_Z__qcd(p["mass::Z"], u)
+        _m_Z__qcd(p["mass::Z"], u),
+        _alpha_s__qcd(p),
+        _m_b_msbar__qcd(p),
+        _m_c_msbar__qcd(p)
     {
     }
 
     double
     SMComponent<components::QCD>::alpha_s(const double & mu) const
+    {
+        return _alpha_s__qcd([this] (const double & mu) { return this->_evaluate_alpha_s(mu); }, mu);
+    }
+
+    double
+    SMComponent<components::QCD>::_evaluate_alpha_s(const double & mu) const
     {
         double alpha_s_0 = _alpha_s_Z__qcd, mu_0 = _m_Z__qcd;
 
@@ -249,6 +258,12 @@ namespace implementation
 
     double
     SMComponent<components::QCD>::m_b_msbar(const double & mu) const
+    {
+        return _m_b_msbar__qcd([this] (const double & mu) { return this->_evaluate_m_b_msbar(mu); }, mu);
+    }
+
+    double
+    SMComponent<components::QCD>::_evaluate_m_b_msbar(const double & mu) const
     {
         double m_b_MSbar = _m_b_MSbar__qcd();
         double alpha_mu_0 = alpha_s(m_b_MSbar);
@@ -329,6 +344,12 @@ namespace implementation
 
     double
     SMComponent<components::QCD>::m_c_msbar(const double & mu) const
+    {
+        return _m_c_msbar__qcd([this] (const double & mu) { return this->_evaluate_m_c_msbar(mu); }, mu);
+    }
+
+    double
+    SMComponent<components::QCD>::_evaluate_m_c_msbar(const double & mu) const
     {
         double m_c_0 = _m_c_MSbar__qcd();
         double alpha_s_mu0 = alpha_s(m_c_0);
@@ -532,7 +553,8 @@ namespace implementation
         _m_W__deltabs1(p["mass::W"], u),
         _m_Z__deltabs1(p["mass::Z"], u),
         _mu_0c__deltabs1(p["b->s::mu_0c"], u),
-        _mu_0t__deltabs1(p["b->s::mu_0t"], u)
+        _mu_0t__deltabs1(p["b->s::mu_0t"], u),
+        _wilson_coefficients_b_to_s__deltabs1(p)
     {
     }
 
@@ -650,6 +672,12 @@ namespace implementation
          *
          * In the SM there is lepton flavor universality.
          */
+        return _wilson_coefficients_b_to_s__deltabs1([this] (const double & mu) { return this->_evaluate_wilson_coefficients_b_to_s(mu); }, mu);
+    }
+
+    WilsonCoefficients<BToS>
+    SMComponent<components::DeltaBS1>::_evaluate_wilson_coefficients_b_to_s(const double & mu) const
+    {
 
         // Calculation according to [BMU1999], Eq. (25), p. 7
 
@@ -23,6 +23,7 @@
 #define EOS_GUARD_EOS_MODELS_STANDARD_MODEL_HH 1
 
 #include <eos/models/model.hh>
+#include <eos/utils/parameter-memoiser.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 
 namespace eos
@@ -74,6 +75,15 @@ namespace eos
             UsedParameter _m_u_MSbar__qcd;
             UsedParameter _m_Z__qcd;
 
+            /* Results for the present parameter point */
+            ParameterMemoiser<double, double> _alpha_s__qcd;
+            ParameterMemoiser<double, double> _m_b_msbar__qcd;
+            ParameterMemoiser<double, double> _m_c_msbar__qcd;
+
+            double _evaluate_alpha_s(const double & mu) const;
+            double _evaluate_m_b_msbar(const double & mu) const;
+            double _evaluate_m_c_msbar(const double & mu) const;
+
         public:
             SMComponent(const Parameters &, ParameterUser &);
 
@@ -116,6 +126,11 @@ namespace eos
             UsedParameter _mu_0c__deltabs1;
             UsedParameter _mu_0t__deltabs1;
 
+            /* Results for the present parameter point; in the SM they depend only on mu */
+            ParameterMemoiser<WilsonCoefficients<BToS>, double> _wilson_coefficients_b_to_s__deltabs1;
+
+            WilsonCoefficients<BToS> _evaluate_wilson_coefficients_b_to_s(const double & mu) const;
+
         public:
             SMComponent(const Parameters &, ParameterUser &);
 
@@ -172,12 +172,21 @@ namespace eos
         _mu_cP(std::bind(&wcimplementation::cartesian,       _mu_re_cP,       _mu_im_cP)),
         _mu_cPprime(std::bind(&wcimplementation::cartesian,  _mu_re_cPprime,  _mu_im_cPprime)),
         _mu_cT(std::bind(&wcimplementation::cartesian,       _mu_re_cT,       _mu_im_cT)),
-        _mu_cT5(std::bind(&wcimplementation::cartesian,      _mu_re_cT5,      _mu_im_cT5))
+        _mu_cT5(std::bind(&wcimplementation::cartesian,      _mu_re_cT5,      _mu_im_cT5)),
+        _wilson_coefficients_b_to_s__deltabs1(p)
     {
     }
 
     WilsonCoefficients<BToS>
     WilsonScanComponent<components::DeltaBS1>::wilson_coefficients_b_to_s(const double & mu, const std::string & lepton_flavor, const bool & cp_conjugate) const
+    {
+        return _wilson_coefficients_b_to_s__deltabs1([this] (const double & mu, const std::string & lepton_flavor, const bool & cp_conjugate)
+                { return this->_evaluate_wilson_coefficients_b_to_s(mu, lepton_flavor, cp_conjugate); },
+                mu, lepton_flavor, cp_conjugate);
+    }
+
+    WilsonCoefficients<BToS>
+    WilsonScanComponent<components::DeltaBS1>::_evaluate_wilson_coefficients_b_to_s(const double & /*mu*/, const std::string & lepton_flavor, const bool & cp_conjugate) const
     {
         std::function<complex<double> ()> c9,  c9prime;
         std::function<complex<double> ()> c10, c10prime;
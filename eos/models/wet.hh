@@ -108,6 +108,11 @@ namespace eos
             std::function<complex<double> ()> _mu_cT;
             std::function<complex<double> ()> _mu_cT5;
 
+            /* Results for the present parameter point */
+            ParameterMemoiser<WilsonCoefficients<BToS>, double, std::string, bool> _wilson_coefficients_b_to_s__deltabs1;
+
+            WilsonCoefficients<BToS> _evaluate_wilson_coefficients_b_to_s(const double & mu, const std::string & lepton_flavor, const bool & cp_conjugate) const;
+
         public:
             WilsonScanComponent(const Parameters &, const Options &, ParameterUser &);
 
@@ -0,0 +1,152 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/observable-batch.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <exception>
+#include <limits>
+
+namespace eos
+{
+    namespace impl
+    {
+        // an independent clone of the observable, alongside handles to its varied inputs
+        struct ObservableBatchClone
+        {
+            ObservablePtr observable;
+
+            std::vector<KinematicVariable> kinematic_variables;
+
+            std::vector<Parameter> parameters;
+
+            ObservableBatchClone(const ObservablePtr & original, const std::vector<std::string> & kinematic_variable_names, const std::vector<std::string> & parameter_names) :
+                observable(original->clone())
+            {
+                auto k = observable->kinematics();
+                for (const auto & name : kinematic_variable_names)
+                {
+                    kinematic_variables.push_back(k[name]);
+                }
+
+                auto p = observable->parameters();
+                for (const auto & name : parameter_names)
+                {
+                    parameters.push_back(p[name]);
+                }
+            }
+        };
+    }
+
+    void
+    evaluate_batch(const ObservablePtr & observable,
+            const std::vector<std::string> & kinematic_variables, const double * kinematic_points, const unsigned & number_of_kinematic_points,
+            const std::vector<std::string> & parameters, const double * parameter_points, const unsigned & number_of_parameter_points,
+            double * results)
+    {
+        if (! observable)
+            throw InternalError("evaluate_batch: the observable is undefined");
+
+        const unsigned number_of_rows    = parameters.empty()          ? 1u : number_of_parameter_points;
+        const unsigned number_of_columns = kinematic_variables.empty() ? 1u : number_of_kinematic_points;
+        const unsigned long n = static_cast<unsigned long>(number_of_rows) * number_of_columns;
+        if (0 == n)
+            return;
+
+        const unsigned k_dim = kinematic_variables.size(), p_dim = parameters.size();
+
+        // each thread evaluates a contiguous range of points on its own clone, such that the
+        // parameters change as rarely as possible
+        const unsigned long number_of_clones = std::min<unsigned long>(std::max(1u, ThreadPool::instance()->number_of_threads()), n);
+        const unsigned long chunk_size = (n + number_of_clones - 1) / number_of_clones;
+
+        std::vector<impl::ObservableBatchClone> clones;
+        clones.reserve(number_of_clones);
+        for (auto c = 0ul ; c < number_of_clones ; ++c)
+        {
+            clones.emplace_back(observable, kinematic_variables, parameters);
+        }
+
+        std::vector<std::exception_ptr> errors(number_of_clones);
+        std::vector<Ticket> tickets;
+        tickets.reserve(number_of_clones);
+        for (auto c = 0ul ; c < number_of_clones ; ++c)
+        {
+            auto work = [&, c]()
+            {
+                auto & clone = clones[c];
+
+                // evaluations that fail with an eos::Exception yield NaN; any other exception is rethrown once all threads have finished
+                try
+                {
+                    unsigned long current_row = number_of_rows;
+                    for (auto i = c * chunk_size, i_end = std::min(n, (c + 1) * chunk_size) ; i < i_end ; ++i)
+                    {
+                        const unsigned long row = i / number_of_columns, column = i % number_of_columns;
+
+                        if ((row != current_row) && (0 != p_dim))
+                        {
+                            for (auto j = 0u ; j < p_dim ; ++j)
+                            {
+                                clone.parameters[j].set(parameter_points[row * p_dim + j]);
+                            }
+                        }
+                        current_row = row;
+
+                        for (auto j = 0u ; j < k_dim ; ++j)
+                        {
+                            clone.kinematic_variables[j].set(kinematic_points[column * k_dim + j]);
+                        }
+
+                        try
+                        {
+                            results[i] = clone.observable->evaluate();
+                        }
+                        catch (Exception & e)
+                        {
+                            Log::instance()->message("evaluate_batch", ll_error)
+                                << "Exception encountered when evaluating observable '" << clone.observable->name() << "[" << clone.observable->kinematics().as_string() << "];"
+                                << clone.observable->options().as_string() << "': " << e.what();
+                            results[i] = std::numeric_limits<double>::quiet_NaN();
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    errors[c] = std::current_exception();
+                }
+            };
+            tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(work)));
+        }
+
+        for (auto & ticket : tickets)
+        {
+            ticket.wait();
+        }
+
+        for (const auto & error : errors)
+        {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+}
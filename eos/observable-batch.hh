@@ -0,0 +1,63 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_OBSERVABLE_BATCH_HH
+#define EOS_GUARD_EOS_OBSERVABLE_BATCH_HH 1
+
+#include <eos/observable.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * Evaluate an observable for a batch of kinematic points and, optionally, of parameter points.
+     *
+     * The evaluations are distributed over the threads of the ThreadPool, each of which uses
+     * its own clone of the observable. The clones are created in the calling thread, and take
+     * over the values of all other parameters and kinematic variables at the time of the call.
+     * The observable itself is not modified.
+     *
+     * Evaluations that fail with an eos::Exception yield NaN, and the exception is logged with
+     * level ll_error. Any other exception is rethrown once all threads have finished.
+     *
+     * @param observable                  The observable to be evaluated.
+     * @param kinematic_variables         The names of the kinematic variables that are varied. May be empty.
+     * @param kinematic_points            The values of the kinematic variables, in row-major order, i.e.,
+     *                                    number_of_kinematic_points rows of kinematic_variables.size() values.
+     * @param number_of_kinematic_points  The number of kinematic points. Ignored if kinematic_variables is empty.
+     * @param parameters                  The names of the parameters that are varied. May be empty.
+     * @param parameter_points            The values of the parameters, in row-major order, i.e.,
+     *                                    number_of_parameter_points rows of parameters.size() values.
+     * @param number_of_parameter_points  The number of parameter points. Ignored if parameters is empty.
+     * @param results                     The array of values of the observable, in row-major order, i.e.,
+     *                                    one row per parameter point, with one value per kinematic point.
+     *                                    If parameters is empty, the array comprises a single row.
+     *                                    If kinematic_variables is empty, each row comprises a single value.
+     *
+     * @warning Must not be called from within a thread of the ThreadPool.
+     */
+    void evaluate_batch(const ObservablePtr & observable,
+            const std::vector<std::string> & kinematic_variables, const double * kinematic_points, const unsigned & number_of_kinematic_points,
+            const std::vector<std::string> & parameters, const double * parameter_points, const unsigned & number_of_parameter_points,
+            double * results);
+}
+
+#endif
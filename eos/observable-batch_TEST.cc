@@ -0,0 +1,106 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/observable.hh>
+#include <eos/observable-batch.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+class ObservableBatchTest :
+    public TestCase
+{
+    public:
+        ObservableBatchTest() :
+            TestCase("observable_batch_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            p["CKM::abs(V_cb)"] = 0.042;
+
+            Kinematics k{ { "q2", 1.0 } };
+            Options o{ { "model", "CKM" }, { "form-factors", "BSZ2015" }, { "l", "mu" } };
+
+            auto observable = Observable::make("B->Dlnu::dBR/dq2", p, k, o);
+            TEST_CHECK(observable);
+
+            const std::vector<double> q2{ 0.5, 1.5, 2.5, 4.0, 6.0, 8.0, 10.0 };
+
+            // kinematic points only
+            {
+                std::vector<double> results(q2.size());
+                evaluate_batch(observable, { "q2" }, q2.data(), q2.size(), { }, nullptr, 0, results.data());
+
+                for (auto i = 0u ; i < q2.size() ; ++i)
+                {
+                    k["q2"] = q2[i];
+                    TEST_CHECK_RELATIVE_ERROR(observable->evaluate(), results[i], 1.0e-14);
+                }
+            }
+
+            // kinematic and parameter points; the branching ratio scales with |V_cb|^2
+            {
+                const std::vector<double> v_cb{ 0.040, 0.041, 0.043 };
+                std::vector<double> results(v_cb.size() * q2.size());
+
+                k["q2"] = 1.0;
+                evaluate_batch(observable, { "q2" }, q2.data(), q2.size(), { "CKM::abs(V_cb)" }, v_cb.data(), v_cb.size(), results.data());
+
+                // the observable and its parameters are not modified
+                TEST_CHECK_EQUAL(0.042, p["CKM::abs(V_cb)"].evaluate());
+                TEST_CHECK_EQUAL(1.0,   k["q2"].evaluate());
+
+                for (auto j = 0u ; j < v_cb.size() ; ++j)
+                {
+                    for (auto i = 0u ; i < q2.size() ; ++i)
+                    {
+                        k["q2"] = q2[i];
+                        TEST_CHECK_RELATIVE_ERROR(observable->evaluate() * std::pow(v_cb[j] / 0.042, 2), results[j * q2.size() + i], 1.0e-12);
+                    }
+                }
+            }
+
+            // parameter points only
+            {
+                const std::vector<double> v_cb{ 0.040, 0.044 };
+                std::vector<double> results(v_cb.size());
+
+                k["q2"] = 2.0;
+                evaluate_batch(observable, { }, nullptr, 0, { "CKM::abs(V_cb)" }, v_cb.data(), v_cb.size(), results.data());
+
+                TEST_CHECK_RELATIVE_ERROR(observable->evaluate() * std::pow(0.040 / 0.042, 2), results[0], 1.0e-12);
+                TEST_CHECK_RELATIVE_ERROR(observable->evaluate() * std::pow(0.044 / 0.042, 2), results[1], 1.0e-12);
+            }
+
+            // unknown kinematic variables and parameters
+            {
+                std::vector<double> results(q2.size());
+                TEST_CHECK_THROWS(UnknownKinematicVariableError, evaluate_batch(observable, { "q2_min" }, q2.data(), q2.size(), { }, nullptr, 0, results.data()));
+                TEST_CHECK_THROWS(UnknownParameterError, evaluate_batch(observable, { "q2" }, q2.data(), 1, { "CKM::qwerty" }, q2.data(), 1, results.data()));
+            }
+        }
+} observable_batch_test;
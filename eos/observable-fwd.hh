@@ -28,6 +28,8 @@ namespace eos
 
     class CacheableObservable;
 
+    class DifferentiableObservable;
+
     using ObservablePtr = std::shared_ptr<Observable>;
 
     class ObservableEntry;
@@ -138,6 +138,25 @@ namespace eos
         return result;
     }
 
+    /* Helper function to create ObservableEntry for a regular observable that also provides its gradient */
+    template <typename Decay_, typename Tuple_, typename ... Args_>
+    std::pair<QualifiedName, ObservableEntryPtr> make_observable(const char * name,
+            const char * latex,
+            const Unit & unit,
+            double (Decay_::* function)(const Args_ & ...) const,
+            Dual (Decay_::* gradient_function)(const std::vector<Parameter> &, const Args_ & ...) const,
+            const Tuple_ & kinematics_names,
+            const Options & forced_options = Options{})
+    {
+        QualifiedName qn(name);
+
+        auto result = std::make_pair(qn, make_concrete_observable_entry(qn, latex, unit, function, gradient_function, kinematics_names, forced_options));
+
+        impl::observable_entries.insert(result);
+
+        return result;
+    }
+
     /* Helper functions to create ObservableEntry for a cacheable observable */
     template <typename Decay_, typename Tuple_, typename ... Args_>
     std::pair<QualifiedName, ObservableEntryPtr> make_cacheable_observable(const char * name,
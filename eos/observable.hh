@@ -22,6 +22,7 @@
 
 #include <eos/observable-fwd.hh>
 #include <eos/reference.hh>
+#include <eos/maths/dual.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/instantiation_policy.hh>
 #include <eos/utils/kinematic.hh>
@@ -81,6 +82,64 @@ namespace eos
             virtual double evaluate() const = 0;
 
             virtual ObservablePtr make_cached_observable(const CacheableObservable *) const = 0;
+
+            /*!
+             * Create an observable that differs from another cacheable observable of the same type only in its bin,
+             * and whose intermediate result is prepared alongside the other observable's intermediate result.
+             *
+             * Returns nullptr if this is not supported.
+             */
+            virtual ObservablePtr make_binned_observable(CacheableObservable *) const
+            {
+                return { nullptr };
+            }
+    };
+
+    /**
+     * DifferentiableObservable is an opt-in interface for such observables
+     * that can provide their gradient with respect to a set of parameters by
+     * means of forward-mode automatic differentiation.
+     */
+    class DifferentiableObservable
+    {
+        public:
+            virtual ~DifferentiableObservable() = default;
+
+            /*!
+             * Whether evaluate_with_gradient() can be used. Observables that implement this interface
+             * for only some of their options, e.g., for some of their form factor parametrizations,
+             * return false for all other options.
+             */
+            virtual bool differentiable() const
+            {
+                return true;
+            }
+
+            /*!
+             * Evaluate the observable alongside its gradient.
+             *
+             * @param parameters The parameters with respect to which the gradient is computed.
+             *                   The i-th gradient component corresponds to the i-th parameter.
+             */
+            virtual Dual evaluate_with_gradient(const std::vector<Parameter> & parameters) const = 0;
+
+        protected:
+            /*!
+             * Read a parameter's value as a dual number.
+             *
+             * @param parameter  The parameter whose value shall be read.
+             * @param parameters The parameters with respect to which the gradient is computed.
+             */
+            static Dual read(const Parameter & parameter, const std::vector<Parameter> & parameters)
+            {
+                for (auto i = 0u ; i < parameters.size() ; ++i)
+                {
+                    if (parameters[i].id() == parameter.id())
+                        return Dual::variable(parameter.evaluate(), i, parameters.size());
+                }
+
+                return Dual(parameter.evaluate());
+            }
     };
 
     /**
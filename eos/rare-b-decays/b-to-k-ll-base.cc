@@ -87,4 +87,16 @@ namespace eos
         return power_of<2>(g_fermi * alpha_e() * lambda_t) * sqrt(lambda(s)) * beta_l(s) * xi_pseudo(s) * xi_pseudo(s) /
                        (512.0 * power_of<5>(M_PI) * power_of<3>(m_B()));
     }
+
+    void
+    BToKDilepton::AmplitudeGenerator::amplitudes(const std::span<const double> & q2, const std::span<BToKDilepton::Amplitudes> & result) const
+    {
+        if (q2.size() != result.size())
+            throw InternalError("BToKDilepton::AmplitudeGenerator::amplitudes: size mismatch between q2 and result");
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            result[i] = this->amplitudes(q2[i]);
+        }
+    }
 }
@@ -26,6 +26,8 @@
 #include <eos/rare-b-decays/b-to-k-ll.hh>
 #include <eos/utils/options-impl.hh>
 
+#include <span>
+
 namespace eos
 {
     class BToKDilepton::AmplitudeGenerator :
@@ -59,6 +61,18 @@ namespace eos
 
             virtual ~AmplitudeGenerator();
             virtual BToKDilepton::Amplitudes amplitudes(const double & q2) const = 0;
+
+            /*!
+             * Evaluate the amplitudes on a grid of q2 values.
+             *
+             * The default implementation evaluates the amplitudes point by point.
+             * Derived classes can override it to compute the q2-independent inputs
+             * only once per grid.
+             *
+             * @param q2     The values of q2.
+             * @param result The amplitudes, one per value of q2.
+             */
+            virtual void amplitudes(const std::span<const double> & q2, const std::span<BToKDilepton::Amplitudes> & result) const;
     };
 
     struct BToKDilepton::DipoleFormFactors
@@ -269,8 +269,9 @@ namespace eos
 
         // cf. [BF2001] Eq. (22 + TODO: 31)
         // cf. [BF2001] Eq. (22 + TODO: 30)
-        double f_t_over_f_p = form_factors->f_t(s) / form_factors->f_p(s);
-        double f_0_over_f_p = form_factors->f_0(s) / form_factors->f_p(s);
+        const auto ff = form_factors->evaluate_all(s);
+        double f_t_over_f_p = ff.f_t / ff.f_p;
+        double f_0_over_f_p = ff.f_0 / ff.f_p;
 
         double F_Tkin = f_t_over_f_p * 2.0 * std::sqrt(lambda(s)) * beta_l(s) / (m_B() + m_K());
         double F_Skin = f_0_over_f_p * 0.5 * (power_of<2>(m_B()) - power_of<2>(m_K())) / (m_b_MSbar - m_s_MSbar);
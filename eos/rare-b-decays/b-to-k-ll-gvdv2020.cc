@@ -26,6 +26,8 @@
 #include <eos/rare-b-decays/qcdf-integrals.hh>
 #include <eos/utils/memoise.hh>
 
+#include <vector>
+
 #include <gsl/gsl_sf.h>
 
 namespace eos
@@ -50,9 +52,33 @@ namespace eos
     {
     }
 
+    BToKDileptonAmplitudes<tag::GvDV2020>::Inputs
+    BToKDileptonAmplitudes<tag::GvDV2020>::inputs(const WilsonCoefficients<BToS> & wc) const
+    {
+        complex<double> lambda_hat_u = (model->ckm_ub() * conj(model->ckm_us())) / (model->ckm_tb() * conj(model->ckm_ts()));
+        if (cp_conjugate)
+            lambda_hat_u = std::conj(lambda_hat_u);
+
+        return Inputs{
+            wc,
+            ShortDistanceLowRecoil::c8eff(wc), // LO C8eff
+            lambda_hat_u,
+            model->alpha_s(mu()), // alpha_s at the hard scale
+            this->m_b_PS()
+        };
+    }
+
     BToKDilepton::DipoleFormFactors
     BToKDileptonAmplitudes<tag::GvDV2020>::dipole_form_factors(const double & s, const WilsonCoefficients<BToS> & wc) const
     {
+        return dipole_form_factors(s, inputs(wc), xi_pseudo(s));
+    }
+
+    BToKDilepton::DipoleFormFactors
+    BToKDileptonAmplitudes<tag::GvDV2020>::dipole_form_factors(const double & s, const Inputs & in, const double & xi_pseudo) const
+    {
+        const WilsonCoefficients<BToS> & wc = in.wc;
+
         // charges of down- and up-type quarks
         static const double e_d = -1.0 / 3.0;
         static const double e_u = +2.0 / 3.0;
@@ -66,14 +92,11 @@ namespace eos
         }
 
         // kinematics
-        double m_b_PS = this->m_b_PS();
+        const double & m_b_PS = in.m_b_PS;
 
         // couplings
-        double alpha_s_mu = model->alpha_s(mu()); // alpha_s at the hard scale
-        double a_mu = alpha_s_mu * QCD::casimir_f / 4.0 / M_PI;
-        complex<double> lambda_hat_u = (model->ckm_ub() * conj(model->ckm_us())) / (model->ckm_tb() * conj(model->ckm_ts()));
-        if (cp_conjugate)
-            lambda_hat_u = std::conj(lambda_hat_u);
+        double a_mu = in.alpha_s_mu * QCD::casimir_f / 4.0 / M_PI;
+        const complex<double> & lambda_hat_u = in.lambda_hat_u;
 
 
         // inverse of the "negative" moment of the B meson LCDA
@@ -99,7 +122,7 @@ namespace eos
                 - CharmLoops::h(mu, s));
 
         /* Effective wilson coefficients */
-        complex<double> c8eff = ShortDistanceLowRecoil::c8eff(wc); // LO C8eff
+        const complex<double> & c8eff = in.c8eff; // LO C8eff
 
         /* top sector */
         // cf. [BHP2007], Eq. (B.2) and [BFS2001], Eqs. (14), (15), p. 5, in comparison with \delta_{2,3} = 1
@@ -154,7 +177,7 @@ namespace eos
 
         // cf. [BFS2001], Eq. (15), and [BHP2008], Eq. (C.4)
         BToKDilepton::DipoleFormFactors result;
-        result.calT = xi_pseudo(s) * C_psd + power_of<2>(M_PI) / 3.0 * (f_B * f_K) / m_B * T_psd;
+        result.calT = xi_pseudo * C_psd + power_of<2>(M_PI) / 3.0 * (f_B * f_K) / m_B * T_psd;
 
         return result;
     }
@@ -185,43 +208,69 @@ namespace eos
     {
         BToKDilepton::Amplitudes result;
 
-        WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavor, cp_conjugate);
+        this->amplitudes(std::span<const double>(&s, 1), std::span<BToKDilepton::Amplitudes>(&result, 1));
 
-        auto dff = dipole_form_factors(s, wc);
-
-        const double m_B2 = m_B * m_B, m_K2 = m_K * m_K;
+        return result;
+    }
 
-        // cf. [GvDV2020] Eq. (A.5)
-        const double
-            calF_plus   = form_factors->f_p(s),
-            calF_time   = form_factors->f_0(s),
-            calF_T_plus = s / m_B / (m_B + m_K) * form_factors->f_t(s);
+    void
+    BToKDileptonAmplitudes<tag::GvDV2020>::amplitudes(const std::span<const double> & q2, const std::span<BToKDilepton::Amplitudes> & amplitudes) const
+    {
+        if (q2.size() != amplitudes.size())
+            throw InternalError("BToKDileptonAmplitudes<tag::GvDV2020>::amplitudes: size mismatch between q2 and result");
 
-        const complex<double> calH_plus = nonlocal_formfactor->H_plus(s);
+        // q2-independent inputs
+        const WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavor, cp_conjugate);
+        const Inputs in = inputs(wc);
 
-        double F_Tkin = calF_T_plus / calF_plus * 2.0 * std::sqrt(lambda(s)) * beta_l(s) * m_B / s;
-        double F_Skin = calF_time / calF_plus * 0.5 * (m_B2 - m_K2) / (m_b_MSbar - m_s_MSbar);
+        const double m_B2 = m_B * m_B, m_K2 = m_K * m_K;
 
-        // Wilson coefficients
-        const complex<double>
-            c7eff = ShortDistanceLowRecoil::c7eff(s, 0.0, 0.0, 0.0, false, wc); // LO C7eff
         const complex<double>
             c9_p  = wc.c9() + wc.c9prime(),
-            c10_p = wc.c10() + wc.c10prime(),
-            c7_p  = c7eff + wc.c7prime();
-
-        // cf. [BHP2007], Eq. (3.2), p. 3 and 4 or [BKMS2012] (1205.5811)
-        result.F_A  = c10_p;
-        result.F_T  = F_Tkin * wc.cT();
-        result.F_T5 = F_Tkin * wc.cT5();
-        result.F_S  = F_Skin * (wc.cS() + wc.cSprime());
-        result.F_P  = F_Skin * (wc.cP() + wc.cPprime()) + m_l() * c10_p *
-                      ((m_B2 - m_K2) / s * (calF_time / calF_plus - 1.0) - 1.0);
-        result.F_V  = c9_p
-                      + 2.0 * m_b_MSbar() * m_B / s * c7_p * calF_T_plus / calF_plus
-                      + 2.0 * m_b_PS() / m_B / xi_pseudo(s) * (dff.calT - 16.0 * power_of<2>(M_PI) * power_of<3>(m_B()) / m_b_PS() / s * calH_plus)
-                      + 8.0 * m_l * m_B / s * calF_T_plus / calF_plus * wc.cT();
+            c10_p = wc.c10() + wc.c10prime();
 
-        return result;
+        // local form factors
+        std::vector<FormFactors<PToP>::Values> ff(q2.size());
+        form_factors->evaluate_batch(q2, ff);
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            const double & s = q2[i];
+            BToKDilepton::Amplitudes & result = amplitudes[i];
+
+            // cf. [GvDV2020] Eq. (A.5)
+            const double
+                calF_plus   = ff[i].f_p,
+                calF_time   = ff[i].f_0,
+                calF_T_plus = s / m_B / (m_B + m_K) * ff[i].f_t;
+
+            // cf. [BF2001], Eq. (22)
+            const double xi_pseudo = calF_plus;
+
+            auto dff = dipole_form_factors(s, in, xi_pseudo);
+
+            const complex<double> calH_plus = nonlocal_formfactor->H_plus(s);
+
+            double F_Tkin = calF_T_plus / calF_plus * 2.0 * std::sqrt(lambda(s)) * beta_l(s) * m_B / s;
+            double F_Skin = calF_time / calF_plus * 0.5 * (m_B2 - m_K2) / (m_b_MSbar - m_s_MSbar);
+
+            // Wilson coefficients
+            const complex<double>
+                c7eff = ShortDistanceLowRecoil::c7eff(s, 0.0, 0.0, 0.0, false, wc); // LO C7eff
+            const complex<double>
+                c7_p  = c7eff + wc.c7prime();
+
+            // cf. [BHP2007], Eq. (3.2), p. 3 and 4 or [BKMS2012] (1205.5811)
+            result.F_A  = c10_p;
+            result.F_T  = F_Tkin * wc.cT();
+            result.F_T5 = F_Tkin * wc.cT5();
+            result.F_S  = F_Skin * (wc.cS() + wc.cSprime());
+            result.F_P  = F_Skin * (wc.cP() + wc.cPprime()) + m_l() * c10_p *
+                          ((m_B2 - m_K2) / s * (calF_time / calF_plus - 1.0) - 1.0);
+            result.F_V  = c9_p
+                          + 2.0 * m_b_MSbar() * m_B / s * c7_p * calF_T_plus / calF_plus
+                          + 2.0 * in.m_b_PS / m_B / xi_pseudo * (dff.calT - 16.0 * power_of<2>(M_PI) * power_of<3>(m_B()) / in.m_b_PS / s * calH_plus)
+                          + 8.0 * m_l * m_B / s * calF_T_plus / calF_plus * wc.cT();
+        }
     }
 }
@@ -56,6 +56,23 @@ namespace eos
             double mu_f() const;
             BToKDilepton::DipoleFormFactors dipole_form_factors(const double & q2, const WilsonCoefficients<BToS> & wc) const;
             double xi_pseudo(const double & q2) const;
+
+            virtual void amplitudes(const std::span<const double> & q2, const std::span<BToKDilepton::Amplitudes> & result) const;
+
+        private:
+            // q2-independent inputs to the amplitudes, obtained once per grid of q2 values
+            struct Inputs
+            {
+                WilsonCoefficients<BToS> wc;
+                complex<double> c8eff;
+                complex<double> lambda_hat_u;
+                double alpha_s_mu;
+                double m_b_PS;
+            };
+
+            Inputs inputs(const WilsonCoefficients<BToS> & wc) const;
+
+            BToKDilepton::DipoleFormFactors dipole_form_factors(const double & q2, const Inputs & in, const double & xi_pseudo) const;
     };
 }
 
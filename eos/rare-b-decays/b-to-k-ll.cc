@@ -69,6 +69,10 @@ namespace eos
         UsedParameter tau;
         UsedParameter mu;
 
+        using IntermediateResult = BToKDilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -143,6 +147,18 @@ namespace eos
             return angular_coefficients_array(amplitude_generator->amplitudes(s), s);
         }
 
+        void differential_angular_coefficients_arrays(const std::span<const double> & s, const std::span<std::array<double, 3>> & result) const
+        {
+            // evaluate the amplitudes on all points at once, sharing the q2-independent inputs
+            std::vector<BToKDilepton::Amplitudes> amplitudes(s.size());
+            amplitude_generator->amplitudes(s, amplitudes);
+
+            for (std::size_t i = 0 ; i < s.size() ; ++i)
+            {
+                result[i] = angular_coefficients_array(amplitudes[i], s[i]);
+            }
+        }
+
         inline BToKDilepton::AngularCoefficients differential_angular_coefficients(const double & s) const
         {
             return BToKDilepton::AngularCoefficients(differential_angular_coefficients_array(s));
@@ -170,13 +186,23 @@ namespace eos
             return a.b_l;
         }
 
-        BToKDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 3> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
         {
-            std::function<std::array<double, 3> (const double &)> integrand =
-                    std::bind(&Implementation<BToKDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 3> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 3>> &)> integrand =
+                    std::bind(&Implementation<BToKDilepton>::differential_angular_coefficients_arrays, this, std::placeholders::_1, std::placeholders::_2);
 
-            return BToKDilepton::AngularCoefficients(integrated_angular_coefficients_array);
+            return integrate1D(integrand, 64, s_min, s_max);
+        }
+
+        inline BToKDilepton::AngularCoefficients integrated_angular_coefficients(const IntermediateResult * ir) const
+        {
+            return BToKDilepton::AngularCoefficients(ir->ac);
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.ac = integrated_angular_coefficients_array(s_min, s_max);
+            return &intermediate_result;
         }
 
         inline double beta_l(const double & s) const
@@ -237,34 +263,40 @@ namespace eos
     }
 
     // Integrated Observables
+    const BToKDilepton::IntermediateResult *
+    BToKDilepton::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    BToKDilepton::integrated_decay_width(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_decay_width(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a = _imp->integrated_angular_coefficients(ir);
 
         return _imp->unnormalized_decay_width(a);
     }
 
     double
-    BToKDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a = _imp->integrated_angular_coefficients(ir);
 
         return _imp->differential_branching_ratio(a);
     }
 
     double
-    BToKDilepton::integrated_flat_term(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_flat_term(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a = _imp->integrated_angular_coefficients(ir);
 
         return _imp->differential_flat_term_numerator(a) / _imp->unnormalized_decay_width(a);
     }
 
     double
-    BToKDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BToKDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
-        AngularCoefficients a = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a = _imp->integrated_angular_coefficients(ir);
 
         return _imp->differential_forward_backward_asymmetry_numerator(a) / _imp->unnormalized_decay_width(a);
 
@@ -21,12 +21,15 @@
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_B_TO_K_LL_HH
 #define EOS_GUARD_SRC_RARE_B_DECAYS_B_TO_K_LL_HH 1
 
+#include <eos/observable.hh>
 #include <eos/maths/complex.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+
 namespace eos
 {
 
@@ -56,10 +59,12 @@ namespace eos
             double two_differential_decay_width(const double & s, const double & c_theta_l) const;
 
             // Integrated Observables
-            double integrated_decay_width(const double & s_min, const double & s_max) const;
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_flat_term(const double & s_min, const double & s_max) const;
-            double integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+            double integrated_decay_width(const IntermediateResult * ir) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_flat_term(const IntermediateResult * ir) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult * ir) const;
             double integrated_ratio_muons_electrons(const double & s_min, const double & s_max) const;
 
             /*!
@@ -99,6 +104,23 @@ namespace eos
         complex<double> F_T;
         complex<double> F_T5;
     };
+
+    /*!
+     * The q^2-integrated angular coefficients a_l, b_l and c_l, from which all integrated observables
+     * in one bin are derived.
+     */
+    class BToKDilepton::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 3> ac;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
 }
 
 #endif
@@ -19,6 +19,7 @@
  */
 
 #include <eos/rare-b-decays/b-to-kstar-ll-base.hh>
+#include <eos/rare-b-decays/b-to-kstar-ll-impl.hh>
 #include <eos/utils/destringify.hh>
 #include <eos/utils/kinematic.hh>
 
@@ -79,4 +80,15 @@ namespace eos
         return s / m_B() / m_B();
     }
 
+    void
+    BToKstarDilepton::AmplitudeGenerator::amplitudes(const std::span<const double> & q2, const std::span<BToKstarDilepton::Amplitudes> & result) const
+    {
+        if (q2.size() != result.size())
+            throw InternalError("BToKstarDilepton::AmplitudeGenerator::amplitudes: size mismatch between q2 and result");
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            result[i] = this->amplitudes(q2[i]);
+        }
+    }
 }
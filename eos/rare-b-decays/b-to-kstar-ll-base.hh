@@ -26,6 +26,8 @@
 #include <eos/form-factors/mesonic.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
 
+#include <span>
+
 namespace eos
 {
     class BToKstarDilepton::AmplitudeGenerator :
@@ -66,6 +68,18 @@ namespace eos
 
             virtual ~AmplitudeGenerator();
             virtual BToKstarDilepton::Amplitudes amplitudes(const double & q2) const = 0;
+
+            /*!
+             * Evaluate the amplitudes on a grid of q2 values.
+             *
+             * The default implementation evaluates the amplitudes point by point.
+             * Derived classes can override it to compute the q2-independent inputs
+             * only once per grid.
+             *
+             * @param q2     The values of q2.
+             * @param result The amplitudes, one per value of q2.
+             */
+            virtual void amplitudes(const std::span<const double> & q2, const std::span<BToKstarDilepton::Amplitudes> & result) const;
     };
 
     struct BToKstarDilepton::DipoleFormFactors
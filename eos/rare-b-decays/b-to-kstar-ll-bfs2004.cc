@@ -360,6 +360,25 @@ namespace eos
         return result;
     }
 
+    double
+    BToKstarDileptonAmplitudes<tag::BFS2004>::xi_perp(const FormFactors<PToV>::Values & ff) const
+    {
+        const double factor = m_B() / (m_B() + m_Kstar());
+        double result = uncertainty_xi_perp * factor * ff.v;
+
+        return result;
+    }
+
+    double
+    BToKstarDileptonAmplitudes<tag::BFS2004>::xi_par(const double & s, const FormFactors<PToV>::Values & ff) const
+    {
+        const double factor1 = (m_B() + m_Kstar()) / (2.0 * energy(s));
+        const double factor2 = (1.0 - m_Kstar() / m_B());
+        double result = uncertainty_xi_par * (factor1 * ff.a_1 - factor2 * ff.a_2);
+
+        return result;
+    }
+
     double
     BToKstarDileptonAmplitudes<tag::BFS2004>::norm(const double & s) const
     {
@@ -407,6 +426,9 @@ namespace eos
 
         auto dff = dipole_form_factors(s, wc);
 
+        const auto ff = form_factors->evaluate_all(s);
+        const double xi_perp = this->xi_perp(ff), xi_par = this->xi_par(s, ff);
+
         const complex<double>
             wilson_minus_right = (wc.c9() - wc.c9prime()) + (wc.c10() - wc.c10prime()),
             wilson_minus_left  = (wc.c9() - wc.c9prime()) - (wc.c10() - wc.c10prime()),
@@ -417,7 +439,7 @@ namespace eos
         const double prefactor_long = -norm_s / (2.0 * m_Kstar() * std::sqrt(s));
 
         const complex<double>
-            a = (m2_diff - s) * 2.0 * energy(s) * xi_perp(s) - lambda(s) * m_B() / m2_diff * (xi_perp(s) - xi_par(s)),
+            a = (m2_diff - s) * 2.0 * energy(s) * xi_perp - lambda(s) * m_B() / m2_diff * (xi_perp - xi_par),
             b = 2.0 * m_b_PS() * (
                     ((m_B2 + 3.0 * m_K2 - s) * 2.0 * energy(s) / m_B() - lambda(s) / m2_diff) * dff.calT_perp_left
                     - lambda(s) / m2_diff * dff.calT_parallel
@@ -429,35 +451,35 @@ namespace eos
         // perpendicular amplitude
         const double prefactor_perp = +std::sqrt(2.0) * norm_s * m_B() * std::sqrt(eos::lambda(1.0, mKhat2, shat));
 
-        result.a_perp_right = prefactor_perp * (wilson_plus_right * xi_perp(s) + uncertainty_perp() * (2.0 * mbhat / shat) * dff.calT_perp_right);
-        result.a_perp_left  = prefactor_perp * (wilson_plus_left  * xi_perp(s) + uncertainty_perp() * (2.0 * mbhat / shat) * dff.calT_perp_right);
+        result.a_perp_right = prefactor_perp * (wilson_plus_right * xi_perp + uncertainty_perp() * (2.0 * mbhat / shat) * dff.calT_perp_right);
+        result.a_perp_left  = prefactor_perp * (wilson_plus_left  * xi_perp + uncertainty_perp() * (2.0 * mbhat / shat) * dff.calT_perp_right);
 
         // parallel amplitude
         const double prefactor_par = -std::sqrt(2.0) * norm_s * m2_diff;
 
         result.a_para_right = prefactor_par * (
-                                wilson_minus_right * xi_perp(s) * 2.0 * energy(s) / m2_diff
+                                wilson_minus_right * xi_perp * 2.0 * energy(s) / m2_diff
                                 + uncertainty_para() * 4.0 * m_b_PS() * energy(s) / s / m_B() * dff.calT_perp_left
                              );
         result.a_para_left  = prefactor_par * (
-                                wilson_minus_left  * xi_perp(s) * 2.0 * energy(s) / m2_diff
+                                wilson_minus_left  * xi_perp * 2.0 * energy(s) / m2_diff
                                 + uncertainty_para() * 4.0 * m_b_PS() * energy(s) / s / m_B() * dff.calT_perp_left
                              );
 
         // timelike amplitude
         result.a_time = norm_s * sqrt_lam / sqrt_s
             * (2.0 * (wc.c10() - wc.c10prime()) + s / m_l / (m_b_MSbar + m_s_MSbar) * (wc.cP() - wc.cPprime()))
-            * form_factors->a_0(s);
+            * ff.a_0;
 
         // scalar amplitude
-        result.a_scal = -2.0 * norm_s * sqrt_lam * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s_MSbar) * form_factors->a_0(s);
+        result.a_scal = -2.0 * norm_s * sqrt_lam * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s_MSbar) * ff.a_0;
 
         // tensor amplitudes [BHvD2012]  eqs. (B18 - B20)
         // no form factor relations used
         const double
-            ff_T1  = form_factors->t_1(s),
-            ff_T2  = form_factors->t_2(s),
-            ff_T3  = form_factors->t_3(s),
+            ff_T1  = ff.t_1,
+            ff_T2  = ff.t_2,
+            ff_T3  = ff.t_3,
 
             kin_tensor_1 = norm_s / m_Kstar() * ((m_B2 + 3.0 * m_K2 - s) * ff_T2 - lambda(s) / m2_diff * ff_T3),
             kin_tensor_2 = 2.0 * norm_s * sqrt_lam / sqrt_s * ff_T1,
@@ -84,6 +84,8 @@ namespace eos
             double norm(const double & q2) const;
             double xi_perp(const double & q2) const;
             double xi_par(const double & q2) const;
+            double xi_perp(const FormFactors<PToV>::Values & ff) const;
+            double xi_par(const double & q2, const FormFactors<PToV>::Values & ff) const;
 
             virtual double real_C9_perp(const double & s) const;
             virtual double real_C9_para(const double & s) const;
@@ -58,6 +58,22 @@ namespace eos
             virtual double H_long_corrections(const double & s) const;
 
             virtual BToKstarDilepton::Amplitudes amplitudes(const double & q2) const;
+            virtual void amplitudes(const std::span<const double> & q2, const std::span<BToKstarDilepton::Amplitudes> & result) const;
+
+        private:
+            // q2-independent inputs to the amplitudes, obtained once per grid of q2 values
+            struct Inputs
+            {
+                WilsonCoefficients<BToS> wc;
+                complex<double> c8eff;
+                complex<double> lambda_hat_u;
+                double alpha_s_mu;
+                double m_b_PS;
+            };
+
+            Inputs inputs(const WilsonCoefficients<BToS> & wc) const;
+
+            BToKstarDilepton::FormFactorCorrections sb_contributions(const double & q2, const Inputs & in) const;
     };
 }
 
@@ -19,10 +19,12 @@
 #include <eos/observable.hh>
 #include <eos/maths/complex.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll.hh>
+#include <eos/rare-b-decays/b-to-kstar-ll-gvdv2020.hh>
 #include <eos/rare-b-decays/b-to-kstar-ll-impl.hh>
 #include <eos/rare-b-decays/nonlocal-formfactors.hh>
 
 #include <iostream>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -127,6 +129,25 @@ class BToKstarDileptonGvDV2020Test :
             TEST_CHECK_RELATIVE_ERROR(imag(amps.a_perp_right),  7.42463e-11,  eps);
             TEST_CHECK_RELATIVE_ERROR(real(amps.a_time),       -1.45112e-10,  eps);
             TEST_CHECK_RELATIVE_ERROR(imag(amps.a_time),       -2.79261e-11,  eps);
+
+            // evaluating on a grid of q2 values must agree with the point-by-point evaluation
+            BToKstarDileptonAmplitudes<tag::GvDV2020> generator(p, oo);
+            const std::vector<double> grid{ 1.0, 4.0, 6.0, 8.0 };
+            std::vector<BToKstarDilepton::Amplitudes> batch(grid.size());
+            generator.amplitudes(grid, batch);
+
+            for (std::size_t i = 0 ; i < grid.size() ; ++i)
+            {
+                const auto point = generator.amplitudes(grid[i]);
+
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_long_left,  point.a_long_left,  1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_long_right, point.a_long_right, 1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_para_left,  point.a_para_left,  1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_para_right, point.a_para_right, 1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_perp_left,  point.a_perp_left,  1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_perp_right, point.a_perp_right, 1e-12);
+                TEST_CHECK_RELATIVE_ERROR_C(batch[i].a_time,       point.a_time,       1e-12);
+            }
        }
     }
 } b_to_kstar_dilepton_GvDV2020_test;
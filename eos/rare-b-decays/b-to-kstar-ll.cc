@@ -195,6 +195,18 @@ namespace eos
             return angular_coefficients_array(amplitude_generator->amplitudes(s), s);
         }
 
+        void differential_angular_coefficients_arrays(const std::span<const double> & s, const std::span<std::array<double, 12>> & result) const
+        {
+            // evaluate the amplitudes on all points at once, sharing the q2-independent inputs
+            std::vector<BToKstarDilepton::Amplitudes> amplitudes(s.size());
+            amplitude_generator->amplitudes(s, amplitudes);
+
+            for (std::size_t i = 0 ; i < s.size() ; ++i)
+            {
+                result[i] = angular_coefficients_array(amplitudes[i], s[i]);
+            }
+        }
+
         inline BToKstarDilepton::AngularCoefficients differential_angular_coefficients(const double & s) const
         {
             return BToKstarDilepton::AngularCoefficients(differential_angular_coefficients_array(s));
@@ -202,8 +214,8 @@ namespace eos
 
         BToKstarDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
         {
-            std::function<std::array<double, 12> (const double &)> integrand =
-                    std::bind(&Implementation<BToKstarDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 12>> &)> integrand =
+                    std::bind(&Implementation<BToKstarDilepton>::differential_angular_coefficients_arrays, this, std::placeholders::_1, std::placeholders::_2);
             std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
 
             return BToKstarDilepton::AngularCoefficients(integrated_angular_coefficients_array);
@@ -215,6 +227,23 @@ namespace eos
             return &intermediate_result;
         }
 
+        std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const
+        {
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 12>> &)> integrand =
+                    std::bind(&Implementation<BToKstarDilepton>::differential_angular_coefficients_arrays, this, std::placeholders::_1, std::placeholders::_2);
+
+            // the amplitudes are evaluated on the sampling points of all bins at once
+            const auto integrated = integrate1D(integrand, 64, bins);
+
+            std::vector<IntermediateResult> result(bins.size());
+            for (std::size_t i = 0 ; i < bins.size() ; ++i)
+            {
+                result[i].ac = BToKstarDilepton::AngularCoefficients(integrated[i]);
+            }
+
+            return result;
+        }
+
         inline double decay_width(const BToKstarDilepton::AngularCoefficients & a_c)
         {
             // cf. [BHvD2010], p. 6, eq. (2.7)
@@ -560,6 +589,12 @@ namespace eos
         return _imp->prepare(q2_min, q2_max);
     }
 
+    std::vector<BToKstarDilepton::IntermediateResult>
+    BToKstarDilepton::prepare_bins(const std::vector<std::array<double, 2>> & bins) const
+    {
+        return _imp->prepare_bins(bins);
+    }
+
 
     double
     BToKstarDilepton::integrated_decay_width(const IntermediateResult * ir) const
@@ -33,6 +33,7 @@
 #include <eos/utils/reference-name.hh>
 
 #include <array>
+#include <vector>
 
 namespace eos
 {
@@ -143,6 +144,8 @@ namespace eos
             // @{
             class IntermediateResult;
             const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            /// Prepare the intermediate results of several q^2 bins at once, equivalent to calling prepare() for each bin.
+            std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const;
             double integrated_decay_width(const IntermediateResult * ir) const;
             double integrated_branching_ratio(const IntermediateResult * ir) const;
             double integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult * ir) const;
@@ -226,6 +229,12 @@ namespace eos
              */
             static const std::set<ReferenceName> references;
 
+            /*!
+             * Regular observables may share one object. Apart from prepare(), our member functions
+             * only read from our implementation, and the amplitude generators only read from theirs.
+             */
+            static constexpr bool shareable = true;
+
             /*!
              * Options used in the computation of our observables.
              */
@@ -75,4 +75,15 @@ namespace eos
         return s / m_B() / m_B();
     }
 
+    void
+    BsToPhiDilepton::AmplitudeGenerator::amplitudes(const std::span<const double> & q2, const std::span<BsToPhiDilepton::Amplitudes> & result) const
+    {
+        if (q2.size() != result.size())
+            throw InternalError("BsToPhiDilepton::AmplitudeGenerator::amplitudes: size mismatch between q2 and result");
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            result[i] = this->amplitudes(q2[i]);
+        }
+    }
 }
@@ -23,6 +23,8 @@
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/memoise.hh>
 
+#include <vector>
+
 #include <gsl/gsl_sf.h>
 
 using namespace std;
@@ -46,26 +48,48 @@ namespace eos
     }
 
 
+    BsToPhiDileptonAmplitudes<tag::GvDV2020>::Inputs
+    BsToPhiDileptonAmplitudes<tag::GvDV2020>::inputs(const WilsonCoefficients<BToS> & wc) const
+    {
+        complex<double> lambda_hat_u = (model->ckm_ub() * conj(model->ckm_us())) / (model->ckm_tb() * conj(model->ckm_ts()));
+        if (cp_conjugate)
+            lambda_hat_u = std::conj(lambda_hat_u);
+
+        return Inputs{
+            wc,
+            ShortDistanceLowRecoil::c8eff(wc), // LO C8eff
+            lambda_hat_u,
+            model->alpha_s(mu()), // alpha_s at the hard scale
+            this->m_b_PS()
+        };
+    }
+
     BsToPhiDilepton::FormFactorCorrections
     BsToPhiDileptonAmplitudes<tag::GvDV2020>::sb_contributions(const double & s, const WilsonCoefficients<BToS> & wc) const
     {
+        return sb_contributions(s, inputs(wc));
+    }
+
+    BsToPhiDilepton::FormFactorCorrections
+    BsToPhiDileptonAmplitudes<tag::GvDV2020>::sb_contributions(const double & s, const Inputs & in) const
+    {
+        const WilsonCoefficients<BToS> & wc = in.wc;
+
         // charges of down- and up-type quarks
         static const double e_s = -1.0 / 3.0;
 
         // kinematics
-        double m_b_PS = this->m_b_PS();
+        const double & m_b_PS = in.m_b_PS;
         double m_B2 = power_of<2>(m_B());
         double m_V2 = power_of<2>(m_V());
         double energy = this->energy(s);
 
         // Coupling
-        double alpha_s_mu = model->alpha_s(mu()); // alpha_s at the hard scale
-        complex<double> lambda_hat_u = (model->ckm_ub() * conj(model->ckm_us())) / (model->ckm_tb() * conj(model->ckm_ts()));
-        if (cp_conjugate)
-            lambda_hat_u = std::conj(lambda_hat_u);
+        const double & alpha_s_mu = in.alpha_s_mu; // alpha_s at the hard scale
+        const complex<double> & lambda_hat_u = in.lambda_hat_u;
 
         /* Effective wilson coefficients */
-        complex<double> c8eff = ShortDistanceLowRecoil::c8eff(wc); // LO C8eff
+        const complex<double> & c8eff = in.c8eff; // LO C8eff
 
         /* Y(s) for the up and the top sector */
         // cf. [BFS2001], Eq. (10), p. 4
@@ -149,116 +173,144 @@ namespace eos
     {
         BsToPhiDilepton::Amplitudes result;
 
-        WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavor, cp_conjugate);
+        this->amplitudes(std::span<const double>(&s, 1), std::span<BsToPhiDilepton::Amplitudes>(&result, 1));
 
-        // local form factors
-        const double
-            ff_V  = form_factors->v(s),
-            ff_A0 = form_factors->a_0(s),
-            ff_A1 = form_factors->a_1(s),
-            ff_A2 = form_factors->a_2(s),
-            ff_T1 = form_factors->t_1(s),
-            ff_T2 = form_factors->t_2(s),
-            ff_T3 = form_factors->t_3(s);
+        return result;
+    }
 
-        // kinematics
-        const double
-            sqrt_s      = std::sqrt(s),
-            m_B         = this->m_B(), m_B2 = power_of<2>(m_B),
-            m_V         = this->m_V(), m_V2 = power_of<2>(m_V),
-            lambda      = eos::lambda(m_B2, m_V2, s),
-            sqrt_lambda = std::sqrt(lambda);
+    void
+    BsToPhiDileptonAmplitudes<tag::GvDV2020>::amplitudes(const std::span<const double> & q2, const std::span<BsToPhiDilepton::Amplitudes> & amplitudes) const
+    {
+        if (q2.size() != amplitudes.size())
+            throw InternalError("BsToPhiDileptonAmplitudes<tag::GvDV2020>::amplitudes: size mismatch between q2 and result");
 
-        // vectorial form factors, cf. [GvDV2020], eq. (A.11)
-        const double
-            calF_perp = sqrt(2.0) * sqrt_lambda / (m_B * (m_B + m_V)) * ff_V,
-            calF_para = sqrt(2.0) * (m_B + m_V) / m_B * ff_A1,
-            calF_long = ((m_B2 - m_V2 - s) * power_of<2>(m_B + m_V) * ff_A1 - lambda * ff_A2)
-                      / (2.0 * m_V * m_B2 * (m_B + m_V)),
-            calF_time = ff_A0;
+        // q2-independent inputs
+        const WilsonCoefficients<BToS> wc = model->wilson_coefficients_b_to_s(mu(), lepton_flavor, cp_conjugate);
+        const Inputs in = inputs(wc);
 
-        // tensorial form factors, cf. [GvDV2020], eq. (A.11)
         const double
-            calF_T_perp = sqrt(2.0) * sqrt_lambda / m_B2 * ff_T1,
-            calF_T_para = sqrt(2.0) * (m_B2 - m_V2) / m_B2 * ff_T2,
-            calF_T_long = s / (2.0 * power_of<3>(m_B) * m_V) *
-                        ((m_B2 + 3.0 * m_V2 - s) * ff_T2 - lambda / (m_B2 - m_V2) * ff_T3);
-
-        // Contributions not probortional to Qc
-        auto sb_c = sb_contributions(s, wc);
-
-        const complex<double>
-            calH_perp = nonlocal_formfactor->H_perp(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_perp * sb_c.t + calF_T_perp * sb_c.t_T),
-            calH_para = nonlocal_formfactor->H_para(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_para * sb_c.t + calF_T_para * sb_c.t_T),
-            calH_long = nonlocal_formfactor->H_long(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_long * sb_c.t + calF_T_long * sb_c.t_T) - sb_c.t_wa;
-
+            m_B  = this->m_B(), m_B2 = power_of<2>(m_B),
+            m_V  = this->m_V(), m_V2 = power_of<2>(m_V);
 
         // Wilson coefficients
-        const complex<double>
-            c7eff = ShortDistanceLowRecoil::c7eff(s, 0.0, 0.0, 0.0, false, wc); // LO C7eff
         const complex<double>
             c910_m_r = (wc.c9() - wc.c9prime()) + (wc.c10() - wc.c10prime()),
             c910_m_l = (wc.c9() - wc.c9prime()) - (wc.c10() - wc.c10prime()),
             c910_p_r = (wc.c9() + wc.c9prime()) + (wc.c10() + wc.c10prime()),
-            c910_p_l = (wc.c9() + wc.c9prime()) - (wc.c10() + wc.c10prime()),
-            c7_m = (c7eff - wc.c7prime()),
-            c7_p = (c7eff + wc.c7prime());
+            c910_p_l = (wc.c9() + wc.c9prime()) - (wc.c10() + wc.c10prime());
 
         // quark masses
         const double
             m_b_msbar = model->m_b_msbar(mu()),
             m_s_msbar = model->m_s_msbar(mu());
 
-        // normalization constant, cf. KM2005A (3.7)
-        const double calN = g_fermi() * alpha_e * abs(model->ckm_tb() * conj(model->ckm_ts()))
-                * sqrt(s * beta_l(s) * sqrt_lambda / (3.0 * 1024 * power_of<5>(M_PI) * m_B));
+        // normalization constant without its q2 dependence, cf. KM2005A (3.7)
+        const double calN_0 = g_fermi() * alpha_e * abs(model->ckm_tb() * conj(model->ckm_ts()));
 
-        // vector amplitudes, cf. KM2005A (3.2) - (3.4)
-        result.a_long_right = -calN * m_B / sqrt_s * (
-                c910_m_r * calF_long
-                + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_long - 16.0 * power_of<2>(M_PI) * m_B * calH_long)
-        );
-        result.a_long_left  = -calN * m_B / sqrt_s * (
-                c910_m_l * calF_long
-                + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_long - 16.0 * power_of<2>(M_PI) * m_B * calH_long)
-        );
-
-        result.a_para_right = -calN * (
-                c910_m_r * calF_para
-                + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_para - 16.0 * power_of<2>(M_PI) * m_B * calH_para)
-        );
-        result.a_para_left  = -calN * (
-                c910_m_l * calF_para
-                + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_para - 16.0 * power_of<2>(M_PI) * m_B * calH_para)
-        );
-
-        result.a_perp_right = +calN * (
-                c910_p_r * calF_perp
-                + 2.0 * m_B / s * ((m_b_msbar + m_s_msbar) * c7_p * calF_T_perp - 16.0 * power_of<2>(M_PI) * m_B * calH_perp)
-        );
-        result.a_perp_left  = +calN * (
-                c910_p_l * calF_perp
-                + 2.0 * m_B / s * ((m_b_msbar + m_s_msbar) * c7_p * calF_T_perp - 16.0 * power_of<2>(M_PI) * m_B * calH_perp)
-        );
-
-        // scalar amplitude, cf. KM2005A (3.5)
-        result.a_time = calN / m_B * sqrt_lambda / sqrt_s * calF_time * (
-            2.0 * (wc.c10() - wc.c10prime()) + s / m_l / (m_b_MSbar + m_s_MSbar) * (wc.cP() - wc.cPprime())
-        );
-
-        // Tensor amplitudes, cf BHvD2012 (B.17)-(B.20) and GVdV2020 (A.11)
-        result.a_scal = -2.0 * calN / m_B * sqrt_lambda * calF_time * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s_MSbar);
-
-        result.a_para_perp = 2.0 * calN * m_B2 / s * calF_T_long * wc.cT();
-        result.a_time_long = - 2.0 * calN * m_B2 / s * calF_T_long * wc.cT5();
-
-        result.a_time_perp = sqrt(2) * calN * m_B / sqrt_s * calF_T_perp * wc.cT();
-        result.a_long_perp = - sqrt(2) * calN * m_B / sqrt_s * calF_T_perp * wc.cT5();
-
-        result.a_long_para = sqrt(2) * calN * m_B / sqrt_s * calF_T_para * wc.cT();
-        result.a_time_para = - sqrt(2) * calN * m_B / sqrt_s * calF_T_para* wc.cT5();
-
-        return result;
+        // local form factors
+        std::vector<FormFactors<PToV>::Values> ff(q2.size());
+        form_factors->evaluate_batch(q2, ff);
+
+        for (std::size_t i = 0 ; i < q2.size() ; ++i)
+        {
+            const double & s = q2[i];
+            BsToPhiDilepton::Amplitudes & result = amplitudes[i];
+
+            const double
+                ff_V  = ff[i].v,
+                ff_A0 = ff[i].a_0,
+                ff_A1 = ff[i].a_1,
+                ff_A2 = ff[i].a_2,
+                ff_T1 = ff[i].t_1,
+                ff_T2 = ff[i].t_2,
+                ff_T3 = ff[i].t_3;
+
+            // kinematics
+            const double
+                sqrt_s      = std::sqrt(s),
+                lambda      = eos::lambda(m_B2, m_V2, s),
+                sqrt_lambda = std::sqrt(lambda);
+
+            // vectorial form factors, cf. [GvDV2020], eq. (A.11)
+            const double
+                calF_perp = sqrt(2.0) * sqrt_lambda / (m_B * (m_B + m_V)) * ff_V,
+                calF_para = sqrt(2.0) * (m_B + m_V) / m_B * ff_A1,
+                calF_long = ((m_B2 - m_V2 - s) * power_of<2>(m_B + m_V) * ff_A1 - lambda * ff_A2)
+                          / (2.0 * m_V * m_B2 * (m_B + m_V)),
+                calF_time = ff_A0;
+
+            // tensorial form factors, cf. [GvDV2020], eq. (A.11)
+            const double
+                calF_T_perp = sqrt(2.0) * sqrt_lambda / m_B2 * ff_T1,
+                calF_T_para = sqrt(2.0) * (m_B2 - m_V2) / m_B2 * ff_T2,
+                calF_T_long = s / (2.0 * power_of<3>(m_B) * m_V) *
+                            ((m_B2 + 3.0 * m_V2 - s) * ff_T2 - lambda / (m_B2 - m_V2) * ff_T3);
+
+            // Contributions not probortional to Qc
+            auto sb_c = sb_contributions(s, in);
+
+            const complex<double>
+                calH_perp = nonlocal_formfactor->H_perp(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_perp * sb_c.t + calF_T_perp * sb_c.t_T),
+                calH_para = nonlocal_formfactor->H_para(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_para * sb_c.t + calF_T_para * sb_c.t_T),
+                calH_long = nonlocal_formfactor->H_long(s) - 1.0 / 16.0 / power_of<2>(M_PI) * (calF_long * sb_c.t + calF_T_long * sb_c.t_T) - sb_c.t_wa;
+
+
+            // Wilson coefficients
+            const complex<double>
+                c7eff = ShortDistanceLowRecoil::c7eff(s, 0.0, 0.0, 0.0, false, wc); // LO C7eff
+            const complex<double>
+                c7_m = (c7eff - wc.c7prime()),
+                c7_p = (c7eff + wc.c7prime());
+
+            // normalization constant, cf. KM2005A (3.7)
+            const double calN = calN_0
+                    * sqrt(s * beta_l(s) * sqrt_lambda / (3.0 * 1024 * power_of<5>(M_PI) * m_B));
+
+            // vector amplitudes, cf. KM2005A (3.2) - (3.4)
+            result.a_long_right = -calN * m_B / sqrt_s * (
+                    c910_m_r * calF_long
+                    + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_long - 16.0 * power_of<2>(M_PI) * m_B * calH_long)
+            );
+            result.a_long_left  = -calN * m_B / sqrt_s * (
+                    c910_m_l * calF_long
+                    + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_long - 16.0 * power_of<2>(M_PI) * m_B * calH_long)
+            );
+
+            result.a_para_right = -calN * (
+                    c910_m_r * calF_para
+                    + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_para - 16.0 * power_of<2>(M_PI) * m_B * calH_para)
+            );
+            result.a_para_left  = -calN * (
+                    c910_m_l * calF_para
+                    + 2.0 * m_B / s * ((m_b_msbar - m_s_msbar) * c7_m * calF_T_para - 16.0 * power_of<2>(M_PI) * m_B * calH_para)
+            );
+
+            result.a_perp_right = +calN * (
+                    c910_p_r * calF_perp
+                    + 2.0 * m_B / s * ((m_b_msbar + m_s_msbar) * c7_p * calF_T_perp - 16.0 * power_of<2>(M_PI) * m_B * calH_perp)
+            );
+            result.a_perp_left  = +calN * (
+                    c910_p_l * calF_perp
+                    + 2.0 * m_B / s * ((m_b_msbar + m_s_msbar) * c7_p * calF_T_perp - 16.0 * power_of<2>(M_PI) * m_B * calH_perp)
+            );
+
+            // scalar amplitude, cf. KM2005A (3.5)
+            result.a_time = calN / m_B * sqrt_lambda / sqrt_s * calF_time * (
+                2.0 * (wc.c10() - wc.c10prime()) + s / m_l / (m_b_MSbar + m_s_MSbar) * (wc.cP() - wc.cPprime())
+            );
+
+            // Tensor amplitudes, cf BHvD2012 (B.17)-(B.20) and GVdV2020 (A.11)
+            result.a_scal = -2.0 * calN / m_B * sqrt_lambda * calF_time * (wc.cS() - wc.cSprime()) / (m_b_MSbar + m_s_MSbar);
+
+            result.a_para_perp = 2.0 * calN * m_B2 / s * calF_T_long * wc.cT();
+            result.a_time_long = - 2.0 * calN * m_B2 / s * calF_T_long * wc.cT5();
+
+            result.a_time_perp = sqrt(2) * calN * m_B / sqrt_s * calF_T_perp * wc.cT();
+            result.a_long_perp = - sqrt(2) * calN * m_B / sqrt_s * calF_T_perp * wc.cT5();
+
+            result.a_long_para = sqrt(2) * calN * m_B / sqrt_s * calF_T_para * wc.cT();
+            result.a_time_para = - sqrt(2) * calN * m_B / sqrt_s * calF_T_para* wc.cT5();
+        }
     }
 
     // C9 and its corrections [BFS2001] eqs. (40-41)
@@ -77,6 +77,10 @@ namespace eos
         UsedParameter mu;
         UsedParameter phiBs;
 
+        using IntermediateResult = BsToPhiDilepton::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -221,18 +225,45 @@ namespace eos
             return angular_coefficients_array(amplitude_generator->amplitudes(s), s);
         }
 
+        void differential_angular_coefficients_arrays(const std::span<const double> & s, const std::span<std::array<double, 12>> & result) const
+        {
+            // evaluate the amplitudes on all points at once, sharing the q2-independent inputs
+            std::vector<BsToPhiDilepton::Amplitudes> amplitudes(s.size());
+            amplitude_generator->amplitudes(s, amplitudes);
+
+            for (std::size_t i = 0 ; i < s.size() ; ++i)
+            {
+                result[i] = angular_coefficients_array(amplitudes[i], s[i]);
+            }
+        }
+
         inline BsToPhiDilepton::AngularCoefficients differential_angular_coefficients(const double & s) const
         {
             return BsToPhiDilepton::AngularCoefficients(differential_angular_coefficients_array(s));
         }
 
-        BsToPhiDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        std::array<double, 12> integrated_angular_coefficients_array(const double & s_min, const double & s_max) const
+        {
+            std::function<void (const std::span<const double> &, const std::span<std::array<double, 12>> &)> integrand =
+                    std::bind(&Implementation<BsToPhiDilepton>::differential_angular_coefficients_arrays, this, std::placeholders::_1, std::placeholders::_2);
+
+            return integrate1D(integrand, 64, s_min, s_max);
+        }
+
+        inline BsToPhiDilepton::AngularCoefficients integrated_angular_coefficients(const double & s_min, const double & s_max) const
+        {
+            return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array(s_min, s_max));
+        }
+
+        inline BsToPhiDilepton::AngularCoefficients integrated_angular_coefficients(const IntermediateResult * ir) const
         {
-            std::function<std::array<double, 12> (const double &)> integrand =
-                    std::bind(&Implementation<BsToPhiDilepton>::differential_angular_coefficients_array, this, std::placeholders::_1);
-            std::array<double, 12> integrated_angular_coefficients_array = integrate1D(integrand, 64, s_min, s_max);
+            return BsToPhiDilepton::AngularCoefficients(ir->ac);
+        }
 
-            return BsToPhiDilepton::AngularCoefficients(integrated_angular_coefficients_array);
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.ac = integrated_angular_coefficients_array(s_min, s_max);
+            return &intermediate_result;
         }
 
         inline double decay_width(const BsToPhiDilepton::AngularCoefficients & a_c)
@@ -573,22 +604,28 @@ namespace eos
         return a_c.j9;
     }
 
+    const BsToPhiDilepton::IntermediateResult *
+    BsToPhiDilepton::prepare(const double & q2_min, const double & q2_max) const
+    {
+        return _imp->prepare(q2_min, q2_max);
+    }
+
     double
-    BsToPhiDilepton::integrated_decay_width(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_decay_width(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return integrated_decay_width(s_min, s_max) * _imp->tau() / _imp->hbar();
+        return integrated_decay_width(ir) * _imp->tau() / _imp->hbar();
     }
 
 
     double
-    BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // Convert from asymmetry in the decay width to asymmetry in the BR
         // cf. [PDG2008] : Gamma = hbar / tau_B, pp. 5, 79
@@ -597,66 +634,66 @@ namespace eos
 
         // cf. [BHvD2010], eq. (2.8), p. 6
         // cf. [BHvD2012], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return (a_c.j6s + 0.5 * a_c.j6c) / Gamma;
      }
 
     double
-    BsToPhiDilepton::integrated_forward_backward_asymmetry(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_forward_backward_asymmetry(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.8), p. 6
         // cf. [BHvD2012], eq. (A7)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return (a_c.j6s + 0.5 * a_c.j6c) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_longitudinal_polarisation(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_longitudinal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], eq. (A9)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return (a_c.j1c - a_c.j2c / 3.0) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_transversal_polarisation(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transversal_polarisation(const IntermediateResult * ir) const
     {
         // cf. [BHvD2012], eq. (A10)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 2.0 * (a_c.j1s - a_c.j2s / 3.0) / _imp->decay_width(a_c);
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_2(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.10), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.5 * a_c.j3 / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.11), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return sqrt((4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)) / (-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3)));
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_4(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], eq. (2.12), p. 6
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         return sqrt((power_of<2>(a_c.j5) + 4.0 * power_of<2>(a_c.j8)) / (4.0 * power_of<2>(a_c.j4) + power_of<2>(a_c.j7)));
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
 
         // cf. [BS2011], eq. (34), p. 9 for the massless case
         return std::sqrt(16.0 * power_of<2>(a_c.j2s) - power_of<2>(a_c.j6s) - 4.0 * (power_of<2>(a_c.j3) + power_of<2>(a_c.j9)))
@@ -664,141 +701,141 @@ namespace eos
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_re(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_re(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (38), p. 10
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.25 * a_c.j6s / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_transverse_asymmetry_im(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_transverse_asymmetry_im(const IntermediateResult * ir) const
     {
         // cf. [BS2011], eq. (30), p. 8
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return 0.5 * a_c.j9 / a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_h_1(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_1(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.13)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return sqrt(2.0) * a_c.j4 / sqrt(-a_c.j2c * (2.0 * a_c.j2s - a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_2(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_2(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.14)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return  a_c.j5 / sqrt(-2.0 * a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_3(const IntermediateResult * ir) const
     {
         // cf. [BHvD2010], p. 7, eq. (2.15)
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j6s / (2.0 * sqrt(power_of<2>(2.0 * a_c.j2s) - power_of<2>(a_c.j3)));
     }
 
     double
-    BsToPhiDilepton::integrated_h_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return sqrt(2.0) * a_c.j8 / sqrt(-a_c.j2c * (2.0 * a_c.j2s + a_c.j3));
     }
 
     double
-    BsToPhiDilepton::integrated_h_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_h_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return -a_c.j9 / sqrt(power_of<2>(2.0 * a_c.j2s) + power_of<2>(a_c.j3));
     }
 
     // integrated angular coefficients
     double
-    BsToPhiDilepton::integrated_j_1c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_1c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j1c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_1s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_1s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j1s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_2c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_2c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j2c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_2s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_2s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j2s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_3(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_3(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j3;
     }
 
     double
-    BsToPhiDilepton::integrated_j_4(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_4(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j4;
     }
 
     double
-    BsToPhiDilepton::integrated_j_5(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_5(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j5;
     }
 
     double
-    BsToPhiDilepton::integrated_j_6c(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_6c(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j6c;
     }
 
     double
-    BsToPhiDilepton::integrated_j_6s(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_6s(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j6s;
     }
 
     double
-    BsToPhiDilepton::integrated_j_7(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_7(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j7;
     }
 
     double
-    BsToPhiDilepton::integrated_j_8(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_8(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j8;
     }
 
     double
-    BsToPhiDilepton::integrated_j_9(const double & s_min, const double & s_max) const
+    BsToPhiDilepton::integrated_j_9(const IntermediateResult * ir) const
     {
-        AngularCoefficients a_c = _imp->integrated_angular_coefficients(s_min, s_max);
+        AngularCoefficients a_c = _imp->integrated_angular_coefficients(ir);
         return a_c.j9;
     }
 
@@ -20,6 +20,7 @@
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_BS_TO_PHI_LL_HH
 #define EOS_GUARD_SRC_RARE_B_DECAYS_BS_TO_PHI_LL_HH 1
 
+#include <eos/observable.hh>
 #include <eos/maths/complex.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/options.hh>
@@ -136,13 +137,15 @@ namespace eos
              * e.g. from @f$\bar{B}_s^0 \to \phi \ell^+ \ell^-@f$, only.
              */
             // @{
-            double integrated_decay_width(const double & q2_min, const double & q2_max) const;
-            double integrated_branching_ratio(const double & q2_min, const double & q2_max) const;
-            double integrated_unnormalized_forward_backward_asymmetry(const double & s_min, const double & s_max) const;
-            double integrated_forward_backward_asymmetry(const double & q2_min, const double & q2_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const;
+            double integrated_decay_width(const IntermediateResult * ir) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_unnormalized_forward_backward_asymmetry(const IntermediateResult * ir) const;
+            double integrated_forward_backward_asymmetry(const IntermediateResult * ir) const;
             double integrated_forward_backward_asymmetry_cp_averaged(const double & s_min, const double & s_max) const;
-            double integrated_longitudinal_polarisation(const double & q2_min, const double & q2_max) const;
-            double integrated_transversal_polarisation(const double & q2_min, const double & q2_max) const;
+            double integrated_longitudinal_polarisation(const IntermediateResult * ir) const;
+            double integrated_transversal_polarisation(const IntermediateResult * ir) const;
             // @}
 
             /*!
@@ -152,12 +155,12 @@ namespace eos
              * matrix elements at small @f$q^2@f$.
              */
             // @{
-            double integrated_transverse_asymmetry_2(const double & q2_min, const double & q2_max) const;
-            double integrated_transverse_asymmetry_3(const double & q2_min, const double & q2_max) const;
-            double integrated_transverse_asymmetry_4(const double & q2_min, const double & q2_max) const;
-            double integrated_transverse_asymmetry_5(const double & q2_min, const double & q2_max) const;
-            double integrated_transverse_asymmetry_re(const double & q2_min, const double & q2_max) const;
-            double integrated_transverse_asymmetry_im(const double & q2_min, const double & q2_max) const;
+            double integrated_transverse_asymmetry_2(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_3(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_4(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_5(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_re(const IntermediateResult * ir) const;
+            double integrated_transverse_asymmetry_im(const IntermediateResult * ir) const;
             // @}
 
             /*!
@@ -167,29 +170,29 @@ namespace eos
              * matrix elements at large @f$q^2@f$.
              */
             // @{
-            double integrated_h_1(const double & q2_min, const double & q2_max) const;
-            double integrated_h_2(const double & q2_min, const double & q2_max) const;
-            double integrated_h_3(const double & q2_min, const double & q2_max) const;
-            double integrated_h_4(const double & q2_min, const double & q2_max) const;
-            double integrated_h_5(const double & q2_min, const double & q2_max) const;
+            double integrated_h_1(const IntermediateResult * ir) const;
+            double integrated_h_2(const IntermediateResult * ir) const;
+            double integrated_h_3(const IntermediateResult * ir) const;
+            double integrated_h_4(const IntermediateResult * ir) const;
+            double integrated_h_5(const IntermediateResult * ir) const;
             // @}
 
             /*!
              * @name Angular observables (@f$q^2@f$-integrated)
              */
             // @{
-            double integrated_j_1s(const double & q2_min, const double & q2_max) const;
-            double integrated_j_1c(const double & q2_min, const double & q2_max) const;
-            double integrated_j_2s(const double & q2_min, const double & q2_max) const;
-            double integrated_j_2c(const double & q2_min, const double & q2_max) const;
-            double integrated_j_3(const double & q2_min, const double & q2_max) const;
-            double integrated_j_4(const double & q2_min, const double & q2_max) const;
-            double integrated_j_5(const double & q2_min, const double & q2_max) const;
-            double integrated_j_6s(const double & q2_min, const double & q2_max) const;
-            double integrated_j_6c(const double & q2_min, const double & q2_max) const;
-            double integrated_j_7(const double & q2_min, const double & q2_max) const;
-            double integrated_j_8(const double & q2_min, const double & q2_max) const;
-            double integrated_j_9(const double & q2_min, const double & q2_max) const;
+            double integrated_j_1s(const IntermediateResult * ir) const;
+            double integrated_j_1c(const IntermediateResult * ir) const;
+            double integrated_j_2s(const IntermediateResult * ir) const;
+            double integrated_j_2c(const IntermediateResult * ir) const;
+            double integrated_j_3(const IntermediateResult * ir) const;
+            double integrated_j_4(const IntermediateResult * ir) const;
+            double integrated_j_5(const IntermediateResult * ir) const;
+            double integrated_j_6s(const IntermediateResult * ir) const;
+            double integrated_j_6c(const IntermediateResult * ir) const;
+            double integrated_j_7(const IntermediateResult * ir) const;
+            double integrated_j_8(const IntermediateResult * ir) const;
+            double integrated_j_9(const IntermediateResult * ir) const;
             // @}
 
             /*!
@@ -251,6 +254,23 @@ namespace eos
         complex<double> a_time_para, a_long_para;
     };
 
+    /*!
+     * The q^2-integrated angular coefficients J_i, from which all integrated observables
+     * in one bin are derived.
+     */
+    class BsToPhiDilepton::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 12> ac;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
+
 
     class BsToPhiDileptonAndConjugate:
         public ParameterUser
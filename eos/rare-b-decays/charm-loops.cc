@@ -27,6 +27,7 @@
 #include <eos/rare-b-decays/long-distance.hh>
 #include <eos/utils/exception.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/memoise.hh>
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/stringify.hh>
@@ -334,9 +335,37 @@ namespace eos
     }
 
     /* Two-Loop functions for charm-quark loops */
-    // cf. [AAGW2001], Eq. (56), p. 20
     complex<double>
-    CharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c)
+    CharmLoopsMassiveCoefficients::operator() (const double & s_hat, const complex<double> & log_s_hat) const
+    {
+        complex<double> r = r0[0] + r1[0] * log_s_hat;
+        complex<double> i = i0[0] + i1[0] * log_s_hat;
+
+        // avoid 0 * log(0) when no logarithm is present at s_hat = 0
+        if ((0.0 == r1[0]) && (0.0 == i1[0]))
+        {
+            r = r0[0];
+            i = i0[0];
+        }
+
+        // s_hat^k log(s_hat) vanishes for s_hat -> 0 and k > 0
+        if (0.0 == s_hat)
+            return r + complex<double>(0.0, 1.0) * i;
+
+        double s_hat_k = 1.0;
+        for (unsigned k = 1 ; k < 4 ; ++k)
+        {
+            s_hat_k *= s_hat;
+
+            r += s_hat_k * (r0[k] + r1[k] * log_s_hat);
+            i += s_hat_k * (i0[k] + i1[k] * log_s_hat);
+        }
+
+        return r + complex<double>(0.0, 1.0) * i;
+    }
+
+    CharmLoopsMassiveCoefficients
+    CharmLoops::F17_massive_coefficients(const double & mu, const double & m_b, const double & m_c)
     {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap1700[7][5][2] = {
@@ -410,135 +439,104 @@ namespace eos
         };
 
         double m_c_hat = m_c / m_b, z = power_of<2>(m_c_hat);
-        double s_hat = s / power_of<2>(m_b);
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.0 < s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F17_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
 
         const double rho17[4] = {
             1.94955 * power_of<3>(m_c_hat), 11.6973 * m_c_hat, 70.1839 * m_c_hat, -3.8991 / m_c_hat + 159.863 * m_c_hat
         };
 
+        CharmLoopsMassiveCoefficients c;
+
         // real part
-        complex<double> r = -208.0 / 243.0 * log(mu / m_b);
+        c.r0[0] = -208.0 / 243.0 * log(mu / m_b);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
-                r = r + kap1700[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r0[0] += kap1700[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1710[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r0[1] += kap1710[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1711[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r1[1] += kap1711[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1720[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r0[2] += kap1720[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1721[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r1[2] += kap1721[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1730[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r0[3] += kap1730[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1731[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.r1[3] += kap1731[l][m][0] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 0 ; l < 4; l++)
-            r = r + rho17[l] * pow(s_hat, l);
+            c.r0[l] += rho17[l];
 
         // imaginary part
-        complex<double> i = 0.0;
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1700[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i0[0] += kap1700[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1710[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i0[1] += kap1710[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1711[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i1[1] += kap1711[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1720[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i0[2] += kap1720[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1721[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i1[2] += kap1721[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1730[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i0[3] += kap1730[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1731[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_c_hat), m);
+                c.i1[3] += kap1731[l][m][1] * pow(z, l-3) * pow(log(m_c_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return c;
     }
 
-    namespace impl
+    // cf. [AAGW2001], Eq. (56), p. 20
+    complex<double>
+    CharmLoops::F17_massive(const double & mu, const double & s, const double & m_b, const double & m_c)
     {
-        complex<double> f27_0(const double & mu, const double & m_b, const double & m_q)
-        {
-            static long double kap2700[7][5][2] = {
-                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-                {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-                {{6.85597, 3.10281}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
-                {{13.2214, -9.55118}, {31.3046, -11.1701}, {-3.55556, -22.3402}, {-2.37037, 0}, {0, 0}},
-                {{-11.182, 18.3741}, {27.9808, 0}, {0, -22.3402}, {-2.37037, 0}, {0, 0}},
-                {{7.26787, -17.3757}, {-17.9753, 14.8935}, {24.8889, 0}, {0, 0}, {0, 0}}
-            };
-
-            const double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-
-            const long double rho27 = -11.6973 * power_of<3>(m_q_hat);
-
-            // real part
-            double r = 416.0 / 81.0 * log(mu / m_b);
-
-            for (int l = 3 ; l < 7 ; l++)
-                for (int m = 0 ; m < 4 ; m++)
-                    r = r + kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
-
-            r = r + rho27 ;
-
-            // imaginary part
-            double i = 0.0;
-
-            for (int l = 3 ; l < 7 ; l++)
-                for (int m = 0 ; m < 3 ; m++)
-                    i = i + kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+        double s_hat = s / power_of<2>(m_b);
 
-            return complex<double>(r, i);
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.0 < s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F17_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
         }
+
+        return memoise(CharmLoops::F17_massive_coefficients, mu, m_b, m_c)(s_hat, log_s_hat);
     }
 
-    // cf. [AAGW2001], Eq. (56), p. 20
-    complex<double>
-    CharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    CharmLoopsMassiveCoefficients
+    CharmLoops::F27_massive_coefficients(const double & mu, const double & m_b, const double & m_q)
     {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap2700[7][5][2] = {
@@ -612,107 +610,105 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
 
         const double rho27[4] = {
             -11.6973 * power_of<3>(m_q_hat), -70.1839 * m_q_hat, -421.103 * m_q_hat, 23.3946 / m_q_hat - 959.179 * m_q_hat
         };
 
-        if (s_hat == 0)
-        {
-            return impl::f27_0(mu, m_b, m_q);
-        }
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.0 < s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F27_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
+        CharmLoopsMassiveCoefficients c;
 
         // real part
-        complex<double> r = 416.0 / 81.0 * log(mu / m_b);
+        c.r0[0] = 416.0 / 81.0 * log(mu / m_b);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[0] += kap2700[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2710[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[1] += kap2710[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2711[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[1] += kap2711[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2720[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[2] += kap2720[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2721[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[2] += kap2721[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2730[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[3] += kap2730[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2731[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[3] += kap2731[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 4; l++)
-            r = r + rho27[l] * pow(s_hat, l);
+            c.r0[l] += rho27[l];
 
         // imaginary part
-        complex<double> i = 0.0;
-
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[0] += kap2700[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2710[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[1] += kap2710[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2711[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[1] += kap2711[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2720[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[2] += kap2720[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2721[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[2] += kap2721[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2730[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[3] += kap2730[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2731[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[3] += kap2731[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return c;
     }
 
-    // cf. [AAGW2001], Eq. (54), p. 19
+    // cf. [AAGW2001], Eq. (56), p. 20
     complex<double>
-    CharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    CharmLoops::F27_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
     {
-        // F19(s) diverges for s -> 0. However, s * F19(s) -> 0 for s -> 0.
-        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F19_massive: F19 diverges for s -> 0. Check that F19 enters via 's * F19(s)' and replace by zero.");
+        double s_hat = s / m_b / m_b;
 
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.0 < s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.00))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F27_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
+
+        return memoise(CharmLoops::F27_massive_coefficients, mu, m_b, m_q)(s_hat, log_s_hat);
+    }
+
+    CharmLoopsMassiveCoefficients
+    CharmLoops::F19_massive_coefficients(const double & mu, const double & m_b, const double & m_q)
+    {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap1900[7][5][2] = {
             {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
@@ -795,115 +791,123 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F19_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
 
         const double rho19[4] = {
             3.8991 * power_of<3>(m_q_hat), -23.3946 * m_q_hat, -140.368 * m_q_hat, 7.79821 / m_q_hat - 319.726 * m_q_hat
         };
 
+        CharmLoopsMassiveCoefficients c;
+
         // real part
-        complex<double> r = (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b)
-            - 16.0 / 243.0 * log(mu/m_b) * log_s_hat
-            + (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log(mu/m_b) * s_hat
-            + (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log(mu/m_b) * s_hat * s_hat
-            + (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log(mu/m_b) * power_of<3>(s_hat)
-            - 256.0 / 243.0 * power_of<2>(log(mu/m_b));
+        c.r0[0] = (-1424.0 / 729.0 + 64.0 / 27.0 * log(m_q_hat)) * log(mu/m_b) - 256.0 / 243.0 * power_of<2>(log(mu/m_b));
+        c.r1[0] = -16.0 / 243.0 * log(mu/m_b);
+        c.r0[1] = (16.0 / 1215.0 - 32.0 / 135.0 /power_of<2>(m_q_hat)) * log(mu/m_b);
+        c.r0[2] = (4.0 / 2835.0 - 8.0 / 315.0 /power_of<4>(m_q_hat)) * log(mu/m_b);
+        c.r0[3] = (16.0 / 76545.0 - 32.0 /8505.0 / power_of<6>(m_q_hat)) * log(mu/m_b);
 
         for (int l = 3  ; l < 7 ; l++)
             for (int m = 0  ; m < 4  ; m++)
-                r = r + kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[0] += kap1900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3  ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[0] += kap1901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2  ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[1] += kap1910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4  ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[1] += kap1911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1  ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[2] += kap1920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3  ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[2] += kap1921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0  ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap1930[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[3] += kap1930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3  ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap1931[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[3] += kap1931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        for (int l = 0  ; l < 4; l++)
-            r = r + rho19[l] * pow(s_hat, l);
+        for (int l = 0 ; l < 4; l++)
+            c.r0[l] += rho19[l];
 
         // imaginary part
-        complex<double> i = 16.0 / 243.0 * M_PI * log(mu/m_b);
+        c.i0[0] = 16.0 / 243.0 * M_PI * log(mu/m_b);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[0] += kap1900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[0] += kap1901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[1] += kap1910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[1] += kap1911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[2] += kap1920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[2] += kap1921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap1930[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[3] += kap1930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap1931[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[3] += kap1931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return c;
     }
 
     // cf. [AAGW2001], Eq. (54), p. 19
     complex<double>
-    CharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    CharmLoops::F19_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
     {
-        // F29(s) diverges for s -> 0. However, s * F29(s) -> 0 for s -> 0.
+        // F19(s) diverges for s -> 0. However, s * F19(s) -> 0 for s -> 0.
         if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
-            throw InternalError("CharmLoops::F29_massive: F29 diverges for s -> 0. Check that F29 enters via 's * F29(s)' and replace by zero.");
+            throw InternalError("CharmLoops::F19_massive: F19 diverges for s -> 0. Check that F19 enters via 's * F19(s)' and replace by zero.");
 
+        double s_hat = s / m_b / m_b;
+
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.000 <= s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F19_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
+
+        return memoise(CharmLoops::F19_massive_coefficients, mu, m_b, m_q)(s_hat, log_s_hat);
+    }
+
+    CharmLoopsMassiveCoefficients
+    CharmLoops::F29_massive_coefficients(const double & mu, const double & m_b, const double & m_q)
+    {
         // cf. [ABGW2001], Appendix B, pp. 34-38
         static double kap2900[7][5][2] = {
             {{0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
@@ -985,105 +989,118 @@ namespace eos
         };
 
         double m_q_hat = m_q / m_b, z = power_of<2>(m_q_hat);
-        double s_hat = s / m_b / m_b;
-
-        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
-        if ((0.000 <= s_hat) && (s_hat <= 0.45))
-        {
-            log_s_hat.imag(0.0);
-        }
-        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
-        {
-            log_s_hat.imag(+M_PI);
-        }
-        else
-        {
-            throw InternalError("CharmLoop::F29_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
-        }
 
         const double rho29[4] = {
             -23.3946 * power_of<3>(m_q_hat), 140.368 * m_q_hat, 842.206 * m_q_hat, -46.7892 / m_q_hat + 1918.36 * m_q_hat
         };
 
+        CharmLoopsMassiveCoefficients c;
+
         // real part
-        complex<double> r = (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b)
-            + 32.0 / 81.0 * log(mu / m_b) * log_s_hat
-            + (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log(mu / m_b) * s_hat
-            + (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log(mu / m_b) * s_hat * s_hat
-            + (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log(mu / m_b) * power_of<3>(s_hat)
-            + 512.0 / 81.0 * power_of<2>(log(mu / m_b));
+        c.r0[0] = (256.0 / 243.0 - 128.0 / 9.0 * log(m_q_hat)) * log(mu / m_b) + 512.0 / 81.0 * power_of<2>(log(mu / m_b));
+        c.r1[0] = 32.0 / 81.0 * log(mu / m_b);
+        c.r0[1] = (-32.0 / 405.0 + 64.0 / 45 / power_of<2>(m_q_hat)) * log(mu / m_b);
+        c.r0[2] = (-8.0 / 945.0 + 16.0 / 105 / power_of<4>(m_q_hat)) * log(mu / m_b);
+        c.r0[3] = (-32.0 / 25515.0 + 64.0 / 2835 / power_of<6>(m_q_hat)) * log(mu / m_b);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 4 ; m++)
-                r = r + kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[0] += kap2900[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2901[l][m][0] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[0] += kap2901[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2910[l][m][0] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[1] += kap2910[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2911[l][m][0] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[1] += kap2911[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2920[l][m][0] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[2] += kap2920[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2921[l][m][0] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[2] += kap2921[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 5 ; m++)
-                r = r + kap2930[l][m][0] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r0[3] += kap2930[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                r = r + kap2931[l][m][0] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.r1[3] += kap2931[l][m][0] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 4; l++)
-            r = r + rho29[l] * pow(s_hat, l);
+            c.r0[l] += rho29[l];
 
         // imaginary part
-        complex<double> i = - 32.0 / 81.0 * M_PI * log(mu/m_b);
+        c.i0[0] = - 32.0 / 81.0 * M_PI * log(mu/m_b);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[0] += kap2900[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 3 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2901[l][m][1] * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[0] += kap2901[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 2 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2910[l][m][1] * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[1] += kap2910[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2911[l][m][1] * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[1] += kap2911[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 1 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2920[l][m][1] * s_hat * s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[2] += kap2920[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2921[l][m][1] * s_hat * s_hat * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[2] += kap2921[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 0 ; l < 7 ; l++)
             for (int m = 0 ; m < 3 ; m++)
-                i = i + kap2930[l][m][1] * power_of<3>(s_hat) * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i0[3] += kap2930[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
         for (int l = 4 ; l < 7 ; l++)
             for (int m = 0 ; m < 2 ; m++)
-                i = i + kap2931[l][m][1] * power_of<3>(s_hat) * log_s_hat * pow(z, l-3) * pow(log(m_q_hat), m);
+                c.i1[3] += kap2931[l][m][1] * pow(z, l-3) * pow(log(m_q_hat), m);
 
-        return r + complex<double>(0.0, 1.0) * i;
+        return c;
+    }
+
+    // cf. [AAGW2001], Eq. (54), p. 19
+    complex<double>
+    CharmLoops::F29_massive(const double & mu, const double & s, const double & m_b, const double & m_q)
+    {
+        // F29(s) diverges for s -> 0. However, s * F29(s) -> 0 for s -> 0.
+        if (abs(s) < 1e-6) // allow for s = 1e-6, corresponding roughly to the dielectron threshold
+            throw InternalError("CharmLoops::F29_massive: F29 diverges for s -> 0. Check that F29 enters via 's * F29(s)' and replace by zero.");
+
+        double s_hat = s / m_b / m_b;
+
+        complex<double> log_s_hat = { std::log(std::abs(s_hat)), 0.0 };
+        if ((0.000 <= s_hat) && (s_hat <= 0.45))
+        {
+            log_s_hat.imag(0.0);
+        }
+        else if ((-0.45 <= s_hat) && (s_hat <= -0.000))
+        {
+            log_s_hat.imag(+M_PI);
+        }
+        else
+        {
+            throw InternalError("CharmLoop::F29_massive used outside its domain of validity, s_hat = " + stringify(s_hat));
+        }
+
+        return memoise(CharmLoops::F29_massive_coefficients, mu, m_b, m_q)(s_hat, log_s_hat);
     }
 
     // cf. [AAGW2001], eqs. (48) and (49), p. 18
@@ -26,6 +26,7 @@
 #include <eos/utils/diagnostics.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
 #include <vector>
 
 namespace eos
@@ -46,6 +47,23 @@ namespace eos
         complex<double> operator()(const double & s) const { return complex<double>(real_part(s), imag_part(s)); };
     };
 
+    /*!
+     * Coefficients of the massive two-loop functions F_ij, cf. [ABGW2001], Appendix B.
+     *
+     * The real and imaginary parts of F_ij are polynomials of degree three in s_hat = s / m_b^2
+     * and of degree one in log(s_hat). Their coefficients depend on mu and the quark masses only,
+     * which allows to reuse them for all values of s.
+     */
+    struct CharmLoopsMassiveCoefficients
+    {
+        // coefficients of s_hat^k and s_hat^k log(s_hat) in the real part
+        std::array<double, 4> r0{}, r1{};
+        // coefficients of s_hat^k and s_hat^k log(s_hat) in the imaginary part
+        std::array<double, 4> i0{}, i1{};
+
+        complex<double> operator() (const double & s_hat, const complex<double> & log_s_hat) const;
+    };
+
     struct CharmLoops
     {
         /* One-loop functions */
@@ -79,6 +97,12 @@ namespace eos
         static complex<double> F29_massive(const double & mu, const double & s, const double & m_b, const double & m_c);
         static complex<double> delta_F29_massive(const double & mu, const double & s, const double & m_c);
 
+        // coefficients of the massive case, independent of s
+        static CharmLoopsMassiveCoefficients F17_massive_coefficients(const double & mu, const double & m_b, const double & m_c);
+        static CharmLoopsMassiveCoefficients F19_massive_coefficients(const double & mu, const double & m_b, const double & m_c);
+        static CharmLoopsMassiveCoefficients F27_massive_coefficients(const double & mu, const double & m_b, const double & m_c);
+        static CharmLoopsMassiveCoefficients F29_massive_coefficients(const double & mu, const double & m_b, const double & m_c);
+
         // helper functions for F8j, cf. [BFS2001], Eqs. (29) and (84), pp. 8 and 30
         static complex<double> B0(const double & s, const double & m_q);
         static complex<double> C0(const double & s, const double & m_q);
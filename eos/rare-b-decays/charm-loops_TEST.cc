@@ -21,6 +21,7 @@
 #include <test/test.hh>
 #include <eos/rare-b-decays/charm-loops.hh>
 
+#include <array>
 #include <cmath>
 
 using namespace test;
@@ -417,6 +418,51 @@ class FormFactorsTest :
                 TEST_CHECK_RELATIVE_ERROR(+ 4.0282600,  real(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), eps);
                 TEST_CHECK_RELATIVE_ERROR(- 0.6601020,  imag(CharmLoops::F29_massive(mu, -1.0, m_b, m_c)), eps);
             }
+
+            /* Formfactors, massive loops at s/q^2 = 0 */
+            {
+                static const double mu = 4.2, m_b = 4.6, m_c = 1.2, eps = 1e-7;
+
+                TEST_CHECK_NEARLY_EQUAL(+ 3.99747123,  real(CharmLoops::F27_massive(mu, 0.0, m_b, m_c)), eps);
+                TEST_CHECK_NEARLY_EQUAL(+ 0.61565441,  imag(CharmLoops::F27_massive(mu, 0.0, m_b, m_c)), eps);
+
+                // F17 is continuous at s = 0
+                TEST_CHECK_NEARLY_EQUAL(real(CharmLoops::F17_massive(mu, 1.0e-9, m_b, m_c)), real(CharmLoops::F17_massive(mu, 0.0, m_b, m_c)), eps);
+                TEST_CHECK_NEARLY_EQUAL(imag(CharmLoops::F17_massive(mu, 1.0e-9, m_b, m_c)), imag(CharmLoops::F17_massive(mu, 0.0, m_b, m_c)), eps);
+            }
+
+            /* Formfactors, massive loops at further points, with reference values from the former evaluation of all coefficients per point */
+            {
+                static const double eps = 1e-9;
+
+                static const struct
+                {
+                    double mu, s, m_b, m_c;
+                    std::array<double, 2> F27, F29, F17, F19;
+                } references[] =
+                {
+                    { 4.2, +1.0, 4.6, 1.2, { +4.0732404688e+00, +6.8391026739e-01 }, { +5.6814038151e+00, -1.7027214508e+00 }, { -6.7887206703e-01, -1.1398469951e-01 }, { -1.3690220652e+01, +2.8380147098e-01 } },
+                    { 4.2, +6.0, 4.6, 1.2, { +4.3856325414e+00, +1.0662740354e+00 }, { +6.2736443903e+00, +1.5519580731e+00 }, { -7.3093991137e-01, -1.7771334333e-01 }, { -3.4408703309e+01, -2.5864665908e-01 } },
+                    { 2.5, -6.0, 4.8, 1.4, { +3.0239397756e-01, +2.7007952147e-01 }, { -2.6349498847e+00, -4.1540869291e-01 }, { -5.0390806544e-02, -4.5011957684e-02 }, { -3.6348306563e+00, +6.9252157827e-02 } },
+                    { 2.5, +1.0, 4.8, 1.4, { +7.8507793886e-01, +4.9125827772e-01 }, { -4.0202274696e+00, -1.2077596615e+00 }, { -1.3084496296e-01, -8.1876000972e-02 }, { -1.0339275404e+01, +2.0130770119e-01 } },
+                    { 2.5, +6.0, 4.8, 1.4, { +1.0868144940e+00, +7.6005922891e-01 }, { -7.0345306433e+00, +3.6092892970e-01 }, { -1.8113607975e-01, -1.2667741052e-01 }, { -2.1745884520e+01, -6.0142551030e-02 } },
+                    { 5.0, -6.0, 4.2, 1.0, { +5.0893138080e+00, +4.6045486170e-01 }, { +1.0356045294e+01, -1.8803662010e+00 }, { -8.4820711718e-01, -7.6740747449e-02 }, { +3.1327223064e+00, +3.1341321274e-01 } },
+                    { 5.0, +1.0, 4.2, 1.0, { +5.7463725306e+00, +8.6219395102e-01 }, { +1.3628327859e+01, -1.5702930186e+00 }, { -9.5772745325e-01, -1.4369870562e-01 }, { -1.6626991065e+01, +2.6173024128e-01 } },
+                    { 5.0, +6.0, 4.2, 1.0, { +6.0302455458e+00, +1.4160790126e+00 }, { +1.7901047335e+01, +5.9153363163e+00 }, { -1.0050443455e+00, -2.3601461342e-01 }, { -6.0084072820e+01, -9.8587544877e-01 } },
+                };
+
+                for (const auto & r : references)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(r.F27[0], real(CharmLoops::F27_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F27[1], imag(CharmLoops::F27_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F29[0], real(CharmLoops::F29_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F29[1], imag(CharmLoops::F29_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F17[0], real(CharmLoops::F17_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F17[1], imag(CharmLoops::F17_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F19[0], real(CharmLoops::F19_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                    TEST_CHECK_RELATIVE_ERROR(r.F19[1], imag(CharmLoops::F19_massive(r.mu, r.s, r.m_b, r.m_c)), eps);
+                }
+            }
         }
 } two_loop_test;
 
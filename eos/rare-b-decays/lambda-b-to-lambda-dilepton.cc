@@ -325,6 +325,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        using IntermediateResult = LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -412,6 +416,8 @@ namespace eos
             double L = -1.0 * (m_b_PS2 - s) / s * std::log(1.0 - s / m_b_PS2);
 
             // ratio of tensor to vector form factors
+            const auto ff = form_factors->evaluate_all(s);
+
             // cf. [BFvD2014], eqs. (??)-(??)
             double R1p = 1.0 + alpha_s / (3.0 * M_PI) * (2.0 * std::log(m_b_PS / mu()) - 2.0 - L);
             double R1m = 1.0 + alpha_s / (3.0 * M_PI) * (2.0 * std::log(m_b_PS / mu()) - 2.0 - L);
@@ -462,17 +468,17 @@ namespace eos
                 );
 
             // cf. [BFvD2014], eqs. (??)-(??)
-            result.a_perp_1_R = -2.0 *       N * (wc.c9() + wc.c9prime() + (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1p) * form_factors->f_perp_v(s) * sqrtsminus;
-            result.a_perp_1_L = -2.0 *       N * (wc.c9() + wc.c9prime() - (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1p) * form_factors->f_perp_v(s) * sqrtsminus;
+            result.a_perp_1_R = -2.0 *       N * (wc.c9() + wc.c9prime() + (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1p) * ff.f_perp_v * sqrtsminus;
+            result.a_perp_1_L = -2.0 *       N * (wc.c9() + wc.c9prime() - (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1p) * ff.f_perp_v * sqrtsminus;
 
-            result.a_para_1_R = +2.0 *       N * (wc.c9() - wc.c9prime() + (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1m) * form_factors->f_perp_a(s) * sqrtsplus;
-            result.a_para_1_L = +2.0 *       N * (wc.c9() - wc.c9prime() - (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1m) * form_factors->f_perp_a(s) * sqrtsplus;
+            result.a_para_1_R = +2.0 *       N * (wc.c9() - wc.c9prime() + (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1m) * ff.f_perp_a * sqrtsplus;
+            result.a_para_1_L = +2.0 *       N * (wc.c9() - wc.c9prime() - (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar * m_Lambda_b / s * tau_1m) * ff.f_perp_a * sqrtsplus;
 
-            result.a_perp_0_R = +sqrt(2.0) * N * (wc.c9() + wc.c9prime() + (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0p) * form_factors->f_long_v(s) * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
-            result.a_perp_0_L = +sqrt(2.0) * N * (wc.c9() + wc.c9prime() - (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0p) * form_factors->f_long_v(s) * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
+            result.a_perp_0_R = +sqrt(2.0) * N * (wc.c9() + wc.c9prime() + (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0p) * ff.f_long_v * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
+            result.a_perp_0_L = +sqrt(2.0) * N * (wc.c9() + wc.c9prime() - (wc.c10() + wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0p) * ff.f_long_v * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
 
-            result.a_para_0_R = -sqrt(2.0) * N * (wc.c9() - wc.c9prime() + (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0m) * form_factors->f_long_a(s) * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
-            result.a_para_0_L = -sqrt(2.0) * N * (wc.c9() - wc.c9prime() - (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0m) * form_factors->f_long_a(s) * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
+            result.a_para_0_R = -sqrt(2.0) * N * (wc.c9() - wc.c9prime() + (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0m) * ff.f_long_a * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
+            result.a_para_0_L = -sqrt(2.0) * N * (wc.c9() - wc.c9prime() - (wc.c10() - wc.c10prime()) + 2.0 * m_b_MSbar / m_Lambda_b * tau_0m) * ff.f_long_a * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
 
             result.alpha = this->alpha();
             result.polarisation = this->polarisation();
@@ -497,9 +503,15 @@ namespace eos
             return lambdab_to_lambda_dilepton::AngularObservables{ _differential_angular_observables(s) };
         }
 
-        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const double & s_min, const double & s_max)
+        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
         {
-            return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
+            return lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.k = _integrated_angular_observables(s_min, s_max);
+            return &intermediate_result;
         }
     };
 
@@ -550,273 +562,279 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LargeRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        return _imp->integrated_angular_observables(ir).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     /* Polarised angular observables */
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m1(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1() / o.decay_width();
     }
 
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m2(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m3(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m4(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m5(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k5() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m6(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k6() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m7(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k7() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m8(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k8() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m9(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k9() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m10(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k10() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m11(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k11() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m12(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k12() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m13(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k13() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m14(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k14() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m15(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k15() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m16(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k16() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m17(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k17() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m18(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k18() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m19(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k19() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m20(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k20() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m21(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k21() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m22(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k22() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m23(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k23() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m24(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k24() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m25(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k25() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m26(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k26() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m27(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k27() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m28(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k28() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m29(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k29() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m30(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k30() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m31(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k31() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m32(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k32() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m33(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k33() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LargeRecoil>::integrated_m34(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k34() / o.decay_width();
     }
 
@@ -864,6 +882,10 @@ namespace eos
 
         std::shared_ptr<FormFactors<OneHalfPlusToOneHalfPlus>> form_factors;
 
+        using IntermediateResult = LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult;
+
+        IntermediateResult intermediate_result;
+
         static const std::vector<OptionSpecification> options;
 
         Implementation(const Parameters & p, const Options & o, ParameterUser & u) :
@@ -914,11 +936,13 @@ namespace eos
             complex<double> c7eff = ShortDistanceLowRecoil::c7eff(s, mu(), alpha_s, m_b, true, wc);
             complex<double> c9eff = ShortDistanceLowRecoil::c9eff(s, mu(), alpha_s, m_b, m_c, true, false, lambda_hat_u, wc);
 
+            const auto ff = form_factors->evaluate_all(s);
+
             // cf. [BFvD2014], eq.s (??), p. ??
-            double zeta_perp_V = (m_Lambda_b + m_Lambda) / m_Lambda_b * form_factors->f_perp_t(s)  / form_factors->f_perp_v(s);
-            double zeta_perp_A = (m_Lambda_b - m_Lambda) / m_Lambda_b * form_factors->f_perp_t5(s) / form_factors->f_perp_a(s);
-            double zeta_long_V = s / ((m_Lambda_b + m_Lambda) * m_Lambda_b) * form_factors->f_long_t(s)  / form_factors->f_long_v(s);
-            double zeta_long_A = s / ((m_Lambda_b - m_Lambda) * m_Lambda_b) * form_factors->f_long_t5(s) / form_factors->f_long_a(s);
+            double zeta_perp_V = (m_Lambda_b + m_Lambda) / m_Lambda_b * ff.f_perp_t  / ff.f_perp_v;
+            double zeta_perp_A = (m_Lambda_b - m_Lambda) / m_Lambda_b * ff.f_perp_t5 / ff.f_perp_a;
+            double zeta_long_V = s / ((m_Lambda_b + m_Lambda) * m_Lambda_b) * ff.f_long_t  / ff.f_long_v;
+            double zeta_long_A = s / ((m_Lambda_b - m_Lambda) * m_Lambda_b) * ff.f_long_t5 / ff.f_long_a;
 
             // parametrize subleading power corrections, cf. [MvD2016], eq. (B1), p. ??
             complex<double> x_perp_0 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_perp_0();
@@ -927,20 +951,20 @@ namespace eos
             complex<double> x_para_1 = (4.0 / 3.0 * wc.c1() + wc.c2()) * r_para_1();
 
             // cf. [BFvD2014], eqs. (4.9)-(4.10), p. 11
-            result.a_perp_1_R = -2.0 *       N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_perp_V + (wc.c10() + wc.c10prime()) + x_perp_1) * form_factors->f_perp_v(s) * sqrtsminus;
-            result.a_perp_1_L = -2.0 *       N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_perp_V - (wc.c10() + wc.c10prime()) + x_perp_1) * form_factors->f_perp_v(s) * sqrtsminus;
+            result.a_perp_1_R = -2.0 *       N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_perp_V + (wc.c10() + wc.c10prime()) + x_perp_1) * ff.f_perp_v * sqrtsminus;
+            result.a_perp_1_L = -2.0 *       N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_perp_V - (wc.c10() + wc.c10prime()) + x_perp_1) * ff.f_perp_v * sqrtsminus;
 
-            result.a_para_1_R = +2.0 *       N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_perp_A + (wc.c10() - wc.c10prime()) + x_para_1) * form_factors->f_perp_a(s) * sqrtsplus;
-            result.a_para_1_L = +2.0 *       N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_perp_A - (wc.c10() - wc.c10prime()) + x_para_1) * form_factors->f_perp_a(s) * sqrtsplus;
+            result.a_para_1_R = +2.0 *       N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_perp_A + (wc.c10() - wc.c10prime()) + x_para_1) * ff.f_perp_a * sqrtsplus;
+            result.a_para_1_L = +2.0 *       N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_perp_A - (wc.c10() - wc.c10prime()) + x_para_1) * ff.f_perp_a * sqrtsplus;
 
-            result.a_perp_0_R = +sqrt(2.0) * N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_long_V + (wc.c10() + wc.c10prime()) + x_perp_0) * form_factors->f_long_v(s)
+            result.a_perp_0_R = +sqrt(2.0) * N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_long_V + (wc.c10() + wc.c10prime()) + x_perp_0) * ff.f_long_v
                 * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
-            result.a_perp_0_L = +sqrt(2.0) * N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_long_V - (wc.c10() + wc.c10prime()) + x_perp_0) * form_factors->f_long_v(s)
+            result.a_perp_0_L = +sqrt(2.0) * N * (c9eff + wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff + wc.c7prime()) * zeta_long_V - (wc.c10() + wc.c10prime()) + x_perp_0) * ff.f_long_v
                 * (m_Lambda_b + m_Lambda)  / sqrts * sqrtsminus;
 
-            result.a_para_0_R = -sqrt(2.0) * N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_long_A + (wc.c10() - wc.c10prime()) + x_para_0) * form_factors->f_long_a(s)
+            result.a_para_0_R = -sqrt(2.0) * N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_long_A + (wc.c10() - wc.c10prime()) + x_para_0) * ff.f_long_a
                 * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
-            result.a_para_0_L = -sqrt(2.0) * N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_long_A - (wc.c10() - wc.c10prime()) + x_para_0) * form_factors->f_long_a(s)
+            result.a_para_0_L = -sqrt(2.0) * N * (c9eff - wc.c9prime() + (2.0 * kappa * m_b * m_Lambda_b / s) * (c7eff - wc.c7prime()) * zeta_long_A - (wc.c10() - wc.c10prime()) + x_para_0) * ff.f_long_a
                 * (m_Lambda_b - m_Lambda)  / sqrts * sqrtsplus;
 
             result.alpha = this->alpha();
@@ -966,9 +990,15 @@ namespace eos
             return lambdab_to_lambda_dilepton::AngularObservables{ _differential_angular_observables(s) };
         }
 
-        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const double & s_min, const double & s_max)
+        inline lambdab_to_lambda_dilepton::AngularObservables integrated_angular_observables(const IntermediateResult * ir)
         {
-            return lambdab_to_lambda_dilepton::AngularObservables{ _integrated_angular_observables(s_min, s_max) };
+            return lambdab_to_lambda_dilepton::AngularObservables{ ir->k };
+        }
+
+        const IntermediateResult * prepare(const double & s_min, const double & s_max)
+        {
+            intermediate_result.k = _integrated_angular_observables(s_min, s_max);
+            return &intermediate_result;
         }
     };
 
@@ -1019,342 +1049,348 @@ namespace eos
     }
 
     /* q^2-integrated observables */
+    const LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult *
+    LambdaBToLambdaDilepton<LowRecoil>::prepare(const double & s_min, const double & s_max) const
+    {
+        return _imp->prepare(s_min, s_max);
+    }
+
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_branching_ratio(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
+        return _imp->integrated_angular_observables(ir).decay_width() * _imp->tau_Lambda_b / _imp->hbar;
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_leptonic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_leptonic();
+        return _imp->integrated_angular_observables(ir).a_fb_leptonic();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_hadronic(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_hadronic();
+        return _imp->integrated_angular_observables(ir).a_fb_hadronic();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_a_fb_combined(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).a_fb_combined();
+        return _imp->integrated_angular_observables(ir).a_fb_combined();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_fzero(const IntermediateResult * ir) const
     {
-        return _imp->integrated_angular_observables(s_min, s_max).f_zero();
+        return _imp->integrated_angular_observables(ir).f_zero();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k1c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2ss(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2ss() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2cc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2cc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k2c(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2c() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k3s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4sc(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4sc() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_k4s(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4s() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m1(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k1() / o.decay_width();
     }
 
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m2(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k2() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m3(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k3() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m4(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k4() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m5(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k5() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m6(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k6() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m7(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k7() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m8(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k8() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m9(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k9() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m10(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k10() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m11(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k11() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m12(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k12() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m13(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k13() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m14(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k14() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m15(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k15() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m16(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k16() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m17(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k17() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m18(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k18() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m19(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k19() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m20(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k20() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m21(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k21() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m22(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k22() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m23(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k23() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m24(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k24() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m25(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k25() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m26(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k26() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m27(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k27() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m28(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k28() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m29(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k29() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m30(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k30() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m31(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k31() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m32(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k32() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m33(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k33() / o.decay_width();
     }
 
     double
-    LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const double & s_min, const double & s_max) const
+    LambdaBToLambdaDilepton<LowRecoil>::integrated_m34(const IntermediateResult * ir) const
     {
-        auto o = _imp->integrated_angular_observables(s_min, s_max);
+        auto o = _imp->integrated_angular_observables(ir);
         return o.k34() / o.decay_width();
     }
 
@@ -21,12 +21,15 @@
 #ifndef EOS_GUARD_EOS_RARE_B_DECAYS_BARYONIC_B_TO_S_DILEPTON_HH
 #define EOS_GUARD_EOS_RARE_B_DECAYS_BARYONIC_B_TO_S_DILEPTON_HH 1
 
+#include <eos/observable.hh>
 #include <eos/rare-b-decays/decays.hh>
 #include <eos/utils/options.hh>
 #include <eos/utils/parameters.hh>
 #include <eos/utils/private_implementation_pattern.hh>
 #include <eos/utils/reference-name.hh>
 
+#include <array>
+
 namespace eos
 {
     /*
@@ -46,46 +49,48 @@ namespace eos
             double differential_a_fb_combined(const double & s) const;
             double differential_fzero(const double & s) const;
 
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_leptonic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_hadronic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_combined(const double & s_min, const double & s_max) const;
-            double integrated_fzero(const double & s_min, const double & s_max) const;
-
-            double integrated_m1(const double & s_min, const double & s_max) const;
-            double integrated_m2(const double & s_min, const double & s_max) const;
-            double integrated_m3(const double & s_min, const double & s_max) const;
-            double integrated_m4(const double & s_min, const double & s_max) const;
-            double integrated_m5(const double & s_min, const double & s_max) const;
-            double integrated_m6(const double & s_min, const double & s_max) const;
-            double integrated_m7(const double & s_min, const double & s_max) const;
-            double integrated_m8(const double & s_min, const double & s_max) const;
-            double integrated_m9(const double & s_min, const double & s_max) const;
-            double integrated_m10(const double & s_min, const double & s_max) const;
-            double integrated_m11(const double & s_min, const double & s_max) const;
-            double integrated_m12(const double & s_min, const double & s_max) const;
-            double integrated_m13(const double & s_min, const double & s_max) const;
-            double integrated_m14(const double & s_min, const double & s_max) const;
-            double integrated_m15(const double & s_min, const double & s_max) const;
-            double integrated_m16(const double & s_min, const double & s_max) const;
-            double integrated_m17(const double & s_min, const double & s_max) const;
-            double integrated_m18(const double & s_min, const double & s_max) const;
-            double integrated_m19(const double & s_min, const double & s_max) const;
-            double integrated_m20(const double & s_min, const double & s_max) const;
-            double integrated_m21(const double & s_min, const double & s_max) const;
-            double integrated_m22(const double & s_min, const double & s_max) const;
-            double integrated_m23(const double & s_min, const double & s_max) const;
-            double integrated_m24(const double & s_min, const double & s_max) const;
-            double integrated_m25(const double & s_min, const double & s_max) const;
-            double integrated_m26(const double & s_min, const double & s_max) const;
-            double integrated_m27(const double & s_min, const double & s_max) const;
-            double integrated_m28(const double & s_min, const double & s_max) const;
-            double integrated_m29(const double & s_min, const double & s_max) const;
-            double integrated_m30(const double & s_min, const double & s_max) const;
-            double integrated_m31(const double & s_min, const double & s_max) const;
-            double integrated_m32(const double & s_min, const double & s_max) const;
-            double integrated_m33(const double & s_min, const double & s_max) const;
-            double integrated_m34(const double & s_min, const double & s_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_a_fb_leptonic(const IntermediateResult * ir) const;
+            double integrated_a_fb_hadronic(const IntermediateResult * ir) const;
+            double integrated_a_fb_combined(const IntermediateResult * ir) const;
+            double integrated_fzero(const IntermediateResult * ir) const;
+
+            double integrated_m1(const IntermediateResult * ir) const;
+            double integrated_m2(const IntermediateResult * ir) const;
+            double integrated_m3(const IntermediateResult * ir) const;
+            double integrated_m4(const IntermediateResult * ir) const;
+            double integrated_m5(const IntermediateResult * ir) const;
+            double integrated_m6(const IntermediateResult * ir) const;
+            double integrated_m7(const IntermediateResult * ir) const;
+            double integrated_m8(const IntermediateResult * ir) const;
+            double integrated_m9(const IntermediateResult * ir) const;
+            double integrated_m10(const IntermediateResult * ir) const;
+            double integrated_m11(const IntermediateResult * ir) const;
+            double integrated_m12(const IntermediateResult * ir) const;
+            double integrated_m13(const IntermediateResult * ir) const;
+            double integrated_m14(const IntermediateResult * ir) const;
+            double integrated_m15(const IntermediateResult * ir) const;
+            double integrated_m16(const IntermediateResult * ir) const;
+            double integrated_m17(const IntermediateResult * ir) const;
+            double integrated_m18(const IntermediateResult * ir) const;
+            double integrated_m19(const IntermediateResult * ir) const;
+            double integrated_m20(const IntermediateResult * ir) const;
+            double integrated_m21(const IntermediateResult * ir) const;
+            double integrated_m22(const IntermediateResult * ir) const;
+            double integrated_m23(const IntermediateResult * ir) const;
+            double integrated_m24(const IntermediateResult * ir) const;
+            double integrated_m25(const IntermediateResult * ir) const;
+            double integrated_m26(const IntermediateResult * ir) const;
+            double integrated_m27(const IntermediateResult * ir) const;
+            double integrated_m28(const IntermediateResult * ir) const;
+            double integrated_m29(const IntermediateResult * ir) const;
+            double integrated_m30(const IntermediateResult * ir) const;
+            double integrated_m31(const IntermediateResult * ir) const;
+            double integrated_m32(const IntermediateResult * ir) const;
+            double integrated_m33(const IntermediateResult * ir) const;
+            double integrated_m34(const IntermediateResult * ir) const;
 
             /*!
              * References used in the computation of our observables.
@@ -99,6 +104,23 @@ namespace eos
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
 
+    /*!
+     * The q^2-integrated angular observables K_1ss through K_34 at large recoil, from which all
+     * integrated observables in one bin are derived.
+     */
+    class LambdaBToLambdaDilepton<LargeRecoil>::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 34> k;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
+
     /*
      * Decay: Lambda_b -> Lambda l^+ l^- at low recoil, cf. [BFvD2014]
      */
@@ -116,57 +138,59 @@ namespace eos
             double differential_a_fb_combined(const double & s) const;
             double differential_fzero(const double & s) const;
 
-            double integrated_branching_ratio(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_leptonic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_hadronic(const double & s_min, const double & s_max) const;
-            double integrated_a_fb_combined(const double & s_min, const double & s_max) const;
-            double integrated_fzero(const double & s_min, const double & s_max) const;
-
-            double integrated_k1ss(const double & s_min, const double & s_max) const;
-            double integrated_k1cc(const double & s_min, const double & s_max) const;
-            double integrated_k1c(const double & s_min, const double & s_max) const;
-            double integrated_k2ss(const double & s_min, const double & s_max) const;
-            double integrated_k2cc(const double & s_min, const double & s_max) const;
-            double integrated_k2c(const double & s_min, const double & s_max) const;
-            double integrated_k3sc(const double & s_min, const double & s_max) const;
-            double integrated_k3s(const double & s_min, const double & s_max) const;
-            double integrated_k4sc(const double & s_min, const double & s_max) const;
-            double integrated_k4s(const double & s_min, const double & s_max) const;
-
-            double integrated_m1(const double & s_min, const double & s_max) const;
-            double integrated_m2(const double & s_min, const double & s_max) const;
-            double integrated_m3(const double & s_min, const double & s_max) const;
-            double integrated_m4(const double & s_min, const double & s_max) const;
-            double integrated_m5(const double & s_min, const double & s_max) const;
-            double integrated_m6(const double & s_min, const double & s_max) const;
-            double integrated_m7(const double & s_min, const double & s_max) const;
-            double integrated_m8(const double & s_min, const double & s_max) const;
-            double integrated_m9(const double & s_min, const double & s_max) const;
-            double integrated_m10(const double & s_min, const double & s_max) const;
-            double integrated_m11(const double & s_min, const double & s_max) const;
-            double integrated_m12(const double & s_min, const double & s_max) const;
-            double integrated_m13(const double & s_min, const double & s_max) const;
-            double integrated_m14(const double & s_min, const double & s_max) const;
-            double integrated_m15(const double & s_min, const double & s_max) const;
-            double integrated_m16(const double & s_min, const double & s_max) const;
-            double integrated_m17(const double & s_min, const double & s_max) const;
-            double integrated_m18(const double & s_min, const double & s_max) const;
-            double integrated_m19(const double & s_min, const double & s_max) const;
-            double integrated_m20(const double & s_min, const double & s_max) const;
-            double integrated_m21(const double & s_min, const double & s_max) const;
-            double integrated_m22(const double & s_min, const double & s_max) const;
-            double integrated_m23(const double & s_min, const double & s_max) const;
-            double integrated_m24(const double & s_min, const double & s_max) const;
-            double integrated_m25(const double & s_min, const double & s_max) const;
-            double integrated_m26(const double & s_min, const double & s_max) const;
-            double integrated_m27(const double & s_min, const double & s_max) const;
-            double integrated_m28(const double & s_min, const double & s_max) const;
-            double integrated_m29(const double & s_min, const double & s_max) const;
-            double integrated_m30(const double & s_min, const double & s_max) const;
-            double integrated_m31(const double & s_min, const double & s_max) const;
-            double integrated_m32(const double & s_min, const double & s_max) const;
-            double integrated_m33(const double & s_min, const double & s_max) const;
-            double integrated_m34(const double & s_min, const double & s_max) const;
+            class IntermediateResult;
+            const IntermediateResult * prepare(const double & s_min, const double & s_max) const;
+            double integrated_branching_ratio(const IntermediateResult * ir) const;
+            double integrated_a_fb_leptonic(const IntermediateResult * ir) const;
+            double integrated_a_fb_hadronic(const IntermediateResult * ir) const;
+            double integrated_a_fb_combined(const IntermediateResult * ir) const;
+            double integrated_fzero(const IntermediateResult * ir) const;
+
+            double integrated_k1ss(const IntermediateResult * ir) const;
+            double integrated_k1cc(const IntermediateResult * ir) const;
+            double integrated_k1c(const IntermediateResult * ir) const;
+            double integrated_k2ss(const IntermediateResult * ir) const;
+            double integrated_k2cc(const IntermediateResult * ir) const;
+            double integrated_k2c(const IntermediateResult * ir) const;
+            double integrated_k3sc(const IntermediateResult * ir) const;
+            double integrated_k3s(const IntermediateResult * ir) const;
+            double integrated_k4sc(const IntermediateResult * ir) const;
+            double integrated_k4s(const IntermediateResult * ir) const;
+
+            double integrated_m1(const IntermediateResult * ir) const;
+            double integrated_m2(const IntermediateResult * ir) const;
+            double integrated_m3(const IntermediateResult * ir) const;
+            double integrated_m4(const IntermediateResult * ir) const;
+            double integrated_m5(const IntermediateResult * ir) const;
+            double integrated_m6(const IntermediateResult * ir) const;
+            double integrated_m7(const IntermediateResult * ir) const;
+            double integrated_m8(const IntermediateResult * ir) const;
+            double integrated_m9(const IntermediateResult * ir) const;
+            double integrated_m10(const IntermediateResult * ir) const;
+            double integrated_m11(const IntermediateResult * ir) const;
+            double integrated_m12(const IntermediateResult * ir) const;
+            double integrated_m13(const IntermediateResult * ir) const;
+            double integrated_m14(const IntermediateResult * ir) const;
+            double integrated_m15(const IntermediateResult * ir) const;
+            double integrated_m16(const IntermediateResult * ir) const;
+            double integrated_m17(const IntermediateResult * ir) const;
+            double integrated_m18(const IntermediateResult * ir) const;
+            double integrated_m19(const IntermediateResult * ir) const;
+            double integrated_m20(const IntermediateResult * ir) const;
+            double integrated_m21(const IntermediateResult * ir) const;
+            double integrated_m22(const IntermediateResult * ir) const;
+            double integrated_m23(const IntermediateResult * ir) const;
+            double integrated_m24(const IntermediateResult * ir) const;
+            double integrated_m25(const IntermediateResult * ir) const;
+            double integrated_m26(const IntermediateResult * ir) const;
+            double integrated_m27(const IntermediateResult * ir) const;
+            double integrated_m28(const IntermediateResult * ir) const;
+            double integrated_m29(const IntermediateResult * ir) const;
+            double integrated_m30(const IntermediateResult * ir) const;
+            double integrated_m31(const IntermediateResult * ir) const;
+            double integrated_m32(const IntermediateResult * ir) const;
+            double integrated_m33(const IntermediateResult * ir) const;
+            double integrated_m34(const IntermediateResult * ir) const;
 
             /*!
              * References used in the computation of our observables.
@@ -179,6 +203,23 @@ namespace eos
             static std::vector<OptionSpecification>::const_iterator begin_options();
             static std::vector<OptionSpecification>::const_iterator end_options();
     };
+
+    /*!
+     * The q^2-integrated angular observables K_1ss through K_34 at low recoil, from which all
+     * integrated observables in one bin are derived.
+     */
+    class LambdaBToLambdaDilepton<LowRecoil>::IntermediateResult :
+        public CacheableObservable::IntermediateResult
+    {
+        public:
+            std::array<double, 34> k;
+
+            IntermediateResult()
+            {
+            }
+
+            ~IntermediateResult() = default;
+    };
 }
 
 #endif
@@ -30,9 +30,6 @@
 #include <map>
 #include <numeric>
 
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_blas.h>
-
 namespace eos
 {
     using std::abs;
@@ -799,7 +796,7 @@ namespace eos
                     return p_at_z / phi(q2, phi_parameters) / F_plus;
                 }
 
-                inline std::pair<gsl_vector *, gsl_vector *> orthonormal_coefficients() const
+                inline std::array<complex<double>, interpolation_order + 1> orthonormal_coefficients() const
                 {
                     const std::array<complex<double>, interpolation_order + 1> interpolation_values{
                         complex<double>(re_at_m7_plus, im_at_m7_plus),
@@ -810,45 +807,26 @@ namespace eos
                         polar<double>(abs_at_psi2S_plus, arg_at_psi2S_plus)
                     };
 
-                    std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
-
-                    // Split array of derivatives to real and imaginary parts
-                    gsl_vector * dL_real_part = gsl_vector_calloc(interpolation_order + 1);
-                    gsl_vector * dL_imag_part = gsl_vector_calloc(interpolation_order + 1);
+                    const std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
 
-                    for (unsigned i = 0; i <= interpolation_order; ++i)
-                    {
-                        gsl_vector_set(dL_real_part, i, real(dL[i]));
-                        gsl_vector_set(dL_imag_part, i, imag(dL[i]));
-                    }
-
-                    const gsl_matrix * coefficient_matrix = orthonormal_polynomials.coefficient_matrix();
-
-                    // Solve the system by computing (coefficient_matrix)^(-1) . dL_real_part and idem for imag
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_real_part);
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_imag_part);
-
-                    return std::make_pair(dL_real_part, dL_imag_part);
+                    // Solve the triangular system (coefficient_matrix) . x = dL
+                    return orthonormal_polynomials.orthonormal_coefficients(dL);
                 }
 
                 virtual complex<double> get_orthonormal_coefficients(const unsigned & i) const
                 {
-                    auto coefficients = orthonormal_coefficients();
-
-                    return complex<double>(gsl_vector_get(coefficients.first,  i),
-                                           gsl_vector_get(coefficients.second, i));
+                    return orthonormal_coefficients()[i];
                 }
 
                 virtual double weak_bound() const
                 {
-                    auto coefficients = orthonormal_coefficients();
+                    const auto coefficients = orthonormal_coefficients();
 
                     double largest_absolute_coeff = 0.0, coeff;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coeff =   power_of<2>(gsl_vector_get(coefficients.first,  i))
-                                + power_of<2>(gsl_vector_get(coefficients.second, i));
+                        coeff = norm(coefficients[i]);
                         if (coeff > largest_absolute_coeff)
                         {
                             largest_absolute_coeff = coeff;
@@ -860,14 +838,13 @@ namespace eos
 
                 virtual double strong_bound() const
                 {
-                    auto coefficients = orthonormal_coefficients();
+                    const auto coefficients = orthonormal_coefficients();
 
                     double coefficient_sum = 0.0;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coefficient_sum +=   power_of<2>(gsl_vector_get(coefficients.first,  i))
-                                           + power_of<2>(gsl_vector_get(coefficients.second, i));
+                        coefficient_sum += norm(coefficients[i]);
                     }
 
                     return coefficient_sum;
@@ -1221,7 +1198,7 @@ namespace eos
                     return p_at_z / phi(q2, phi_parameters) / F_plus;
                 }
 
-                inline std::pair<gsl_vector *, gsl_vector *> orthonormal_coefficients() const
+                inline std::array<complex<double>, interpolation_order + 1> orthonormal_coefficients() const
                 {
                     const std::array<complex<double>, interpolation_order + 1> interpolation_values{
                         complex<double>(re_at_m7_plus, im_at_m7_plus),
@@ -1233,45 +1210,26 @@ namespace eos
                         polar<double>(abs_at_psi2S_plus, arg_at_psi2S_plus)
                     };
 
-                    std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
+                    const std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
 
-                    // Split array of derivatives to real and imaginary parts
-                    gsl_vector * dL_real_part = gsl_vector_calloc(interpolation_order + 1);
-                    gsl_vector * dL_imag_part = gsl_vector_calloc(interpolation_order + 1);
-
-                    for (unsigned i = 0; i <= interpolation_order; ++i)
-                    {
-                        gsl_vector_set(dL_real_part, i, real(dL[i]));
-                        gsl_vector_set(dL_imag_part, i, imag(dL[i]));
-                    }
-
-                    const gsl_matrix * coefficient_matrix = orthonormal_polynomials.coefficient_matrix();
-
-                    // Solve the system by computing (coefficient_matrix)^(-1) . dL_real_part and idem for imag
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_real_part);
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_imag_part);
-
-                    return std::make_pair(dL_real_part, dL_imag_part);
+                    // Solve the triangular system (coefficient_matrix) . x = dL
+                    return orthonormal_polynomials.orthonormal_coefficients(dL);
                 }
 
                 virtual complex<double> get_orthonormal_coefficients(const unsigned & i) const
                 {
-                    auto coefficients = orthonormal_coefficients();
-
-                    return complex<double>(gsl_vector_get(coefficients.first,  i),
-                                           gsl_vector_get(coefficients.second, i));
+                    return orthonormal_coefficients()[i];
                 }
 
                 virtual double weak_bound() const
                 {
-                    auto coefficients = orthonormal_coefficients();
+                    const auto coefficients = orthonormal_coefficients();
 
                     double largest_absolute_coeff = 0.0, coeff;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coeff =  power_of<2>(gsl_vector_get(coefficients.first,  i))
-                               + power_of<2>(gsl_vector_get(coefficients.second, i));
+                        coeff = norm(coefficients[i]);
                         if (coeff > largest_absolute_coeff)
                         {
                             largest_absolute_coeff = coeff;
@@ -1283,14 +1241,13 @@ namespace eos
 
                 virtual double strong_bound() const
                 {
-                    auto coefficients = orthonormal_coefficients();
+                    const auto coefficients = orthonormal_coefficients();
 
                     double coefficient_sum = 0.0;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coefficient_sum +=  power_of<2>(gsl_vector_get(coefficients.first,  i))
-                                          + power_of<2>(gsl_vector_get(coefficients.second, i));
+                        coefficient_sum += norm(coefficients[i]);
                     }
 
                     return coefficient_sum;
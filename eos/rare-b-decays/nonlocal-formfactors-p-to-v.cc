@@ -27,15 +27,14 @@
 #include <eos/utils/options-impl.hh>
 #include <eos/utils/kinematic.hh>
 #include <eos/utils/memoise.hh>
+#include <eos/utils/parameter-memoiser.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
 #include <eos/utils/stringify.hh>
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_blas.h>
-
 namespace eos
 {
     using std::abs;
@@ -290,6 +289,18 @@ namespace eos
                 // Orthogonal polynomials on an arc of the unit circle
                 std::shared_ptr<SzegoPolynomial<5u>> polynomials;
 
+                // Quantities that depend on the parameters but not on q2, shared by all polarisations
+                struct Coefficients
+                {
+                    std::array<complex<double>, 6> alpha_perp, alpha_para, alpha_long;
+
+                    double s_0, s_p;
+
+                    complex<double> z_Jpsi, z_psi2S;
+                };
+
+                ParameterMemoiser<Coefficients> memoised_coefficients;
+
                 std::string _final_state() const
                 {
                     switch (opt_q.value()[0])
@@ -303,6 +314,46 @@ namespace eos
                     }
                 }
 
+                Coefficients coefficients() const
+                {
+                    return memoised_coefficients([this] ()
+                    {
+                        Coefficients result;
+
+                        result.alpha_perp = {
+                            complex<double>(re_alpha_0_perp, im_alpha_0_perp),
+                            complex<double>(re_alpha_1_perp, im_alpha_1_perp),
+                            complex<double>(re_alpha_2_perp, im_alpha_2_perp),
+                            complex<double>(re_alpha_3_perp, im_alpha_3_perp),
+                            complex<double>(re_alpha_4_perp, im_alpha_4_perp),
+                            complex<double>(re_alpha_5_perp, im_alpha_5_perp),
+                        };
+                        result.alpha_para = {
+                            complex<double>(re_alpha_0_para, im_alpha_0_para),
+                            complex<double>(re_alpha_1_para, im_alpha_1_para),
+                            complex<double>(re_alpha_2_para, im_alpha_2_para),
+                            complex<double>(re_alpha_3_para, im_alpha_3_para),
+                            complex<double>(re_alpha_4_para, im_alpha_4_para),
+                            complex<double>(re_alpha_5_para, im_alpha_5_para),
+                        };
+                        result.alpha_long = {
+                            complex<double>(re_alpha_0_long, im_alpha_0_long),
+                            complex<double>(re_alpha_1_long, im_alpha_1_long),
+                            complex<double>(re_alpha_2_long, im_alpha_2_long),
+                            complex<double>(re_alpha_3_long, im_alpha_3_long),
+                            complex<double>(re_alpha_4_long, im_alpha_4_long),
+                            complex<double>(re_alpha_5_long, im_alpha_5_long),
+                        };
+
+                        result.s_0     = this->t_0();
+                        result.s_p     = 4.0 * power_of<2>(m_D0);
+                        result.z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),  result.s_p, result.s_0);
+                        result.z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S), result.s_p, result.s_0);
+
+                        return result;
+                    });
+                }
+
             public:
                 GvDV2020(const Parameters & p, const Options & o) :
                     form_factors(FormFactorFactory<PToV>::create(stringify(Process_::label) + "::" + o.get("form-factors", "BSZ2015"), p)),
@@ -363,7 +414,8 @@ namespace eos
 
                     // The parameters of the polynomial expension are computed using t0 = 4.0 and
                     // the masses are set to the same values as for local form-factors
-                    polynomials(PolynomialsFactory::create(opt_q.value()))
+                    polynomials(PolynomialsFactory::create(opt_q.value())),
+                    memoised_coefficients(p)
                 {
                     this->uses(*form_factors);
                 }
@@ -408,65 +460,43 @@ namespace eos
                 // Residue of H at s = m_Jpsi2 computed as the residue wrt z -z_Jpsi divided by dz/ds evaluated at s = m_Jpsi2
                 inline complex<double> H_residue_jpsi(const std::array<unsigned, 4> & phi_parameters, const std::array<complex<double>, 6> & alpha) const
                 {
-                    const double m_Jpsi2  = power_of<2>(m_Jpsi);
-                    const double m_psi2S2 = power_of<2>(m_psi2S);
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z_Jpsi  = eos::nff_utils::z(m_Jpsi2,  s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const double m_Jpsi2 = power_of<2>(m_Jpsi);
 
-                    const auto & polynomials_at_z = (*polynomials)(z_Jpsi);
+                    const auto & polynomials_at_z = (*polynomials)(c.z_Jpsi);
                     const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
-                    const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_Jpsi2, -0.5) * pow(pow(s_p - m_Jpsi2, 0.5) + pow(s_p - s_0, 0.5), -2);
+                    const complex<double> dzds = -pow(c.s_p - c.s_0, 0.5) * pow(c.s_p - m_Jpsi2, -0.5) * pow(pow(c.s_p - m_Jpsi2, 0.5) + pow(c.s_p - c.s_0, 0.5), -2);
 
-                    return p_at_z / phi(m_Jpsi2, phi_parameters) * (1 - norm(z_Jpsi)) * (1. - z_Jpsi * std::conj(z_psi2S)) / (z_Jpsi - z_psi2S) / dzds;
+                    return p_at_z / phi(m_Jpsi2, phi_parameters) * (1 - norm(c.z_Jpsi)) * (1. - c.z_Jpsi * std::conj(c.z_psi2S)) / (c.z_Jpsi - c.z_psi2S) / dzds;
                 }
 
                 // Residue of H at s = m_psi2S2 computed as the residue wrt z -z_psi2S divided by dz/ds evaluated at s = m_psi2S2
                 inline complex<double> H_residue_psi2s(const std::array<unsigned, 4> & phi_parameters, const std::array<complex<double>, 6> & alpha) const
                 {
-                    const double m_Jpsi2  = power_of<2>(m_Jpsi);
+                    const Coefficients c = coefficients();
                     const double m_psi2S2 = power_of<2>(m_psi2S);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z_Jpsi  = eos::nff_utils::z(m_Jpsi2,  s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
-
-                    const auto & polynomials_at_z = (*polynomials)(z_psi2S);
+                    const auto & polynomials_at_z = (*polynomials)(c.z_psi2S);
                     const complex<double> p_at_z = std::inner_product(alpha.begin(), alpha.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
-                    const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_psi2S2, -0.5) * pow(pow(s_p - m_psi2S2, 0.5) + pow(s_p - s_0, 0.5), -2);
+                    const complex<double> dzds = -pow(c.s_p - c.s_0, 0.5) * pow(c.s_p - m_psi2S2, -0.5) * pow(pow(c.s_p - m_psi2S2, 0.5) + pow(c.s_p - c.s_0, 0.5), -2);
 
-                    return p_at_z / phi(m_psi2S2, phi_parameters) *(1 - norm(z_psi2S)) * (1. - z_psi2S * std::conj(z_Jpsi)) / (z_psi2S - z_Jpsi) / dzds;
+                    return p_at_z / phi(m_psi2S2, phi_parameters) * (1 - norm(c.z_psi2S)) * (1. - c.z_psi2S * std::conj(c.z_Jpsi)) / (c.z_psi2S - c.z_Jpsi) / dzds;
                 }
 
                 virtual complex<double> H_perp(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
-
-                    const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_perp.begin(), alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
-
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
+                    const auto & polynomials_at_z = (*polynomials)(z);
+                    const complex<double> p_at_z = std::inner_product(c.alpha_perp.begin(), c.alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
 
@@ -477,47 +507,25 @@ namespace eos
 
                 virtual complex<double> Hhat_perp(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_perp.begin(), alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(c.alpha_perp.begin(), c.alpha_perp.end(), polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
                 virtual complex<double> H_para(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
-
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
                     const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_para.begin(), alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(c.alpha_para.begin(), c.alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -529,47 +537,25 @@ namespace eos
 
                 virtual complex<double> Hhat_para(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_para.begin(), alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(c.alpha_para.begin(), c.alpha_para.end(), polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
                 virtual complex<double> H_long(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
-
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
                     const auto & polynomials_at_z = (*polynomials)(z);
-                    const complex<double> p_at_z = std::inner_product(alpha_long.begin(), alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    const complex<double> p_at_z = std::inner_product(c.alpha_long.begin(), c.alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -581,119 +567,55 @@ namespace eos
 
                 virtual complex<double> Hhat_long(const double & q2) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
                     const auto & polynomials_at_z = (*polynomials)(z);
 
-                    return std::inner_product(alpha_long.begin(), alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
+                    return std::inner_product(c.alpha_long.begin(), c.alpha_long.end(), polynomials_at_z.begin(), complex<double>(0, 0));
                 }
 
 
                 virtual complex<double> H_perp_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, alpha_perp);
+                    return H_residue_jpsi(phi_parameters, coefficients().alpha_perp);
                 }
 
                 virtual complex<double> H_perp_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, alpha_perp);
+                    return H_residue_psi2s(phi_parameters, coefficients().alpha_perp);
                 }
 
                 virtual complex<double> H_para_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, alpha_para);
+                    return H_residue_jpsi(phi_parameters, coefficients().alpha_para);
                 }
 
                 virtual complex<double> H_para_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, alpha_para);
+                    return H_residue_psi2s(phi_parameters, coefficients().alpha_para);
                 }
 
                 virtual complex<double> H_long_residue_jpsi() const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_jpsi(phi_parameters, alpha_long);
+                    return H_residue_jpsi(phi_parameters, coefficients().alpha_long);
                 }
 
                 virtual complex<double> H_long_residue_psi2s() const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_psi2s(phi_parameters, alpha_long);
+                    return H_residue_psi2s(phi_parameters, coefficients().alpha_long);
                 }
 
                 virtual complex<double> ratio_perp(const complex<double> & q2) const
@@ -775,46 +697,21 @@ namespace eos
                 virtual complex<double> normalized_moment_V23(const double &) const
                 {
                     return 0.0;
-                }                virtual complex<double> get_orthonormal_perp_coefficients(const unsigned & i) const
-                {
-                    const std::array<complex<double>, 6> alpha_perp{
-                        complex<double>(re_alpha_0_perp, im_alpha_0_perp),
-                        complex<double>(re_alpha_1_perp, im_alpha_1_perp),
-                        complex<double>(re_alpha_2_perp, im_alpha_2_perp),
-                        complex<double>(re_alpha_3_perp, im_alpha_3_perp),
-                        complex<double>(re_alpha_4_perp, im_alpha_4_perp),
-                        complex<double>(re_alpha_5_perp, im_alpha_5_perp),
-                    };
+                }
 
-                    return alpha_perp[i];
+                virtual complex<double> get_orthonormal_perp_coefficients(const unsigned & i) const
+                {
+                    return coefficients().alpha_perp[i];
                 }
 
                 virtual complex<double> get_orthonormal_para_coefficients(const unsigned & i) const
                 {
-                    const std::array<complex<double>, 6> alpha_para{
-                        complex<double>(re_alpha_0_para, im_alpha_0_para),
-                        complex<double>(re_alpha_1_para, im_alpha_1_para),
-                        complex<double>(re_alpha_2_para, im_alpha_2_para),
-                        complex<double>(re_alpha_3_para, im_alpha_3_para),
-                        complex<double>(re_alpha_4_para, im_alpha_4_para),
-                        complex<double>(re_alpha_5_para, im_alpha_5_para),
-                    };
-
-                    return alpha_para[i];
+                    return coefficients().alpha_para[i];
                 }
 
                 virtual complex<double> get_orthonormal_long_coefficients(const unsigned & i) const
                 {
-                    const std::array<complex<double>, 6> alpha_long{
-                        complex<double>(re_alpha_0_long, im_alpha_0_long),
-                        complex<double>(re_alpha_1_long, im_alpha_1_long),
-                        complex<double>(re_alpha_2_long, im_alpha_2_long),
-                        complex<double>(re_alpha_3_long, im_alpha_3_long),
-                        complex<double>(re_alpha_4_long, im_alpha_4_long),
-                        complex<double>(re_alpha_5_long, im_alpha_5_long),
-                    };
-
-                    return alpha_long[i];
+                    return coefficients().alpha_long[i];
                 }
 
                 virtual double weak_bound() const
@@ -942,6 +839,26 @@ namespace eos
                 // Orthogonal polynomials on an arc of the unit circle used for the computation of dispersive bounds
                 std::shared_ptr<SzegoPolynomial<5u>> orthonormal_polynomials;
 
+                // Quantities that depend on the parameters but not on q2, shared by all polarisations
+                struct Coefficients
+                {
+                    std::array<complex<double>, interpolation_order + 1> values_perp, values_para, values_long;
+
+                    double s_0, s_p;
+
+                    complex<double> z_Jpsi, z_psi2S;
+                };
+
+                ParameterMemoiser<Coefficients> memoised_coefficients;
+
+                // Coefficients of the expansion in the orthonormal polynomials, as required only for the dispersive bounds
+                struct OrthonormalCoefficients
+                {
+                    std::array<complex<double>, interpolation_order + 1> perp_coefficients, para_coefficients, long_coefficients;
+                };
+
+                ParameterMemoiser<OrthonormalCoefficients> memoised_orthonormal_coefficients;
+
                 std::string _final_state() const
                 {
                     switch (opt_q.value()[0])
@@ -955,6 +872,62 @@ namespace eos
                     }
                 }
 
+                Coefficients coefficients() const
+                {
+                    return memoised_coefficients([this] ()
+                    {
+                        Coefficients result;
+
+                        result.values_perp = {
+                            complex<double>(re_at_m7_perp, im_at_m7_perp),
+                            complex<double>(re_at_m5_perp, im_at_m5_perp),
+                            complex<double>(re_at_m3_perp, im_at_m3_perp),
+                            complex<double>(re_at_m1_perp, im_at_m1_perp),
+                            polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
+                            polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
+                        };
+                        result.values_para = {
+                            complex<double>(re_at_m7_para, im_at_m7_para),
+                            complex<double>(re_at_m5_para, im_at_m5_para),
+                            complex<double>(re_at_m3_para, im_at_m3_para),
+                            complex<double>(re_at_m1_para, im_at_m1_para),
+                            polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
+                            polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
+                        };
+                        result.values_long = {
+                            complex<double>(re_at_m7_long, im_at_m7_long),
+                            complex<double>(re_at_m5_long, im_at_m5_long),
+                            complex<double>(re_at_m3_long, im_at_m3_long),
+                            complex<double>(re_at_m1_long, im_at_m1_long),
+                            polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
+                            polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
+                        };
+
+                        result.s_0     = this->t_0();
+                        result.s_p     = 4.0 * power_of<2>(m_D0);
+                        result.z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),  result.s_p, result.s_0);
+                        result.z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S), result.s_p, result.s_0);
+
+                        return result;
+                    });
+                }
+
+                OrthonormalCoefficients orthonormal_coefficients() const
+                {
+                    return memoised_orthonormal_coefficients([this] ()
+                    {
+                        const Coefficients c = coefficients();
+
+                        // Decompose the interpolating polynomial, given in the monomial basis, on the orthonormal polynomials
+                        OrthonormalCoefficients result;
+                        result.perp_coefficients = orthonormal_polynomials->orthonormal_coefficients(lagrange.get_coefficients(c.values_perp));
+                        result.para_coefficients = orthonormal_polynomials->orthonormal_coefficients(lagrange.get_coefficients(c.values_para));
+                        result.long_coefficients = orthonormal_polynomials->orthonormal_coefficients(lagrange.get_coefficients(c.values_long));
+
+                        return result;
+                    });
+                }
+
             public:
                 GRvDV2022order5(const Parameters & p, const Options & o) :
                     form_factors(FormFactorFactory<PToV>::create(stringify(Process_::label) + "::" + o.get("form-factors", "BSZ2015"), p)),
@@ -1024,7 +997,9 @@ namespace eos
 
                     // The parameters of the polynomial expension are computed using t0 = 4.0 and
                     // the masses are set to mB(s) = 5.279 (5.366) and mKst(phi) = 0.896 (1.02) (same values as for local form-factors)
-                    orthonormal_polynomials(PolynomialsFactory::create(opt_q.value()))
+                    orthonormal_polynomials(PolynomialsFactory::create(opt_q.value())),
+                    memoised_coefficients(p),
+                    memoised_orthonormal_coefficients(p)
                 {
                     this->uses(*form_factors);
                 }
@@ -1069,61 +1044,39 @@ namespace eos
                 // Residue of H at s = m_Jpsi2 computed as the residue wrt z -z_Jpsi divided by dz/ds evaluated at s = m_Jpsi2
                 inline complex<double> H_residue_jpsi(const std::array<unsigned, 4> & phi_parameters, const std::array<complex<double>, interpolation_order + 1> & interpolation_values) const
                 {
-                    const double m_Jpsi2  = power_of<2>(m_Jpsi);
-                    const double m_psi2S2 = power_of<2>(m_psi2S);
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z_Jpsi  = eos::nff_utils::z(m_Jpsi2,  s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const double m_Jpsi2 = power_of<2>(m_Jpsi);
 
-                    const complex<double> p_at_z = lagrange(interpolation_values, z_Jpsi);
+                    const complex<double> p_at_z = lagrange(interpolation_values, c.z_Jpsi);
 
-                    const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_Jpsi2, -0.5) * pow(pow(s_p - m_Jpsi2, 0.5) + pow(s_p - s_0, 0.5), -2);
+                    const complex<double> dzds = -pow(c.s_p - c.s_0, 0.5) * pow(c.s_p - m_Jpsi2, -0.5) * pow(pow(c.s_p - m_Jpsi2, 0.5) + pow(c.s_p - c.s_0, 0.5), -2);
 
-                    return p_at_z / phi(m_Jpsi2, phi_parameters) * (1 - norm(z_Jpsi)) * (1. - z_Jpsi * std::conj(z_psi2S)) / (z_Jpsi - z_psi2S) / dzds;
+                    return p_at_z / phi(m_Jpsi2, phi_parameters) * (1 - norm(c.z_Jpsi)) * (1. - c.z_Jpsi * std::conj(c.z_psi2S)) / (c.z_Jpsi - c.z_psi2S) / dzds;
                 }
 
                 // Residue of H at s = m_psi2S2 computed as the residue wrt z -z_psi2S divided by dz/ds evaluated at s = m_psi2S2
                 inline complex<double> H_residue_psi2s(const std::array<unsigned, 4> & phi_parameters, const std::array<complex<double>, interpolation_order + 1> & interpolation_values) const
                 {
-                    const double m_Jpsi2  = power_of<2>(m_Jpsi);
+                    const Coefficients c = coefficients();
                     const double m_psi2S2 = power_of<2>(m_psi2S);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z_Jpsi  = eos::nff_utils::z(m_Jpsi2,  s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(m_psi2S2, s_p, s_0);
-
-                    const complex<double> p_at_z = lagrange(interpolation_values, z_psi2S);
+                    const complex<double> p_at_z = lagrange(interpolation_values, c.z_psi2S);
 
-                    const complex<double> dzds = -pow(s_p - s_0, 0.5) * pow(s_p - m_psi2S2, -0.5) * pow(pow(s_p - m_psi2S2, 0.5) + pow(s_p - s_0, 0.5), -2);
+                    const complex<double> dzds = -pow(c.s_p - c.s_0, 0.5) * pow(c.s_p - m_psi2S2, -0.5) * pow(pow(c.s_p - m_psi2S2, 0.5) + pow(c.s_p - c.s_0, 0.5), -2);
 
-                    return p_at_z / phi(m_psi2S2, phi_parameters) *(1 - norm(z_psi2S)) * (1. - z_psi2S * std::conj(z_Jpsi)) / (z_psi2S - z_Jpsi) / dzds;
+                    return p_at_z / phi(m_psi2S2, phi_parameters) * (1 - norm(c.z_psi2S)) * (1. - c.z_psi2S * std::conj(c.z_Jpsi)) / (c.z_psi2S - c.z_Jpsi) / dzds;
                 }
 
                 virtual complex<double> H_perp(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_perp, im_at_m7_perp),
-                        complex<double>(re_at_m5_perp, im_at_m5_perp),
-                        complex<double>(re_at_m3_perp, im_at_m3_perp),
-                        complex<double>(re_at_m1_perp, im_at_m1_perp),
-                        polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    const complex<double> p_at_z = lagrange(interpolation_values, z);
+                    const complex<double> p_at_z = lagrange(c.values_perp, z);
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -1135,44 +1088,22 @@ namespace eos
 
                 virtual complex<double> Hhat_perp(const double & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_perp, im_at_m7_perp),
-                        complex<double>(re_at_m5_perp, im_at_m5_perp),
-                        complex<double>(re_at_m3_perp, im_at_m3_perp),
-                        complex<double>(re_at_m1_perp, im_at_m1_perp),
-                        polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
-
-                    return lagrange(interpolation_values, z);
+                    return lagrange(c.values_perp, z);
                 }
 
                 virtual complex<double> H_para(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_para, im_at_m7_para),
-                        complex<double>(re_at_m5_para, im_at_m5_para),
-                        complex<double>(re_at_m3_para, im_at_m3_para),
-                        complex<double>(re_at_m1_para, im_at_m1_para),
-                        polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    const complex<double> p_at_z = lagrange(interpolation_values, z);
+                    const complex<double> p_at_z = lagrange(c.values_para, z);
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -1184,44 +1115,22 @@ namespace eos
 
                 virtual complex<double> Hhat_para(const double & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_para, im_at_m7_para),
-                        complex<double>(re_at_m5_para, im_at_m5_para),
-                        complex<double>(re_at_m3_para, im_at_m3_para),
-                        complex<double>(re_at_m1_para, im_at_m1_para),
-                        polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
-
-                    return lagrange(interpolation_values, z);
+                    return lagrange(c.values_para, z);
                 }
 
                 virtual complex<double> H_long(const complex<double> & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_long, im_at_m7_long),
-                        complex<double>(re_at_m5_long, im_at_m5_long),
-                        complex<double>(re_at_m3_long, im_at_m3_long),
-                        complex<double>(re_at_m1_long, im_at_m1_long),
-                        polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
-                    };
-
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2,                     s_p, s_0);
-                    const auto z_Jpsi  = eos::nff_utils::z(power_of<2>(m_Jpsi),    s_p, s_0);
-                    const auto z_psi2S = eos::nff_utils::z(power_of<2>(m_psi2S),   s_p, s_0);
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, z_Jpsi, z_psi2S);
+                    const complex<double> blaschke_factor = eos::nff_utils::blaschke_cc(z, c.z_Jpsi, c.z_psi2S);
 
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    const complex<double> p_at_z = lagrange(interpolation_values, z);
+                    const complex<double> p_at_z = lagrange(c.values_long, z);
 
                     return p_at_z / phi(q2, phi_parameters) / blaschke_factor;
                 }
@@ -1233,116 +1142,53 @@ namespace eos
 
                 virtual complex<double> Hhat_long(const double & q2) const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_long, im_at_m7_long),
-                        complex<double>(re_at_m5_long, im_at_m5_long),
-                        complex<double>(re_at_m3_long, im_at_m3_long),
-                        complex<double>(re_at_m1_long, im_at_m1_long),
-                        polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
-                    };
+                    const Coefficients c = coefficients();
+                    const auto z = eos::nff_utils::z(q2, c.s_p, c.s_0);
 
-                    const double s_0   = this->t_0();
-                    const double s_p   = 4.0 * power_of<2>(m_D0);
-                    const auto z       = eos::nff_utils::z(q2, s_p, s_0);
-
-                    return lagrange(interpolation_values, z);
+                    return lagrange(c.values_long, z);
                 }
 
+
                 virtual complex<double> H_perp_residue_jpsi() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_perp, im_at_m7_perp),
-                        complex<double>(re_at_m5_perp, im_at_m5_perp),
-                        complex<double>(re_at_m3_perp, im_at_m3_perp),
-                        complex<double>(re_at_m1_perp, im_at_m1_perp),
-                        polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, interpolation_values);
+                    return H_residue_jpsi(phi_parameters, coefficients().values_perp);
                 }
 
                 virtual complex<double> H_perp_residue_psi2s() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_perp, im_at_m7_perp),
-                        complex<double>(re_at_m5_perp, im_at_m5_perp),
-                        complex<double>(re_at_m3_perp, im_at_m3_perp),
-                        complex<double>(re_at_m1_perp, im_at_m1_perp),
-                        polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, interpolation_values);
+                    return H_residue_psi2s(phi_parameters, coefficients().values_perp);
                 }
 
                 virtual complex<double> H_para_residue_jpsi() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_para, im_at_m7_para),
-                        complex<double>(re_at_m5_para, im_at_m5_para),
-                        complex<double>(re_at_m3_para, im_at_m3_para),
-                        complex<double>(re_at_m1_para, im_at_m1_para),
-                        polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_jpsi(phi_parameters, interpolation_values);
+                    return H_residue_jpsi(phi_parameters, coefficients().values_para);
                 }
 
                 virtual complex<double> H_para_residue_psi2s() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_para, im_at_m7_para),
-                        complex<double>(re_at_m5_para, im_at_m5_para),
-                        complex<double>(re_at_m3_para, im_at_m3_para),
-                        complex<double>(re_at_m1_para, im_at_m1_para),
-                        polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 3, 0};
 
-                    return H_residue_psi2s(phi_parameters, interpolation_values);
+                    return H_residue_psi2s(phi_parameters, coefficients().values_para);
                 }
 
                 virtual complex<double> H_long_residue_jpsi() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_long, im_at_m7_long),
-                        complex<double>(re_at_m5_long, im_at_m5_long),
-                        complex<double>(re_at_m3_long, im_at_m3_long),
-                        complex<double>(re_at_m1_long, im_at_m1_long),
-                        polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_jpsi(phi_parameters, interpolation_values);
+                    return H_residue_jpsi(phi_parameters, coefficients().values_long);
                 }
 
                 virtual complex<double> H_long_residue_psi2s() const
                 {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_long, im_at_m7_long),
-                        complex<double>(re_at_m5_long, im_at_m5_long),
-                        complex<double>(re_at_m3_long, im_at_m3_long),
-                        complex<double>(re_at_m1_long, im_at_m1_long),
-                        polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
-                    };
-
                     const std::array<unsigned, 4> phi_parameters = {3, 1, 2, 2};
 
-                    return H_residue_psi2s(phi_parameters, interpolation_values);
+                    return H_residue_psi2s(phi_parameters, coefficients().values_long);
                 }
 
                 virtual complex<double> ratio_perp(const complex<double> & q2) const
@@ -1411,154 +1257,30 @@ namespace eos
                     return F_T_long / F_long;
                 }
 
-                inline std::pair<gsl_vector *, gsl_vector *> orthonormal_perp_coefficients() const
-                {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_perp, im_at_m7_perp),
-                        complex<double>(re_at_m5_perp, im_at_m5_perp),
-                        complex<double>(re_at_m3_perp, im_at_m3_perp),
-                        complex<double>(re_at_m1_perp, im_at_m1_perp),
-                        polar<double>(abs_at_Jpsi_perp, arg_at_Jpsi_perp_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_perp, arg_at_psi2S_perp_minus_long + arg_at_psi2S_long)
-                    };
-
-                    std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
-
-                    // Split array of derivatives to real and imaginary parts
-                    gsl_vector * dL_real_part = gsl_vector_calloc(interpolation_order + 1);
-                    gsl_vector * dL_imag_part = gsl_vector_calloc(interpolation_order + 1);
-
-                    for (unsigned i = 0; i <= interpolation_order; ++i)
-                    {
-                        gsl_vector_set(dL_real_part, i, real(dL[i]));
-                        gsl_vector_set(dL_imag_part, i, imag(dL[i]));
-                    }
-
-                    const gsl_matrix * coefficient_matrix = orthonormal_polynomials->coefficient_matrix();
-
-                    // Solve the system by computing (coefficient_matrix)^(-1) . dL_real_part and idem for imag
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_real_part);
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_imag_part);
-
-                    return std::make_pair(dL_real_part, dL_imag_part);
-                }
-
-                inline std::pair<gsl_vector *, gsl_vector *> orthonormal_para_coefficients() const
-                {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_para, im_at_m7_para),
-                        complex<double>(re_at_m5_para, im_at_m5_para),
-                        complex<double>(re_at_m3_para, im_at_m3_para),
-                        complex<double>(re_at_m1_para, im_at_m1_para),
-                        polar<double>(abs_at_Jpsi_para, arg_at_Jpsi_para_minus_long + arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_para, arg_at_psi2S_para_minus_long + arg_at_psi2S_long)
-                    };
-
-                    std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
-
-                    // Split array of derivatives to real and imaginary parts
-                    gsl_vector * dL_real_part = gsl_vector_calloc(interpolation_order + 1);
-                    gsl_vector * dL_imag_part = gsl_vector_calloc(interpolation_order + 1);
-
-                    for (unsigned i = 0; i <= interpolation_order; ++i)
-                    {
-                        gsl_vector_set(dL_real_part, i, real(dL[i]));
-                        gsl_vector_set(dL_imag_part, i, imag(dL[i]));
-                    }
-
-                    const gsl_matrix * coefficient_matrix = orthonormal_polynomials->coefficient_matrix();
-
-                    // Solve the system by computing (coefficient_matrix)^(-1) . dL_real_part and idem for imag
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_real_part);
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_imag_part);
-
-                    return std::make_pair(dL_real_part, dL_imag_part);
-                }
-
-                inline std::pair<gsl_vector *, gsl_vector *> orthonormal_long_coefficients() const
-                {
-                    const std::array<complex<double>, interpolation_order + 1> interpolation_values{
-                        complex<double>(re_at_m7_long, im_at_m7_long),
-                        complex<double>(re_at_m5_long, im_at_m5_long),
-                        complex<double>(re_at_m3_long, im_at_m3_long),
-                        complex<double>(re_at_m1_long, im_at_m1_long),
-                        polar<double>(abs_at_Jpsi_long, arg_at_Jpsi_long),
-                        polar<double>(abs_at_psi2S_long, arg_at_psi2S_long)
-                    };
-
-                    std::array<complex<double>, interpolation_order + 1> dL = lagrange.get_coefficients(interpolation_values);
-
-                    // Split array of derivatives to real and imaginary parts
-                    gsl_vector * dL_real_part = gsl_vector_calloc(interpolation_order + 1);
-                    gsl_vector * dL_imag_part = gsl_vector_calloc(interpolation_order + 1);
-
-                    for (unsigned i = 0; i <= interpolation_order; ++i)
-                    {
-                        gsl_vector_set(dL_real_part, i, real(dL[i]));
-                        gsl_vector_set(dL_imag_part, i, imag(dL[i]));
-                    }
-
-                    const gsl_matrix * coefficient_matrix = orthonormal_polynomials->coefficient_matrix();
-
-                    // Solve the system by computing (coefficient_matrix)^(-1) . dL_real_part and idem for imag
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_real_part);
-                    gsl_blas_dtrsv(CblasUpper, CblasNoTrans, CblasNonUnit, coefficient_matrix, dL_imag_part);
-
-                    return std::make_pair(dL_real_part, dL_imag_part);
-                }
-
                 virtual complex<double> get_orthonormal_perp_coefficients(const unsigned & i) const
                 {
-                    auto coefficients = orthonormal_perp_coefficients();
-
-                    return complex<double>(gsl_vector_get(coefficients.first,  i),
-                                           gsl_vector_get(coefficients.second, i));
+                    return orthonormal_coefficients().perp_coefficients[i];
                 }
 
                 virtual complex<double> get_orthonormal_para_coefficients(const unsigned & i) const
                 {
-                    auto coefficients = orthonormal_para_coefficients();
-
-                    return complex<double>(gsl_vector_get(coefficients.first,  i),
-                                           gsl_vector_get(coefficients.second, i));
+                    return orthonormal_coefficients().para_coefficients[i];
                 }
 
                 virtual complex<double> get_orthonormal_long_coefficients(const unsigned & i) const
                 {
-                    auto coefficients = orthonormal_long_coefficients();
-
-                    return complex<double>(gsl_vector_get(coefficients.first,  i),
-                                           gsl_vector_get(coefficients.second, i));
+                    return orthonormal_coefficients().long_coefficients[i];
                 }
 
                 virtual double weak_bound() const
                 {
-                    auto perp_coefficients = orthonormal_perp_coefficients();
-                    auto para_coefficients = orthonormal_para_coefficients();
-                    auto long_coefficients = orthonormal_long_coefficients();
+                    const OrthonormalCoefficients c = orthonormal_coefficients();
 
-                    double largest_absolute_coeff = 0.0, coeff;
+                    double largest_absolute_coeff = 0.0;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coeff = power_of<2>(gsl_vector_get(perp_coefficients.first,  i))
-                              + power_of<2>(gsl_vector_get(perp_coefficients.second, i));
-                        if (coeff > largest_absolute_coeff)
-                        {
-                            largest_absolute_coeff = coeff;
-                        }
-                        coeff = power_of<2>(gsl_vector_get(para_coefficients.first,  i))
-                              + power_of<2>(gsl_vector_get(para_coefficients.second, i));
-                        if (coeff > largest_absolute_coeff)
-                        {
-                            largest_absolute_coeff = coeff;
-                        }
-                        coeff = power_of<2>(gsl_vector_get(long_coefficients.first,  i))
-                              + power_of<2>(gsl_vector_get(long_coefficients.second, i));
-                        if (coeff > largest_absolute_coeff)
-                        {
-                            largest_absolute_coeff = coeff;
-                        }
+                        largest_absolute_coeff = std::max({ largest_absolute_coeff, norm(c.perp_coefficients[i]), norm(c.para_coefficients[i]), norm(c.long_coefficients[i]) });
                     }
 
                     return largest_absolute_coeff;
@@ -1566,20 +1288,13 @@ namespace eos
 
                 virtual double strong_bound() const
                 {
-                    auto perp_coefficients = orthonormal_perp_coefficients();
-                    auto para_coefficients = orthonormal_para_coefficients();
-                    auto long_coefficients = orthonormal_long_coefficients();
+                    const OrthonormalCoefficients c = orthonormal_coefficients();
 
                     double coefficient_sum = 0.0;
 
                     for (unsigned i = 0; i <= interpolation_order; ++i)
                     {
-                        coefficient_sum += power_of<2>(gsl_vector_get(perp_coefficients.first,  i))
-                                          + power_of<2>(gsl_vector_get(perp_coefficients.second, i));
-                        coefficient_sum += power_of<2>(gsl_vector_get(para_coefficients.first,  i))
-                                          + power_of<2>(gsl_vector_get(para_coefficients.second, i));
-                        coefficient_sum += power_of<2>(gsl_vector_get(long_coefficients.first,  i))
-                                          + power_of<2>(gsl_vector_get(long_coefficients.second, i));
+                        coefficient_sum += norm(c.perp_coefficients[i]) + norm(c.para_coefficients[i]) + norm(c.long_coefficients[i]);
                     }
 
                     return coefficient_sum;
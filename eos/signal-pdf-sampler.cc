@@ -0,0 +1,542 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/signal-pdf-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <ostream>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+namespace eos
+{
+    SignalPDFSampler::Config::Config() :
+        _scan_points(4096),
+        _safety_factor(1.2),
+        _min_efficiency(0.01),
+        _burn_in(1000),
+        _stride(10),
+        _seed(1234567u)
+    {
+    }
+
+    unsigned
+    SignalPDFSampler::Config::scan_points() const
+    {
+        return _scan_points;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::scan_points(const unsigned & x)
+    {
+        _scan_points = x;
+        return *this;
+    }
+
+    double
+    SignalPDFSampler::Config::safety_factor() const
+    {
+        return _safety_factor;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::safety_factor(const double & x)
+    {
+        _safety_factor = x;
+        return *this;
+    }
+
+    double
+    SignalPDFSampler::Config::min_efficiency() const
+    {
+        return _min_efficiency;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::min_efficiency(const double & x)
+    {
+        _min_efficiency = x;
+        return *this;
+    }
+
+    unsigned
+    SignalPDFSampler::Config::burn_in() const
+    {
+        return _burn_in;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::burn_in(const unsigned & x)
+    {
+        _burn_in = x;
+        return *this;
+    }
+
+    unsigned
+    SignalPDFSampler::Config::stride() const
+    {
+        return _stride;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::stride(const unsigned & x)
+    {
+        _stride = x;
+        return *this;
+    }
+
+    unsigned long
+    SignalPDFSampler::Config::seed() const
+    {
+        return _seed;
+    }
+
+    SignalPDFSampler::Config &
+    SignalPDFSampler::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+        return *this;
+    }
+
+    template <>
+    struct Implementation<SignalPDFSampler>
+    {
+        // the number of events, or scan points, per block; each block uses its own random number stream
+        static constexpr unsigned block_size = 1024;
+
+        // the number of candidates per call to SignalPDF::evaluate_batch
+        static constexpr unsigned batch_size = 256;
+
+        SignalPDFSampler::Config config;
+
+        unsigned dim;
+
+        // the box of kinematic ranges
+        std::vector<double> lower, width;
+
+        // one independent clone of the PDF per thread
+        std::vector<SignalPDFPtr> clones;
+
+        // the uniform scan of the box and the cumulative distribution of its PDF values, used to start the chains
+        std::vector<double> scan, scan_cdf;
+
+        double log_envelope;
+
+        bool markov_chain;
+
+        // the index of the next unused random number stream
+        unsigned long next_stream;
+
+        double efficiency;
+
+        struct Block
+        {
+            std::vector<double> events;
+            std::vector<double> log_values;
+            double max_log_value = -std::numeric_limits<double>::max();
+            unsigned long proposed = 0, accepted = 0;
+        };
+
+        Implementation(const SignalPDFPtr & pdf, const SignalPDFSampler::Config & config) :
+            config(config),
+            dim(0),
+            markov_chain(false),
+            next_stream(0),
+            efficiency(0.0)
+        {
+            if (config.scan_points() == 0)
+                throw InternalError("SignalPDFSampler: at least one scan point is required");
+
+            if (! (config.safety_factor() >= 1.0))
+                throw InternalError("SignalPDFSampler: the safety factor must not be smaller than 1");
+
+            if (config.stride() == 0)
+                throw InternalError("SignalPDFSampler: the stride must be positive");
+
+            for (const auto & d : *pdf)
+            {
+                lower.push_back(d.min);
+                width.push_back(d.max - d.min);
+                ++dim;
+            }
+
+            if (dim == 0)
+                throw InternalError("SignalPDFSampler: the PDF '" + stringify(pdf->name()) + "' has no kinematic variables");
+
+            const unsigned number_of_clones = std::max(1u, ThreadPool::instance()->number_of_threads());
+            for (auto c = 0u ; c < number_of_clones ; ++c)
+            {
+                clones.push_back(std::static_pointer_cast<SignalPDF>(pdf->clone()));
+            }
+
+            // scan the box uniformly
+            const unsigned n = config.scan_points();
+            const unsigned number_of_blocks = (n + block_size - 1) / block_size;
+            std::vector<double> scan_log_values(n);
+            scan.resize(n * dim);
+            run_blocks(number_of_blocks, [&] (const SignalPDF & clone, gsl_rng * rng, const unsigned & b)
+            {
+                const unsigned begin = b * block_size, end = std::min(n, begin + block_size);
+                for (auto i = begin * dim ; i < end * dim ; ++i)
+                {
+                    scan[i] = lower[i % dim] + width[i % dim] * gsl_rng_uniform(rng);
+                }
+
+                clone.evaluate_batch(scan.data() + begin * dim, end - begin, scan_log_values.data() + begin);
+            });
+
+            // treat scan points with undefined or infinite log(PDF) values as if the PDF vanished there
+            for (auto & log_value : scan_log_values)
+            {
+                if (! std::isfinite(log_value))
+                    log_value = -std::numeric_limits<double>::infinity();
+            }
+
+            const double max_log_value = *std::max_element(scan_log_values.cbegin(), scan_log_values.cend());
+            if (max_log_value <= -std::numeric_limits<double>::max())
+                throw InternalError("SignalPDFSampler: the PDF '" + stringify(pdf->name()) + "' vanishes at all scan points");
+
+            log_envelope = max_log_value + std::log(config.safety_factor());
+
+            // the accept-reject efficiency is the ratio of the PDF's mean value and the envelope
+            double sum = 0.0;
+            scan_cdf.resize(n);
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                sum += std::exp(scan_log_values[i] - max_log_value);
+                scan_cdf[i] = sum;
+            }
+
+            const double estimated_efficiency = sum / n / config.safety_factor();
+            markov_chain = estimated_efficiency < config.min_efficiency();
+
+            if (markov_chain)
+            {
+                Log::instance()->message("SignalPDFSampler.ctor", ll_informational)
+                    << "Estimated accept-reject efficiency " << estimated_efficiency << " is too small; using Metropolis chains";
+            }
+        }
+
+        // run f for each block concurrently, distributing the blocks over the clones in a fixed order;
+        // an exception thrown by f is rethrown once all threads have finished
+        void run_blocks(const unsigned & number_of_blocks, const std::function<void (const SignalPDF &, gsl_rng *, const unsigned &)> & f)
+        {
+            const unsigned long first_stream = next_stream;
+            next_stream += number_of_blocks;
+
+            std::vector<std::exception_ptr> errors(clones.size());
+            std::vector<Ticket> tickets;
+            tickets.reserve(clones.size());
+            for (auto c = 0u ; (c < clones.size()) && (c < number_of_blocks) ; ++c)
+            {
+                auto work = [&, c]()
+                {
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    try
+                    {
+                        for (auto b = c ; b < number_of_blocks ; b += clones.size())
+                        {
+                            gsl_rng_set(rng, config.seed() + first_stream + b);
+                            f(*clones[c], rng, b);
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[c] = std::current_exception();
+                    }
+                    gsl_rng_free(rng);
+                };
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(work)));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            for (const auto & error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        void accept_reject(const unsigned & m, const SignalPDF & clone, gsl_rng * rng, Block & block) const
+        {
+            std::vector<double> candidates(batch_size * dim), log_values(batch_size);
+
+            block.events.reserve(m * dim);
+            block.log_values.reserve(m);
+            while (block.accepted < m)
+            {
+                for (auto i = 0u ; i < batch_size * dim ; ++i)
+                {
+                    candidates[i] = lower[i % dim] + width[i % dim] * gsl_rng_uniform(rng);
+                }
+
+                clone.evaluate_batch(candidates.data(), batch_size, log_values.data());
+
+                for (auto i = 0u ; i < batch_size ; ++i)
+                {
+                    // reject candidates with undefined or infinite log(PDF) values, which would otherwise
+                    // pass the comparison below or break the envelope
+                    const bool finite = std::isfinite(log_values[i]);
+
+                    // a violation of the envelope is corrected for once the block is complete
+                    if (finite)
+                        block.max_log_value = std::max(block.max_log_value, log_values[i]);
+
+                    if (block.accepted == m)
+                        continue;
+
+                    ++block.proposed;
+                    if ((! finite) || (std::log(gsl_rng_uniform_pos(rng)) >= log_values[i] - log_envelope))
+                        continue;
+
+                    ++block.accepted;
+                    block.events.insert(block.events.end(), candidates.begin() + i * dim, candidates.begin() + (i + 1) * dim);
+                    block.log_values.push_back(log_values[i]);
+                }
+            }
+        }
+
+        void metropolis(const unsigned & m, const SignalPDF & clone, gsl_rng * rng, Block & block) const
+        {
+            // start from one of the scan points, chosen according to the PDF
+            const double r = scan_cdf.back() * gsl_rng_uniform(rng);
+            const unsigned start = std::min<unsigned>(std::upper_bound(scan_cdf.cbegin(), scan_cdf.cend(), r) - scan_cdf.cbegin(), scan_cdf.size() - 1);
+
+            std::vector<double> x(scan.cbegin() + start * dim, scan.cbegin() + (start + 1) * dim), y(dim);
+            double log_x, log_y;
+            clone.evaluate_batch(x.data(), 1, &log_x);
+
+            double scale = 0.1;
+            unsigned window_accepted = 0;
+
+            const auto step = [&] () -> bool
+            {
+                bool inside = true;
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    y[i] = x[i] + scale * width[i] * gsl_ran_ugaussian(rng);
+                    inside = inside && (lower[i] <= y[i]) && (y[i] <= lower[i] + width[i]);
+                }
+
+                // the PDF vanishes outside of the box
+                if (! inside)
+                    return false;
+
+                clone.evaluate_batch(y.data(), 1, &log_y);
+                if ((! std::isfinite(log_y)) || (std::log(gsl_rng_uniform_pos(rng)) >= log_y - log_x))
+                    return false;
+
+                x.swap(y);
+                log_x = log_y;
+
+                return true;
+            };
+
+            // adapt the step size during the burn-in, aiming at an acceptance rate between 15% and 40%
+            for (auto i = 1u ; i <= config.burn_in() ; ++i)
+            {
+                window_accepted += step();
+
+                if (i % 100 != 0)
+                    continue;
+
+                if (window_accepted > 40)
+                    scale = std::min(1.0, scale * 1.5);
+                else if (window_accepted < 15)
+                    scale /= 1.5;
+
+                window_accepted = 0;
+            }
+
+            block.events.reserve(m * dim);
+            block.log_values.reserve(m);
+            for (auto e = 0u ; e < m ; ++e)
+            {
+                for (auto s = 0u ; s < config.stride() ; ++s)
+                {
+                    ++block.proposed;
+                    block.accepted += step();
+                }
+
+                block.events.insert(block.events.end(), x.cbegin(), x.cend());
+                block.log_values.push_back(log_x);
+            }
+        }
+
+        void sample(const unsigned & n, double * events)
+        {
+            std::vector<double> result;
+            std::vector<double> result_log_values;
+            result.reserve(n * dim);
+            result_log_values.reserve(n);
+
+            unsigned long proposed = 0, accepted = 0;
+            while (result_log_values.size() < n)
+            {
+                const unsigned needed = n - result_log_values.size();
+                const unsigned number_of_blocks = (needed + block_size - 1) / block_size;
+
+                std::vector<Block> blocks(number_of_blocks);
+                run_blocks(number_of_blocks, [&] (const SignalPDF & clone, gsl_rng * rng, const unsigned & b)
+                {
+                    const unsigned m = std::min(block_size, needed - b * block_size);
+
+                    if (markov_chain)
+                        this->metropolis(m, clone, rng, blocks[b]);
+                    else
+                        this->accept_reject(m, clone, rng, blocks[b]);
+                });
+
+                double max_log_value = -std::numeric_limits<double>::max();
+                for (const auto & block : blocks)
+                {
+                    result.insert(result.end(), block.events.cbegin(), block.events.cend());
+                    result_log_values.insert(result_log_values.end(), block.log_values.cbegin(), block.log_values.cend());
+                    max_log_value = std::max(max_log_value, block.max_log_value);
+                    proposed += block.proposed;
+                    accepted += block.accepted;
+                }
+
+                if (markov_chain || (max_log_value <= log_envelope))
+                    continue;
+
+                // raise the envelope and thin the events accepted so far; an event x has been accepted with
+                // probability min(1, f(x) / M), and is kept with probability max(M, f(x)) / M', such that
+                // the overall probability is f(x) / M' for the new envelope M'.
+                const double new_log_envelope = max_log_value + std::log(config.safety_factor());
+
+                Log::instance()->message("SignalPDFSampler::sample", ll_warning)
+                    << "PDF value exceeds the envelope by a factor of " << std::exp(max_log_value - log_envelope) << "; raising the envelope";
+
+                gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                gsl_rng_set(rng, config.seed() + next_stream++);
+
+                unsigned kept = 0;
+                for (auto i = 0u ; i < result_log_values.size() ; ++i)
+                {
+                    if (std::log(gsl_rng_uniform_pos(rng)) >= std::max(log_envelope, result_log_values[i]) - new_log_envelope)
+                        continue;
+
+                    std::copy(result.cbegin() + i * dim, result.cbegin() + (i + 1) * dim, result.begin() + kept * dim);
+                    result_log_values[kept] = result_log_values[i];
+                    ++kept;
+                }
+                gsl_rng_free(rng);
+
+                result.resize(kept * dim);
+                result_log_values.resize(kept);
+                log_envelope = new_log_envelope;
+            }
+
+            std::copy(result.cbegin(), result.cbegin() + n * dim, events);
+            efficiency = (proposed > 0) ? double(accepted) / double(proposed) : 0.0;
+        }
+    };
+
+    SignalPDFSampler::SignalPDFSampler(const SignalPDFPtr & pdf, const Config & config) :
+        PrivateImplementationPattern<SignalPDFSampler>(new Implementation<SignalPDFSampler>(pdf, config))
+    {
+    }
+
+    SignalPDFSampler::~SignalPDFSampler()
+    {
+    }
+
+    void
+    SignalPDFSampler::sample(const unsigned & n, double * events)
+    {
+        _imp->sample(n, events);
+    }
+
+    std::vector<std::vector<double>>
+    SignalPDFSampler::sample(const unsigned & n)
+    {
+        std::vector<double> events(n * _imp->dim);
+        _imp->sample(n, events.data());
+
+        std::vector<std::vector<double>> result;
+        result.reserve(n);
+        for (auto e = events.cbegin() ; e != events.cend() ; e += _imp->dim)
+        {
+            result.emplace_back(e, e + _imp->dim);
+        }
+
+        return result;
+    }
+
+    void
+    SignalPDFSampler::sample(const unsigned & n, std::ostream & output)
+    {
+        // events that have already been written cannot be thinned if the envelope is raised while generating
+        // a later chunk; the accompanying warning indicates that the number of scan points should be increased
+        static constexpr unsigned chunk_size = 64 * Implementation<SignalPDFSampler>::block_size;
+
+        const auto precision = output.precision(std::numeric_limits<double>::max_digits10);
+
+        std::vector<double> events;
+        for (unsigned written = 0 ; written < n ; written += chunk_size)
+        {
+            const unsigned m = std::min(chunk_size, n - written);
+            events.resize(m * _imp->dim);
+            _imp->sample(m, events.data());
+
+            for (auto e = 0u ; e < m ; ++e)
+            {
+                for (auto i = 0u ; i < _imp->dim ; ++i)
+                {
+                    output << (i == 0 ? "" : " ") << events[e * _imp->dim + i];
+                }
+                output << '\n';
+            }
+        }
+
+        output.precision(precision);
+    }
+
+    unsigned
+    SignalPDFSampler::dimension() const
+    {
+        return _imp->dim;
+    }
+
+    bool
+    SignalPDFSampler::markov_chain() const
+    {
+        return _imp->markov_chain;
+    }
+
+    double
+    SignalPDFSampler::efficiency() const
+    {
+        return _imp->efficiency;
+    }
+}
@@ -0,0 +1,149 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_SIGNAL_PDF_SAMPLER_HH
+#define EOS_GUARD_EOS_SIGNAL_PDF_SAMPLER_HH 1
+
+#include <eos/signal-pdf.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <iosfwd>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * SignalPDFSampler generates events, i.e., points in the kinematic phase space,
+     * that are distributed according to a SignalPDF.
+     *
+     * The events are produced by accept-reject sampling with a constant envelope over the
+     * box of the PDF's kinematic ranges. The envelope is determined from a uniform scan of
+     * the box. Whenever an evaluation exceeds the envelope, the envelope is raised and the
+     * events accepted so far are thinned, such that the result remains exact. If the scan
+     * indicates an acceptance efficiency below a configurable threshold, the sampler falls
+     * back to random-walk Metropolis chains.
+     *
+     * The events are generated in blocks of fixed size. Each block uses an independent
+     * random number stream, and the blocks are distributed over the threads of the
+     * ThreadPool, each of which evaluates its own clone of the PDF. The events therefore
+     * only depend on the seed, and not on the number of threads.
+     */
+    class SignalPDFSampler :
+        public PrivateImplementationPattern<SignalPDFSampler>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// The number of uniformly distributed points used to determine the envelope.
+                    unsigned scan_points() const;
+                    Config & scan_points(const unsigned & x);
+
+                    /// The factor by which the envelope exceeds the largest value of the PDF encountered so far.
+                    double safety_factor() const;
+                    Config & safety_factor(const double & x);
+
+                    /// The estimated acceptance efficiency below which Metropolis chains are used.
+                    double min_efficiency() const;
+                    Config & min_efficiency(const double & x);
+
+                    /// The number of Metropolis steps discarded at the start of each chain.
+                    unsigned burn_in() const;
+                    Config & burn_in(const unsigned & x);
+
+                    /// The number of Metropolis steps per event.
+                    unsigned stride() const;
+                    Config & stride(const unsigned & x);
+
+                    /// The seed of the random number generators.
+                    unsigned long seed() const;
+                    Config & seed(const unsigned long & x);
+
+                private:
+                    unsigned _scan_points;
+                    double _safety_factor;
+                    double _min_efficiency;
+                    unsigned _burn_in;
+                    unsigned _stride;
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * Scans the PDF to determine the envelope and the sampling method.
+             *
+             * @param pdf    The PDF from which events shall be drawn. It is not modified.
+             * @param config The configuration of the sampler.
+             */
+            SignalPDFSampler(const SignalPDFPtr & pdf, const Config & config = Config());
+
+            /// Destructor.
+            ~SignalPDFSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Draw events into a preallocated array.
+             *
+             * @param n      The number of events.
+             * @param events The array of n * dimension() values, which is filled in row-major order.
+             */
+            void sample(const unsigned & n, double * events);
+
+            /*!
+             * Draw events.
+             *
+             * @param n The number of events.
+             *
+             * @return The kinematic variables, in the order of the PDF's parameter descriptions, for each event.
+             */
+            std::vector<std::vector<double>> sample(const unsigned & n);
+
+            /*!
+             * Draw events and write them to a stream, one event per line.
+             *
+             * The events are generated and written in chunks, to limit the memory footprint.
+             *
+             * @param n      The number of events.
+             * @param output The stream to which the events are written.
+             */
+            void sample(const unsigned & n, std::ostream & output);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of kinematic variables per event.
+            unsigned dimension() const;
+
+            /// Return true if events are drawn from Metropolis chains rather than by accept-reject sampling.
+            bool markov_chain() const;
+
+            /// Retrieve the fraction of accepted candidates or Metropolis proposals in the last call to sample().
+            double efficiency() const;
+            ///@}
+    };
+}
+
+#endif
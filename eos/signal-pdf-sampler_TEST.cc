@@ -0,0 +1,245 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/signal-pdf.hh>
+#include <eos/signal-pdf-sampler.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace test;
+using namespace eos;
+
+// a PDF whose batch evaluations are modified after the fact, e.g., to fail or to yield undefined values
+class ModifiedSignalPDF :
+    public SignalPDF
+{
+    public:
+        using Modification = std::function<void (const double *, const unsigned &, double *)>;
+
+    private:
+        SignalPDFPtr _pdf;
+
+        Modification _modification;
+
+    public:
+        ModifiedSignalPDF(const SignalPDFPtr & pdf, const Modification & modification) :
+            _pdf(pdf),
+            _modification(modification)
+        {
+        }
+
+        virtual const QualifiedName & name() const { return _pdf->name(); }
+
+        virtual double evaluate() const { return _pdf->evaluate(); }
+
+        virtual void evaluate_batch(const double * points, const unsigned & n, double * results) const
+        {
+            _pdf->evaluate_batch(points, n, results);
+            _modification(points, n, results);
+        }
+
+        virtual double normalization() const { return _pdf->normalization(); }
+
+        virtual const ParameterUser & parameter_user() const { return _pdf->parameter_user(); }
+
+        virtual Kinematics kinematics() { return _pdf->kinematics(); }
+
+        virtual Parameters parameters() { return _pdf->parameters(); }
+
+        virtual Options options() { return _pdf->options(); }
+
+        virtual DensityPtr clone() const
+        {
+            return DensityPtr(new ModifiedSignalPDF(std::static_pointer_cast<SignalPDF>(_pdf->clone()), _modification));
+        }
+
+        virtual DensityPtr clone(const Parameters & parameters) const
+        {
+            return DensityPtr(new ModifiedSignalPDF(std::static_pointer_cast<SignalPDF>(_pdf->clone(parameters)), _modification));
+        }
+
+        virtual Density::Iterator begin() const { return _pdf->begin(); }
+
+        virtual Density::Iterator end() const { return _pdf->end(); }
+};
+
+class SignalPDFSamplerTest :
+    public TestCase
+{
+    public:
+        SignalPDFSamplerTest() :
+            TestCase("signal_pdf_sampler_test")
+        {
+        }
+
+        // the first two moments of the PDF (9 + 8 z + 9 z^2) / 24 on [-1, +1] are 2/9 and 2/5
+        static void check_moments(const std::vector<std::vector<double>> & events, const double & eps)
+        {
+            double mean = 0.0, second_moment = 0.0;
+            for (const auto & e : events)
+            {
+                TEST_CHECK_EQUAL(1u, e.size());
+                TEST_CHECK(-1.0 <= e[0] && e[0] <= +1.0);
+
+                mean          += e[0];
+                second_moment += e[0] * e[0];
+            }
+            mean          /= events.size();
+            second_moment /= events.size();
+
+            TEST_CHECK_NEARLY_EQUAL(2.0 / 9.0, mean,          eps);
+            TEST_CHECK_NEARLY_EQUAL(2.0 / 5.0, second_moment, eps);
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Kinematics k{ { "z_min", -1.0 }, { "z_max", +1.0 } };
+            auto pdf = SignalPDF::make("Test::Legendre1D", p, k, Options{ });
+            TEST_CHECK(pdf);
+
+            // batch evaluation agrees with evaluation at the kinematic variables
+            {
+                const std::vector<double> points{ -0.9, -0.2, 0.0, 0.5, 1.0 };
+                std::vector<double> results(points.size());
+                pdf->evaluate_batch(points.data(), points.size(), results.data());
+
+                for (auto i = 0u ; i < points.size() ; ++i)
+                {
+                    k["z"] = points[i];
+                    TEST_CHECK_NEARLY_EQUAL(pdf->evaluate(), results[i], 1.0e-14);
+                }
+            }
+
+            // accept-reject sampling
+            {
+                SignalPDFSampler sampler(pdf);
+                TEST_CHECK_EQUAL(1u, sampler.dimension());
+                TEST_CHECK(! sampler.markov_chain());
+
+                const auto events = sampler.sample(20000);
+                TEST_CHECK_EQUAL(20000u, events.size());
+                check_moments(events, 0.015);
+
+                // the efficiency is the ratio of the mean value 12 and the envelope 1.2 * 26
+                TEST_CHECK_NEARLY_EQUAL(12.0 / (1.2 * 26.0), sampler.efficiency(), 0.02);
+            }
+
+            // the events only depend on the seed
+            {
+                SignalPDFSampler sampler1(pdf), sampler2(pdf), sampler3(pdf, SignalPDFSampler::Config().seed(7654321u));
+
+                std::vector<double> events1(2500), events2(2500), events3(2500);
+                sampler1.sample(2500, events1.data());
+                sampler2.sample(2500, events2.data());
+                sampler3.sample(2500, events3.data());
+
+                TEST_CHECK(events1 == events2);
+                TEST_CHECK(events1 != events3);
+            }
+
+            // an envelope that is too small is raised, and the events are thinned
+            {
+                SignalPDFSampler sampler(pdf, SignalPDFSampler::Config().scan_points(1).safety_factor(1.0));
+                TEST_CHECK(! sampler.markov_chain());
+
+                check_moments(sampler.sample(20000), 0.015);
+            }
+
+            // Metropolis chains
+            {
+                SignalPDFSampler sampler(pdf, SignalPDFSampler::Config().min_efficiency(1.0));
+                TEST_CHECK(sampler.markov_chain());
+
+                check_moments(sampler.sample(20000), 0.03);
+                TEST_CHECK(sampler.efficiency() > 0.1);
+            }
+
+            // streamed events
+            {
+                SignalPDFSampler sampler(pdf);
+
+                std::stringstream output;
+                sampler.sample(10, output);
+
+                unsigned lines = 0;
+                for (std::string line ; std::getline(output, line) ; ++lines)
+                {
+                    const double z = std::stod(line);
+                    TEST_CHECK(-1.0 <= z && z <= +1.0);
+                }
+                TEST_CHECK_EQUAL(10u, lines);
+            }
+
+            // invalid configurations
+            {
+                TEST_CHECK_THROWS(InternalError, SignalPDFSampler(pdf, SignalPDFSampler::Config().scan_points(0)));
+                TEST_CHECK_THROWS(InternalError, SignalPDFSampler(pdf, SignalPDFSampler::Config().safety_factor(0.5)));
+                TEST_CHECK_THROWS(InternalError, SignalPDFSampler(pdf, SignalPDFSampler::Config().stride(0)));
+            }
+
+            // failed evaluations within the threads are rethrown
+            {
+                auto failing_pdf = std::make_shared<ModifiedSignalPDF>(pdf, [] (const double *, const unsigned &, double *)
+                {
+                    throw InternalError("ModifiedSignalPDF: evaluation failed");
+                });
+
+                TEST_CHECK_THROWS(InternalError, SignalPDFSampler{ failing_pdf });
+            }
+
+            // candidates with undefined or infinite log(PDF) values are rejected
+            {
+                auto undefined_pdf = std::make_shared<ModifiedSignalPDF>(pdf, [] (const double * points, const unsigned & n, double * results)
+                {
+                    for (auto i = 0u ; i < n ; ++i)
+                    {
+                        if (points[i] > 0.5)
+                            results[i] = std::numeric_limits<double>::quiet_NaN();
+                        else if (points[i] < -0.75)
+                            results[i] = std::numeric_limits<double>::infinity();
+                    }
+                });
+
+                SignalPDFSampler accept_reject(undefined_pdf);
+                TEST_CHECK(! accept_reject.markov_chain());
+
+                SignalPDFSampler metropolis(undefined_pdf, SignalPDFSampler::Config().min_efficiency(1.0));
+                TEST_CHECK(metropolis.markov_chain());
+
+                for (auto * sampler : { &accept_reject, &metropolis })
+                {
+                    const auto events = sampler->sample(5000);
+                    TEST_CHECK_EQUAL(5000u, events.size());
+
+                    for (const auto & e : events)
+                    {
+                        TEST_CHECK(-0.75 <= e[0] && e[0] <= 0.5);
+                    }
+                }
+            }
+        }
+} signal_pdf_sampler_test;
@@ -45,7 +45,8 @@ namespace eos
     namespace test
     {
         // PDF = (1/2 L_0 + 1/3 L_1 + 1/4 L_2) / 2
-        class Legendre1DPDF
+        class Legendre1DPDF :
+            public ParameterUser
         {
             public:
                 Legendre1DPDF(const Parameters &, const Options &)
@@ -228,7 +229,9 @@ namespace eos
                     std::make_tuple(
                         KinematicRange{ "q2", 0.0, 26.41, BToPseudoscalarLeptonNeutrino::kinematics_description_q2 }
                     ),
-                    &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
+                    std::function<double (const BToPseudoscalarLeptonNeutrino *, const double &, const double &)>([] (const BToPseudoscalarLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->integrated_branching_ratio(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -242,7 +245,9 @@ namespace eos
                         KinematicRange{ "q2", 0.0, 26.41, BToPseudoscalarLeptonNeutrino::kinematics_description_q2 },
                         KinematicRange{ "cos(theta_l)", -1.0, +1.0, BToPseudoscalarLeptonNeutrino::kinematics_description_c_theta_l}
                     ),
-                    &BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width,
+                    std::function<double (const BToPseudoscalarLeptonNeutrino *, const double &, const double &)>([] (const BToPseudoscalarLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->normalized_integrated_decay_width(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -268,7 +273,9 @@ namespace eos
                     std::make_tuple(
                         KinematicRange{ "q2", 0.0, 11.62, BToPseudoscalarLeptonNeutrino::kinematics_description_q2 }
                     ),
-                    &BToPseudoscalarLeptonNeutrino::integrated_branching_ratio,
+                    std::function<double (const BToPseudoscalarLeptonNeutrino *, const double &, const double &)>([] (const BToPseudoscalarLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->integrated_branching_ratio(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -282,7 +289,9 @@ namespace eos
                         KinematicRange{ "q2", 0.0, 11.62, BToPseudoscalarLeptonNeutrino::kinematics_description_q2 },
                         KinematicRange{ "cos(theta_l)", -1.0, +1.0, BToPseudoscalarLeptonNeutrino::kinematics_description_c_theta_l}
                     ),
-                    &BToPseudoscalarLeptonNeutrino::normalized_integrated_decay_width,
+                    std::function<double (const BToPseudoscalarLeptonNeutrino *, const double &, const double &)>([] (const BToPseudoscalarLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->normalized_integrated_decay_width(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -389,7 +398,9 @@ namespace eos
                         KinematicRange{ "cos(theta_k)", -1.0, +1.0, BsToKstarLeptonNeutrino::kinematics_description_c_theta_k },
                         KinematicRange{ "phi", 0.0, 2.0 * M_PI, BsToKstarLeptonNeutrino::kinematics_description_phi }
                     ),
-                    &BsToKstarLeptonNeutrino::integrated_decay_width,
+                    std::function<double (const BsToKstarLeptonNeutrino *, const double &, const double &)>([] (const BsToKstarLeptonNeutrino * decay, const double & s_min, const double & s_max) -> double {
+                        return decay->integrated_decay_width(decay->prepare(s_min, s_max));
+                    }),
                     std::make_tuple(
                         "s_min",
                         "s_max"
@@ -402,7 +413,9 @@ namespace eos
                     std::make_tuple(
                         KinematicRange{ "q2", 0.011, 11.1, LambdaBToLambdaCLeptonNeutrino::kinematics_description_q2 }
                     ),
-                    &LambdaBToLambdaCLeptonNeutrino::integrated_branching_ratio,
+                    std::function<double (const LambdaBToLambdaCLeptonNeutrino *, const double &, const double &)>([] (const LambdaBToLambdaCLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->integrated_branching_ratio(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -418,7 +431,9 @@ namespace eos
                         KinematicRange{ "cos(theta_L)", -1.0, +1.0, LambdaBToLambdaCLeptonNeutrino::kinematics_description_c_theta_L },
                         KinematicRange{ "phi", 0.0, 2.0 * M_PI, LambdaBToLambdaCLeptonNeutrino::kinematics_description_phi }
                     ),
-                    &LambdaBToLambdaCLeptonNeutrino::integrated_decay_width,
+                    std::function<double (const LambdaBToLambdaCLeptonNeutrino *, const double &, const double &)>([] (const LambdaBToLambdaCLeptonNeutrino * decay, const double & q2_min, const double & q2_max) -> double {
+                        return decay->integrated_decay_width(decay->prepare(q2_min, q2_max));
+                    }),
                     std::make_tuple(
                         "q2_min",
                         "q2_max"
@@ -460,7 +475,9 @@ namespace eos
                         KinematicRange{ "s",                  1.00,  6.00, BToKDilepton::kinematics_description_s },
                         KinematicRange{ "cos(theta_l)^LHCb", -1.0,  +1.0,  BToKDilepton::kinematics_description_c_theta_l }
                     ),
-                    &BToKDilepton::integrated_decay_width,
+                    std::function<double (const BToKDilepton *, const double &, const double &)>([] (const BToKDilepton * decay, const double & s_min, const double & s_max) -> double {
+                        return decay->integrated_decay_width(decay->prepare(s_min, s_max));
+                    }),
                     std::make_tuple(
                         "s_min",
                         "s_max"
@@ -474,7 +491,9 @@ namespace eos
                         KinematicRange{ "s",                 15.00, 22.87, BToKDilepton::kinematics_description_s },
                         KinematicRange{ "cos(theta_l)^LHCb", -1.0,  +1.0,  BToKDilepton::kinematics_description_c_theta_l }
                     ),
-                    &BToKDilepton::integrated_decay_width,
+                    std::function<double (const BToKDilepton *, const double &, const double &)>([] (const BToKDilepton * decay, const double & s_min, const double & s_max) -> double {
+                        return decay->integrated_decay_width(decay->prepare(s_min, s_max));
+                    }),
                     std::make_tuple(
                         "s_min",
                         "s_max"
@@ -60,8 +60,23 @@ namespace eos
 
             virtual double evaluate() const = 0;
 
+            /*!
+             * Evaluate the logarithm of the (unnormalized) PDF at several kinematic points at once.
+             *
+             * The kinematic variables bound to the PDF are not changed.
+             *
+             * @param points  The kinematic points in row-major order, with one column per kinematic
+             *                variable in the order of the PDF's parameter descriptions.
+             * @param n       The number of points.
+             * @param results The n values of the log(PDF).
+             */
+            virtual void evaluate_batch(const double * points, const unsigned & n, double * results) const = 0;
+
             virtual double normalization() const = 0;
 
+            /// Retrieve the ids of the parameters on which the PDF depends.
+            virtual const ParameterUser & parameter_user() const = 0;
+
             virtual Kinematics kinematics() = 0;
 
             virtual Parameters parameters() = 0;
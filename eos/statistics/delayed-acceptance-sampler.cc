@@ -0,0 +1,483 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/delayed-acceptance-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <config.h>
+
+#ifdef EOS_USE_GSL_LINALG_CHOLESKY_DECOMP
+#  if (EOS_USE_GSL_LINALG_CHOLESKY_DECOMP == 1)
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp
+#  else
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp1
+#  endif
+#else
+#  error EOS_USE_GSL_LINALG_CHOLESKY_DECOMP not defined.
+#endif
+
+namespace eos
+{
+    DelayedAcceptanceSampler::Config::Config() :
+        _emulator(true),
+        _seed(1234567u)
+    {
+    }
+
+    bool
+    DelayedAcceptanceSampler::Config::emulator() const
+    {
+        return _emulator;
+    }
+
+    DelayedAcceptanceSampler::Config &
+    DelayedAcceptanceSampler::Config::emulator(const bool & x)
+    {
+        _emulator = x;
+        return *this;
+    }
+
+    unsigned long
+    DelayedAcceptanceSampler::Config::seed() const
+    {
+        return _seed;
+    }
+
+    DelayedAcceptanceSampler::Config &
+    DelayedAcceptanceSampler::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+        return *this;
+    }
+
+    template <>
+    struct Implementation<DelayedAcceptanceSampler>
+    {
+        LogPosterior log_posterior;
+
+        LogLikelihood log_likelihood;
+
+        DelayedAcceptanceSampler::Config config;
+
+        std::vector<Parameter> parameters;
+
+        const unsigned dim;
+
+        // user-supplied surrogate, if any
+        std::unique_ptr<LogLikelihood> surrogate;
+        std::vector<Parameter> surrogate_parameters;
+
+        // Gaussian emulator: mean and Cholesky factor of the covariance, in row-major order
+        bool emulator_trained;
+        std::vector<double> emulator_mean, emulator_cholesky;
+
+        gsl_rng * rng;
+
+        // Cholesky factor of the proposal's covariance in row-major order, and its scale
+        std::vector<double> proposal_cholesky;
+        double proposal_scale;
+
+        // the current position in the space of the sampler, i.e., the probits of the generator values
+        std::vector<double> z;
+
+        // log(target density) and log(surrogate density) at the current position
+        double current_log_target, current_log_surrogate;
+
+        unsigned proposed, first_stage_accepted, accepted;
+
+        Implementation(const LogPosterior & log_posterior, const LogPosterior * surrogate_posterior, const DelayedAcceptanceSampler::Config & config) :
+            log_posterior(log_posterior),
+            log_likelihood(log_posterior.log_likelihood()),
+            config(config),
+            parameters(log_posterior.varied_parameters()),
+            dim(parameters.size()),
+            emulator_trained(false),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            proposal_cholesky(dim * dim, 0.0),
+            proposal_scale(2.38 / std::sqrt(dim)),
+            z(dim, 0.0),
+            proposed(0),
+            first_stage_accepted(0),
+            accepted(0)
+        {
+            if (0 == dim)
+                throw InternalError("DelayedAcceptanceSampler: the posterior has no varied parameters");
+
+            gsl_rng_set(rng, config.seed());
+
+            if (surrogate_posterior)
+            {
+                surrogate.reset(new LogLikelihood(surrogate_posterior->log_likelihood()));
+
+                auto surrogate_parameter_set = surrogate->parameters();
+                for (const auto & p : parameters)
+                {
+                    surrogate_parameters.push_back(surrogate_parameter_set[p.name()]);
+                }
+            }
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                proposal_cholesky[i * dim + i] = 1.0;
+            }
+
+            // start at the current parameter point
+            for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+            {
+                (*p)->compute_cdf();
+            }
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                z[i] = gsl_cdf_ugaussian_Pinv(parameters[i].evaluate_generator());
+            }
+
+            if (! std::all_of(z.cbegin(), z.cend(), [] (const double & x) { return std::isfinite(x); }))
+                throw InternalError("DelayedAcceptanceSampler: the starting point lies on the boundary of the prior support");
+
+            current_log_target = log_likelihood() + log_prior(z);
+            current_log_surrogate = log_surrogate(z);
+            if (! std::isfinite(current_log_target) || ! std::isfinite(current_log_surrogate))
+                throw InternalError("DelayedAcceptanceSampler: the posterior or its surrogate is not finite at the starting point");
+        }
+
+        ~Implementation()
+        {
+            gsl_rng_free(rng);
+        }
+
+        // the generator values are distributed as standard normals under the prior
+        static double log_prior(const std::vector<double> & z)
+        {
+            double result = 0.0;
+            for (const auto & z_i : z)
+            {
+                result -= 0.5 * z_i * z_i;
+            }
+
+            return result;
+        }
+
+        // the surrogate log(density), assuming that the parameters are set to the point z
+        double log_surrogate(const std::vector<double> & z)
+        {
+            if (surrogate)
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    surrogate_parameters[i].set(parameters[i].evaluate());
+                }
+
+                return (*surrogate)() + log_prior(z);
+            }
+
+            if (emulator_trained)
+            {
+                // -1/2 |L^-1 (z - mean)|^2 by forward substitution
+                std::vector<double> y(dim);
+                double result = 0.0;
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    double sum = z[i] - emulator_mean[i];
+                    for (auto k = 0u ; k < i ; ++k)
+                    {
+                        sum -= emulator_cholesky[i * dim + k] * y[k];
+                    }
+                    y[i] = sum / emulator_cholesky[i * dim + i];
+                    result -= 0.5 * y[i] * y[i];
+                }
+
+                return result;
+            }
+
+            // without a surrogate, every proposal passes the first stage
+            return 0.0;
+        }
+
+        // set the posterior's parameters to the point z; returns false if z lies outside the prior support
+        bool set_parameters(const std::vector<double> & z)
+        {
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                const double u = gsl_cdf_ugaussian_P(z[i]);
+                if ((u <= 0.0) || (1.0 <= u))
+                    return false;
+
+                parameters[i].set_generator(u);
+            }
+
+            for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+            {
+                (*p)->sample();
+            }
+
+            return true;
+        }
+
+        // propose, screen, and possibly accept a new point; returns true if accepted
+        bool step()
+        {
+            ++proposed;
+
+            std::vector<double> epsilon(dim), z_proposed(z);
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                epsilon[i] = gsl_ran_ugaussian(rng);
+            }
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                for (auto k = 0u ; k <= i ; ++k)
+                {
+                    z_proposed[i] += proposal_scale * proposal_cholesky[i * dim + k] * epsilon[k];
+                }
+            }
+
+            std::vector<double> x_old(dim);
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                x_old[i] = parameters[i].evaluate();
+            }
+
+            auto reject = [&] () {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    parameters[i].set(x_old[i]);
+                }
+
+                return false;
+            };
+
+            if (! set_parameters(z_proposed))
+                return reject();
+
+            // first stage: screen with the surrogate
+            const double proposed_log_surrogate = log_surrogate(z_proposed);
+            if (! std::isfinite(proposed_log_surrogate))
+                return reject();
+
+            if (std::log(gsl_rng_uniform_pos(rng)) >= proposed_log_surrogate - current_log_surrogate)
+                return reject();
+
+            ++first_stage_accepted;
+
+            // second stage: correct for the difference between the surrogate and the target
+            const double proposed_log_target = log_likelihood() + log_prior(z_proposed);
+            if (! std::isfinite(proposed_log_target))
+                return reject();
+
+            const double log_ratio = (proposed_log_target - current_log_target) - (proposed_log_surrogate - current_log_surrogate);
+            if (std::log(gsl_rng_uniform_pos(rng)) >= log_ratio)
+                return reject();
+
+            z = z_proposed;
+            current_log_target = proposed_log_target;
+            current_log_surrogate = proposed_log_surrogate;
+            ++accepted;
+
+            return true;
+        }
+
+        void reset_statistics()
+        {
+            proposed = 0;
+            first_stage_accepted = 0;
+            accepted = 0;
+        }
+
+        // compute the Cholesky factor of a covariance matrix in row-major order; returns false on failure
+        bool cholesky(const std::vector<double> & covariance, std::vector<double> & result) const
+        {
+            gsl_matrix * chol = gsl_matrix_alloc(dim, dim);
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    gsl_matrix_set(chol, i, j, covariance[i * dim + j]);
+                }
+            }
+
+            if (GSL_SUCCESS != GSL_LINALG_CHOLESKY_DECOMP(chol))
+            {
+                gsl_matrix_free(chol);
+                return false;
+            }
+
+            result.assign(dim * dim, 0.0);
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                for (auto j = 0u ; j <= i ; ++j)
+                {
+                    result[i * dim + j] = gsl_matrix_get(chol, i, j);
+                }
+            }
+            gsl_matrix_free(chol);
+
+            return true;
+        }
+
+        void adapt(const unsigned & n)
+        {
+            reset_statistics();
+
+            const double target = (1 == dim) ? 0.44 : 0.234;
+
+            // the covariance of the chain is estimated from the second half of the adaptation steps
+            std::vector<double> mean(dim, 0.0), m2(dim * dim, 0.0);
+            unsigned count = 0;
+
+            for (auto t = 0u ; t < n ; ++t)
+            {
+                const bool step_accepted = step();
+
+                // Robbins-Monro adaptation of the proposal scale towards the optimal acceptance rate
+                proposal_scale *= std::exp(std::pow(t + 1.0, -0.6) * ((step_accepted ? 1.0 : 0.0) - target));
+
+                if (2 * t < n)
+                    continue;
+
+                // Welford's online algorithm for the sample covariance
+                ++count;
+                std::vector<double> delta(dim);
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    delta[i] = z[i] - mean[i];
+                    mean[i] += delta[i] / count;
+                }
+
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    for (auto j = 0u ; j < dim ; ++j)
+                    {
+                        m2[i * dim + j] += delta[i] * (z[j] - mean[j]);
+                    }
+                }
+            }
+
+            if (count <= dim + 1)
+                return;
+
+            std::vector<double> covariance(m2);
+            for (auto & c : covariance)
+            {
+                c /= count - 1.0;
+            }
+
+            std::vector<double> chol;
+            if (! cholesky(covariance, chol))
+            {
+                Log::instance()->message("DelayedAcceptanceSampler::adapt", ll_warning)
+                    << "Cholesky decomposition of the sample covariance failed; keeping the previous proposal";
+
+                return;
+            }
+
+            // the proposal follows the shape of the posterior; its scale is relative to the posterior width
+            proposal_cholesky = chol;
+            proposal_scale = 2.38 / std::sqrt(dim);
+
+            if (surrogate || ! config.emulator())
+                return;
+
+            emulator_mean = mean;
+            emulator_cholesky = chol;
+            emulator_trained = true;
+            current_log_surrogate = log_surrogate(z);
+        }
+
+        std::vector<std::vector<double>> sample(const unsigned & n)
+        {
+            std::vector<std::vector<double>> result;
+            result.reserve(n);
+
+            reset_statistics();
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                step();
+
+                std::vector<double> x(dim);
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    x[j] = parameters[j].evaluate();
+                }
+                result.push_back(x);
+            }
+
+            return result;
+        }
+    };
+
+    DelayedAcceptanceSampler::DelayedAcceptanceSampler(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<DelayedAcceptanceSampler>(new Implementation<DelayedAcceptanceSampler>(log_posterior, nullptr, config))
+    {
+    }
+
+    DelayedAcceptanceSampler::DelayedAcceptanceSampler(const LogPosterior & log_posterior, const LogPosterior & surrogate, const Config & config) :
+        PrivateImplementationPattern<DelayedAcceptanceSampler>(new Implementation<DelayedAcceptanceSampler>(log_posterior, &surrogate, config))
+    {
+    }
+
+    DelayedAcceptanceSampler::~DelayedAcceptanceSampler()
+    {
+    }
+
+    void
+    DelayedAcceptanceSampler::adapt(const unsigned & n)
+    {
+        _imp->adapt(n);
+    }
+
+    std::vector<std::vector<double>>
+    DelayedAcceptanceSampler::sample(const unsigned & n)
+    {
+        return _imp->sample(n);
+    }
+
+    double
+    DelayedAcceptanceSampler::first_stage_acceptance_rate() const
+    {
+        return (_imp->proposed > 0) ? double(_imp->first_stage_accepted) / _imp->proposed : 0.0;
+    }
+
+    double
+    DelayedAcceptanceSampler::acceptance_rate() const
+    {
+        return (_imp->proposed > 0) ? double(_imp->accepted) / _imp->proposed : 0.0;
+    }
+
+    unsigned
+    DelayedAcceptanceSampler::full_evaluations() const
+    {
+        return _imp->first_stage_accepted;
+    }
+}
@@ -0,0 +1,132 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_DELAYED_ACCEPTANCE_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_DELAYED_ACCEPTANCE_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * DelayedAcceptanceSampler draws samples from a LogPosterior by means of a two-stage
+     * Metropolis algorithm [CF:2005A].
+     *
+     * Each proposal is first screened with a cheap surrogate of the log(likelihood). Only
+     * proposals that pass the first stage are evaluated with the full log(likelihood), and
+     * are subjected to a second acceptance step that corrects for the surrogate's error.
+     * The chain's stationary distribution is therefore the full posterior, irrespective of
+     * the quality of the surrogate.
+     *
+     * The surrogate is either a user-supplied LogPosterior, whose likelihood is evaluated
+     * at the same values of the varied parameters, or a Gaussian emulator of the posterior
+     * that is trained on the samples drawn during adapt().
+     *
+     * The proposals are Gaussian random walks in the space of the priors' generator values,
+     * mapped onto the real line through the inverse CDF of the standard normal distribution.
+     *
+     * @note The sampler changes the values of the varied parameters of the posterior.
+     */
+    class DelayedAcceptanceSampler :
+        public PrivateImplementationPattern<DelayedAcceptanceSampler>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// Train a Gaussian emulator during adapt() if no surrogate posterior is provided.
+                    bool emulator() const;
+                    Config & emulator(const bool & x);
+
+                    /// The seed of the random number generator.
+                    unsigned long seed() const;
+                    Config & seed(const unsigned long & x);
+
+                private:
+                    bool _emulator;
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor using a Gaussian emulator as the surrogate.
+             *
+             * The chain starts at the current values of the posterior's varied parameters.
+             *
+             * @param log_posterior The posterior from which samples shall be drawn.
+             * @param config        The configuration of the sampler.
+             */
+            DelayedAcceptanceSampler(const LogPosterior & log_posterior, const Config & config = Config());
+
+            /*!
+             * Constructor using a user-supplied surrogate.
+             *
+             * The chain starts at the current values of the posterior's varied parameters.
+             *
+             * @param log_posterior The posterior from which samples shall be drawn.
+             * @param surrogate     A cheap approximation of the posterior. It must provide all varied parameters
+             *                      of the posterior. Only its likelihood is used; the priors are taken from the posterior.
+             * @param config        The configuration of the sampler.
+             */
+            DelayedAcceptanceSampler(const LogPosterior & log_posterior, const LogPosterior & surrogate, const Config & config = Config());
+
+            /// Destructor.
+            ~DelayedAcceptanceSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Adapt the proposal and, if applicable, train the emulator.
+             *
+             * @param n The number of adaptation steps.
+             */
+            void adapt(const unsigned & n);
+
+            /*!
+             * Draw samples from the posterior.
+             *
+             * @param n The number of samples.
+             *
+             * @return The values of the varied parameters, in the order of LogPosterior::varied_parameters(), for each sample.
+             */
+            std::vector<std::vector<double>> sample(const unsigned & n);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the fraction of proposals that passed the first stage in the last call to adapt() or sample().
+            double first_stage_acceptance_rate() const;
+
+            /// Retrieve the fraction of proposals that were accepted in the last call to adapt() or sample().
+            double acceptance_rate() const;
+
+            /// Retrieve the number of evaluations of the full likelihood in the last call to adapt() or sample().
+            unsigned full_evaluations() const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,102 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/delayed-acceptance-sampler.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    std::pair<double, double> mean_and_sigma(const std::vector<std::vector<double>> & samples)
+    {
+        double sum = 0.0, sum_of_squares = 0.0;
+        for (const auto & s : samples)
+        {
+            sum += s[0];
+            sum_of_squares += s[0] * s[0];
+        }
+
+        const double mean = sum / samples.size();
+        const double variance = sum_of_squares / samples.size() - mean * mean;
+
+        return std::make_pair(mean, std::sqrt(variance));
+    }
+}
+
+class DelayedAcceptanceSamplerTest :
+    public TestCase
+{
+    public:
+        DelayedAcceptanceSamplerTest() :
+            TestCase("delayed_acceptance_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // the posterior is Gaussian with mean 4.3 and width 0.1 / sqrt(2)
+
+            // Gaussian emulator
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+
+                DelayedAcceptanceSampler sampler(log_posterior);
+                sampler.adapt(2000);
+
+                const auto samples = sampler.sample(10000);
+                TEST_CHECK_EQUAL(samples.size(), 10000u);
+
+                // the emulator rejects some proposals without evaluating the full likelihood
+                TEST_CHECK(sampler.first_stage_acceptance_rate() < 1.0);
+                TEST_CHECK(sampler.full_evaluations() < 10000u);
+                TEST_CHECK(sampler.acceptance_rate() > 0.2);
+
+                const auto result = mean_and_sigma(samples);
+                TEST_CHECK_NEARLY_EQUAL(result.first,  4.3,                0.01);
+                TEST_CHECK_RELATIVE_ERROR(result.second, 0.1 / std::sqrt(2.0), 0.1);
+            }
+
+            // biased user-supplied surrogate: the stationary distribution remains the full posterior
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+
+                Parameters surrogate_parameters = Parameters::Defaults();
+                LogLikelihood surrogate_llh(surrogate_parameters);
+                surrogate_llh.add(ObservablePtr(new ObservableStub(surrogate_parameters, "mass::b(MSbar)")), 4.1, 4.15, 4.2);
+                LogPosterior surrogate(surrogate_llh);
+                surrogate.add(LogPrior::Flat(surrogate_parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+
+                DelayedAcceptanceSampler sampler(log_posterior, surrogate);
+                sampler.adapt(2000);
+
+                const auto samples = sampler.sample(20000);
+                TEST_CHECK(sampler.acceptance_rate() < sampler.first_stage_acceptance_rate());
+                TEST_CHECK_EQUAL(sampler.full_evaluations(), unsigned(sampler.first_stage_acceptance_rate() * 20000 + 0.5));
+
+                const auto result = mean_and_sigma(samples);
+                TEST_CHECK_NEARLY_EQUAL(result.first,  4.3,                0.01);
+                TEST_CHECK_RELATIVE_ERROR(result.second, 0.1 / std::sqrt(2.0), 0.1);
+            }
+        }
+} delayed_acceptance_sampler_test;
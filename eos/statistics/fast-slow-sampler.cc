@@ -0,0 +1,488 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/fast-slow-sampler.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+namespace eos
+{
+    FastSlowSampler::Config::Config() :
+        _oversampling(5),
+        _fast_threshold(0.5),
+        _seed(1234567u)
+    {
+    }
+
+    unsigned
+    FastSlowSampler::Config::oversampling() const
+    {
+        return _oversampling;
+    }
+
+    FastSlowSampler::Config &
+    FastSlowSampler::Config::oversampling(const unsigned & x)
+    {
+        if (0 == x)
+            throw InternalError("FastSlowSampler::Config: oversampling must be positive");
+
+        _oversampling = x;
+        return *this;
+    }
+
+    double
+    FastSlowSampler::Config::fast_threshold() const
+    {
+        return _fast_threshold;
+    }
+
+    FastSlowSampler::Config &
+    FastSlowSampler::Config::fast_threshold(const double & x)
+    {
+        if ((x < 0.0) || (1.0 < x))
+            throw InternalError("FastSlowSampler::Config: fast threshold must be in the interval [0, 1]");
+
+        _fast_threshold = x;
+        return *this;
+    }
+
+    unsigned long
+    FastSlowSampler::Config::seed() const
+    {
+        return _seed;
+    }
+
+    FastSlowSampler::Config &
+    FastSlowSampler::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+        return *this;
+    }
+
+    namespace implementation
+    {
+        // The parameters of one prior, which are updated together
+        struct ParameterBlock
+        {
+            LogPriorPtr prior;
+
+            // position of the block's parameters within the varied parameters
+            unsigned offset, size;
+
+            std::vector<Parameter::Id> ids;
+
+            // number of observables and likelihood blocks that need to be recomputed when the block changes
+            unsigned cost;
+
+            // number of observables that need to be recomputed when the block changes
+            unsigned observables;
+
+            bool fast;
+
+            // proposal scale in the space of the sampler
+            double scale;
+
+            // number of adaptation steps taken so far
+            unsigned adaptation_steps;
+
+            unsigned accepted, proposed;
+        };
+    }
+
+    template <>
+    struct Implementation<FastSlowSampler>
+    {
+        using ParameterBlock = implementation::ParameterBlock;
+
+        LogPosterior log_posterior;
+
+        LogLikelihood log_likelihood;
+
+        FastSlowSampler::Config config;
+
+        std::vector<Parameter> parameters;
+
+        const unsigned dim;
+
+        std::vector<ParameterBlock> blocks;
+
+        unsigned number_of_observables;
+
+        // number of likelihood blocks that read parameters directly
+        unsigned number_of_likelihood_blocks;
+
+        gsl_rng * rng;
+
+        // the current position in the space of the sampler, i.e., the probits of the generator values
+        std::vector<double> z;
+
+        // log(likelihood) at the current position
+        double current_log_likelihood;
+
+        // ids of parameters that were reset following a rejected proposal, and whose observables are therefore outdated
+        std::vector<Parameter::Id> pending;
+
+        // number of observables that depend on the pending parameters
+        unsigned pending_observables;
+
+        // above this fraction of outdated observables, the whole cache is updated in parallel
+        static constexpr double parallel_fraction = 0.5;
+
+        Implementation(const LogPosterior & log_posterior, const FastSlowSampler::Config & config) :
+            log_posterior(log_posterior),
+            log_likelihood(log_posterior.log_likelihood()),
+            config(config),
+            parameters(log_posterior.varied_parameters()),
+            dim(parameters.size()),
+            number_of_observables(0),
+            number_of_likelihood_blocks(0),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            z(dim, 0.0),
+            current_log_likelihood(-std::numeric_limits<double>::infinity()),
+            pending_observables(0)
+        {
+            if (0 == dim)
+                throw InternalError("FastSlowSampler: the posterior has no varied parameters");
+
+            gsl_rng_set(rng, config.seed());
+
+            unsigned offset = 0;
+            for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+            {
+                const unsigned size = std::distance((*p)->begin(), (*p)->end());
+
+                std::vector<Parameter::Id> ids;
+                for (auto i = offset ; i < offset + size ; ++i)
+                {
+                    ids.push_back(parameters[i].id());
+                }
+
+                blocks.push_back(ParameterBlock{ *p, offset, size, ids, 0u, 0u, false, 1.0 / std::sqrt(size), 0u, 0u, 0u });
+                offset += size;
+            }
+
+            classify();
+
+            // start at the current parameter point
+            for (auto & block : blocks)
+            {
+                block.prior->compute_cdf();
+            }
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                z[i] = gsl_cdf_ugaussian_Pinv(parameters[i].evaluate_generator());
+            }
+
+            if (! std::all_of(z.cbegin(), z.cend(), [] (const double & x) { return std::isfinite(x); }))
+                throw InternalError("FastSlowSampler: the starting point lies on the boundary of the prior support");
+
+            current_log_likelihood = log_likelihood();
+            if (! std::isfinite(current_log_likelihood))
+                throw InternalError("FastSlowSampler: the likelihood is not finite at the starting point");
+        }
+
+        ~Implementation()
+        {
+            gsl_rng_free(rng);
+        }
+
+        // determine the cost of each block from the parameter dependencies of the observables,
+        // and of those likelihood blocks that read parameters directly
+        void classify()
+        {
+            auto cache = log_likelihood.observable_cache();
+
+            for (auto o = cache.begin(), o_end = cache.end() ; o != o_end ; ++o)
+            {
+                ++number_of_observables;
+
+                // observables that do not register their parameters might depend on any parameter
+                const bool depends_on_all = (*o)->begin() == (*o)->end();
+
+                for (auto & block : blocks)
+                {
+                    const bool depends = depends_on_all || std::any_of(block.ids.cbegin(), block.ids.cend(),
+                            [&o] (const Parameter::Id & id) { return (*o)->end() != std::find((*o)->begin(), (*o)->end(), id); });
+
+                    if (depends)
+                    {
+                        ++block.cost;
+                        ++block.observables;
+                    }
+                }
+            }
+
+            for (auto c = log_likelihood.begin(), c_end = log_likelihood.end() ; c != c_end ; ++c)
+            {
+                for (auto b = c->begin_blocks(), b_end = c->end_blocks() ; b != b_end ; ++b)
+                {
+                    const LogLikelihoodBlock & llh_block = **b;
+                    if (llh_block.begin() == llh_block.end())
+                        continue;
+
+                    ++number_of_likelihood_blocks;
+
+                    for (auto & block : blocks)
+                    {
+                        const bool depends = std::any_of(block.ids.cbegin(), block.ids.cend(),
+                                [&llh_block] (const Parameter::Id & id) { return llh_block.end() != std::find(llh_block.begin(), llh_block.end(), id); });
+
+                        if (depends)
+                            ++block.cost;
+                    }
+                }
+            }
+
+            unsigned max_cost = 0;
+            for (const auto & block : blocks)
+            {
+                max_cost = std::max(max_cost, block.cost);
+            }
+
+            for (auto & block : blocks)
+            {
+                block.fast = block.cost <= config.fast_threshold() * max_cost;
+            }
+
+            // if no block is slow, there is nothing to gain from oversampling
+            if (std::all_of(blocks.cbegin(), blocks.cend(), [] (const ParameterBlock & b) { return b.fast; }))
+            {
+                for (auto & block : blocks)
+                {
+                    block.fast = false;
+                }
+            }
+
+            for (const auto & block : blocks)
+            {
+                Log::instance()->message("FastSlowSampler::classify", ll_informational)
+                    << "Block of " << block.size << " parameter(s) starting with '" << parameters[block.offset].name()
+                    << "' affects " << block.observables << " observable(s) and " << (block.cost - block.observables)
+                    << " likelihood block(s) directly, and is " << (block.fast ? "fast" : "slow");
+            }
+        }
+
+        // propose a new position for one block, and accept or reject it; returns true if accepted
+        bool update(ParameterBlock & block)
+        {
+            std::vector<double> z_proposed(block.size), x_old(block.size);
+            double delta_log_prior = 0.0;
+
+            ++block.proposed;
+
+            for (auto i = 0u ; i < block.size ; ++i)
+            {
+                const auto & z_old = z[block.offset + i];
+                z_proposed[i] = z_old + block.scale * gsl_ran_ugaussian(rng);
+
+                const double u = gsl_cdf_ugaussian_P(z_proposed[i]);
+                if ((u <= 0.0) || (1.0 <= u))
+                    return false;
+
+                // the generator values are distributed as standard normals under the prior
+                delta_log_prior += 0.5 * (z_old * z_old - z_proposed[i] * z_proposed[i]);
+            }
+
+            for (auto i = 0u ; i < block.size ; ++i)
+            {
+                auto & p = parameters[block.offset + i];
+                x_old[i] = p.evaluate();
+                p.set_generator(gsl_cdf_ugaussian_P(z_proposed[i]));
+            }
+            block.prior->sample();
+
+            // recompute only the observables that depend on this block, or on a block that was reset previously;
+            // if these are most of the observables, the parallel update of the whole cache is faster
+            pending.insert(pending.end(), block.ids.cbegin(), block.ids.cend());
+            const double proposed_log_likelihood = (block.observables + pending_observables > parallel_fraction * number_of_observables)
+                ? log_likelihood()
+                : log_likelihood(pending);
+            pending.clear();
+            pending_observables = 0;
+
+            const double log_ratio = proposed_log_likelihood - current_log_likelihood + delta_log_prior;
+            if (std::isfinite(proposed_log_likelihood) && (std::log(gsl_rng_uniform_pos(rng)) < log_ratio))
+            {
+                std::copy(z_proposed.cbegin(), z_proposed.cend(), z.begin() + block.offset);
+                current_log_likelihood = proposed_log_likelihood;
+                ++block.accepted;
+
+                return true;
+            }
+
+            // reset the parameters; their observables are recomputed alongside the next proposal
+            for (auto i = 0u ; i < block.size ; ++i)
+            {
+                parameters[block.offset + i].set(x_old[i]);
+            }
+            pending = block.ids;
+            pending_observables = block.observables;
+
+            return false;
+        }
+
+        // update each slow block once, and each fast block several times
+        void sweep(const bool & adapt)
+        {
+            for (auto & block : blocks)
+            {
+                const unsigned repetitions = block.fast ? config.oversampling() : 1u;
+
+                for (auto r = 0u ; r < repetitions ; ++r)
+                {
+                    const bool accepted = update(block);
+
+                    if (! adapt)
+                        continue;
+
+                    // Robbins-Monro adaptation of the proposal scale towards the optimal acceptance rate
+                    const double target = (1 == block.size) ? 0.44 : 0.234;
+                    ++block.adaptation_steps;
+                    block.scale *= std::exp(std::pow(block.adaptation_steps, -0.6) * ((accepted ? 1.0 : 0.0) - target));
+                }
+            }
+        }
+
+        // bring all observables up to date with the current parameter point
+        void flush()
+        {
+            if (pending.empty())
+                return;
+
+            log_likelihood(pending);
+            pending.clear();
+            pending_observables = 0;
+        }
+
+        void reset_statistics()
+        {
+            for (auto & block : blocks)
+            {
+                block.accepted = 0;
+                block.proposed = 0;
+            }
+        }
+
+        void adapt(const unsigned & n)
+        {
+            reset_statistics();
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                sweep(true);
+            }
+
+            flush();
+        }
+
+        std::vector<std::vector<double>> sample(const unsigned & n)
+        {
+            std::vector<std::vector<double>> result;
+            result.reserve(n);
+
+            reset_statistics();
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                sweep(false);
+
+                std::vector<double> x(dim);
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    x[j] = parameters[j].evaluate();
+                }
+                result.push_back(x);
+            }
+
+            flush();
+
+            return result;
+        }
+    };
+
+    FastSlowSampler::FastSlowSampler(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<FastSlowSampler>(new Implementation<FastSlowSampler>(log_posterior, config))
+    {
+    }
+
+    FastSlowSampler::~FastSlowSampler()
+    {
+    }
+
+    void
+    FastSlowSampler::adapt(const unsigned & n)
+    {
+        _imp->adapt(n);
+    }
+
+    std::vector<std::vector<double>>
+    FastSlowSampler::sample(const unsigned & n)
+    {
+        return _imp->sample(n);
+    }
+
+    std::vector<double>
+    FastSlowSampler::costs() const
+    {
+        std::vector<double> result(_imp->dim, 0.0);
+        for (const auto & block : _imp->blocks)
+        {
+            std::fill(result.begin() + block.offset, result.begin() + block.offset + block.size,
+                    double(block.cost) / std::max(1u, _imp->number_of_observables + _imp->number_of_likelihood_blocks));
+        }
+
+        return result;
+    }
+
+    std::vector<bool>
+    FastSlowSampler::fast() const
+    {
+        std::vector<bool> result(_imp->dim, false);
+        for (const auto & block : _imp->blocks)
+        {
+            std::fill(result.begin() + block.offset, result.begin() + block.offset + block.size, block.fast);
+        }
+
+        return result;
+    }
+
+    std::vector<double>
+    FastSlowSampler::acceptance_rates() const
+    {
+        std::vector<double> result(_imp->dim, 0.0);
+        for (const auto & block : _imp->blocks)
+        {
+            const double rate = (block.proposed > 0) ? double(block.accepted) / block.proposed : 0.0;
+            std::fill(result.begin() + block.offset, result.begin() + block.offset + block.size, rate);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,130 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_FAST_SLOW_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_FAST_SLOW_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * FastSlowSampler draws samples from a LogPosterior by means of blocked Metropolis updates,
+     * one block per prior.
+     *
+     * The cost of updating a block is estimated as the number of observables in the
+     * likelihood's ObservableCache that depend on any of the block's parameters, plus the
+     * number of likelihood blocks that read any of these parameters directly. Blocks
+     * whose cost does not exceed a configurable fraction of the most expensive block's cost
+     * are considered fast, and are updated several times in each sweep over all blocks.
+     * After each proposal, only those observables that depend on the changed parameters are
+     * recomputed, unless these are most of the observables; in that case, the whole cache
+     * is updated in parallel.
+     *
+     * The proposals are Gaussian random walks in the space of the priors' generator values,
+     * mapped onto the real line through the inverse CDF of the standard normal distribution.
+     * Their scales are adapted separately for each block.
+     *
+     * @note The sampler changes the values of the varied parameters of the posterior.
+     * @warning Must not be used from within a thread of the ThreadPool.
+     */
+    class FastSlowSampler :
+        public PrivateImplementationPattern<FastSlowSampler>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// The number of updates of each fast block per sweep.
+                    unsigned oversampling() const;
+                    Config & oversampling(const unsigned & x);
+
+                    /// The maximal cost of a fast block, relative to the cost of the most expensive block.
+                    double fast_threshold() const;
+                    Config & fast_threshold(const double & x);
+
+                    /// The seed of the random number generator.
+                    unsigned long seed() const;
+                    Config & seed(const unsigned long & x);
+
+                private:
+                    unsigned _oversampling;
+                    double _fast_threshold;
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * The chain starts at the current values of the posterior's varied parameters.
+             *
+             * @param log_posterior The posterior from which samples shall be drawn.
+             * @param config        The configuration of the sampler.
+             */
+            FastSlowSampler(const LogPosterior & log_posterior, const Config & config = Config());
+
+            /// Destructor.
+            ~FastSlowSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Adapt the proposal scales of all blocks.
+             *
+             * @param n The number of sweeps.
+             */
+            void adapt(const unsigned & n);
+
+            /*!
+             * Draw samples from the posterior.
+             *
+             * @param n The number of sweeps, each of which yields one sample.
+             *
+             * @return The values of the varied parameters, in the order of LogPosterior::varied_parameters(), for each sample.
+             */
+            std::vector<std::vector<double>> sample(const unsigned & n);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /*!
+             * Retrieve the fraction of observables and likelihood blocks that are recomputed following a change of each varied parameter's block.
+             *
+             * Only those likelihood blocks that read parameters directly are counted.
+             */
+            std::vector<double> costs() const;
+
+            /// Retrieve whether each varied parameter belongs to a fast block.
+            std::vector<bool> fast() const;
+
+            /// Retrieve the acceptance rate of each varied parameter's block in the last call to adapt() or sample().
+            std::vector<double> acceptance_rates() const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/fast-slow-sampler.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+class FastSlowSamplerTest :
+    public TestCase
+{
+    public:
+        FastSlowSamplerTest() :
+            TestCase("fast_slow_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // mass::b(MSbar) enters three observables, mass::c only one
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                auto mb_1 = new TestObservable(parameters, Kinematics(), "mass::b(MSbar)");
+                mb_1->set_option("variant", "1");
+                auto mb_2 = new TestObservable(parameters, Kinematics(), "mass::b(MSbar)");
+                mb_2->set_option("variant", "2");
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(mb_1), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(mb_2), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(new TestObservable(parameters, Kinematics(), "mass::c")), 1.2, 1.25, 1.3);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.0, 1.5 }));
+                log_posterior[0].set(4.25);
+                log_posterior[1].set(1.25);
+
+                FastSlowSampler sampler(log_posterior, FastSlowSampler::Config().oversampling(4));
+
+                const auto costs = sampler.costs();
+                TEST_CHECK_EQUAL(costs.size(), 2u);
+                TEST_CHECK_NEARLY_EQUAL(costs[0], 0.75, 1e-15);
+                TEST_CHECK_NEARLY_EQUAL(costs[1], 0.25, 1e-15);
+
+                const auto fast = sampler.fast();
+                TEST_CHECK_EQUAL(fast.size(), 2u);
+                TEST_CHECK(! fast[0]);
+                TEST_CHECK(fast[1]);
+
+                sampler.adapt(1000);
+                const auto samples = sampler.sample(5000);
+                TEST_CHECK_EQUAL(samples.size(), 5000u);
+
+                const auto rates = sampler.acceptance_rates();
+                TEST_CHECK_NEARLY_EQUAL(rates[0], 0.44, 0.1);
+                TEST_CHECK_NEARLY_EQUAL(rates[1], 0.44, 0.1);
+
+                // the posterior is Gaussian in both parameters, with means (4.2, 1.25) and widths (0.1 / sqrt(3), 0.05)
+                double sum[2] = { 0.0, 0.0 }, sum_of_squares[2] = { 0.0, 0.0 };
+                for (const auto & s : samples)
+                {
+                    for (auto i = 0u ; i < 2 ; ++i)
+                    {
+                        sum[i] += s[i];
+                        sum_of_squares[i] += s[i] * s[i];
+                    }
+                }
+
+                const double mean_b = sum[0] / samples.size(), mean_c = sum[1] / samples.size();
+                TEST_CHECK_NEARLY_EQUAL(mean_b, 4.2,  0.01);
+                TEST_CHECK_NEARLY_EQUAL(mean_c, 1.25, 0.005);
+                TEST_CHECK_RELATIVE_ERROR(std::sqrt(sum_of_squares[0] / samples.size() - mean_b * mean_b), 0.1 / std::sqrt(3.0), 0.15);
+                TEST_CHECK_RELATIVE_ERROR(std::sqrt(sum_of_squares[1] / samples.size() - mean_c * mean_c), 0.05,                0.15);
+
+                // the observables are consistent with the final parameter point
+                const double cached_log_likelihood = llh(std::vector<Parameter::Id>{});
+                TEST_CHECK_NEARLY_EQUAL(cached_log_likelihood, llh(), 1e-12);
+            }
+        }
+} fast_slow_sampler_test;
@@ -22,15 +22,29 @@
 #include <eos/statistics/test-statistic-impl.hh>
 #include <eos/utils/log.hh>
 #include <eos/utils/observable_cache.hh>
+#include <eos/maths/derivative.hh>
 #include <eos/maths/power-of.hh>
 #include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
 #include <eos/utils/verify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <limits>
 #include <map>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <gsl/gsl_blas.h>
 #include <gsl/gsl_cdf.h>
@@ -65,7 +79,9 @@ namespace eos
 
             ObservableCache::Id id;
 
-            const double mode, sigma_lower, sigma_upper;
+            double mode;
+
+            const double sigma_lower, sigma_upper;
 
             // coefficients needed for asymmetric Gaussian x^{+a}_{-b}
             // the pdf/cumulative is a piecewise function
@@ -135,6 +151,18 @@ namespace eos
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual Dual evaluate_with_gradient() const
+            {
+                const Dual & value = cache.prediction_with_gradient(id);
+
+                // allow for asymmetric Gaussian uncertainty
+                const double sigma = (value.value() > mode) ? sigma_upper : sigma_lower;
+
+                const Dual chi = (value - mode) / sigma;
+
+                return norm - chi * chi / 2.0;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -155,10 +183,9 @@ namespace eos
              * theory value that is likely under exp. should yield
              * likely value of exp. assuming theory.
              *
-             * This procedure is used in both sample() and significance()
+             * This procedure is used in sample(), resample() and significance()
              */
-
-            virtual double sample(gsl_rng * rng) const
+            double pseudo_measurement(gsl_rng * rng, double & sigma) const
             {
                 // find out if sample in upper or lower part
                 double u = gsl_rng_uniform(rng);
@@ -171,24 +198,35 @@ namespace eos
                 const double & theory = cache[id];
 
                 // get a sample observable using the inverse-transform method
-                double obs, sigma;
                 if (u < b / (a + b))
                 {
-                    obs = gsl_cdf_gaussian_Pinv(u / c_b, b) + theory;
                     sigma = b;
+                    return gsl_cdf_gaussian_Pinv(u / c_b, b) + theory;
                 }
                 else
                 {
-                    obs = gsl_cdf_gaussian_Pinv(u - 0.5 * c_b, a) + theory;
                     sigma = a;
+                    return gsl_cdf_gaussian_Pinv(u - 0.5 * c_b, a) + theory;
                 }
+            }
+
+            virtual double sample(gsl_rng * rng) const
+            {
+                double sigma;
+                const double obs = pseudo_measurement(rng, sigma);
 
                 // calculate the properly normalized log likelihood
                 // note that we generate from theory,
-                const double chi = (theory - obs) / sigma;
+                const double chi = (cache[id] - obs) / sigma;
                 return norm - power_of<2>(chi) / 2.0;
             }
 
+            virtual void resample(gsl_rng * rng)
+            {
+                double sigma;
+                mode = pseudo_measurement(rng, sigma);
+            }
+
             virtual double significance() const
             {
                 const double value = cache[id];
@@ -314,6 +352,13 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            virtual Dual evaluate_with_gradient() const
+            {
+                const Dual value = (cache.prediction_with_gradient(id) - nu) / lambda;
+
+                return norm + alpha * value - exp(value);
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -349,6 +394,15 @@ namespace eos
                 return norm + alpha * value - std::exp(value);
             }
 
+            // draw the deviation from the central value, and shift it to the theory prediction
+            virtual void resample(gsl_rng * rng)
+            {
+                const double x = lambda * std::log(gsl_ran_gamma(rng, alpha, 1.0)) + nu;
+
+                central = cache[id] + (x - central);
+                nu      = central - lambda * std::log(alpha);
+            }
+
             /*
              * To find the significance, it is necessary to determine the smallest interval
              * around the mode. This is achieved by finding the mirror point
@@ -478,7 +532,9 @@ namespace eos
 
             const double physical_limit;
 
-            const double theta, alpha, beta;
+            double theta;
+
+            const double alpha, beta;
 
             double norm;
 
@@ -548,6 +604,14 @@ namespace eos
                 return norm + (alpha * beta - 1) * std::log(z) - std::pow(z, beta);
             }
 
+            virtual Dual evaluate_with_gradient() const
+            {
+                // standardized transform
+                const Dual z = (cache.prediction_with_gradient(id) - physical_limit) / theta;
+
+                return norm + (alpha * beta - 1) * log(z) - pow(z, beta);
+            }
+
             inline double mode() const
             {
                 return physical_limit + theta * std::pow(alpha - 1 / beta, 1 / beta);
@@ -577,6 +641,27 @@ namespace eos
                 return norm + (alpha * beta - 1) * std::log(z) - w;
             }
 
+            /*
+             * The distribution is shifted to the prediction by rescaling theta,
+             * such that the median coincides with the prediction. For a prediction
+             * at or below the physical limit, the measurement remains unchanged.
+             */
+            virtual void resample(gsl_rng * rng)
+            {
+                const double theory = cache[id];
+                if (theory <= physical_limit)
+                    return;
+
+                // median of the standardized distribution
+                const double median = std::pow(gsl_cdf_gamma_Pinv(0.5, alpha, 1.0), 1 / beta);
+
+                const double theta_theory = (theory - physical_limit) / median;
+                const double x = physical_limit + theta_theory * std::pow(gsl_ran_gamma(rng, alpha, 1.0), 1 / beta);
+
+                theta = (x - physical_limit) / median;
+                norm  = -1.0 * gsl_sf_lngamma(alpha) + std::log(std::fabs(beta / theta));
+            }
+
             virtual double significance() const
             {
                 const double value = cache[id];
@@ -752,6 +837,27 @@ namespace eos
                 return ret_val;
             }
 
+            Dual evaluate_with_gradient() const
+            {
+                std::vector<Dual> values;
+                values.reserve(components.size());
+
+                for (const auto & component : components)
+                    values.push_back(component->evaluate_with_gradient());
+
+                const Dual max_val = *std::max_element(values.cbegin(), values.cend());
+
+                // computed weighted sum, renormalize exponents
+                Dual ret_val = 0.0;
+                auto v = values.cbegin();
+                for (auto w = weights.cbegin(); w != weights.cend() ; ++w, ++v)
+                {
+                    ret_val += *w * exp(*v - max_val);
+                }
+
+                return log(ret_val) + max_val;
+            }
+
             unsigned number_of_observations() const
             {
                 return components.front()->number_of_observations();
@@ -762,6 +868,16 @@ namespace eos
                 throw InternalError("LogLikelihoodBlock::MixtureBlock::sample() not implemented yet");
             }
 
+            void resample(gsl_rng * /*rng*/)
+            {
+                throw InternalError("LogLikelihoodBlock::MixtureBlock::resample() not implemented yet");
+            }
+
+            bool resamplable() const
+            {
+                return false;
+            }
+
             double significance() const
             {
                 double value = -2.0 * evaluate();
@@ -1006,6 +1122,36 @@ namespace eos
                 return _norm - 0.5 * chi_square();
             }
 
+            virtual Dual evaluate_with_gradient() const
+            {
+                // measurements <- R * observables - mean
+                std::vector<Dual> measurements(_dim_meas);
+                for (auto i = 0u ; i < _dim_meas ; ++i)
+                {
+                    measurements[i] = -gsl_vector_get(_mean, i);
+
+                    for (auto j = 0u ; j < _dim_pred ; ++j)
+                    {
+                        measurements[i] += gsl_matrix_get(_response, i, j) * _cache.prediction_with_gradient(_ids[j]);
+                    }
+                }
+
+                // chi^2 <- measurements^T * inv(covariance) * measurements
+                Dual chi_squared = 0.0;
+                for (auto i = 0u ; i < _dim_meas ; ++i)
+                {
+                    Dual row = 0.0;
+                    for (auto j = 0u ; j < _dim_meas ; ++j)
+                    {
+                        row += gsl_matrix_get(_covariance_inv, i, j) * measurements[j];
+                    }
+
+                    chi_squared += measurements[i] * row;
+                }
+
+                return _norm - 0.5 * chi_squared;
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return _number_of_observations;
@@ -1035,6 +1181,25 @@ namespace eos
                 return result;
             }
 
+            virtual void resample(gsl_rng * rng)
+            {
+                // generate standard normals
+                for (auto i = 0u ; i < _dim_meas ; ++i)
+                {
+                    gsl_vector_set(_measurements, i, gsl_ran_ugaussian(rng));
+                }
+
+                // read observable values from cache
+                for (auto i = 0u ; i < _dim_pred ; ++i)
+                {
+                    gsl_vector_set(_observables, i, _cache[_ids[i]]);
+                }
+
+                // mean <- R * observables + _chol * standard normals
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _response, _observables, 0.0, _mean);
+                gsl_blas_dgemv(CblasNoTrans, 1.0, _chol, _measurements, 1.0, _mean);
+            }
+
             virtual double significance() const
             {
                 const auto chi_squared = this->chi_square();
@@ -1119,6 +1284,39 @@ namespace eos
                 }
             }
 
+            virtual Dual evaluate_with_gradient() const
+            {
+                Dual saturation = 0.0;
+
+                for (auto i : ids)
+                {
+                    saturation += cache.prediction_with_gradient(i);
+                }
+
+                if (saturation < 0.0)
+                {
+                    throw InternalError("Contribution to the uniform bound must be positive; found to be negative!");
+                }
+                else if (saturation < bound)
+                {
+                    return 0.0;
+                }
+                else
+                {
+                    if (uncertainty == 0.0)
+                    {
+                        return - std::numeric_limits<double>::infinity();
+                    }
+                    else
+                    {
+                        // add a gaussian like penalty
+                        const Dual chi = (saturation - bound) / uncertainty;
+
+                        return - 0.5 * chi * chi;
+                    }
+                }
+            }
+
             virtual unsigned number_of_observations() const
             {
                 return 0.0;
@@ -1129,6 +1327,10 @@ namespace eos
                 return 0.0;
             }
 
+            virtual void resample(gsl_rng * /*rng*/)
+            {
+            }
+
             virtual double significance() const
             {
                 return 0.0;
@@ -1152,12 +1354,272 @@ namespace eos
                 return LogLikelihoodBlockPtr(new UniformBoundBlock(cache, std::move(ids), bound, uncertainty));
             }
         };
+
+        struct UnbinnedBlock :
+            public LogLikelihoodBlock
+        {
+            // the number of events per chunk; each chunk is processed by a single thread
+            static constexpr unsigned long chunk_size = 16384;
+
+            ObservableCache cache;
+
+            SignalPDFPtr pdf;
+
+            // one independent clone of the PDF per further thread
+            std::vector<SignalPDFPtr> clones;
+
+            std::shared_ptr<const double> events;
+
+            const unsigned long number_of_events;
+
+            unsigned dim;
+
+            const bool extended;
+
+            ObservableCache::Id yield_id;
+
+            const double log_factorial;
+
+            // the state of one concurrent summation, which outlives the block if a helper starts late
+            struct Summation
+            {
+                std::shared_ptr<const double> events;
+                unsigned long number_of_events;
+                unsigned long number_of_chunks;
+                unsigned dim;
+
+                std::atomic<unsigned long> next_chunk{ 0 }, completed_chunks{ 0 };
+                std::mutex mutex;
+                std::condition_variable done;
+
+                std::vector<double> partial_sums;
+
+                // the first exception thrown while processing a chunk, guarded by the mutex
+                std::exception_ptr error;
+
+                // process chunks until none is left; never throws
+                void process(const SignalPDF & pdf)
+                {
+                    std::vector<double> log_values;
+
+                    for (auto c = next_chunk++ ; c < number_of_chunks ; c = next_chunk++)
+                    {
+                        try
+                        {
+                            const unsigned long begin = c * chunk_size, end = std::min(number_of_events, begin + chunk_size);
+                            log_values.resize(end - begin);
+                            pdf.evaluate_batch(events.get() + begin * dim, end - begin, log_values.data());
+
+                            double sum = 0.0;
+                            for (auto i = 0ul ; i < end - begin ; ++i)
+                            {
+                                sum += log_values[i];
+                            }
+                            partial_sums[c] = sum;
+                        }
+                        catch (...)
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            if (! error)
+                                error = std::current_exception();
+                        }
+
+                        // a failed chunk counts as completed, such that the caller does not wait forever
+                        if (++completed_chunks == number_of_chunks)
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            done.notify_all();
+                        }
+                    }
+                }
+            };
+
+            UnbinnedBlock(const ObservableCache & cache, const SignalPDFPtr & pdf,
+                    const std::shared_ptr<const double> & events, const unsigned long & number_of_events,
+                    const ObservablePtr & yield) :
+                cache(cache),
+                pdf(std::static_pointer_cast<SignalPDF>(pdf->clone(cache.parameters()))),
+                events(events),
+                number_of_events(number_of_events),
+                dim(0),
+                extended(nullptr != yield),
+                yield_id(extended ? this->cache.add(yield) : 0),
+                log_factorial(std::lgamma(number_of_events + 1.0))
+            {
+                for (auto d = this->pdf->begin(), d_end = this->pdf->end() ; d != d_end ; ++d)
+                {
+                    ++dim;
+                }
+
+                // the PDF reads its parameters directly, rather than through the cache
+                uses(this->pdf->parameter_user());
+
+                if (number_of_events <= chunk_size)
+                    return;
+
+                const unsigned number_of_clones = std::min<unsigned long>(ThreadPool::instance()->number_of_threads(), (number_of_events + chunk_size - 1) / chunk_size);
+                for (auto c = 1u ; c < number_of_clones ; ++c)
+                {
+                    clones.push_back(std::static_pointer_cast<SignalPDF>(pdf->clone(cache.parameters())));
+                }
+            }
+
+            virtual ~UnbinnedBlock()
+            {
+            }
+
+            virtual std::string as_string() const
+            {
+                std::string result = "Unbinned: " + pdf->name().full() + "; " + stringify(number_of_events) + " events";
+
+                if (extended)
+                    result += "; extended";
+
+                return result;
+            }
+
+            double sum_of_log_pdf() const
+            {
+                auto summation = std::make_shared<Summation>();
+                summation->events           = events;
+                summation->number_of_events = number_of_events;
+                summation->number_of_chunks = (number_of_events + chunk_size - 1) / chunk_size;
+                summation->dim              = dim;
+                summation->partial_sums.resize(summation->number_of_chunks, 0.0);
+
+                // the helpers only hold shared ownership of the summation and their clone
+                for (const auto & clone : clones)
+                {
+                    ThreadPool::instance()->enqueue(std::function<void (void)>([summation, clone] () { summation->process(*clone); }));
+                }
+
+                summation->process(*pdf);
+
+                {
+                    std::unique_lock<std::mutex> lock(summation->mutex);
+                    summation->done.wait(lock, [&] () { return summation->completed_chunks == summation->number_of_chunks; });
+
+                    if (summation->error)
+                        std::rethrow_exception(summation->error);
+                }
+
+                // sum in a fixed order, to obtain results that do not depend on the scheduling
+                double result = 0.0;
+                for (const auto & s : summation->partial_sums)
+                {
+                    result += s;
+                }
+
+                return result;
+            }
+
+            virtual double evaluate() const
+            {
+                double result = sum_of_log_pdf() - number_of_events * pdf->normalization();
+
+                if (extended)
+                {
+                    const double expected_events = cache[yield_id];
+                    if (expected_events <= 0.0)
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += number_of_events * std::log(expected_events) - expected_events - log_factorial;
+                }
+
+                return result;
+            }
+
+            // the PDF is not differentiable, so the unextended log(likelihood) is differentiated numerically,
+            // but only with respect to the parameters that the PDF uses; cf. ObservableCache::update_with_gradient()
+            virtual Dual evaluate_with_gradient() const
+            {
+                using Stencil = deriv::TwoSidedStencil<1u>;
+
+                const auto & parameters = cache.gradient_parameters();
+                const auto & parameter_user = pdf->parameter_user();
+
+                std::vector<double> gradient(parameters.size(), 0.0);
+                for (auto j = 0u ; j < parameters.size() ; ++j)
+                {
+                    if (parameter_user.end() == std::find(parameter_user.begin(), parameter_user.end(), parameters[j].id()))
+                        continue;
+
+                    Parameter p = parameters[j];
+                    const double x0 = p.evaluate();
+                    const double h = Stencil::step(x0);
+                    for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+                    {
+                        p.set(x0 + Stencil::offsets[k] * h);
+                        gradient[j] += Stencil::weights[k] * (sum_of_log_pdf() - number_of_events * pdf->normalization());
+                    }
+                    p.set(x0);
+
+                    gradient[j] /= Stencil::denominator * h;
+                }
+
+                Dual result(sum_of_log_pdf() - number_of_events * pdf->normalization(), gradient);
+
+                if (extended)
+                {
+                    const Dual & expected_events = cache.prediction_with_gradient(yield_id);
+                    if (expected_events.value() <= 0.0)
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += number_of_events * log(expected_events) - expected_events - log_factorial;
+                }
+
+                return result;
+            }
+
+            virtual unsigned number_of_observations() const
+            {
+                return number_of_events;
+            }
+
+            virtual double sample(gsl_rng * /*rng*/) const
+            {
+                throw InternalError("LogLikelihoodBlock::UnbinnedBlock::sample() not implemented yet");
+            }
+
+            virtual void resample(gsl_rng * /*rng*/)
+            {
+                throw InternalError("LogLikelihoodBlock::UnbinnedBlock::resample() not implemented yet");
+            }
+
+            virtual bool resamplable() const
+            {
+                return false;
+            }
+
+            virtual double significance() const
+            {
+                return 0.0;
+            }
+
+            virtual TestStatistic primary_test_statistic() const
+            {
+                return test_statistics::Empty();
+            }
+
+            virtual LogLikelihoodBlockPtr clone(ObservableCache cache) const
+            {
+                ObservablePtr yield = extended ? this->cache.observable(yield_id)->clone(cache.parameters()) : nullptr;
+
+                return LogLikelihoodBlockPtr(new UnbinnedBlock(cache, pdf, events, number_of_events, yield));
+            }
+        };
     }
 
     LogLikelihoodBlock::~LogLikelihoodBlock()
     {
     }
 
+    bool
+    LogLikelihoodBlock::resamplable() const
+    {
+        return true;
+    }
+
     LogLikelihoodBlockPtr
     LogLikelihoodBlock::Gaussian(ObservableCache cache, const ObservablePtr & observable,
             const double & min, const double & central, const double & max,
@@ -1296,6 +1758,58 @@ namespace eos
         return LogLikelihoodBlockPtr(new implementation::UniformBoundBlock(cache, std::move(indices), bound, uncertainty));
     }
 
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::Unbinned(ObservableCache cache, const SignalPDFPtr & pdf,
+            const std::shared_ptr<const double> & events, const unsigned long & number_of_events,
+            const ObservablePtr & yield)
+    {
+        if (0 == number_of_events)
+            throw InternalError("LogLikelihoodBlock::Unbinned: the sample of events is empty");
+
+        return LogLikelihoodBlockPtr(new implementation::UnbinnedBlock(cache, pdf, events, number_of_events, yield));
+    }
+
+    LogLikelihoodBlockPtr
+    LogLikelihoodBlock::Unbinned(ObservableCache cache, const SignalPDFPtr & pdf,
+            const std::string & filename, const ObservablePtr & yield)
+    {
+        unsigned dim = 0;
+        for (auto d = pdf->begin(), d_end = pdf->end() ; d != d_end ; ++d)
+        {
+            ++dim;
+        }
+
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw InternalError("LogLikelihoodBlock::Unbinned: cannot open '" + filename + "': " + std::strerror(errno));
+
+        struct stat status;
+        if (::fstat(fd, &status) < 0)
+        {
+            ::close(fd);
+            throw InternalError("LogLikelihoodBlock::Unbinned: cannot determine the size of '" + filename + "': " + std::strerror(errno));
+        }
+
+        const std::size_t size = status.st_size;
+        if ((0 == size) || (0 != size % (dim * sizeof(double))))
+        {
+            ::close(fd);
+            throw InternalError("LogLikelihoodBlock::Unbinned: the size of '" + filename + "' is not a positive multiple of " + stringify(dim) + " double-precision values");
+        }
+
+        void * data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == data)
+            throw InternalError("LogLikelihoodBlock::Unbinned: cannot map '" + filename + "' into memory: " + std::strerror(errno));
+
+        // the events are read sequentially in each evaluation
+        ::madvise(data, size, MADV_SEQUENTIAL);
+
+        std::shared_ptr<const double> events(static_cast<const double *>(data), [size] (const double * p) { ::munmap(const_cast<double *>(p), size); });
+
+        return LogLikelihoodBlock::Unbinned(cache, pdf, events, size / (dim * sizeof(double)), yield);
+    }
+
     template <>
     struct WrappedForwardIteratorTraits<LogLikelihood::ConstraintIteratorTag>
     {
@@ -1414,6 +1928,26 @@ namespace eos
 
             return result;
         }
+
+        Dual log_likelihood_with_gradient() const
+        {
+            Dual result = 0.0;
+
+            // loop over all likelihood blocks
+            for (const auto & constraint : constraints)
+            {
+                for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                {
+                    Dual llh = (*b)->evaluate_with_gradient();
+                    if (! std::isfinite(llh.value()))
+                        return -std::numeric_limits<double>::infinity();
+
+                    result += llh;
+                }
+            }
+
+            return result;
+        }
     };
 
     LogLikelihood::LogLikelihood(const Parameters & parameters) :
@@ -1518,4 +2052,20 @@ namespace eos
 
         return _imp->log_likelihood();
     }
+
+    double
+    LogLikelihood::operator() (const std::vector<Parameter::Id> & ids) const
+    {
+        _imp->cache.update(ids);
+
+        return _imp->log_likelihood();
+    }
+
+    Dual
+    LogLikelihood::evaluate_with_gradient(const std::vector<Parameter> & parameters) const
+    {
+        _imp->cache.update_with_gradient(parameters);
+
+        return _imp->log_likelihood_with_gradient();
+    }
 }
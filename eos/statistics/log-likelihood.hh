@@ -23,6 +23,7 @@
 
 #include <eos/constraint.hh>
 #include <eos/observable.hh>
+#include <eos/signal-pdf.hh>
 #include <eos/statistics/log-likelihood-fwd.hh>
 #include <eos/statistics/test-statistic.hh>
 #include <eos/maths/matrix.hh>
@@ -35,6 +36,8 @@
 #include <gsl/gsl_vector.h>
 
 #include <cmath>
+#include <memory>
+#include <string>
 
 namespace eos
 {
@@ -46,8 +49,12 @@ namespace eos
      *
      * Access to any LogLikelihoodBlock is coherent, i.e., changes to one object will propagate
      * to every other object copy. To create an independent instance, use clone().
+     *
+     * Blocks that read parameters directly, rather than through the observables in their
+     * cache, register these parameters via ParameterUser::uses().
      */
-    class LogLikelihoodBlock
+    class LogLikelihoodBlock :
+        public ParameterUser
     {
         public:
             /// Destructor.
@@ -61,6 +68,13 @@ namespace eos
             /// Compute the logarithm of the likelihood for this block.
             virtual double evaluate() const = 0;
 
+            /*!
+             * Compute the logarithm of the likelihood for this block alongside its gradient.
+             *
+             * @note Requires a prior call to ObservableCache::update_with_gradient().
+             */
+            virtual Dual evaluate_with_gradient() const = 0;
+
             /// The number of experimental observations (not observables!) used in this block.
             virtual unsigned number_of_observations() const = 0;
 
@@ -74,6 +88,28 @@ namespace eos
              */
             virtual double sample(gsl_rng * rng) const = 0;
 
+            /*!
+             * Replace the experimental measurement by a pseudo measurement.
+             *
+             * The pseudo measurement is drawn from the experimental distribution, shifted
+             * to the current theory predictions. Only the measurement is modified; the
+             * observables and their cache are kept as they are.
+             *
+             * @note Requires up-to-date predictions in the ObservableCache.
+             * @note Throws for blocks that are not resamplable().
+             * @warning Modifies this block and all of its copies. Use clone() to keep the original measurement.
+             *
+             * @param rng The random number generator.
+             */
+            virtual void resample(gsl_rng * rng) = 0;
+
+            /*!
+             * Whether resample() is supported by this block.
+             *
+             * Defaults to true; blocks that cannot replace their measurement override this.
+             */
+            virtual bool resamplable() const;
+
             /*!
              * Calculate the significance of the deviation between
              * the observables' current value and the mode in
@@ -299,6 +335,42 @@ namespace eos
              */
             static LogLikelihoodBlockPtr UniformBound(ObservableCache cache, const std::vector<ObservablePtr> & observables,
                                                       const double & bound, const double & uncertainty);
+
+            /*!
+             * Create a new LogLikelihoodBlock for an unbinned sample of events distributed according to a SignalPDF.
+             *
+             * The log(likelihood) is the sum of the log(PDF) over all events, normalized once per evaluation.
+             * If an observable for the expected number of events is provided, the block represents an
+             * extended likelihood, which further includes the Poisson probability of the number of events.
+             *
+             * The events are processed in chunks, which are distributed over the ThreadPool and evaluated
+             * on independent clones of the PDF. The calling thread processes chunks as well, such that the
+             * block can also be evaluated from within a thread of the pool.
+             *
+             * @param cache            The Observable cache from which we draw the expected number of events.
+             * @param pdf              The SignalPDF that describes the distribution of the events.
+             * @param events           The kinematic variables of the events in row-major order, following the order of
+             *                         the PDF's parameter descriptions. The storage is shared by all clones of the block.
+             * @param number_of_events The number of events.
+             * @param yield            The Observable for the expected number of events, or nullptr for a non-extended likelihood.
+             */
+            static LogLikelihoodBlockPtr Unbinned(ObservableCache cache, const SignalPDFPtr & pdf,
+                    const std::shared_ptr<const double> & events, const unsigned long & number_of_events,
+                    const ObservablePtr & yield = nullptr);
+
+            /*!
+             * Create a new LogLikelihoodBlock for an unbinned sample of events that is memory-mapped from a file.
+             *
+             * The file contains the kinematic variables of the events as native double-precision values,
+             * in the same order as for the in-memory variant of this function.
+             *
+             * @param cache            The Observable cache from which we draw the expected number of events.
+             * @param pdf              The SignalPDF that describes the distribution of the events.
+             * @param filename         The path to the file of events.
+             * @param yield            The Observable for the expected number of events, or nullptr for a non-extended likelihood.
+             */
+            static LogLikelihoodBlockPtr Unbinned(ObservableCache cache, const SignalPDFPtr & pdf,
+                    const std::string & filename, const ObservablePtr & yield = nullptr);
     };
 
     /*!
@@ -398,6 +470,22 @@ namespace eos
              * @note: all observables are recalculated
              */
             double operator()() const;
+
+            /*!
+             * Evaluate the log likelihood following a change of the given parameters.
+             * @note: only observables that depend on these parameters are recalculated, serially in the calling thread
+             *
+             * @param ids The ids of all parameters that changed since the last evaluation.
+             */
+            double operator()(const std::vector<Parameter::Id> & ids) const;
+
+            /*!
+             * Evaluate the log likelihood alongside its gradient.
+             * @note: all observables are recalculated
+             *
+             * @param parameters The parameters with respect to which the gradient is computed.
+             */
+            Dual evaluate_with_gradient(const std::vector<Parameter> & parameters) const;
             ///@}
     };
 
@@ -22,13 +22,66 @@
 #include <eos/statistics/log-likelihood.hh>
 #include <eos/statistics/log-posterior_TEST.hh>
 #include <eos/maths/power-of.hh>
+#include <eos/signal-pdf.hh>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+#include <gsl/gsl_cdf.h>
 
 using namespace test;
 using namespace eos;
 
 namespace eos
 {
+    // a PDF whose batch evaluation always fails
+    class FailingSignalPDF :
+        public SignalPDF
+    {
+        private:
+            SignalPDFPtr _pdf;
+
+        public:
+            FailingSignalPDF(const SignalPDFPtr & pdf) :
+                _pdf(pdf)
+            {
+            }
+
+            virtual const QualifiedName & name() const { return _pdf->name(); }
+
+            virtual double evaluate() const { return _pdf->evaluate(); }
+
+            virtual void evaluate_batch(const double *, const unsigned &, double *) const
+            {
+                throw InternalError("FailingSignalPDF: evaluation failed");
+            }
+
+            virtual double normalization() const { return _pdf->normalization(); }
+
+            virtual const ParameterUser & parameter_user() const { return _pdf->parameter_user(); }
+
+            virtual Kinematics kinematics() { return _pdf->kinematics(); }
+
+            virtual Parameters parameters() { return _pdf->parameters(); }
+
+            virtual Options options() { return _pdf->options(); }
+
+            virtual DensityPtr clone() const
+            {
+                return DensityPtr(new FailingSignalPDF(std::static_pointer_cast<SignalPDF>(_pdf->clone())));
+            }
+
+            virtual DensityPtr clone(const Parameters & parameters) const
+            {
+                return DensityPtr(new FailingSignalPDF(std::static_pointer_cast<SignalPDF>(_pdf->clone(parameters))));
+            }
+
+            virtual Density::Iterator begin() const { return _pdf->begin(); }
+
+            virtual Density::Iterator end() const { return _pdf->end(); }
+    };
+
     class LogLikelihoodTest :
         public TestCase
     {
@@ -607,6 +660,108 @@ namespace eos
                     TEST_CHECK_RELATIVE_ERROR(mvg_covariance->evaluate(), mvg_correlation->evaluate(), eps);
                 }
 
+                // resampling of the measurements
+                {
+                    std::array<ObservablePtr, 2> obs
+                    {{
+                        ObservablePtr(new ObservableStub(p, "mass::b(MSbar)", k)),
+                        ObservablePtr(new ObservableStub(p, "mass::c",        k))
+                    }};
+
+                    ObservableCache cache(p);
+
+                    std::array<double, 2> mean{{ 4.3, 1.1 }};
+                    std::array<std::array<double, 2>, 2> covariance;
+                    covariance[0][0] = 0.1 * 0.1;
+                    covariance[1][1] = 0.05 * 0.05;
+                    covariance[0][1] = covariance[1][0] = 0.003;
+
+                    auto gaussian = LogLikelihoodBlock::Gaussian(cache, obs[0], +4.2, +4.3, +4.4);
+                    auto multivariate = LogLikelihoodBlock::MultivariateGaussian<2>(cache, obs, mean, covariance);
+
+                    // the same shapes as in the LogGamma and Amoroso tests above
+                    const double lg_alpha = 0.383056, lg_lambda = 0.0687907;
+                    auto log_gamma = LogLikelihoodBlock::LogGamma(cache, obs[1], 0.34, 0.53, 0.63, lg_alpha, lg_lambda);
+
+                    const double am_alpha = 8.2392613044e-01, am_beta = 1.6993290032;
+                    auto amoroso = LogLikelihoodBlock::Amoroso(cache, obs[1], 0.0, 2.9708273062, am_alpha, am_beta);
+
+                    // the predictions around which the pseudo measurements are drawn
+                    p["mass::b(MSbar)"] = 4.6;
+                    p["mass::c"] = 1.3;
+                    cache.update();
+
+                    // the original measurements are retained by a clone
+                    ObservableCache original_cache(p);
+                    auto original = gaussian->clone(original_cache);
+                    original_cache.update();
+                    const double original_value = original->evaluate();
+
+                    gsl_rng * rng = gsl_rng_alloc(gsl_rng_mt19937);
+                    gsl_rng_set(rng, 1243);
+
+                    const unsigned n = 1e4;
+                    unsigned n_gaussian_in = 0, n_multivariate_in = 0;
+                    unsigned n_log_gamma_above = 0, n_amoroso_above = 0;
+                    double mean_significance = 0.0;
+                    for (unsigned i = 0 ; i < n ; ++i)
+                    {
+                        gaussian->resample(rng);
+                        multivariate->resample(rng);
+                        log_gamma->resample(rng);
+                        amoroso->resample(rng);
+
+                        // the significances are distributed as if the predictions were the true values
+                        const double significance = gaussian->significance();
+                        mean_significance += significance / n;
+
+                        if (std::abs(significance) <= 1.0)
+                            ++n_gaussian_in;
+
+                        if (multivariate->significance() <= 1.0)
+                            ++n_multivariate_in;
+
+                        // positive significances indicate a mode above the prediction
+                        if (log_gamma->significance() > 0.0)
+                            ++n_log_gamma_above;
+
+                        if (amoroso->significance() > 0.0)
+                            ++n_amoroso_above;
+                    }
+
+                    // predictions at or below the physical limit leave the Amoroso measurement unchanged
+                    {
+                        p["mass::c"] = 1.0;
+                        cache.update();
+                        const double amoroso_value = amoroso->evaluate();
+
+                        p["mass::c"] = -0.5;
+                        cache.update();
+                        amoroso->resample(rng);
+
+                        p["mass::c"] = 1.0;
+                        cache.update();
+                        TEST_CHECK_EQUAL(amoroso_value, amoroso->evaluate());
+                    }
+                    gsl_rng_free(rng);
+
+                    TEST_CHECK_NEARLY_EQUAL(mean_significance, 0.0, 0.03);
+                    TEST_CHECK_NEARLY_EQUAL(n_gaussian_in / double(n), 0.68268949213708585, 0.015);
+                    TEST_CHECK_NEARLY_EQUAL(n_multivariate_in / double(n), 0.68268949213708585, 0.015);
+
+                    // the LogGamma mode is shifted by the deviation from the original mode, and thus
+                    // exceeds the prediction if the underlying gamma variate exceeds alpha
+                    TEST_CHECK_NEARLY_EQUAL(n_log_gamma_above / double(n), gsl_cdf_gamma_Q(lg_alpha, lg_alpha, 1.0), 0.015);
+
+                    // the Amoroso median is rescaled to a pseudo value whose median is the prediction, and
+                    // thus the mode exceeds the prediction for gamma variates above Pinv(1/2)^2 / (alpha - 1/beta)
+                    const double am_median = gsl_cdf_gamma_Pinv(0.5, am_alpha, 1.0);
+                    const double am_mode_threshold = am_median * am_median / (am_alpha - 1.0 / am_beta);
+                    TEST_CHECK_NEARLY_EQUAL(n_amoroso_above / double(n), gsl_cdf_gamma_Q(am_mode_threshold, am_alpha, 1.0), 0.015);
+
+                    TEST_CHECK_EQUAL(original_value, original->evaluate());
+                }
+
                 // bootstrap p-value calculation
                 {
                     Parameters parameters  = Parameters::Defaults();
@@ -655,6 +810,112 @@ namespace eos
                     // ratio of pdfs at mode given by weight ratio
                     TEST_CHECK_RELATIVE_ERROR(pdf_favored, pdf_suppressed + std::log(weights[0] / weights[1]), 1e-12);
                 }
+
+                // unbinned likelihood
+                {
+                    Kinematics k{ { "z_min", -1.0 }, { "z_max", +1.0 } };
+                    auto pdf = SignalPDF::make("Test::Legendre1D", p, k, Options{ });
+
+                    // more events than fit into a single chunk, to exercise the concurrent summation
+                    const unsigned long n = 40000;
+                    auto storage = std::make_shared<std::vector<double>>(n);
+                    double expected = 0.0;
+                    for (auto i = 0ul ; i < n ; ++i)
+                    {
+                        const double z = -1.0 + (2.0 * i + 1.0) / n;
+                        (*storage)[i] = z;
+
+                        // the PDF (9 + 8 z + 9 z^2) is normalized to 24 on [-1, +1]
+                        expected += std::log((9.0 + 8.0 * z + 9.0 * z * z) / 24.0);
+                    }
+                    std::shared_ptr<const double> events(storage, storage->data());
+
+                    ObservableCache cache(p);
+                    auto block = LogLikelihoodBlock::Unbinned(cache, pdf, events, n);
+                    TEST_CHECK_EQUAL(n, block->number_of_observations());
+                    TEST_CHECK_RELATIVE_ERROR(expected, block->evaluate(), 1e-12);
+
+                    // extended likelihood
+                    p["mass::tau"] = 39000.0;
+                    auto extended_block = LogLikelihoodBlock::Unbinned(cache, pdf, events, n, ObservablePtr(new ObservableStub(p, "mass::tau")));
+                    cache.update();
+                    TEST_CHECK_RELATIVE_ERROR(expected + n * std::log(39000.0) - 39000.0 - std::lgamma(n + 1.0), extended_block->evaluate(), 1e-12);
+
+                    // the clone shares the events
+                    LogLikelihood llh(p);
+                    llh.add(Constraint("Test::Unbinned", { }, { extended_block }));
+                    TEST_CHECK_RELATIVE_ERROR(extended_block->evaluate(), llh(), 1e-14);
+
+                    // memory-mapped events
+                    const std::string filename("log-likelihood_TEST-unbinned.bin");
+                    {
+                        std::ofstream file(filename, std::ios::binary);
+                        file.write(reinterpret_cast<const char *>(storage->data()), n * sizeof(double));
+                    }
+                    auto mapped_block = LogLikelihoodBlock::Unbinned(cache, pdf, filename);
+                    TEST_CHECK_EQUAL(n, mapped_block->number_of_observations());
+                    TEST_CHECK_EQUAL(block->evaluate(), mapped_block->evaluate());
+                    std::remove(filename.c_str());
+
+                    TEST_CHECK_THROWS(InternalError, LogLikelihoodBlock::Unbinned(cache, pdf, filename));
+
+                    // failed evaluations in any chunk are rethrown once all chunks are done
+                    auto failing_block = LogLikelihoodBlock::Unbinned(cache, std::make_shared<FailingSignalPDF>(pdf), events, n);
+                    TEST_CHECK_THROWS(InternalError, failing_block->evaluate());
+                    TEST_CHECK_THROWS(InternalError, failing_block->evaluate());
+
+                    // the test PDF does not depend on any parameter
+                    TEST_CHECK(block->begin() == block->end());
+                }
+
+                // unbinned likelihood blocks register the parameters of their PDF
+                {
+                    Kinematics k{ { "q2_min", 1.0 }, { "q2_max", 10.0 } };
+                    auto pdf = SignalPDF::make("B->Dlnu::dGamma/dq2", p, k, Options{ { "model", "CKM" }, { "l", "mu" } });
+
+                    auto storage = std::make_shared<std::vector<double>>(std::vector<double>{ 2.0, 5.0, 8.0 });
+                    std::shared_ptr<const double> events(storage, storage->data());
+
+                    ObservableCache cache(p);
+                    auto block = LogLikelihoodBlock::Unbinned(cache, pdf, events, storage->size());
+
+                    const Parameter::Id id = p["CKM::abs(V_cb)"].id();
+                    TEST_CHECK(block->end() != std::find(block->begin(), block->end(), id));
+
+                    // the gradient agrees with the numerical derivatives of the log(likelihood), also when extended
+                    p["mass::tau"] = 2.5;
+                    auto extended_block = LogLikelihoodBlock::Unbinned(cache, pdf, events, storage->size(), ObservablePtr(new ObservableStub(p, "mass::tau")));
+
+                    const std::vector<Parameter> parameters{ p["B->D::alpha^f+_1@BSZ2015"], p["B->D::alpha^f0_1@BSZ2015"], p["mass::tau"] };
+                    cache.update_with_gradient(parameters);
+
+                    for (const auto & b : { block, extended_block })
+                    {
+                        const Dual result = b->evaluate_with_gradient();
+                        TEST_CHECK_RELATIVE_ERROR(b->evaluate(), result.value(), 1e-12);
+
+                        for (auto i = 0u ; i < parameters.size() ; ++i)
+                        {
+                            Parameter x = parameters[i];
+                            const double x0 = x.evaluate(), h = 1.0e-5 * std::abs(x0);
+
+                            x = x0 + h;
+                            cache.update();
+                            const double upper = b->evaluate();
+                            x = x0 - h;
+                            cache.update();
+                            const double lower = b->evaluate();
+                            x = x0;
+                            cache.update();
+
+                            TEST_CHECK_NEARLY_EQUAL((upper - lower) / (2.0 * h), result.derivative(i), 1.0e-5 * (1.0 + std::abs(result.derivative(i))));
+                        }
+                    }
+
+                    // the unextended log(likelihood) does not depend on the yield
+                    TEST_CHECK_EQUAL(0.0, block->evaluate_with_gradient().derivative(2));
+                    TEST_CHECK_RELATIVE_ERROR(3.0 / 2.5 - 1.0, extended_block->evaluate_with_gradient().derivative(2), 1e-6);
+                }
             }
     } log_likelihood_test;
 }
@@ -107,6 +107,39 @@ namespace eos
         return log_posterior();
     }
 
+    std::pair<double, std::vector<double>>
+    LogPosterior::evaluate_with_gradient() const
+    {
+        if (_priors.empty())
+            throw InternalError("LogPosterior::evaluate_with_gradient(): prior is undefined");
+
+        const Dual log_likelihood = _log_likelihood.evaluate_with_gradient(_varied_parameters);
+
+        double value = log_likelihood.value();
+        std::vector<double> gradient(_varied_parameters.size(), 0.0);
+        for (auto i = 0u ; i < gradient.size() ; ++i)
+        {
+            gradient[i] = log_likelihood.derivative(i);
+        }
+
+        // the priors' parameters are stored contiguously in the order of the priors
+        auto offset = 0u;
+        for (const auto & prior : _priors)
+        {
+            value += (*prior)();
+
+            const auto prior_gradient = prior->gradient();
+            for (auto i = 0u ; i < prior_gradient.size() ; ++i)
+            {
+                gradient[offset + i] += prior_gradient[i];
+            }
+
+            offset += prior_gradient.size();
+        }
+
+        return std::make_pair(value, gradient);
+    }
+
     Parameters
     LogPosterior::parameters() const
     {
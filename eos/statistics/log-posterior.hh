@@ -32,6 +32,7 @@
 #include <eos/utils/wrapped_forward_iterator.hh>
 
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace eos
@@ -63,6 +64,13 @@ namespace eos
 
             /// Evaluate the Log(posterior) density at the current parameter values.
             virtual double evaluate() const;
+
+            /*!
+             * Evaluate the Log(posterior) density and its gradient at the current parameter values.
+             *
+             * The gradient is taken with respect to the varied parameters, in the order of varied_parameters().
+             */
+            std::pair<double, std::vector<double>> evaluate_with_gradient() const;
             ///@}
 
             ///@name Accessors
@@ -122,6 +122,33 @@ class LogPosteriorTest :
                 TEST_CHECK_EQUAL(log_posterior.log_prior(), clone->log_prior());
             }
 
+            // gradient
+            {
+                // exact gradient via ObservableStub
+                LogPosterior log_posterior = make_log_posterior(false);
+                Parameter p = log_posterior[0];
+                p.set(4.35);
+
+                // d/dm log(likelihood) = -(4.35 - 4.2) / 0.1^2, d/dm log(prior) = -(4.35 - 4.4) / 0.1^2
+                const auto result = log_posterior.evaluate_with_gradient();
+                TEST_CHECK_NEARLY_EQUAL(result.first,        log_posterior.evaluate(), eps);
+                TEST_CHECK_EQUAL(result.second.size(),       1u);
+                TEST_CHECK_NEARLY_EQUAL(result.second[0],    -10.0,                    1e-10);
+
+                // numerical gradient for an observable that does not implement DifferentiableObservable
+                Parameters parameters = Parameters::Defaults();
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new TestObservable(parameters, Kinematics(), "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                LogPosterior log_posterior_numerical(llh);
+                log_posterior_numerical.add(LogPrior::CurtailedGauss(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }, 4.3, 4.4, 4.5));
+                parameters["mass::b(MSbar)"] = 4.35;
+
+                const auto result_numerical = log_posterior_numerical.evaluate_with_gradient();
+                TEST_CHECK_NEARLY_EQUAL(result_numerical.first,      result.first, eps);
+                TEST_CHECK_NEARLY_EQUAL(result_numerical.second[0],  -10.0,        1e-6);
+                TEST_CHECK_NEARLY_EQUAL(double(parameters["mass::b(MSbar)"]), 4.35, 0.0);
+            }
+
             // stop if prior undefined
             {
                 Parameters parameters = Parameters::Defaults();
@@ -125,6 +125,17 @@ namespace eos
                     return _value;
                 }
 
+                virtual std::vector<double> gradient() const
+                {
+                    return { 0.0 };
+                }
+
+                virtual std::vector<double> generator_gradient(const std::vector<double> & gradient) const
+                {
+                    // dx/du = max - min
+                    return { gradient[0] * (_range.max - _range.min) };
+                }
+
                 virtual LogPriorPtr clone(const Parameters & parameters) const
                 {
                     return LogPriorPtr(new priors::Flat(parameters, _name, _range));
@@ -246,6 +257,22 @@ namespace eos
                     return norm - 0.5 * power_of<2>((x - _central) / sigma);
                 }
 
+                virtual std::vector<double> gradient() const
+                {
+                    // read parameter's current value
+                    double x = _parameter.evaluate();
+
+                    double sigma = (x < _central) ? _sigma_lower : _sigma_upper;
+
+                    return { -(x - _central) / power_of<2>(sigma) };
+                }
+
+                virtual std::vector<double> generator_gradient(const std::vector<double> & gradient) const
+                {
+                    // dx/du = 1 / pdf(x)
+                    return { gradient[0] * std::exp(-(*this)()) };
+                }
+
                 virtual LogPriorPtr clone(const Parameters & parameters) const
                 {
                     return LogPriorPtr(new priors::CurtailedGauss(parameters, _name, _range, _lower, _central, _upper));
@@ -340,6 +367,23 @@ namespace eos
                     return 1.0 / (2.0 * _ln_lambda * x);
                 }
 
+                virtual std::vector<double> gradient() const
+                {
+                    // read parameter's current value
+                    double x = _parameter.evaluate();
+
+                    if ((x < _min) || (_max < x))
+                        return { 0.0 };
+
+                    return { -1.0 / (2.0 * _ln_lambda * power_of<2>(x)) };
+                }
+
+                virtual std::vector<double> generator_gradient(const std::vector<double> & gradient) const
+                {
+                    // dx/du = 2 ln(lambda) x
+                    return { gradient[0] * 2.0 * _ln_lambda * _parameter.evaluate() };
+                }
+
                 virtual LogPriorPtr clone(const Parameters & parameters) const
                 {
                     return LogPriorPtr(new priors::Scale(parameters, _name, _range, _mu_0, _lambda));
@@ -558,6 +602,44 @@ namespace eos
                     return _norm - 0.5 * chi_square;
                 }
 
+                virtual std::vector<double> gradient() const
+                {
+                    // the gradient reads inv(covariance) * (mean - parameters)
+                    std::vector<double> result(_dim, 0.0);
+                    for (auto i = 0u ; i < _dim ; ++i)
+                    {
+                        for (auto j = 0u ; j < _dim ; ++j)
+                        {
+                            result[i] += gsl_matrix_get(_covariance_inv, i, j) * (gsl_vector_get(_mean, j) - _parameters[j].evaluate());
+                        }
+                    }
+
+                    return result;
+                }
+
+                virtual std::vector<double> generator_gradient(const std::vector<double> & gradient) const
+                {
+                    // x = mean + chol * z with z_j = Phi^-1(u_j), hence dx_i/du_j = chol_ij / phi(z_j)
+                    for (auto i = 0u ; i < _dim ; ++i)
+                    {
+                        gsl_vector_set(_measurements_2, i, _parameters[i].evaluate());
+                    }
+                    gsl_vector_sub(_measurements_2, _mean);
+                    gsl_blas_dgemv(CblasNoTrans, 1.0, _chol_inv, _measurements_2, 0.0, _measurements);
+
+                    std::vector<double> result(_dim, 0.0);
+                    for (auto j = 0u ; j < _dim ; ++j)
+                    {
+                        for (auto i = j ; i < _dim ; ++i)
+                        {
+                            result[j] += gsl_matrix_get(_chol, i, j) * gradient[i];
+                        }
+                        result[j] /= gsl_ran_ugaussian_pdf(gsl_vector_get(_measurements, j));
+                    }
+
+                    return result;
+                }
+
                 virtual LogPriorPtr clone(const Parameters & parameters) const
                 {
                     gsl_vector * mean = gsl_vector_alloc(_dim);
@@ -93,6 +93,22 @@ namespace eos
              */
             virtual double operator() () const = 0;
 
+            /*!
+             * Evaluate the gradient of the natural logarithm of the prior with respect
+             * to the varied parameters, in the order of iteration.
+             */
+            virtual std::vector<double> gradient() const = 0;
+
+            /*!
+             * Transform the gradient of a function with respect to the varied parameters into
+             * its gradient with respect to the generator values, i.e., apply the transposed Jacobian
+             * of the inverse CDF as used in sample(). The Jacobian is evaluated at the current
+             * parameter values.
+             *
+             * @param gradient The gradient with respect to the varied parameters, in the order of iteration.
+             */
+            virtual std::vector<double> generator_gradient(const std::vector<double> & gradient) const = 0;
+
             /*!
              * Generate a prior sample from the inverse CDF and a set of generator values.
              *
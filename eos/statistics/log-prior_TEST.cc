@@ -23,6 +23,8 @@
 #include <eos/statistics/log-prior.hh>
 #include <eos/maths/power-of.hh>
 
+#include <cmath>
+
 using namespace test;
 using namespace eos;
 
@@ -71,6 +73,10 @@ class LogPriorTest :
                 TEST_CHECK_NEARLY_EQUAL(inverse_cdf(flat_prior, param, 0.5), 4.35,               eps);
                 TEST_CHECK_NEARLY_EQUAL(inverse_cdf(flat_prior, param, 1.0), 4.5,                eps);
 
+                // gradients
+                TEST_CHECK_NEARLY_EQUAL(flat_prior->gradient()[0],                  0.0,         eps);
+                TEST_CHECK_NEARLY_EQUAL(flat_prior->generator_gradient({ 2.0 })[0], 0.6,         eps);
+
                 // a continuous parameter of interest
                 TEST_CHECK_EQUAL(flat_prior->begin()->name(), "mass::b(MSbar)");
             }
@@ -132,6 +138,10 @@ class LogPriorTest :
 
                 parameters["mass::b(MSbar)"] = 4.3;
                 TEST_CHECK_NEARLY_EQUAL((*gauss_prior)(), 0.883646846442265719, eps);
+
+                // gradients
+                TEST_CHECK_NEARLY_EQUAL(gauss_prior->gradient()[0],                  10.0,                               1e-10);
+                TEST_CHECK_NEARLY_EQUAL(gauss_prior->generator_gradient({ 1.0 })[0], std::exp(-0.883646846442265719),    eps);
             }
 
             // asymmetric
@@ -159,6 +169,8 @@ class LogPriorTest :
 
                 param = 4.0;
                 TEST_CHECK_NEARLY_EQUAL((*scale_prior)(), 0.1803368801111204, eps);
+                TEST_CHECK_NEARLY_EQUAL(scale_prior->gradient()[0],                  -0.1803368801111204 / 4.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(scale_prior->generator_gradient({ 1.0 })[0], 8.0 * std::log(2.0),       eps);
 
                 param = 7.0;
                 TEST_CHECK_NEARLY_EQUAL((*scale_prior)(), 0.1030496457777831, eps);
@@ -0,0 +1,903 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/no-u-turn-sampler.hh>
+#include <eos/statistics/numerical-derivatives.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/log.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include <config.h>
+
+#ifdef EOS_USE_GSL_LINALG_CHOLESKY_DECOMP
+#  if (EOS_USE_GSL_LINALG_CHOLESKY_DECOMP == 1)
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp
+#  else
+#    define GSL_LINALG_CHOLESKY_DECOMP gsl_linalg_cholesky_decomp1
+#  endif
+#else
+#  error EOS_USE_GSL_LINALG_CHOLESKY_DECOMP not defined.
+#endif
+
+namespace eos
+{
+    NoUTurnSampler::Config::Config() :
+        _target_acceptance(0.8),
+        _max_tree_depth(10),
+        _dense_mass_matrix(false),
+        _generator_space(true),
+        _finite_differences(true),
+        _seed(1234567u)
+    {
+    }
+
+    double
+    NoUTurnSampler::Config::target_acceptance() const
+    {
+        return _target_acceptance;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::target_acceptance(const double & x)
+    {
+        if ((x <= 0.0) || (1.0 <= x))
+            throw InternalError("NoUTurnSampler::Config: target acceptance must be in the interval (0, 1)");
+
+        _target_acceptance = x;
+        return *this;
+    }
+
+    unsigned
+    NoUTurnSampler::Config::max_tree_depth() const
+    {
+        return _max_tree_depth;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::max_tree_depth(const unsigned & x)
+    {
+        if (0 == x)
+            throw InternalError("NoUTurnSampler::Config: maximal tree depth must be positive");
+
+        _max_tree_depth = x;
+        return *this;
+    }
+
+    bool
+    NoUTurnSampler::Config::dense_mass_matrix() const
+    {
+        return _dense_mass_matrix;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::dense_mass_matrix(const bool & x)
+    {
+        _dense_mass_matrix = x;
+        return *this;
+    }
+
+    bool
+    NoUTurnSampler::Config::generator_space() const
+    {
+        return _generator_space;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::generator_space(const bool & x)
+    {
+        _generator_space = x;
+        return *this;
+    }
+
+    bool
+    NoUTurnSampler::Config::finite_differences() const
+    {
+        return _finite_differences;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::finite_differences(const bool & x)
+    {
+        _finite_differences = x;
+        return *this;
+    }
+
+    unsigned long
+    NoUTurnSampler::Config::seed() const
+    {
+        return _seed;
+    }
+
+    NoUTurnSampler::Config &
+    NoUTurnSampler::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+        return *this;
+    }
+
+    namespace implementation
+    {
+        // A point in phase space
+        struct PhaseSpacePoint
+        {
+            // position in the space of the sampler, and the corresponding parameter values
+            std::vector<double> q, x;
+
+            // momentum
+            std::vector<double> p;
+
+            // log(density) at q and its gradient
+            double log_density;
+            std::vector<double> gradient;
+        };
+
+        // A (sub)tree of the trajectory
+        struct Tree
+        {
+            PhaseSpacePoint minus, plus, proposal;
+
+            // number of valid points
+            double n;
+
+            // is the tree still valid?
+            bool valid;
+
+            // sum of the acceptance statistics, and number of contributions
+            double alpha;
+            unsigned n_alpha;
+        };
+
+        // Dual averaging of the step size, cf. [HG:2014A], section 3.2.1
+        struct DualAveraging
+        {
+            static constexpr double gamma = 0.05, t0 = 10.0, kappa = 0.75;
+
+            double target, mu, h_bar, log_epsilon_bar;
+
+            unsigned m;
+
+            DualAveraging(const double & target) :
+                target(target),
+                mu(0.0),
+                h_bar(0.0),
+                log_epsilon_bar(0.0),
+                m(0)
+            {
+            }
+
+            void restart(const double & epsilon)
+            {
+                mu = std::log(10.0 * epsilon);
+                h_bar = 0.0;
+                log_epsilon_bar = 0.0;
+                m = 0;
+            }
+
+            double update(const double & acceptance)
+            {
+                m += 1;
+
+                const double eta = 1.0 / (m + t0);
+                h_bar = (1.0 - eta) * h_bar + eta * (target - acceptance);
+
+                const double log_epsilon = mu - std::sqrt(m) / gamma * h_bar;
+                const double x = std::pow(m, -kappa);
+                log_epsilon_bar = x * log_epsilon + (1.0 - x) * log_epsilon_bar;
+
+                return std::exp(log_epsilon);
+            }
+
+            double final() const
+            {
+                return std::exp(log_epsilon_bar);
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<NoUTurnSampler>
+    {
+        using PhaseSpacePoint = implementation::PhaseSpacePoint;
+        using Tree = implementation::Tree;
+
+        // the maximal difference in the log(joint density) before a trajectory is considered divergent
+        static constexpr double delta_max = 1000.0;
+
+        LogPosterior log_posterior;
+
+        NoUTurnSampler::Config config;
+
+        std::vector<Parameter> parameters;
+
+        std::vector<LogPriorPtr> priors;
+
+        std::vector<unsigned> prior_sizes;
+
+        const unsigned dim;
+
+        std::unique_ptr<NumericalDerivatives> numerical_derivatives;
+
+        gsl_rng * rng;
+
+        double epsilon;
+
+        // inverse mass matrix: either its diagonal, or the full matrix in row-major order
+        std::vector<double> metric;
+
+        // Cholesky factor of the dense inverse mass matrix in row-major order
+        std::vector<double> metric_cholesky;
+
+        PhaseSpacePoint current;
+
+        double acceptance_rate;
+
+        unsigned divergences;
+
+        Implementation(const LogPosterior & log_posterior, const NoUTurnSampler::Config & config) :
+            log_posterior(log_posterior),
+            config(config),
+            parameters(log_posterior.varied_parameters()),
+            dim(parameters.size()),
+            rng(gsl_rng_alloc(gsl_rng_mt19937)),
+            epsilon(1.0),
+            acceptance_rate(0.0),
+            divergences(0)
+        {
+            if (0 == dim)
+                throw InternalError("NoUTurnSampler: the posterior has no varied parameters");
+
+            gsl_rng_set(rng, config.seed());
+
+            for (auto p = log_posterior.begin_priors(), p_end = log_posterior.end_priors() ; p != p_end ; ++p)
+            {
+                priors.push_back(*p);
+                prior_sizes.push_back(std::distance((*p)->begin(), (*p)->end()));
+            }
+
+            if (config.finite_differences())
+                numerical_derivatives.reset(new NumericalDerivatives(log_posterior));
+
+            reset_metric();
+
+            // start at the current parameter point
+            current.q.resize(dim);
+            if (config.generator_space())
+            {
+                for (auto & prior : priors)
+                {
+                    prior->compute_cdf();
+                }
+
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    current.q[i] = gsl_cdf_ugaussian_Pinv(parameters[i].evaluate_generator());
+                }
+            }
+            else
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    current.q[i] = parameters[i].evaluate();
+                }
+            }
+
+            evaluate(current);
+            if (! std::isfinite(current.log_density))
+                throw InternalError("NoUTurnSampler: the posterior is not finite at the starting point");
+
+            current.p.assign(dim, 0.0);
+            epsilon = find_reasonable_step_size(current);
+            restore_current();
+        }
+
+        ~Implementation()
+        {
+            gsl_rng_free(rng);
+        }
+
+        void reset_metric()
+        {
+            if (config.dense_mass_matrix())
+            {
+                metric.assign(dim * dim, 0.0);
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    metric[i * dim + i] = 1.0;
+                }
+                metric_cholesky = metric;
+            }
+            else
+            {
+                metric.assign(dim, 1.0);
+            }
+        }
+
+        // evaluate the log(density) and its gradient at position q of the given point
+        void evaluate(PhaseSpacePoint & point)
+        {
+            point.x.resize(dim);
+            point.gradient.assign(dim, 0.0);
+
+            if (config.generator_space())
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    const double u = gsl_cdf_ugaussian_P(point.q[i]);
+                    if ((u <= 0.0) || (1.0 <= u))
+                    {
+                        point.log_density = -std::numeric_limits<double>::infinity();
+                        return;
+                    }
+
+                    parameters[i].set_generator(u);
+                }
+
+                for (auto & prior : priors)
+                {
+                    prior->sample();
+                }
+
+                // the priors are absorbed into the transformation, only the likelihood remains
+                std::vector<double> gradient(dim, 0.0);
+                if (numerical_derivatives)
+                {
+                    point.log_density = log_posterior.log_likelihood()();
+                    gradient = numerical_derivatives->gradient();
+
+                    auto offset = 0u;
+                    for (const auto & prior : priors)
+                    {
+                        const auto prior_gradient = prior->gradient();
+                        for (auto i = 0u ; i < prior_gradient.size() ; ++i)
+                        {
+                            gradient[offset + i] -= prior_gradient[i];
+                        }
+                        offset += prior_gradient.size();
+                    }
+                }
+                else
+                {
+                    const Dual log_likelihood = log_posterior.log_likelihood().evaluate_with_gradient(parameters);
+
+                    point.log_density = log_likelihood.value();
+                    for (auto i = 0u ; i < dim ; ++i)
+                    {
+                        gradient[i] = log_likelihood.derivative(i);
+                    }
+                }
+
+                // chain rule: parameters -> generator values -> sampler space
+                auto offset = 0u;
+                for (auto j = 0u ; j < priors.size() ; ++j)
+                {
+                    const std::vector<double> slice(gradient.begin() + offset, gradient.begin() + offset + prior_sizes[j]);
+                    const auto generator_gradient = priors[j]->generator_gradient(slice);
+
+                    for (auto i = 0u ; i < prior_sizes[j] ; ++i)
+                    {
+                        point.gradient[offset + i] = generator_gradient[i] * gsl_ran_ugaussian_pdf(point.q[offset + i]);
+                    }
+
+                    offset += prior_sizes[j];
+                }
+
+                // the generator values are distributed as standard normals under the prior
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    point.log_density -= 0.5 * point.q[i] * point.q[i];
+                    point.gradient[i] -= point.q[i];
+                }
+            }
+            else
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    parameters[i].set(point.q[i]);
+                }
+
+                if (numerical_derivatives)
+                {
+                    point.log_density = log_posterior.evaluate();
+                    point.gradient = numerical_derivatives->gradient();
+                }
+                else
+                {
+                    std::tie(point.log_density, point.gradient) = log_posterior.evaluate_with_gradient();
+                }
+            }
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                point.x[i] = parameters[i].evaluate();
+            }
+
+            if (! std::isfinite(point.log_density))
+                point.log_density = -std::numeric_limits<double>::infinity();
+        }
+
+        // velocity = inverse mass matrix * momentum
+        std::vector<double> velocity(const std::vector<double> & p) const
+        {
+            std::vector<double> result(dim, 0.0);
+
+            if (config.dense_mass_matrix())
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    for (auto j = 0u ; j < dim ; ++j)
+                    {
+                        result[i] += metric[i * dim + j] * p[j];
+                    }
+                }
+            }
+            else
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    result[i] = metric[i] * p[i];
+                }
+            }
+
+            return result;
+        }
+
+        double kinetic_energy(const std::vector<double> & p) const
+        {
+            const auto v = velocity(p);
+
+            double result = 0.0;
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                result += p[i] * v[i];
+            }
+
+            return 0.5 * result;
+        }
+
+        double log_joint(const PhaseSpacePoint & point) const
+        {
+            return point.log_density - kinetic_energy(point.p);
+        }
+
+        // draw the momentum from a normal distribution with covariance = mass matrix
+        void draw_momentum(PhaseSpacePoint & point)
+        {
+            point.p.resize(dim);
+
+            if (config.dense_mass_matrix())
+            {
+                // with metric = L L^T, solve L^T p = z
+                std::vector<double> z(dim);
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    z[i] = gsl_ran_ugaussian(rng);
+                }
+
+                for (int i = dim - 1 ; i >= 0 ; --i)
+                {
+                    double sum = z[i];
+                    for (auto k = unsigned(i) + 1 ; k < dim ; ++k)
+                    {
+                        sum -= metric_cholesky[k * dim + i] * point.p[k];
+                    }
+                    point.p[i] = sum / metric_cholesky[i * dim + i];
+                }
+            }
+            else
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    point.p[i] = gsl_ran_ugaussian(rng) / std::sqrt(metric[i]);
+                }
+            }
+        }
+
+        PhaseSpacePoint leapfrog(const PhaseSpacePoint & point, const double & step)
+        {
+            PhaseSpacePoint result(point);
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                result.p[i] += 0.5 * step * point.gradient[i];
+            }
+
+            const auto v = velocity(result.p);
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                result.q[i] += step * v[i];
+            }
+
+            evaluate(result);
+
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                result.p[i] += 0.5 * step * result.gradient[i];
+            }
+
+            return result;
+        }
+
+        // cf. [HG:2014A], algorithm 4
+        double find_reasonable_step_size(const PhaseSpacePoint & start)
+        {
+            PhaseSpacePoint point(start);
+            draw_momentum(point);
+
+            double result = 1.0;
+            const double joint = log_joint(point);
+
+            auto log_ratio = [&] () {
+                const double value = log_joint(leapfrog(point, result)) - joint;
+                return std::isnan(value) ? -std::numeric_limits<double>::infinity() : value;
+            };
+
+            const double direction = (log_ratio() > std::log(0.5)) ? +1.0 : -1.0;
+            for (auto i = 0u ; i < 100 ; ++i)
+            {
+                if (direction * log_ratio() <= -direction * std::log(2.0))
+                    break;
+
+                result *= std::pow(2.0, direction);
+            }
+
+            return result;
+        }
+
+        bool no_u_turn(const PhaseSpacePoint & minus, const PhaseSpacePoint & plus) const
+        {
+            const auto v_minus = velocity(minus.p);
+            const auto v_plus  = velocity(plus.p);
+
+            double dot_minus = 0.0, dot_plus = 0.0;
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                const double dq = plus.q[i] - minus.q[i];
+                dot_minus += dq * v_minus[i];
+                dot_plus  += dq * v_plus[i];
+            }
+
+            return (dot_minus >= 0.0) && (dot_plus >= 0.0);
+        }
+
+        // cf. [HG:2014A], algorithm 6
+        Tree build_tree(const PhaseSpacePoint & point, const double & log_u, const double & direction, const unsigned & depth, const double & joint_0)
+        {
+            if (0 == depth)
+            {
+                PhaseSpacePoint next = leapfrog(point, direction * epsilon);
+                const double joint = log_joint(next);
+                const bool finite = std::isfinite(joint);
+
+                Tree result{ next, next, next, 0.0, false, 0.0, 1u };
+                result.n     = (finite && (log_u <= joint)) ? 1.0 : 0.0;
+                result.valid = finite && (log_u < delta_max + joint);
+                result.alpha = finite ? std::min(1.0, std::exp(joint - joint_0)) : 0.0;
+
+                if (! result.valid)
+                    divergences += 1;
+
+                return result;
+            }
+
+            Tree result = build_tree(point, log_u, direction, depth - 1, joint_0);
+            if (! result.valid)
+                return result;
+
+            Tree next = (direction < 0.0)
+                ? build_tree(result.minus, log_u, direction, depth - 1, joint_0)
+                : build_tree(result.plus,  log_u, direction, depth - 1, joint_0);
+
+            if (direction < 0.0)
+                result.minus = next.minus;
+            else
+                result.plus = next.plus;
+
+            if ((next.n > 0.0) && (gsl_rng_uniform(rng) < next.n / (result.n + next.n)))
+                result.proposal = next.proposal;
+
+            result.alpha   += next.alpha;
+            result.n_alpha += next.n_alpha;
+            result.n       += next.n;
+            result.valid    = next.valid && no_u_turn(result.minus, result.plus);
+
+            return result;
+        }
+
+        // perform one transition of the chain, and return the acceptance statistic
+        double transition()
+        {
+            draw_momentum(current);
+
+            const double joint_0 = log_joint(current);
+            const double log_u = joint_0 - gsl_ran_exponential(rng, 1.0);
+
+            PhaseSpacePoint minus(current), plus(current);
+            PhaseSpacePoint proposal(current);
+
+            double n = 1.0, alpha = 0.0;
+            unsigned n_alpha = 0;
+            bool valid = true;
+
+            for (auto depth = 0u ; valid && (depth < config.max_tree_depth()) ; ++depth)
+            {
+                const double direction = (gsl_rng_uniform(rng) < 0.5) ? -1.0 : +1.0;
+
+                Tree tree = (direction < 0.0)
+                    ? build_tree(minus, log_u, direction, depth, joint_0)
+                    : build_tree(plus,  log_u, direction, depth, joint_0);
+
+                if (direction < 0.0)
+                    minus = tree.minus;
+                else
+                    plus = tree.plus;
+
+                if (tree.valid && (gsl_rng_uniform(rng) < tree.n / n))
+                    proposal = tree.proposal;
+
+                n      += tree.n;
+                alpha   = tree.alpha;
+                n_alpha = tree.n_alpha;
+                valid   = tree.valid && no_u_turn(minus, plus);
+            }
+
+            current = proposal;
+
+            return (n_alpha > 0) ? alpha / n_alpha : 0.0;
+        }
+
+        // set the parameters of the posterior to the current point
+        void restore_current()
+        {
+            for (auto i = 0u ; i < dim ; ++i)
+            {
+                parameters[i].set(current.x[i]);
+            }
+        }
+
+        void update_metric(const std::vector<double> & m2, const unsigned & n)
+        {
+            // regularize towards the unit matrix, following Stan
+            const double shrinkage = 5.0 / (n + 5.0), scale = n / ((n + 5.0) * (n - 1.0));
+
+            if (config.dense_mass_matrix())
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    for (auto j = 0u ; j < dim ; ++j)
+                    {
+                        metric[i * dim + j] = scale * m2[i * dim + j] + ((i == j) ? 1.0e-3 * shrinkage : 0.0);
+                    }
+                }
+
+                gsl_matrix * chol = gsl_matrix_alloc(dim, dim);
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    for (auto j = 0u ; j < dim ; ++j)
+                    {
+                        gsl_matrix_set(chol, i, j, metric[i * dim + j]);
+                    }
+                }
+
+                if (GSL_SUCCESS != GSL_LINALG_CHOLESKY_DECOMP(chol))
+                {
+                    gsl_matrix_free(chol);
+                    Log::instance()->message("NoUTurnSampler::adapt", ll_warning)
+                        << "Cholesky decomposition of the estimated mass matrix failed; resetting to the unit matrix";
+                    reset_metric();
+
+                    return;
+                }
+
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    for (auto j = 0u ; j < dim ; ++j)
+                    {
+                        metric_cholesky[i * dim + j] = (j <= i) ? gsl_matrix_get(chol, i, j) : 0.0;
+                    }
+                }
+                gsl_matrix_free(chol);
+            }
+            else
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    metric[i] = scale * m2[i] + 1.0e-3 * shrinkage;
+                }
+            }
+        }
+
+        void adapt(const unsigned & n)
+        {
+            implementation::DualAveraging dual_averaging(config.target_acceptance());
+            dual_averaging.restart(epsilon);
+
+            // windows: a fast initial phase (step size only), slow windows of
+            // doubling length (step size and mass matrix), and a fast final phase
+            const unsigned init_buffer = 0.15 * n, term_buffer = 0.1 * n;
+            const bool adapt_metric = (n >= 20u) && (n > init_buffer + term_buffer);
+            unsigned window_size = std::max(25u, n / 20u), window_end = init_buffer + window_size;
+
+            const unsigned vector_size = config.dense_mass_matrix() ? dim * dim : dim;
+            std::vector<double> mean(dim, 0.0), m2(vector_size, 0.0);
+            unsigned window_count = 0;
+
+            double acceptance_sum = 0.0;
+            divergences = 0;
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                const double acceptance = transition();
+                acceptance_sum += acceptance;
+                epsilon = dual_averaging.update(acceptance);
+
+                const bool in_slow_phase = adapt_metric && (init_buffer <= i) && (i < n - term_buffer);
+                if (! in_slow_phase)
+                    continue;
+
+                // Welford's online algorithm for the sample covariance
+                window_count += 1;
+                std::vector<double> delta(dim);
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    delta[j] = current.q[j] - mean[j];
+                    mean[j] += delta[j] / window_count;
+                }
+
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    if (config.dense_mass_matrix())
+                    {
+                        for (auto k = 0u ; k < dim ; ++k)
+                        {
+                            m2[j * dim + k] += delta[j] * (current.q[k] - mean[k]);
+                        }
+                    }
+                    else
+                    {
+                        m2[j] += delta[j] * (current.q[j] - mean[j]);
+                    }
+                }
+
+                // the last window extends to the end of the slow phase
+                if ((i + 1 == window_end) || (i + 1 == n - term_buffer))
+                {
+                    if (window_end + 2 * window_size > n - term_buffer)
+                        window_end = n - term_buffer;
+                    else
+                        window_end += 2 * window_size;
+                    window_size *= 2;
+
+                    if (window_count > 2)
+                    {
+                        update_metric(m2, window_count);
+                        epsilon = find_reasonable_step_size(current);
+                        dual_averaging.restart(epsilon);
+                    }
+
+                    mean.assign(dim, 0.0);
+                    m2.assign(vector_size, 0.0);
+                    window_count = 0;
+                }
+            }
+
+            if (n > 0)
+            {
+                epsilon = dual_averaging.final();
+                acceptance_rate = acceptance_sum / n;
+            }
+
+            restore_current();
+        }
+
+        std::vector<std::vector<double>> sample(const unsigned & n)
+        {
+            std::vector<std::vector<double>> result;
+            result.reserve(n);
+
+            double acceptance_sum = 0.0;
+            divergences = 0;
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                acceptance_sum += transition();
+                result.push_back(current.x);
+            }
+
+            if (n > 0)
+                acceptance_rate = acceptance_sum / n;
+
+            restore_current();
+
+            return result;
+        }
+    };
+
+    NoUTurnSampler::NoUTurnSampler(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<NoUTurnSampler>(new Implementation<NoUTurnSampler>(log_posterior, config))
+    {
+    }
+
+    NoUTurnSampler::~NoUTurnSampler()
+    {
+    }
+
+    void
+    NoUTurnSampler::adapt(const unsigned & n)
+    {
+        _imp->adapt(n);
+    }
+
+    std::vector<std::vector<double>>
+    NoUTurnSampler::sample(const unsigned & n)
+    {
+        return _imp->sample(n);
+    }
+
+    double
+    NoUTurnSampler::step_size() const
+    {
+        return _imp->epsilon;
+    }
+
+    std::vector<std::vector<double>>
+    NoUTurnSampler::inverse_mass_matrix() const
+    {
+        const unsigned dim = _imp->dim;
+        std::vector<std::vector<double>> result(dim, std::vector<double>(dim, 0.0));
+
+        for (auto i = 0u ; i < dim ; ++i)
+        {
+            if (_imp->config.dense_mass_matrix())
+            {
+                for (auto j = 0u ; j < dim ; ++j)
+                {
+                    result[i][j] = _imp->metric[i * dim + j];
+                }
+            }
+            else
+            {
+                result[i][i] = _imp->metric[i];
+            }
+        }
+
+        return result;
+    }
+
+    double
+    NoUTurnSampler::acceptance_rate() const
+    {
+        return _imp->acceptance_rate;
+    }
+
+    unsigned
+    NoUTurnSampler::divergences() const
+    {
+        return _imp->divergences;
+    }
+}
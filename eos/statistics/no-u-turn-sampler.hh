@@ -0,0 +1,143 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_NO_U_TURN_SAMPLER_HH
+#define EOS_GUARD_EOS_STATISTICS_NO_U_TURN_SAMPLER_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * NoUTurnSampler draws samples from a LogPosterior using the No-U-Turn variant
+     * of Hamiltonian Monte Carlo [HG:2014A].
+     *
+     * During adaptation, the step size is tuned by dual averaging, and the (inverse) mass
+     * matrix is estimated from the sample covariance within windows of increasing length.
+     *
+     * By default, the sampler operates on the generator values of the priors, i.e., the
+     * cumulative probabilities used by LogPrior::sample(). These are mapped onto the real line
+     * through the inverse CDF of the standard normal distribution, such that the support of
+     * all priors is respected automatically.
+     *
+     * @note The sampler changes the values of the varied parameters of the posterior.
+     */
+    class NoUTurnSampler :
+        public PrivateImplementationPattern<NoUTurnSampler>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// The target of the mean acceptance statistic for the step-size adaptation.
+                    double target_acceptance() const;
+                    Config & target_acceptance(const double & x);
+
+                    /// The maximal depth of the trajectory's binary tree.
+                    unsigned max_tree_depth() const;
+                    Config & max_tree_depth(const unsigned & x);
+
+                    /// Adapt a dense rather than a diagonal mass matrix.
+                    bool dense_mass_matrix() const;
+                    Config & dense_mass_matrix(const bool & x);
+
+                    /// Sample the generator values rather than the parameters themselves.
+                    bool generator_space() const;
+                    Config & generator_space(const bool & x);
+
+                    /*!
+                     * Compute gradients with NumericalDerivatives rather than with LogPosterior::evaluate_with_gradient().
+                     *
+                     * This is the default, since most observables do not provide their gradients yet; for those,
+                     * evaluate_with_gradient() falls back to finite differences that are not cheaper than NumericalDerivatives.
+                     */
+                    bool finite_differences() const;
+                    Config & finite_differences(const bool & x);
+
+                    /// The seed of the random number generator.
+                    unsigned long seed() const;
+                    Config & seed(const unsigned long & x);
+
+                private:
+                    double _target_acceptance;
+                    unsigned _max_tree_depth;
+                    bool _dense_mass_matrix;
+                    bool _generator_space;
+                    bool _finite_differences;
+                    unsigned long _seed;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * The chain starts at the current values of the posterior's varied parameters.
+             *
+             * @param log_posterior The posterior from which samples shall be drawn.
+             * @param config        The configuration of the sampler.
+             */
+            NoUTurnSampler(const LogPosterior & log_posterior, const Config & config = Config());
+
+            /// Destructor.
+            ~NoUTurnSampler();
+            ///@}
+
+            ///@name Sampling
+            ///@{
+            /*!
+             * Adapt the step size and the mass matrix.
+             *
+             * @param n The number of adaptation steps.
+             */
+            void adapt(const unsigned & n);
+
+            /*!
+             * Draw samples from the posterior.
+             *
+             * @param n The number of samples.
+             *
+             * @return The values of the varied parameters, in the order of LogPosterior::varied_parameters(), for each sample.
+             */
+            std::vector<std::vector<double>> sample(const unsigned & n);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the current step size.
+            double step_size() const;
+
+            /// Retrieve the current inverse mass matrix, in the space in which the sampler operates.
+            std::vector<std::vector<double>> inverse_mass_matrix() const;
+
+            /// Retrieve the mean acceptance statistic of the last call to adapt() or sample().
+            double acceptance_rate() const;
+
+            /// Retrieve the number of divergent trajectories in the last call to adapt() or sample().
+            unsigned divergences() const;
+            ///@}
+    };
+}
+
+#endif
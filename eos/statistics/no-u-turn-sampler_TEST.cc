@@ -0,0 +1,104 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/no-u-turn-sampler.hh>
+
+#include <cmath>
+
+using namespace test;
+using namespace eos;
+
+namespace
+{
+    std::pair<double, double> mean_and_sigma(const std::vector<std::vector<double>> & samples)
+    {
+        double sum = 0.0, sum_of_squares = 0.0;
+        for (const auto & s : samples)
+        {
+            sum += s[0];
+            sum_of_squares += s[0] * s[0];
+        }
+
+        const double mean = sum / samples.size();
+        const double variance = sum_of_squares / samples.size() - mean * mean;
+
+        return std::make_pair(mean, std::sqrt(variance));
+    }
+}
+
+class NoUTurnSamplerTest :
+    public TestCase
+{
+    public:
+        NoUTurnSamplerTest() :
+            TestCase("no_u_turn_sampler_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // numerical gradients by default
+            TEST_CHECK(NoUTurnSampler::Config().finite_differences());
+
+            // Gaussian likelihood (4.2 +/- 0.1) and Gaussian prior (4.4 +/- 0.1):
+            // the posterior is Gaussian with mean 4.3 and width 0.1 / sqrt(2)
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+
+                NoUTurnSampler sampler(log_posterior);
+                sampler.adapt(500);
+                TEST_CHECK(sampler.step_size() > 0.0);
+                TEST_CHECK_EQUAL(sampler.inverse_mass_matrix().size(), 1u);
+
+                const auto samples = sampler.sample(2000);
+                TEST_CHECK_EQUAL(samples.size(), 2000u);
+                TEST_CHECK(sampler.acceptance_rate() > 0.5);
+                TEST_CHECK_EQUAL(sampler.divergences(), 0u);
+
+                const auto result = mean_and_sigma(samples);
+                TEST_CHECK_NEARLY_EQUAL(result.first,  4.3,                0.01);
+                TEST_CHECK_RELATIVE_ERROR(result.second, 0.1 / std::sqrt(2.0), 0.1);
+            }
+
+            // Gaussian likelihood (4.2 +/- 0.1) and flat prior, sampled in parameter space
+            // with a dense mass matrix and gradients from LogPosterior::evaluate_with_gradient()
+            {
+                LogPosterior log_posterior = make_log_posterior(true);
+                log_posterior[0].set(4.25);
+
+                NoUTurnSampler sampler(log_posterior, NoUTurnSampler::Config()
+                        .generator_space(false)
+                        .dense_mass_matrix(true)
+                        .finite_differences(false));
+                sampler.adapt(500);
+
+                const auto samples = sampler.sample(2000);
+                TEST_CHECK_EQUAL(sampler.divergences(), 0u);
+
+                const auto result = mean_and_sigma(samples);
+                TEST_CHECK_NEARLY_EQUAL(result.first,  4.2, 0.01);
+                TEST_CHECK_RELATIVE_ERROR(result.second, 0.1, 0.1);
+
+                // the inverse mass matrix approximates the posterior variance
+                TEST_CHECK_RELATIVE_ERROR(sampler.inverse_mass_matrix()[0][0], 0.01, 0.5);
+            }
+        }
+} no_u_turn_sampler_test;
@@ -0,0 +1,303 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/maths/derivative.hh>
+#include <eos/statistics/numerical-derivatives.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <utility>
+
+namespace eos
+{
+    template <>
+    struct Implementation<NumericalDerivatives>
+    {
+        // A point is described by the shifts of one or more varied parameters away from their current values
+        using Point = std::vector<std::pair<unsigned, double>>;
+
+        LogPosterior log_posterior;
+
+        // Ids of the varied parameters, which are common to the original posterior and its clones
+        std::vector<Parameter::Id> ids;
+
+        // One independent clone of the posterior per thread, and its varied parameters
+        std::vector<LogPosteriorPtr> clones;
+        std::vector<std::vector<Parameter>> clone_parameters;
+
+        Implementation(const LogPosterior & log_posterior) :
+            log_posterior(log_posterior)
+        {
+            for (const auto & p : log_posterior.varied_parameters())
+            {
+                ids.push_back(p.id());
+            }
+
+            const unsigned number_of_clones = std::max(1u, ThreadPool::instance()->number_of_threads());
+            for (auto c = 0u ; c < number_of_clones ; ++c)
+            {
+                clones.push_back(log_posterior.clone());
+                clone_parameters.push_back(clones.back()->varied_parameters());
+            }
+        }
+
+        ~Implementation() = default;
+
+        // evaluate a chunk of points serially on one of the clones
+        void evaluate_chunk(const unsigned & c, const std::vector<double> & x0, const std::vector<Point> & points,
+                const unsigned & begin, const unsigned & end, const bool & with_prior, std::vector<double> & results) const
+        {
+            const auto & clone = *clones[c];
+            auto parameters    = clone_parameters[c];
+            auto llh           = clone.log_likelihood();
+
+            // synchronize the clone with the original posterior
+            std::vector<Parameter::Id> changed;
+            for (auto i = 0u ; i < x0.size() ; ++i)
+            {
+                if (parameters[i].evaluate() == x0[i])
+                    continue;
+
+                parameters[i].set(x0[i]);
+                changed.push_back(ids[i]);
+            }
+
+            for (auto k = begin ; k < end ; ++k)
+            {
+                for (const auto & shift : points[k])
+                {
+                    parameters[shift.first].set(x0[shift.first] + shift.second);
+                    changed.push_back(ids[shift.first]);
+                }
+
+                results[k] = llh(changed);
+                if (with_prior)
+                    results[k] += clone.log_prior();
+
+                // restore the original values; the observables are updated along with the next point
+                changed.clear();
+                for (const auto & shift : points[k])
+                {
+                    parameters[shift.first].set(x0[shift.first]);
+                    changed.push_back(ids[shift.first]);
+                }
+            }
+
+            // leave the clone in a consistent state
+            if (! changed.empty())
+                llh(changed);
+        }
+
+        // evaluate all points concurrently
+        std::vector<double> evaluate(const std::vector<double> & x0, const std::vector<Point> & points, const bool & with_prior) const
+        {
+            std::vector<double> results(points.size(), 0.0);
+
+            const unsigned chunk_size = (points.size() + clones.size() - 1) / clones.size();
+
+            std::vector<Ticket> tickets;
+            tickets.reserve(clones.size());
+            for (auto c = 0u ; c < clones.size() ; ++c)
+            {
+                const unsigned begin = std::min<unsigned>(c * chunk_size, points.size());
+                const unsigned end   = std::min<unsigned>(begin + chunk_size, points.size());
+                if (begin == end)
+                    break;
+
+                auto f = [&, c, begin, end]() { this->evaluate_chunk(c, x0, points, begin, end, with_prior, results); };
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(f)));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            return results;
+        }
+
+        std::vector<double> current_values() const
+        {
+            std::vector<double> result;
+            for (const auto & p : log_posterior.varied_parameters())
+            {
+                result.push_back(p.evaluate());
+            }
+
+            return result;
+        }
+
+        std::vector<double> gradient() const
+        {
+            using Stencil = deriv::TwoSidedStencil<1u>;
+
+            const auto x0 = current_values();
+            const unsigned n = x0.size();
+
+            std::vector<double> steps(n);
+            std::vector<Point> points;
+            points.reserve(n * Stencil::offsets.size());
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                steps[i] = Stencil::step(x0[i]);
+
+                for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+                {
+                    points.push_back(Point{ { i, Stencil::offsets[k] * steps[i] } });
+                }
+            }
+
+            const auto values = evaluate(x0, points, true);
+
+            std::vector<double> result(n, 0.0);
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+                {
+                    result[i] += Stencil::weights[k] * values[i * Stencil::offsets.size() + k];
+                }
+                result[i] /= Stencil::denominator * steps[i];
+            }
+
+            return result;
+        }
+
+        std::vector<std::vector<double>> hessian(const bool & with_prior) const
+        {
+            // the diagonal elements use the second-order stencil; the off-diagonal
+            // elements use the tensor product of two first-order stencils.
+            using Stencil1 = deriv::TwoSidedStencil<1u>;
+            using Stencil2 = deriv::TwoSidedStencil<2u>;
+
+            const auto x0 = current_values();
+            const unsigned n = x0.size();
+
+            // the first-order stencil is used for second derivatives, hence the step size of the second-order stencil
+            std::vector<double> steps(n);
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                steps[i] = Stencil2::step(x0[i]);
+            }
+
+            // the unperturbed point comes first
+            std::vector<Point> points{ Point{} };
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                for (auto k = 0u ; k < Stencil2::offsets.size() ; ++k)
+                {
+                    if (0.0 == Stencil2::offsets[k])
+                        continue;
+
+                    points.push_back(Point{ { i, Stencil2::offsets[k] * steps[i] } });
+                }
+            }
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                for (auto j = i + 1 ; j < n ; ++j)
+                {
+                    for (auto k = 0u ; k < Stencil1::offsets.size() ; ++k)
+                    {
+                        for (auto l = 0u ; l < Stencil1::offsets.size() ; ++l)
+                        {
+                            points.push_back(Point{ { i, Stencil1::offsets[k] * steps[i] }, { j, Stencil1::offsets[l] * steps[j] } });
+                        }
+                    }
+                }
+            }
+
+            const auto values = evaluate(x0, points, with_prior);
+
+            std::vector<std::vector<double>> result(n, std::vector<double>(n, 0.0));
+            auto v = values.cbegin() + 1;
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                for (auto k = 0u ; k < Stencil2::offsets.size() ; ++k)
+                {
+                    if (0.0 == Stencil2::offsets[k])
+                    {
+                        result[i][i] += Stencil2::weights[k] * values.front();
+                        continue;
+                    }
+
+                    result[i][i] += Stencil2::weights[k] * *v;
+                    ++v;
+                }
+                result[i][i] /= Stencil2::denominator * steps[i] * steps[i];
+            }
+
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                for (auto j = i + 1 ; j < n ; ++j)
+                {
+                    for (auto k = 0u ; k < Stencil1::offsets.size() ; ++k)
+                    {
+                        for (auto l = 0u ; l < Stencil1::offsets.size() ; ++l)
+                        {
+                            result[i][j] += Stencil1::weights[k] * Stencil1::weights[l] * *v;
+                            ++v;
+                        }
+                    }
+                    result[i][j] /= Stencil1::denominator * Stencil1::denominator * steps[i] * steps[j];
+                    result[j][i] = result[i][j];
+                }
+            }
+
+            return result;
+        }
+    };
+
+    NumericalDerivatives::NumericalDerivatives(const LogPosterior & log_posterior) :
+        PrivateImplementationPattern<NumericalDerivatives>(new Implementation<NumericalDerivatives>(log_posterior))
+    {
+    }
+
+    NumericalDerivatives::~NumericalDerivatives()
+    {
+    }
+
+    std::vector<double>
+    NumericalDerivatives::gradient() const
+    {
+        return _imp->gradient();
+    }
+
+    std::vector<std::vector<double>>
+    NumericalDerivatives::hessian() const
+    {
+        return _imp->hessian(true);
+    }
+
+    std::vector<std::vector<double>>
+    NumericalDerivatives::fisher_matrix() const
+    {
+        auto result = _imp->hessian(false);
+
+        for (auto & row : result)
+        {
+            for (auto & element : row)
+            {
+                element = -element;
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,74 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_NUMERICAL_DERIVATIVES_HH
+#define EOS_GUARD_EOS_STATISTICS_NUMERICAL_DERIVATIVES_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * NumericalDerivatives computes the derivatives of a LogPosterior with respect
+     * to its varied parameters by means of two-sided finite differences.
+     *
+     * The perturbed points are evaluated concurrently in the ThreadPool, using one
+     * independent clone of the posterior per thread. For each perturbed point, only
+     * those observables that depend on the perturbed parameters are recomputed.
+     *
+     * @note The derivatives are computed at the current values of the varied parameters
+     *       of the original posterior. Changes to any other parameter of the original posterior
+     *       after construction are not propagated.
+     * @note None of the methods must be called from within a job of the ThreadPool.
+     */
+    class NumericalDerivatives :
+        public PrivateImplementationPattern<NumericalDerivatives>
+    {
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The posterior whose derivatives shall be computed.
+             */
+            NumericalDerivatives(const LogPosterior & log_posterior);
+
+            /// Destructor.
+            ~NumericalDerivatives();
+            ///@}
+
+            ///@name Derivatives
+            ///@{
+            /// Compute the gradient of the log(posterior).
+            std::vector<double> gradient() const;
+
+            /// Compute the Hessian matrix of the log(posterior).
+            std::vector<std::vector<double>> hessian() const;
+
+            /// Compute the observed Fisher information matrix, i.e., the negative Hessian matrix of the log(likelihood).
+            std::vector<std::vector<double>> fisher_matrix() const;
+            ///@}
+    };
+}
+
+#endif
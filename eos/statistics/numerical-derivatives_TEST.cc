@@ -0,0 +1,100 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/numerical-derivatives.hh>
+
+using namespace test;
+using namespace eos;
+
+class NumericalDerivativesTest :
+    public TestCase
+{
+    public:
+        NumericalDerivativesTest() :
+            TestCase("numerical_derivatives_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            static const double eps = 1e-5;
+
+            // one parameter, with Gaussian likelihood and Gaussian prior
+            {
+                LogPosterior log_posterior = make_log_posterior(false);
+                Parameter p = log_posterior[0];
+                p.set(4.35);
+
+                NumericalDerivatives derivatives(log_posterior);
+
+                // d/dm log(likelihood) = -(m - 4.2) / 0.1^2, d/dm log(prior) = -(m - 4.4) / 0.1^2
+                const auto gradient = derivatives.gradient();
+                TEST_CHECK_EQUAL(gradient.size(), 1u);
+                TEST_CHECK_NEARLY_EQUAL(gradient[0],      -10.0, eps);
+
+                const auto hessian = derivatives.hessian();
+                TEST_CHECK_EQUAL(hessian.size(), 1u);
+                TEST_CHECK_RELATIVE_ERROR(hessian[0][0], -200.0, eps);
+
+                const auto fisher_matrix = derivatives.fisher_matrix();
+                TEST_CHECK_EQUAL(fisher_matrix.size(), 1u);
+                TEST_CHECK_RELATIVE_ERROR(fisher_matrix[0][0], 100.0, eps);
+
+                // changes to the original posterior are picked up
+                p.set(4.25);
+                TEST_CHECK_NEARLY_EQUAL(derivatives.gradient()[0], 10.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(double(p), 4.25, 0.0);
+            }
+
+            // two parameters, with independent observables
+            {
+                Parameters parameters = Parameters::Defaults();
+
+                LogLikelihood llh(parameters);
+                llh.add(ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)")), 4.1, 4.2, 4.3);
+                llh.add(ObservablePtr(new TestObservable(parameters, Kinematics(), "mass::c")), 1.2, 1.25, 1.3);
+
+                LogPosterior log_posterior(llh);
+                log_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+                log_posterior.add(LogPrior::Flat(parameters, "mass::c", ParameterRange{ 1.0, 1.5 }));
+                log_posterior[0].set(4.15);
+                log_posterior[1].set(1.30);
+
+                NumericalDerivatives derivatives(log_posterior);
+
+                const auto gradient = derivatives.gradient();
+                TEST_CHECK_EQUAL(gradient.size(), 2u);
+                TEST_CHECK_NEARLY_EQUAL(gradient[0],   +5.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(gradient[1],  -20.0, eps);
+
+                const auto hessian = derivatives.hessian();
+                TEST_CHECK_EQUAL(hessian.size(), 2u);
+                TEST_CHECK_RELATIVE_ERROR(hessian[0][0], -100.0, eps);
+                TEST_CHECK_NEARLY_EQUAL(hessian[0][1],      0.0, 1e-3);
+                TEST_CHECK_NEARLY_EQUAL(hessian[1][0],      0.0, 1e-3);
+                TEST_CHECK_RELATIVE_ERROR(hessian[1][1], -400.0, eps);
+
+                const auto fisher_matrix = derivatives.fisher_matrix();
+                TEST_CHECK_RELATIVE_ERROR(fisher_matrix[0][0], 100.0, eps);
+                TEST_CHECK_RELATIVE_ERROR(fisher_matrix[1][1], 400.0, eps);
+            }
+        }
+} numerical_derivatives_test;
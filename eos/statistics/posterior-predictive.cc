@@ -0,0 +1,259 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/posterior-predictive.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/stringify.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+
+namespace eos
+{
+    PosteriorPredictive::Config::Config() :
+        _chunk_size(1000)
+    {
+    }
+
+    unsigned
+    PosteriorPredictive::Config::chunk_size() const
+    {
+        return _chunk_size;
+    }
+
+    PosteriorPredictive::Config &
+    PosteriorPredictive::Config::chunk_size(const unsigned & x)
+    {
+        _chunk_size = x;
+        return *this;
+    }
+
+    namespace impl
+    {
+        // the state of a single thread: an independent clone of the parameters and of the cache
+        struct PosteriorPredictiveWorker
+        {
+            Parameters parameters;
+
+            ObservableCache cache;
+
+            std::vector<Parameter> varied_parameters;
+
+            const std::vector<Parameter::Id> & ids;
+
+            const std::vector<ObservableCache::Id> & observables;
+
+            PosteriorPredictiveWorker(const ObservableCache & original, const std::vector<ObservableCache::Id> & observables, const std::vector<Parameter::Id> & ids) :
+                parameters(original.parameters().clone()),
+                cache(original.clone(parameters)),
+                ids(ids),
+                observables(observables)
+            {
+                for (const auto & id : ids)
+                {
+                    varied_parameters.push_back(parameters[id]);
+                }
+            }
+
+            // the observables are updated serially, since we are already running within the ThreadPool
+            void run(const double * samples, const unsigned & begin, const unsigned & end, double * results)
+            {
+                const unsigned p_dim = varied_parameters.size(), o_dim = observables.size();
+
+                for (auto i = begin ; i < end ; ++i)
+                {
+                    for (auto j = 0u ; j < p_dim ; ++j)
+                    {
+                        varied_parameters[j].set(samples[i * p_dim + j]);
+                    }
+
+                    cache.update(ids);
+
+                    for (auto j = 0u ; j < o_dim ; ++j)
+                    {
+                        results[i * o_dim + j] = cache[observables[j]];
+                    }
+                }
+            }
+        };
+
+        // write the header of a NumPy .npy file (format version 1.0) for a C-ordered two-dimensional array of doubles
+        void write_npy_header(std::ostream & output, const unsigned & rows, const unsigned & columns)
+        {
+            static_assert(std::endian::native == std::endian::little, "the .npy output assumes a little-endian platform");
+
+            std::string header = "{'descr': '<f8', 'fortran_order': False, 'shape': (" + stringify(rows) + ", " + stringify(columns) + "), }";
+
+            // the magic string, the version and the header length take up 10 bytes; the total length must be a multiple of 64 bytes
+            header.append(63 - (10 + header.size()) % 64, ' ');
+            header.push_back('\n');
+
+            const std::uint16_t size = header.size();
+            output.write("\x93NUMPY\x01\x00", 8);
+            output.put(static_cast<char>(size & 0xff));
+            output.put(static_cast<char>(size >> 8));
+            output.write(header.data(), header.size());
+        }
+    }
+
+    template <>
+    struct Implementation<PosteriorPredictive>
+    {
+        PosteriorPredictive::Config config;
+
+        std::vector<ObservableCache::Id> observables;
+
+        std::vector<Parameter::Id> parameters;
+
+        std::vector<std::unique_ptr<impl::PosteriorPredictiveWorker>> workers;
+
+        Implementation(const ObservableCache & cache, const std::vector<ObservableCache::Id> & observables,
+                const std::vector<Parameter::Id> & parameters, const PosteriorPredictive::Config & config) :
+            config(config),
+            observables(observables),
+            parameters(parameters)
+        {
+            if (0 == config.chunk_size())
+                throw InternalError("PosteriorPredictive: the chunk size must be positive");
+
+            if (observables.empty())
+                throw InternalError("PosteriorPredictive: no observables to predict");
+
+            for (const auto & id : observables)
+            {
+                if (id >= cache.size())
+                    throw InternalError("PosteriorPredictive: invalid observable id '" + stringify(id) + "'");
+            }
+
+            for (const auto & id : parameters)
+            {
+                // throws for invalid ids
+                cache.parameters()[id];
+            }
+
+            // each thread works on its own clone of the cache
+            const unsigned number_of_workers = std::max(1u, ThreadPool::instance()->number_of_threads());
+            for (auto w = 0u ; w < number_of_workers ; ++w)
+            {
+                workers.emplace_back(new impl::PosteriorPredictiveWorker(cache, this->observables, this->parameters));
+            }
+        }
+
+        void predict(const double * samples, const unsigned & n, double * results)
+        {
+            if (0 == n)
+                return;
+
+            // each thread evaluates a contiguous range of samples
+            const unsigned number_of_jobs = std::min<unsigned>(workers.size(), n);
+            const unsigned chunk = (n + number_of_jobs - 1) / number_of_jobs;
+
+            // failures within the jobs are passed on to the caller
+            std::vector<std::exception_ptr> errors(number_of_jobs);
+            std::vector<Ticket> tickets;
+            tickets.reserve(number_of_jobs);
+            for (auto w = 0u ; w < number_of_jobs ; ++w)
+            {
+                auto work = [&, w]()
+                {
+                    try
+                    {
+                        workers[w]->run(samples, w * chunk, std::min(n, (w + 1) * chunk), results);
+                    }
+                    catch (...)
+                    {
+                        errors[w] = std::current_exception();
+                    }
+                };
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(work)));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            for (const auto & error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        void predict(const double * samples, const unsigned & n, const std::string & path)
+        {
+            std::ofstream output(path, std::ios::binary | std::ios::trunc);
+            if (! output)
+                throw InternalError("PosteriorPredictive: cannot open file '" + path + "' for writing");
+
+            impl::write_npy_header(output, n, observables.size());
+
+            std::vector<double> buffer(std::min(n, config.chunk_size()) * observables.size());
+            for (auto begin = 0u ; begin < n ; begin += config.chunk_size())
+            {
+                const unsigned size = std::min(n - begin, config.chunk_size());
+                predict(samples + begin * parameters.size(), size, buffer.data());
+
+                output.write(reinterpret_cast<const char *>(buffer.data()), size * observables.size() * sizeof(double));
+                if (! output)
+                    throw InternalError("PosteriorPredictive: cannot write to file '" + path + "'");
+            }
+        }
+    };
+
+    PosteriorPredictive::PosteriorPredictive(const ObservableCache & cache, const std::vector<ObservableCache::Id> & observables,
+            const std::vector<Parameter::Id> & parameters, const Config & config) :
+        PrivateImplementationPattern<PosteriorPredictive>(new Implementation<PosteriorPredictive>(cache, observables, parameters, config))
+    {
+    }
+
+    PosteriorPredictive::~PosteriorPredictive()
+    {
+    }
+
+    unsigned
+    PosteriorPredictive::number_of_observables() const
+    {
+        return _imp->observables.size();
+    }
+
+    unsigned
+    PosteriorPredictive::number_of_parameters() const
+    {
+        return _imp->parameters.size();
+    }
+
+    void
+    PosteriorPredictive::predict(const double * samples, const unsigned & n, double * results)
+    {
+        _imp->predict(samples, n, results);
+    }
+
+    void
+    PosteriorPredictive::predict(const double * samples, const unsigned & n, const std::string & path)
+    {
+        _imp->predict(samples, n, path);
+    }
+}
@@ -0,0 +1,122 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_POSTERIOR_PREDICTIVE_HH
+#define EOS_GUARD_EOS_STATISTICS_POSTERIOR_PREDICTIVE_HH 1
+
+#include <eos/utils/observable_cache.hh>
+#include <eos/utils/parameters.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <string>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * PosteriorPredictive evaluates a set of observables for a sequence of parameter samples,
+     * e.g., samples of a posterior.
+     *
+     * The samples are distributed over the threads of the ThreadPool, each of which uses its own
+     * clone of the ObservableCache. The clones are created once, in the constructor, and take
+     * over the values of all parameters that are not varied. Within each thread, only the
+     * observables that depend on the varied parameters are updated.
+     *
+     * Evaluations that fail yield NaN, cf. ObservableCache::update().
+     *
+     * @note The cache passed to the constructor is not modified.
+     */
+    class PosteriorPredictive :
+        public PrivateImplementationPattern<PosteriorPredictive>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// The number of samples that are evaluated and held in memory at once when writing to a file.
+                    unsigned chunk_size() const;
+                    Config & chunk_size(const unsigned & x);
+
+                private:
+                    unsigned _chunk_size;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param cache       The cache that holds the observables.
+             * @param observables The ids of the observables to be predicted, in the order of the output columns.
+             * @param parameters  The ids of the varied parameters, in the order of the sample columns.
+             * @param config      The configuration.
+             */
+            PosteriorPredictive(const ObservableCache & cache, const std::vector<ObservableCache::Id> & observables,
+                    const std::vector<Parameter::Id> & parameters, const Config & config = Config());
+
+            /// Destructor.
+            ~PosteriorPredictive();
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the number of predicted observables.
+            unsigned number_of_observables() const;
+
+            /// Retrieve the number of varied parameters.
+            unsigned number_of_parameters() const;
+            ///@}
+
+            ///@name Prediction
+            ///@{
+            /*!
+             * Predict the observables for a sequence of samples.
+             *
+             * @param samples The values of the varied parameters, in row-major order, i.e.,
+             *                n rows of number_of_parameters() values.
+             * @param n       The number of samples.
+             * @param results The predictions, in row-major order, i.e.,
+             *                n rows of number_of_observables() values.
+             *
+             * @warning Must not be called from within a thread of the ThreadPool.
+             */
+            void predict(const double * samples, const unsigned & n, double * results);
+
+            /*!
+             * Predict the observables for a sequence of samples, and write the predictions to a file.
+             *
+             * The file uses the NumPy .npy format, and holds a two-dimensional array of shape
+             * (n, number_of_observables()) of double-precision numbers. The predictions are
+             * evaluated and written in chunks, cf. Config::chunk_size().
+             *
+             * @param samples The values of the varied parameters, in row-major order, i.e.,
+             *                n rows of number_of_parameters() values.
+             * @param n       The number of samples.
+             * @param path    The path of the output file, which is overwritten if it exists.
+             *
+             * @warning Must not be called from within a thread of the ThreadPool.
+             */
+            void predict(const double * samples, const unsigned & n, const std::string & path);
+            ///@}
+    };
+}
+
+#endif
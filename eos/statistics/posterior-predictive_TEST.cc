@@ -0,0 +1,200 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/observable.hh>
+#include <eos/statistics/posterior-predictive.hh>
+#include <eos/utils/exception.hh>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace test;
+using namespace eos;
+
+// fails for negative values of its parameter
+struct FailingObservable :
+    public Observable
+{
+    QualifiedName n;
+    Parameters p;
+    Parameter x;
+
+    FailingObservable(const Parameters & p) :
+        n("PosteriorPredictive::FailingObservable"),
+        p(p),
+        x(p["CKM::abs(V_cb)"])
+    {
+    }
+
+    virtual const QualifiedName & name() const { return n; }
+    virtual Parameters parameters() { return p; }
+    virtual Kinematics kinematics() { return Kinematics(); }
+    virtual Options options() { return Options(); }
+    virtual ObservablePtr clone() const { return ObservablePtr(new FailingObservable(p.clone())); }
+    virtual ObservablePtr clone(const Parameters & p) const { return ObservablePtr(new FailingObservable(p)); }
+
+    virtual double evaluate() const
+    {
+        if (x() < 0.0)
+            throw InternalError("FailingObservable: negative parameter");
+
+        return x();
+    }
+};
+
+class PosteriorPredictiveTest :
+    public TestCase
+{
+    public:
+        PosteriorPredictiveTest() :
+            TestCase("posterior_predictive_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            Parameters p = Parameters::Defaults();
+            Options o{ { "model", "CKM" }, { "form-factors", "BSZ2015" }, { "l", "mu" } };
+
+            ObservableCache cache(p);
+            std::vector<ObservablePtr> observables;
+            std::vector<ObservableCache::Id> ids;
+            for (const auto & q2 : { 1.0, 4.0, 9.0 })
+            {
+                observables.push_back(Observable::make("B->Dlnu::dBR/dq2", p, Kinematics{ { "q2", q2 } }, o));
+                ids.push_back(cache.add(observables.back()));
+            }
+            observables.push_back(Observable::make("B->Dlnu::BR", p, Kinematics{ { "q2_min", 1.0 }, { "q2_max", 9.0 } }, o));
+            ids.push_back(cache.add(observables.back()));
+            cache.update();
+
+            Parameter v_cb    = p["CKM::abs(V_cb)"];
+            Parameter alpha_0 = p["B->D::alpha^f+_0@BSZ2015"];
+            const double v_cb_central = v_cb.evaluate(), alpha_0_central = alpha_0.evaluate();
+
+            const std::vector<double> samples
+            {
+                0.040, 0.66,
+                0.041, 0.67,
+                0.042, 0.68,
+                0.043, 0.69,
+                0.044, 0.70,
+            };
+            const unsigned n = samples.size() / 2;
+
+            // serial reference values
+            std::vector<double> reference;
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                v_cb    = samples[2 * i + 0];
+                alpha_0 = samples[2 * i + 1];
+                for (const auto & observable : observables)
+                {
+                    reference.push_back(observable->evaluate());
+                }
+            }
+            v_cb    = v_cb_central;
+            alpha_0 = alpha_0_central;
+
+            PosteriorPredictive predictive(cache, ids, { v_cb.id(), alpha_0.id() }, PosteriorPredictive::Config().chunk_size(2));
+            TEST_CHECK_EQUAL(4u, predictive.number_of_observables());
+            TEST_CHECK_EQUAL(2u, predictive.number_of_parameters());
+
+            // predictions in memory
+            {
+                std::vector<double> results(n * 4);
+                predictive.predict(samples.data(), n, results.data());
+
+                for (auto i = 0u ; i < results.size() ; ++i)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(reference[i], results[i], 1.0e-12);
+                }
+
+                // the cache and its parameters are not modified
+                TEST_CHECK_EQUAL(v_cb_central,    v_cb.evaluate());
+                TEST_CHECK_EQUAL(alpha_0_central, alpha_0.evaluate());
+                TEST_CHECK_EQUAL(observables[0]->evaluate(), cache[ids[0]]);
+            }
+
+            // predictions written to a .npy file, in chunks of two samples
+            {
+                const std::string filename = "posterior-predictive_TEST.npy";
+                predictive.predict(samples.data(), n, filename);
+
+                std::ifstream file(filename, std::ios::binary);
+                TEST_CHECK(file.good());
+
+                std::string magic(8, '\0');
+                file.read(magic.data(), 8);
+                TEST_CHECK_EQUAL(std::string("\x93NUMPY\x01\x00", 8), magic);
+
+                std::uint16_t header_size = static_cast<unsigned char>(file.get());
+                header_size |= static_cast<unsigned char>(file.get()) << 8;
+                TEST_CHECK_EQUAL(0u, (10u + header_size) % 64u);
+
+                std::string header(header_size, '\0');
+                file.read(header.data(), header_size);
+                TEST_CHECK(std::string::npos != header.find("'descr': '<f8'"));
+                TEST_CHECK(std::string::npos != header.find("'shape': (5, 4)"));
+                TEST_CHECK_EQUAL('\n', header.back());
+
+                std::vector<double> results(n * 4);
+                file.read(reinterpret_cast<char *>(results.data()), results.size() * sizeof(double));
+                TEST_CHECK(file.good());
+                TEST_CHECK(EOF == file.peek());
+
+                for (auto i = 0u ; i < results.size() ; ++i)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(reference[i], results[i], 1.0e-12);
+                }
+
+                std::remove(filename.c_str());
+            }
+
+            // invalid arguments
+            {
+                TEST_CHECK_THROWS(InternalError, PosteriorPredictive(cache, { }, { v_cb.id() }));
+                TEST_CHECK_THROWS(InternalError, PosteriorPredictive(cache, { 17u }, { v_cb.id() }));
+                TEST_CHECK_THROWS(InternalError, PosteriorPredictive(cache, ids, { 1u << 30 }));
+                TEST_CHECK_THROWS(InternalError, PosteriorPredictive(cache, ids, { v_cb.id() }, PosteriorPredictive::Config().chunk_size(0)));
+            }
+
+            // failures of the observables are passed on to the caller
+            {
+                ObservableCache failing_cache(p);
+                const auto id = failing_cache.add(ObservablePtr(new FailingObservable(p)));
+                failing_cache.update();
+
+                PosteriorPredictive failing_predictive(failing_cache, { id }, { v_cb.id() });
+
+                const std::vector<double> failing_samples{ 0.040, 0.041, -0.042, 0.043 };
+                std::vector<double> results(failing_samples.size());
+                TEST_CHECK_THROWS(InternalError, failing_predictive.predict(failing_samples.data(), failing_samples.size(), results.data()));
+
+                // valid samples can still be predicted
+                failing_predictive.predict(failing_samples.data(), 2, results.data());
+                TEST_CHECK_EQUAL(0.040, results[0]);
+                TEST_CHECK_EQUAL(0.041, results[1]);
+            }
+        }
+} posterior_predictive_test;
@@ -0,0 +1,422 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <eos/statistics/pseudo-experiments.hh>
+#include <eos/constraint.hh>
+#include <eos/utils/exception.hh>
+#include <eos/utils/private_implementation_pattern-impl.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_multimin.h>
+#include <gsl/gsl_rng.h>
+
+namespace eos
+{
+    PseudoExperiments::Config::Config() :
+        _max_iterations(1000),
+        _tolerance(1.0e-5),
+        _step_size(0.5),
+        _seed(1234567u)
+    {
+    }
+
+    unsigned
+    PseudoExperiments::Config::max_iterations() const
+    {
+        return _max_iterations;
+    }
+
+    PseudoExperiments::Config &
+    PseudoExperiments::Config::max_iterations(const unsigned & x)
+    {
+        _max_iterations = x;
+        return *this;
+    }
+
+    double
+    PseudoExperiments::Config::tolerance() const
+    {
+        return _tolerance;
+    }
+
+    PseudoExperiments::Config &
+    PseudoExperiments::Config::tolerance(const double & x)
+    {
+        _tolerance = x;
+        return *this;
+    }
+
+    double
+    PseudoExperiments::Config::step_size() const
+    {
+        return _step_size;
+    }
+
+    PseudoExperiments::Config &
+    PseudoExperiments::Config::step_size(const double & x)
+    {
+        _step_size = x;
+        return *this;
+    }
+
+    unsigned long
+    PseudoExperiments::Config::seed() const
+    {
+        return _seed;
+    }
+
+    PseudoExperiments::Config &
+    PseudoExperiments::Config::seed(const unsigned long & x)
+    {
+        _seed = x;
+        return *this;
+    }
+
+    namespace impl
+    {
+        // the state of a single thread: an independent clone of the posterior, and the minimizer
+        struct PseudoExperimentWorker
+        {
+            LogPosteriorPtr log_posterior;
+
+            LogLikelihood log_likelihood;
+
+            std::vector<Parameter> parameters;
+
+            std::vector<Parameter::Id> ids;
+
+            const unsigned dim;
+
+            gsl_multimin_fminimizer * minimizer;
+
+            gsl_vector * start, * step;
+
+            gsl_rng * rng;
+
+            PseudoExperimentWorker(const LogPosterior & original) :
+                log_posterior(original.clone()),
+                log_likelihood(log_posterior->log_likelihood()),
+                parameters(log_posterior->varied_parameters()),
+                dim(parameters.size()),
+                minimizer(gsl_multimin_fminimizer_alloc(gsl_multimin_fminimizer_nmsimplex2, dim)),
+                start(gsl_vector_alloc(dim)),
+                step(gsl_vector_alloc(dim)),
+                rng(gsl_rng_alloc(gsl_rng_mt19937))
+            {
+                for (const auto & p : parameters)
+                {
+                    ids.push_back(p.id());
+                }
+            }
+
+            ~PseudoExperimentWorker()
+            {
+                gsl_rng_free(rng);
+                gsl_vector_free(step);
+                gsl_vector_free(start);
+                gsl_multimin_fminimizer_free(minimizer);
+            }
+
+            // set the parameters to the point z; returns false if z lies outside the prior support
+            bool set_parameters(const gsl_vector * z)
+            {
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    const double u = gsl_cdf_ugaussian_P(gsl_vector_get(z, i));
+                    if ((u <= 0.0) || (1.0 <= u))
+                        return false;
+
+                    parameters[i].set_generator(u);
+                }
+
+                for (auto p = log_posterior->begin_priors(), p_end = log_posterior->end_priors() ; p != p_end ; ++p)
+                {
+                    (*p)->sample();
+                }
+
+                return true;
+            }
+
+            // the observables are updated serially, since we are already running within the ThreadPool
+            double log_likelihood_value()
+            {
+                return log_likelihood(ids);
+            }
+
+            // the function to be minimized, i.e., -log(posterior) as a function of the probits of the generator values
+            static double negative_log_posterior(const gsl_vector * z, void * data)
+            {
+                auto w = static_cast<PseudoExperimentWorker *>(data);
+
+                if (! w->set_parameters(z))
+                    return std::numeric_limits<double>::max();
+
+                const double result = -(w->log_likelihood_value() + w->log_posterior->log_prior());
+                if (! std::isfinite(result))
+                    return std::numeric_limits<double>::max();
+
+                return result;
+            }
+
+            PseudoExperiments::Result run(const unsigned & index, const std::vector<double> & generating_point,
+                    const std::vector<double> & z_generating, const PseudoExperiments::Config & config)
+            {
+                PseudoExperiments::Result result;
+                result.index = index;
+
+                // compute the predictions at the generating point
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    parameters[i].set(generating_point[i]);
+                }
+                log_likelihood_value();
+
+                // replace the measurements by pseudo measurements
+                gsl_rng_set(rng, config.seed() + index);
+                for (const auto & constraint : log_likelihood)
+                {
+                    for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                    {
+                        (*b)->resample(rng);
+                    }
+                }
+
+                result.generating_log_likelihood = log_likelihood_value();
+
+                // fit the pseudo measurements, starting at the generating point
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    gsl_vector_set(start, i, z_generating[i]);
+                }
+                gsl_vector_set_all(step, config.step_size());
+
+                gsl_multimin_function f;
+                f.n = dim;
+                f.f = &PseudoExperimentWorker::negative_log_posterior;
+                f.params = static_cast<void *>(this);
+
+                gsl_multimin_fminimizer_set(minimizer, &f, start, step);
+
+                int status = GSL_CONTINUE;
+                result.iterations = 0;
+                while ((GSL_CONTINUE == status) && (result.iterations < config.max_iterations()))
+                {
+                    ++result.iterations;
+
+                    if (GSL_SUCCESS != gsl_multimin_fminimizer_iterate(minimizer))
+                        break;
+
+                    status = gsl_multimin_test_size(gsl_multimin_fminimizer_size(minimizer), config.tolerance());
+                }
+                result.converged = (GSL_SUCCESS == status);
+
+                // evaluate at the best-fit point
+                set_parameters(gsl_multimin_fminimizer_x(minimizer));
+                result.log_likelihood = log_likelihood_value();
+                result.log_posterior  = result.log_likelihood + log_posterior->log_prior();
+                result.test_statistic = -2.0 * (result.generating_log_likelihood - result.log_likelihood);
+
+                result.parameters.resize(dim);
+                for (auto i = 0u ; i < dim ; ++i)
+                {
+                    result.parameters[i] = parameters[i].evaluate();
+                }
+
+                return result;
+            }
+        };
+    }
+
+    template <>
+    struct Implementation<PseudoExperiments>
+    {
+        PseudoExperiments::Config config;
+
+        std::vector<std::string> names;
+
+        std::vector<double> generating_point;
+
+        // the probits of the generator values at the generating point
+        std::vector<double> z_generating;
+
+        std::vector<std::unique_ptr<impl::PseudoExperimentWorker>> workers;
+
+        std::vector<PseudoExperiments::Result> results;
+
+        Implementation(const LogPosterior & log_posterior, const PseudoExperiments::Config & config) :
+            config(config)
+        {
+            if (0 == config.max_iterations())
+                throw InternalError("PseudoExperiments: the maximal number of iterations must be positive");
+
+            if (! (config.tolerance() > 0.0))
+                throw InternalError("PseudoExperiments: the tolerance must be positive");
+
+            if (! (config.step_size() > 0.0))
+                throw InternalError("PseudoExperiments: the step size must be positive");
+
+            const auto & parameters = log_posterior.varied_parameters();
+            if (parameters.empty())
+                throw InternalError("PseudoExperiments: the posterior has no varied parameters");
+
+            // each pseudo experiment resamples all measurements
+            for (const auto & constraint : log_posterior.log_likelihood())
+            {
+                for (auto b = constraint.begin_blocks(), b_end = constraint.end_blocks() ; b != b_end ; ++b)
+                {
+                    if (! (*b)->resamplable())
+                        throw InternalError("PseudoExperiments: the measurement of constraint '" + constraint.name().str() + "' cannot be resampled");
+                }
+            }
+
+            for (const auto & p : parameters)
+            {
+                names.push_back(p.name());
+                generating_point.push_back(p.evaluate());
+            }
+
+            // each thread works on its own clone of the posterior
+            const unsigned number_of_workers = std::max(1u, ThreadPool::instance()->number_of_threads());
+            for (auto w = 0u ; w < number_of_workers ; ++w)
+            {
+                workers.emplace_back(new impl::PseudoExperimentWorker(log_posterior));
+
+                for (auto p = workers.back()->log_posterior->begin_priors(), p_end = workers.back()->log_posterior->end_priors() ; p != p_end ; ++p)
+                {
+                    (*p)->compute_cdf();
+                }
+            }
+
+            for (const auto & p : workers.front()->parameters)
+            {
+                z_generating.push_back(gsl_cdf_ugaussian_Pinv(p.evaluate_generator()));
+            }
+
+            if (! std::all_of(z_generating.cbegin(), z_generating.cend(), [] (const double & x) { return std::isfinite(x); }))
+                throw InternalError("PseudoExperiments: the generating point lies on the boundary of the prior support");
+        }
+
+        void run(const unsigned & n)
+        {
+            const unsigned first_index = results.size();
+            results.resize(first_index + n);
+
+            std::vector<std::exception_ptr> errors(workers.size());
+            std::vector<Ticket> tickets;
+            tickets.reserve(workers.size());
+            for (auto w = 0u ; (w < workers.size()) && (w < n) ; ++w)
+            {
+                auto work = [&, w]()
+                {
+                    try
+                    {
+                        for (auto t = w ; t < n ; t += workers.size())
+                        {
+                            results[first_index + t] = workers[w]->run(first_index + t, generating_point, z_generating, config);
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[w] = std::current_exception();
+                    }
+                };
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>(work)));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            for (const auto & error : errors)
+            {
+                if (error)
+                {
+                    results.resize(first_index);
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        void write(std::ostream & output) const
+        {
+            output << "# index converged iterations generating_log_likelihood log_likelihood log_posterior test_statistic";
+            for (const auto & name : names)
+            {
+                output << ' ' << name;
+            }
+            output << '\n';
+
+            const auto precision = output.precision(10);
+            for (const auto & r : results)
+            {
+                output << r.index << ' ' << r.converged << ' ' << r.iterations << ' '
+                       << r.generating_log_likelihood << ' ' << r.log_likelihood << ' ' << r.log_posterior << ' ' << r.test_statistic;
+                for (const auto & x : r.parameters)
+                {
+                    output << ' ' << x;
+                }
+                output << '\n';
+            }
+            output.precision(precision);
+        }
+    };
+
+    PseudoExperiments::PseudoExperiments(const LogPosterior & log_posterior, const Config & config) :
+        PrivateImplementationPattern<PseudoExperiments>(new Implementation<PseudoExperiments>(log_posterior, config))
+    {
+    }
+
+    PseudoExperiments::~PseudoExperiments()
+    {
+    }
+
+    void
+    PseudoExperiments::run(const unsigned & n)
+    {
+        _imp->run(n);
+    }
+
+    const std::vector<PseudoExperiments::Result> &
+    PseudoExperiments::results() const
+    {
+        return _imp->results;
+    }
+
+    const std::vector<double> &
+    PseudoExperiments::generating_point() const
+    {
+        return _imp->generating_point;
+    }
+
+    void
+    PseudoExperiments::write(std::ostream & output) const
+    {
+        _imp->write(output);
+    }
+}
@@ -0,0 +1,159 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_STATISTICS_PSEUDO_EXPERIMENTS_HH
+#define EOS_GUARD_EOS_STATISTICS_PSEUDO_EXPERIMENTS_HH 1
+
+#include <eos/statistics/log-posterior.hh>
+#include <eos/utils/private_implementation_pattern.hh>
+
+#include <iosfwd>
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * PseudoExperiments generates toy data sets for a LogPosterior and refits each of them.
+     *
+     * The toys are generated at the current values of the posterior's varied parameters, which
+     * are retained as the generating point. For each toy, the measurements of all LogLikelihoodBlock
+     * objects are replaced by pseudo measurements, cf. LogLikelihoodBlock::resample(), and the
+     * posterior is maximised with the Nelder-Mead simplex algorithm. The simplex operates in the
+     * space of the priors' generator values, mapped onto the real line through the inverse CDF of
+     * the standard normal distribution, such that the fit remains within the support of the prior.
+     *
+     * The toys are distributed over the threads of the ThreadPool, each of which uses its own clone
+     * of the posterior. Each toy uses an independent random number stream, such that the results
+     * only depend on the seed, and not on the number of threads.
+     *
+     * @note The posterior passed to the constructor is not modified.
+     */
+    class PseudoExperiments :
+        public PrivateImplementationPattern<PseudoExperiments>
+    {
+        public:
+            class Config
+            {
+                public:
+                    Config();
+
+                    /// The maximal number of simplex iterations per fit.
+                    unsigned max_iterations() const;
+                    Config & max_iterations(const unsigned & x);
+
+                    /// The size of the simplex, in units of the standard normal distribution, at which a fit is considered converged.
+                    double tolerance() const;
+                    Config & tolerance(const double & x);
+
+                    /// The initial step size of the simplex, in units of the standard normal distribution.
+                    double step_size() const;
+                    Config & step_size(const double & x);
+
+                    /// The seed of the random number generators.
+                    unsigned long seed() const;
+                    Config & seed(const unsigned long & x);
+
+                private:
+                    unsigned _max_iterations;
+                    double _tolerance;
+                    double _step_size;
+                    unsigned long _seed;
+            };
+
+            /// The outcome of a single pseudo experiment.
+            struct Result
+            {
+                /// The index of the toy, which determines its random number stream.
+                unsigned index;
+
+                /// True if the fit converged within the maximal number of iterations.
+                bool converged;
+
+                /// The number of simplex iterations.
+                unsigned iterations;
+
+                /// The log(likelihood) of the toy data at the generating point.
+                double generating_log_likelihood;
+
+                /// The log(likelihood) of the toy data at the best-fit point.
+                double log_likelihood;
+
+                /// The log(posterior) of the toy data at the best-fit point.
+                double log_posterior;
+
+                /// The likelihood-ratio test statistic -2 log(L_generating / L_best-fit).
+                double test_statistic;
+
+                /// The values of the varied parameters at the best-fit point.
+                std::vector<double> parameters;
+            };
+
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param log_posterior The posterior for which toys shall be generated.
+             * @param config        The configuration of the fits.
+             */
+            PseudoExperiments(const LogPosterior & log_posterior, const Config & config = Config());
+
+            /// Destructor.
+            ~PseudoExperiments();
+            ///@}
+
+            ///@name Generation
+            ///@{
+            /*!
+             * Generate and fit pseudo experiments.
+             *
+             * Repeated calls continue with the next toy index, such that the results
+             * are the same as for a single call with the total number of toys.
+             *
+             * @param n The number of pseudo experiments.
+             *
+             * @warning Must not be called from within a thread of the ThreadPool.
+             */
+            void run(const unsigned & n);
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Retrieve the results of all pseudo experiments, ordered by their index.
+            const std::vector<Result> & results() const;
+
+            /// Retrieve the values of the varied parameters at the generating point.
+            const std::vector<double> & generating_point() const;
+
+            /*!
+             * Write the results as a table, one pseudo experiment per line.
+             *
+             * The columns are the index, the convergence flag, the number of iterations, the
+             * log(likelihood) at the generating point and at the best-fit point, the log(posterior)
+             * at the best-fit point, the test statistic, and the best-fit values of the varied parameters.
+             * The first line is a comment that names the columns.
+             *
+             * @param output The stream to which the table is written.
+             */
+            void write(std::ostream & output) const;
+            ///@}
+    };
+}
+
+#endif
@@ -0,0 +1,163 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <test/test.hh>
+#include <eos/constraint.hh>
+#include <eos/statistics/log-posterior_TEST.hh>
+#include <eos/statistics/pseudo-experiments.hh>
+#include <eos/maths/power-of.hh>
+#include <eos/utils/exception.hh>
+
+#include <cmath>
+#include <sstream>
+#include <string>
+
+using namespace test;
+using namespace eos;
+
+class PseudoExperimentsTest :
+    public TestCase
+{
+    public:
+        PseudoExperimentsTest() :
+            TestCase("pseudo_experiments_test")
+        {
+        }
+
+        virtual void run() const
+        {
+            // the likelihood is Gaussian with mode 4.2 and width 0.1, and the prior is flat on [3.7, 4.9]
+            LogPosterior log_posterior = make_log_posterior(true);
+            Parameter mass = log_posterior.varied_parameters().front();
+            mass.set(4.2);
+
+            const double log_likelihood = log_posterior.log_likelihood()();
+
+            // fits of the pseudo measurements
+            {
+                PseudoExperiments pseudo_experiments(log_posterior);
+                TEST_CHECK_EQUAL(1u, pseudo_experiments.generating_point().size());
+                TEST_CHECK_EQUAL(4.2, pseudo_experiments.generating_point().front());
+
+                pseudo_experiments.run(400);
+
+                const auto & results = pseudo_experiments.results();
+                TEST_CHECK_EQUAL(400u, results.size());
+
+                // the best-fit points are distributed like the measurement, and the test statistic like a chi^2 with one dof
+                double mean = 0.0, variance = 0.0, test_statistic = 0.0;
+                for (auto i = 0u ; i < results.size() ; ++i)
+                {
+                    const auto & r = results[i];
+                    TEST_CHECK_EQUAL(i, r.index);
+                    TEST_CHECK(r.converged);
+                    TEST_CHECK(r.test_statistic > -1.0e-8);
+                    TEST_CHECK_NEARLY_EQUAL(r.log_posterior, r.log_likelihood - std::log(1.2), 1.0e-10);
+
+                    mean           += r.parameters[0] / results.size();
+                    variance       += power_of<2>(r.parameters[0] - 4.2) / results.size();
+                    test_statistic += r.test_statistic / results.size();
+                }
+
+                TEST_CHECK_NEARLY_EQUAL(4.2, mean, 0.02);
+                TEST_CHECK_RELATIVE_ERROR(0.1, std::sqrt(variance), 0.1);
+                TEST_CHECK_NEARLY_EQUAL(1.0, test_statistic, 0.25);
+
+                // the posterior and its measurements are not modified
+                TEST_CHECK_EQUAL(4.2, mass.evaluate());
+                TEST_CHECK_EQUAL(log_likelihood, log_posterior.log_likelihood()());
+            }
+
+            // the results only depend on the seed
+            {
+                PseudoExperiments pe1(log_posterior), pe2(log_posterior), pe3(log_posterior, PseudoExperiments::Config().seed(7654321u));
+
+                pe1.run(20);
+                pe2.run(12);
+                pe2.run(8);
+                pe3.run(20);
+
+                for (auto i = 0u ; i < 20u ; ++i)
+                {
+                    TEST_CHECK_EQUAL(pe1.results()[i].index,          pe2.results()[i].index);
+                    TEST_CHECK_EQUAL(pe1.results()[i].parameters[0],  pe2.results()[i].parameters[0]);
+                    TEST_CHECK_EQUAL(pe1.results()[i].test_statistic, pe2.results()[i].test_statistic);
+                    TEST_CHECK(pe1.results()[i].parameters[0] != pe3.results()[i].parameters[0]);
+                }
+            }
+
+            // table of results
+            {
+                PseudoExperiments pseudo_experiments(log_posterior);
+                pseudo_experiments.run(5);
+
+                std::stringstream output;
+                pseudo_experiments.write(output);
+
+                std::string line;
+                std::getline(output, line);
+                TEST_CHECK_EQUAL('#', line.front());
+                TEST_CHECK(std::string::npos != line.find("mass::b(MSbar)"));
+
+                unsigned lines = 0;
+                for ( ; std::getline(output, line) ; ++lines)
+                {
+                    std::stringstream columns(line);
+                    unsigned index, converged, iterations;
+                    double generating_llh, best_fit_llh, best_fit_log_posterior, test_statistic, best_fit_mass;
+                    columns >> index >> converged >> iterations >> generating_llh >> best_fit_llh >> best_fit_log_posterior >> test_statistic >> best_fit_mass;
+
+                    TEST_CHECK(! columns.fail());
+                    TEST_CHECK_EQUAL(lines, index);
+                    TEST_CHECK_NEARLY_EQUAL(pseudo_experiments.results()[lines].parameters[0], best_fit_mass, 1.0e-8);
+                }
+                TEST_CHECK_EQUAL(5u, lines);
+            }
+
+            // invalid configurations
+            {
+                TEST_CHECK_THROWS(InternalError, PseudoExperiments(log_posterior, PseudoExperiments::Config().max_iterations(0)));
+                TEST_CHECK_THROWS(InternalError, PseudoExperiments(log_posterior, PseudoExperiments::Config().tolerance(0.0)));
+                TEST_CHECK_THROWS(InternalError, PseudoExperiments(log_posterior, PseudoExperiments::Config().step_size(-1.0)));
+            }
+
+            // likelihoods that cannot be resampled
+            {
+                Parameters parameters = Parameters::Defaults();
+                LogLikelihood llh(parameters);
+
+                auto observable = ObservablePtr(new ObservableStub(parameters, "mass::b(MSbar)"));
+                std::vector<LogLikelihoodBlockPtr> components
+                {
+                    LogLikelihoodBlock::Gaussian(llh.observable_cache(), observable, 4.1, 4.2, 4.3),
+                    LogLikelihoodBlock::Gaussian(llh.observable_cache(), observable, 4.3, 4.4, 4.5)
+                };
+                auto mixture = LogLikelihoodBlock::Mixture(components, { 0.5, 0.5 }, { });
+                TEST_CHECK(components.front()->resamplable());
+                TEST_CHECK(! mixture->resamplable());
+
+                llh.add(Constraint("Test::Mixture", { observable }, { mixture }));
+
+                LogPosterior mixture_posterior(llh);
+                mixture_posterior.add(LogPrior::Flat(parameters, "mass::b(MSbar)", ParameterRange{ 3.7, 4.9 }));
+
+                TEST_CHECK_THROWS(InternalError, PseudoExperiments{ mixture_posterior });
+            }
+        }
+} pseudo_experiments_test;
@@ -27,6 +27,11 @@
 #include <eos/utils/concrete-cacheable-observable.hh>
 #include <eos/utils/concrete_observable.hh>
 #include <eos/utils/observable_cache.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <array>
+#include <tuple>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -133,6 +138,75 @@ namespace eos
         return _imp->evaluate2(ir);
     }
 
+    /*!
+     * Provide a binned observable, whose intermediate results can be prepared for several bins at once
+     */
+    class TestBinnableObservableProvider :
+        public ParameterUser
+    {
+        public:
+            struct IntermediateResult :
+                public CacheableObservable::IntermediateResult
+            {
+                // integral of q2 over the bin
+                double integral;
+            };
+
+            UsedParameter m_B;
+
+            IntermediateResult _intermediate_result;
+
+            static unsigned prepare_calls, prepare_bins_calls;
+
+            TestBinnableObservableProvider(const Parameters & parameters, const Options &) :
+                m_B(parameters["mass::B_u"], *this)
+            {
+            }
+
+            const IntermediateResult * prepare(const double & q2_min, const double & q2_max) const
+            {
+                ++prepare_calls;
+
+                auto & ir = const_cast<IntermediateResult &>(_intermediate_result);
+                ir.integral = (q2_max * q2_max - q2_min * q2_min) / 2.0;
+
+                return &_intermediate_result;
+            }
+
+            std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const
+            {
+                ++prepare_bins_calls;
+
+                std::vector<IntermediateResult> result(bins.size());
+                for (auto i = 0u ; i < bins.size() ; ++i)
+                {
+                    result[i].integral = (bins[i][1] * bins[i][1] - bins[i][0] * bins[i][0]) / 2.0;
+                }
+
+                return result;
+            }
+
+            double integral(const IntermediateResult * ir) const
+            {
+                return ir->integral;
+            }
+
+            double scaled_integral(const IntermediateResult * ir) const
+            {
+                return m_B * ir->integral;
+            }
+
+            static const std::set<ReferenceName> references;
+    };
+
+    unsigned TestBinnableObservableProvider::prepare_calls = 0;
+    unsigned TestBinnableObservableProvider::prepare_bins_calls = 0;
+
+    const std::set<ReferenceName>
+    TestBinnableObservableProvider::references
+    {
+    };
+
     /*!
     * Construct the same observable as a regular observable
     */
@@ -152,6 +226,10 @@ namespace eos
              * References used in the computation of our observables.
              */
             static const std::set<ReferenceName> references;
+
+            static constexpr bool shareable = true;
+
+            static unsigned instances;
     };
 
     const std::set<ReferenceName>
@@ -159,6 +237,8 @@ namespace eos
     {
     };
 
+    unsigned TestRegularObservableProvider::instances = 0;
+
     template <>
     struct Implementation<TestRegularObservableProvider>
     {
@@ -189,6 +269,7 @@ namespace eos
     TestRegularObservableProvider::TestRegularObservableProvider(const Parameters & parameters, const Options & options) :
         PrivateImplementationPattern<TestRegularObservableProvider>(new Implementation<TestRegularObservableProvider>(parameters, options, *this))
     {
+        ++instances;
     }
 
     TestRegularObservableProvider::~TestRegularObservableProvider()
@@ -305,5 +386,173 @@ class CacheableObservableTest :
 
         }
 
+        // binned observables share the preparation of their intermediate results
+        {
+            Parameters p = Parameters::Defaults();
+            p["mass::B_u"] = 5.27934;
+
+            using TestBinnableObservable = class ConcreteCacheableObservable<TestBinnableObservableProvider, double, double>;
+
+            auto make = [&p] (const char * name, const double & q2_min, const double & q2_max, double (TestBinnableObservableProvider::* fn)(const TestBinnableObservableProvider::IntermediateResult *) const)
+            {
+                return ObservablePtr(new TestBinnableObservable(name, p, Kinematics({{"q2_min", q2_min}, {"q2_max", q2_max}}), Options(),
+                    &TestBinnableObservableProvider::prepare,
+                    fn,
+                    std::make_tuple("q2_min", "q2_max")
+                ));
+            };
+
+            ObservableCache cache(p);
+            std::vector<ObservableCache::Id> ids
+            {
+                cache.add(make("test::integral", 1.0, 2.0, &TestBinnableObservableProvider::integral)),
+                cache.add(make("test::integral", 2.0, 4.0, &TestBinnableObservableProvider::integral)),
+                cache.add(make("test::scaled_integral", 1.0, 2.0, &TestBinnableObservableProvider::scaled_integral)),
+                cache.add(make("test::scaled_integral", 2.0, 4.0, &TestBinnableObservableProvider::scaled_integral)),
+                cache.add(make("test::integral", 1.0, 4.0, &TestBinnableObservableProvider::integral))
+            };
+            TEST_CHECK_EQUAL(cache.size(), 5u);
+
+            TestBinnableObservableProvider::prepare_calls = 0;
+            TestBinnableObservableProvider::prepare_bins_calls = 0;
+            TEST_CHECK_NO_THROW(cache.update());
+            TEST_CHECK_EQUAL(TestBinnableObservableProvider::prepare_calls,      0u);
+            TEST_CHECK_EQUAL(TestBinnableObservableProvider::prepare_bins_calls, 1u);
+
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[0]],           1.5, 1.0e-12);
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[1]],           6.0, 1.0e-12);
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[2]], 5.27934 * 1.5, 1.0e-12);
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[3]], 5.27934 * 6.0, 1.0e-12);
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[4]],           7.5, 1.0e-12);
+
+            // the observables follow changes of the parameters
+            p["mass::B_u"] = 5.0;
+            TEST_CHECK_NO_THROW(cache.update());
+            TEST_CHECK_NEARLY_EQUAL(cache[ids[3]],     5.0 * 6.0, 1.0e-12);
+
+            // a single bin uses the regular preparation
+            ObservableCache single(p);
+            auto id = single.add(make("test::integral", 1.0, 3.0, &TestBinnableObservableProvider::integral));
+            TestBinnableObservableProvider::prepare_calls = 0;
+            TestBinnableObservableProvider::prepare_bins_calls = 0;
+            TEST_CHECK_NO_THROW(single.update());
+            TEST_CHECK_EQUAL(TestBinnableObservableProvider::prepare_calls,      1u);
+            TEST_CHECK_EQUAL(TestBinnableObservableProvider::prepare_bins_calls, 0u);
+            TEST_CHECK_NEARLY_EQUAL(single[id], 4.0, 1.0e-12);
+        }
+
+        // grouped bins of physical observables agree with the same bins evaluated on their own
+        {
+            Parameters p = Parameters::Defaults();
+
+            const std::vector<std::tuple<const char *, Options>> observables
+            {
+                { "B->Dlnu::BR",             Options{ { "model", "CKM" }, { "form-factors", "BSZ2015" }, { "l", "mu" } } },
+                { "B->K^*ll::BR_CP_specific", Options{ { "model", "WET" }, { "tag", "BFS2004" }, { "form-factors", "BSZ2015" }, { "l", "mu" } } }
+            };
+            const std::vector<std::array<double, 2>> bins { { 1.0, 2.0 }, { 2.0, 4.0 }, { 4.0, 6.0 }, { 1.0, 6.0 } };
+
+            for (const auto & [name, options] : observables)
+            {
+                ObservableCache cache(p);
+                std::vector<ObservableCache::Id> ids;
+                std::vector<ObservablePtr> singles;
+                for (const auto & bin : bins)
+                {
+                    const Kinematics k{ { "q2_min", bin[0] }, { "q2_max", bin[1] } };
+                    ids.push_back(cache.add(Observable::make(name, p, k, options)));
+                    singles.push_back(Observable::make(name, p, k.clone(), options));
+                }
+                TEST_CHECK_NO_THROW(cache.update());
+
+                for (std::size_t i = 0 ; i < bins.size() ; ++i)
+                {
+                    TEST_CHECK_RELATIVE_ERROR(singles[i]->evaluate(), cache[ids[i]], 1.0e-14);
+                }
+            }
+        }
+
+        // regular observables with the same parameters and options share their decay object
+        {
+            Parameters p = Parameters::Defaults();
+
+            using TestRegularObservable = class ConcreteObservable<TestRegularObservableProvider, double>;
+
+            TestRegularObservableProvider::instances = 0;
+
+            ObservablePtr o1(new TestRegularObservable("test::regular_observable1(q2)", p, Kinematics({{"q2", 2.0}}), Options(),
+                &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+            ObservablePtr o2(new TestRegularObservable("test::regular_observable2(q2)", p, Kinematics({{"q2", 3.0}}), Options(),
+                &TestRegularObservableProvider::evaluate2, std::make_tuple("q2")));
+            TEST_CHECK_EQUAL(TestRegularObservableProvider::instances, 1u);
+            TEST_CHECK_EQUAL(o2->evaluate(), 9.0);
+
+            // different options require a different decay object
+            ObservablePtr o3(new TestRegularObservable("test::regular_observable1(q2)", p, Kinematics({{"q2", 2.0}}), Options{ { "model", "WET" } },
+                &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+            TEST_CHECK_EQUAL(TestRegularObservableProvider::instances, 2u);
+
+            // so do different parameters
+            ObservablePtr o4 = o1->clone();
+            TEST_CHECK_EQUAL(TestRegularObservableProvider::instances, 3u);
+            TEST_CHECK_EQUAL(o4->evaluate(), o1->evaluate());
+
+            // decay objects that are no longer in use are not reused
+            o1.reset();
+            o2.reset();
+            ObservablePtr o5(new TestRegularObservable("test::regular_observable1(q2)", p, Kinematics({{"q2", 2.0}}), Options(),
+                &TestRegularObservableProvider::evaluate1, std::make_tuple("q2")));
+            TEST_CHECK_EQUAL(TestRegularObservableProvider::instances, 4u);
+        }
+
+        // one shared decay object can be evaluated concurrently
+        {
+            Parameters p = Parameters::Defaults();
+
+            std::vector<ObservablePtr> observables;
+            for (const auto & [name, options] : std::vector<std::tuple<const char *, Options>>{
+                    { "B->Dlnu::dBR/dq2",   Options{ { "model", "CKM" }, { "form-factors", "BSZ2015" }, { "l", "mu" } } },
+                    { "B->D^*lnu::dBR/dq2", Options{ { "model", "CKM" }, { "form-factors", "BSZ2015" }, { "l", "mu" } } } })
+            {
+                for (const auto & q2 : { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 })
+                {
+                    observables.push_back(Observable::make(name, p, Kinematics{ { "q2", q2 } }, options));
+                }
+            }
+
+            std::vector<double> reference;
+            for (const auto & o : observables)
+            {
+                reference.push_back(o->evaluate());
+            }
+
+            std::vector<std::vector<double>> results(16, std::vector<double>(observables.size(), 0.0));
+            std::vector<Ticket> tickets;
+            for (auto j = 0u ; j < results.size() ; ++j)
+            {
+                tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>([&observables, &results, j] ()
+                {
+                    // every job evaluates all observables, starting at a different one
+                    for (auto i = 0u ; i < observables.size() ; ++i)
+                    {
+                        const auto k = (i + j) % observables.size();
+                        results[j][k] = observables[k]->evaluate();
+                    }
+                })));
+            }
+
+            for (auto & ticket : tickets)
+            {
+                ticket.wait();
+            }
+
+            for (const auto & result : results)
+            {
+                for (auto i = 0u ; i < observables.size() ; ++i)
+                {
+                    TEST_CHECK_EQUAL(reference[i], result[i]);
+                }
+            }
+        }
     }
 } cacheable_observable_test;
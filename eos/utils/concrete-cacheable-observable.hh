@@ -27,15 +27,53 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <array>
+#include <concepts>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace eos
 {
     template <typename Decay_, typename ... Args_>
     class ConcreteCacheableObservable;
 
+    namespace impl
+    {
+        /*!
+         * Decays that can prepare the intermediate results of several bins at once, sharing the
+         * evaluation of their integrands, provide
+         *
+         *   std::vector<IntermediateResult> prepare_bins(const std::vector<std::array<double, 2>> & bins) const;
+         *
+         * which must be equivalent to calling their two-argument prepare() for each bin.
+         */
+        template <typename Decay_, typename ... Args_>
+        concept BinnablePreparation = (sizeof...(Args_) == 2) &&
+            requires (const Decay_ * decay, const std::vector<std::array<double, 2>> & bins)
+            {
+                { decay->prepare_bins(bins) } -> std::same_as<std::vector<typename Decay_::IntermediateResult>>;
+            };
+
+        /*!
+         * The bins of all cacheable observables that share one Decay_ object, and their intermediate results.
+         */
+        template <typename Decay_>
+        struct IntermediateResultBins
+        {
+            // the kinematics of each bin
+            std::vector<Kinematics> kinematics;
+
+            // the kinematic variables that hold the lower and upper boundary of each bin
+            std::vector<std::array<KinematicVariable, 2>> boundaries;
+
+            // std::deque does not invalidate references to its elements when bins are added
+            std::deque<typename Decay_::IntermediateResult> results;
+        };
+    }
+
     template <typename Decay_, typename ... Args_>
     class ConcreteCachedObservable :
         public Observable
@@ -59,6 +97,8 @@ namespace eos
 
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
+            std::shared_ptr<impl::IntermediateResultBins<Decay_>> _bins;
+
         public:
             ConcreteCachedObservable(const QualifiedName & name,
                     const Parameters & parameters,
@@ -68,7 +108,8 @@ namespace eos
                     const typename Decay_::IntermediateResult * intermediate_result,
                     const std::function<const typename Decay_::IntermediateResult * (const Decay_ *, const Args_ & ...)> & prepare_fn,
                     const std::function<double (const Decay_ *, const typename Decay_::IntermediateResult *)> & evaluate_fn,
-                    const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names) :
+                    const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names,
+                    const std::shared_ptr<impl::IntermediateResultBins<Decay_>> & bins = nullptr) :
                 _name(name),
                 _parameters(parameters),
                 _kinematics(kinematics),
@@ -77,7 +118,8 @@ namespace eos
                 _intermediate_result(intermediate_result),
                 _prepare_fn(prepare_fn),
                 _evaluate_fn(evaluate_fn),
-                _kinematics_names(kinematics_names)
+                _kinematics_names(kinematics_names),
+                _bins(bins)
             {
                 uses(*_decay);
                 uses(Decay_::references);
@@ -144,6 +186,11 @@ namespace eos
 
             std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type ...> _argument_tuple;
 
+            // if Decay_ supports it, the bins of all observables that share our Decay_ object; our own bin comes first
+            std::shared_ptr<impl::IntermediateResultBins<Decay_>> _bins;
+
+            static constexpr bool binnable = impl::BinnablePreparation<Decay_, Args_ ...>;
+
         public:
             ConcreteCacheableObservable(const QualifiedName & name,
                     const Parameters & parameters,
@@ -164,6 +211,14 @@ namespace eos
             {
                 uses(*_decay);
                 uses(Decay_::references);
+
+                if constexpr (binnable)
+                {
+                    _bins = std::make_shared<impl::IntermediateResultBins<Decay_>>();
+                    _bins->kinematics.push_back(_kinematics);
+                    _bins->boundaries.push_back({ std::get<1>(_argument_tuple), std::get<2>(_argument_tuple) });
+                    _bins->results.emplace_back();
+                }
             }
 
             ~ConcreteCacheableObservable() = default;
@@ -175,18 +230,41 @@ namespace eos
 
             virtual double evaluate() const
             {
-                std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
-
-                const typename Decay_::IntermediateResult * intermediate_result = std::apply(_prepare_fn, values);
-
-                return _evaluate_fn(_decay.get(), intermediate_result);
+                return _evaluate_fn(_decay.get(), static_cast<const typename Decay_::IntermediateResult *>(prepare()));
             };
 
             virtual const CacheableObservable::IntermediateResult * prepare() const
             {
                 std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
 
-                return std::apply(_prepare_fn, values);
+                if constexpr (binnable)
+                {
+                    auto & results = _bins->results;
+
+                    if (1 == results.size())
+                    {
+                        results.front() = *std::apply(_prepare_fn, values);
+                    }
+                    else
+                    {
+                        // prepare the bins of all our binned observables at once
+                        std::vector<std::array<double, 2>> bins;
+                        bins.reserve(results.size());
+                        for (const auto & b : _bins->boundaries)
+                        {
+                            bins.push_back({ b[0].evaluate(), b[1].evaluate() });
+                        }
+
+                        auto prepared = _decay->prepare_bins(bins);
+                        std::move(prepared.begin(), prepared.end(), results.begin());
+                    }
+
+                    return &results.front();
+                }
+                else
+                {
+                    return std::apply(_prepare_fn, values);
+                }
             }
 
             virtual double evaluate(const CacheableObservable::IntermediateResult * intermediate_result) const
@@ -231,7 +309,58 @@ namespace eos
                  */
                 std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = other->_argument_tuple;
 
-                return ObservablePtr(new ConcreteCachedObservable<Decay_, Args_ ...>(_name, _parameters, _kinematics, _options, other->_decay, std::apply(other->_prepare_fn, values), _prepare_fn, _evaluate_fn, _kinematics_names));
+                if constexpr (binnable)
+                {
+                    // the other observable prepares its own bin within its bins' storage
+                    return ObservablePtr(new ConcreteCachedObservable<Decay_, Args_ ...>(_name, _parameters, _kinematics, _options, other->_decay, &other->_bins->results.front(), _prepare_fn, _evaluate_fn, _kinematics_names, other->_bins));
+                }
+                else
+                {
+                    return ObservablePtr(new ConcreteCachedObservable<Decay_, Args_ ...>(_name, _parameters, _kinematics, _options, other->_decay, std::apply(other->_prepare_fn, values), _prepare_fn, _evaluate_fn, _kinematics_names));
+                }
+            }
+
+            virtual ObservablePtr make_binned_observable(CacheableObservable * _other) const
+            {
+                if constexpr (binnable)
+                {
+                    auto other = dynamic_cast<ConcreteCacheableObservable *>(_other);
+                    if (nullptr == other)
+                        return { nullptr };
+
+                    if (other->_parameters != this->_parameters)
+                        return { nullptr };
+
+                    if (other->_options != this->_options)
+                        return { nullptr };
+
+                    // the bin boundaries must be the same kinematic variables
+                    if ((std::string(std::get<0>(other->_kinematics_names)) != std::get<0>(_kinematics_names))
+                        || (std::string(std::get<1>(other->_kinematics_names)) != std::get<1>(_kinematics_names)))
+                        return { nullptr };
+
+                    // reuse an existing bin, or add our bin to the other observable's bins
+                    auto & bins = *other->_bins;
+                    std::size_t index = 0;
+                    for ( ; index < bins.kinematics.size() ; ++index)
+                    {
+                        if (bins.kinematics[index] == _kinematics)
+                            break;
+                    }
+
+                    if (bins.kinematics.size() == index)
+                    {
+                        bins.kinematics.push_back(_kinematics);
+                        bins.boundaries.push_back({ std::get<1>(_argument_tuple), std::get<2>(_argument_tuple) });
+                        bins.results.emplace_back();
+                    }
+
+                    return ObservablePtr(new ConcreteCachedObservable<Decay_, Args_ ...>(_name, _parameters, _kinematics, _options, other->_decay, &bins.results[index], _prepare_fn, _evaluate_fn, _kinematics_names, other->_bins));
+                }
+                else
+                {
+                    return { nullptr };
+                }
             }
 
             virtual ObservablePtr clone() const
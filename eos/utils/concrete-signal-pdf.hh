@@ -24,6 +24,7 @@
 #include <eos/utils/density-impl.hh>
 #include <eos/utils/tuple-maker.hh>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <limits>
@@ -303,6 +304,20 @@ namespace eos
                 return (result > 0 ? std::log(result) : -std::numeric_limits<double>::max());
             };
 
+            virtual void evaluate_batch(const double * points, const unsigned & n, double * results) const
+            {
+                std::array<double, pdf_args_> pdf_arguments;
+
+                for (unsigned i = 0 ; i < n ; ++i)
+                {
+                    std::copy(points + i * pdf_args_, points + (i + 1) * pdf_args_, pdf_arguments.begin());
+
+                    double result = std::apply(_pdf, impl::convert_to_tuple(&_decay, pdf_arguments));
+
+                    results[i] = (result > 0 ? std::log(result) : -std::numeric_limits<double>::max());
+                }
+            }
+
             virtual double normalization() const
             {
                 std::array<double, norm_args_> norm_arguments = impl::evaluate(_norm_arguments);
@@ -317,6 +332,11 @@ namespace eos
                 return _parameters;
             };
 
+            virtual const ParameterUser & parameter_user() const
+            {
+                return _decay;
+            }
+
             virtual Kinematics kinematics()
             {
                 return _kinematics;
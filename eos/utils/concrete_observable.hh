@@ -21,24 +21,119 @@
 #define EOS_GUARD_EOS_UTILS_CONCRETE_OBSERVABLE_HH 1
 
 #include <eos/observable-impl.hh>
+#include <eos/utils/instantiation_policy-impl.hh>
 #include <eos/utils/join.hh>
+#include <eos/utils/lock.hh>
 #include <eos/utils/log.hh>
+#include <eos/utils/mutex.hh>
 #include <eos/utils/tuple-maker.hh>
 #include <eos/utils/units.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <array>
 #include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace eos
 {
+    namespace impl
+    {
+        /*!
+         * Decays whose const member functions, as used by regular observables, are safe to call
+         * from several threads at once may be shared among regular observables. They declare
+         *
+         *   static constexpr bool shareable = true;
+         *
+         * This excludes decays that write to storage owned by their implementation, e.g., by
+         * calling the prepare() function of another decay.
+         */
+        template <typename Decay_>
+        concept ShareableDecay = requires { requires Decay_::shareable; };
+
+        /*!
+         * Holds the Decay_ objects of all regular observables of one type. Observables that
+         * use the same Parameters and the same Options share a single Decay_ object, and hence
+         * also share its model and form factor objects.
+         *
+         * Only weak references to the Decay_ objects are held, and the Parameters objects are
+         * identified without holding a reference to them.
+         */
+        template <typename Decay_>
+        class SharedDecays :
+            public InstantiationPolicy<SharedDecays<Decay_>, Singleton>
+        {
+            private:
+                using KeyType = std::tuple<const void *, std::string>;
+
+                Mutex * const _mutex;
+
+                std::map<KeyType, std::weak_ptr<const Decay_>> _decays;
+
+            public:
+                SharedDecays() :
+                    _mutex(new Mutex)
+                {
+                }
+
+                ~SharedDecays()
+                {
+                    delete _mutex;
+                }
+
+                std::shared_ptr<const Decay_> get(const Parameters & parameters, const Options & options)
+                {
+                    // a Decay_ object keeps the underlying implementation of its parameters alive, through the
+                    // observables that use it; the identity of the parameters is therefore not reused while the
+                    // Decay_ object exists
+                    KeyType key(parameters.identity(), options.as_string());
+
+                    Lock l(*_mutex);
+
+                    auto i = _decays.find(key);
+                    if (_decays.end() != i)
+                    {
+                        if (auto result = i->second.lock())
+                            return result;
+                    }
+
+                    // forget about decays that are no longer in use
+                    std::erase_if(_decays, [] (const auto & d) { return d.second.expired(); });
+
+                    auto result = std::make_shared<const Decay_>(parameters, options);
+                    _decays[key] = result;
+
+                    return result;
+                }
+        };
+
+        // share the Decay_ object among regular observables if it is safe to do so
+        template <typename Decay_>
+        std::shared_ptr<const Decay_> make_decay(const Parameters & parameters, const Options & options)
+        {
+            if constexpr (ShareableDecay<Decay_>)
+            {
+                return SharedDecays<Decay_>::instance()->get(parameters, options);
+            }
+            else
+            {
+                return std::make_shared<const Decay_>(parameters, options);
+            }
+        }
+    }
+
     template <typename Decay_, typename ... Args_>
     class ConcreteObservable :
-        public Observable
+        public Observable,
+        public DifferentiableObservable
     {
         public:
+            using GradientFunction = std::function<Dual (const Decay_ *, const std::vector<Parameter> &, const Args_ & ...)>;
+
+            using DifferentiableFunction = std::function<bool (const Decay_ *)>;
 
         private:
             QualifiedName _name;
@@ -49,10 +144,16 @@ namespace eos
 
             Options _options;
 
-            Decay_ _decay;
+            // shared with all other regular observables of the same type, parameters and options, if Decay_ is shareable
+            std::shared_ptr<const Decay_> _decay;
 
             std::function<double (const Decay_ *, const Args_ & ...)> _function;
 
+            // only set for observables whose Decay_ provides the gradient
+            GradientFunction _gradient_function;
+
+            DifferentiableFunction _differentiable_function;
+
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
             std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, KinematicVariable>::Type ...> _argument_tuple;
@@ -63,17 +164,21 @@ namespace eos
                     const Kinematics & kinematics,
                     const Options & options,
                     const std::function<double (const Decay_ *, const Args_ & ...)> & function,
-                    const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names) :
+                    const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names,
+                    const GradientFunction & gradient_function = GradientFunction(),
+                    const DifferentiableFunction & differentiable_function = DifferentiableFunction()) :
                 _name(name),
                 _parameters(parameters),
                 _kinematics(kinematics),
                 _options(options),
-                _decay(parameters, options),
+                _decay(impl::make_decay<Decay_>(parameters, options)),
                 _function(function),
+                _gradient_function(gradient_function),
+                _differentiable_function(differentiable_function),
                 _kinematics_names(kinematics_names),
-                _argument_tuple(impl::TupleMaker<sizeof...(Args_)>::make(_kinematics, _kinematics_names, &_decay))
+                _argument_tuple(impl::TupleMaker<sizeof...(Args_)>::make(_kinematics, _kinematics_names, _decay.get()))
             {
-                uses(_decay);
+                uses(*_decay);
                 uses(Decay_::references);
             }
 
@@ -89,6 +194,21 @@ namespace eos
                 return std::apply(_function, values);
             };
 
+            virtual bool differentiable() const
+            {
+                return _gradient_function && _differentiable_function && _differentiable_function(_decay.get());
+            }
+
+            virtual Dual evaluate_with_gradient(const std::vector<Parameter> & parameters) const
+            {
+                if (! differentiable())
+                    throw InternalError("Observable '" + _name.str() + "' cannot provide its gradient");
+
+                std::tuple<const Decay_ *, typename impl::ConvertTo<Args_, double>::Type ...> values = _argument_tuple;
+
+                return std::apply([&] (const Decay_ * decay, const auto & ... args) { return _gradient_function(decay, parameters, args ...); }, values);
+            }
+
             virtual Parameters parameters()
             {
                 return _parameters;
@@ -106,12 +226,14 @@ namespace eos
 
             virtual ObservablePtr clone() const
             {
-                return ObservablePtr(new ConcreteObservable(_name, _parameters.clone(), _kinematics.clone(), _options, _function, _kinematics_names));
+                return ObservablePtr(new ConcreteObservable(_name, _parameters.clone(), _kinematics.clone(), _options, _function, _kinematics_names,
+                        _gradient_function, _differentiable_function));
             }
 
             virtual ObservablePtr clone(const Parameters & parameters) const
             {
-                return ObservablePtr(new ConcreteObservable(_name, parameters, _kinematics.clone(), _options, _function, _kinematics_names));
+                return ObservablePtr(new ConcreteObservable(_name, parameters, _kinematics.clone(), _options, _function, _kinematics_names,
+                        _gradient_function, _differentiable_function));
             }
     };
 
@@ -128,6 +250,10 @@ namespace eos
 
             std::function<double (const Decay_ *, const Args_ & ...)> _function;
 
+            typename ConcreteObservable<Decay_, Args_ ...>::GradientFunction _gradient_function;
+
+            typename ConcreteObservable<Decay_, Args_ ...>::DifferentiableFunction _differentiable_function;
+
             std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> _kinematics_names;
 
             std::array<const std::string, sizeof...(Args_)> _kinematics_names_array;
@@ -139,11 +265,15 @@ namespace eos
                     const Unit & unit,
                     const std::function<double (const Decay_ *, const Args_ & ...)> & function,
                     const std::tuple<typename impl::ConvertTo<Args_, const char *>::Type ...> & kinematics_names,
-                    const Options & forced_options) :
+                    const Options & forced_options,
+                    const typename ConcreteObservable<Decay_, Args_ ...>::GradientFunction & gradient_function = { },
+                    const typename ConcreteObservable<Decay_, Args_ ...>::DifferentiableFunction & differentiable_function = { }) :
                 _name(name),
                 _latex(latex),
                 _unit(unit),
                 _function(function),
+                _gradient_function(gradient_function),
+                _differentiable_function(differentiable_function),
                 _kinematics_names(kinematics_names),
                 _kinematics_names_array(impl::make_array<const std::string>(kinematics_names)),
                 _forced_options(forced_options)
@@ -199,7 +329,8 @@ namespace eos
                             << "Observable '" << _name << "' forces option key '" << key << "' to value '" << forced_value << "', overriding user-provided value '" << options[key] << "'";
                     }
                 }
-                return ObservablePtr(new ConcreteObservable<Decay_, Args_ ...>(_name, parameters, kinematics, options + _forced_options, _function, _kinematics_names));
+                return ObservablePtr(new ConcreteObservable<Decay_, Args_ ...>(_name, parameters, kinematics, options + _forced_options, _function, _kinematics_names,
+                        _gradient_function, _differentiable_function));
             }
 
             virtual std::ostream & insert(std::ostream & os) const
@@ -229,6 +360,28 @@ namespace eos
                 std::function<double (const Decay_ *, const Args_ & ...)>(std::mem_fn(function)),
                 kinematics_names, forced_options);
     }
+
+    /*!
+     * As above, for a regular observable that also provides its gradient with respect to a set of parameters,
+     * cf. DifferentiableObservable. The gradient is only used if Decay_::differentiable() returns true.
+     */
+    template <typename Decay_, typename Tuple_, typename ... Args_>
+    ObservableEntryPtr make_concrete_observable_entry(const QualifiedName & name, const std::string & latex,
+            const Unit & unit,
+            double (Decay_::* function)(const Args_ & ...) const,
+            Dual (Decay_::* gradient_function)(const std::vector<Parameter> &, const Args_ & ...) const,
+            const Tuple_ & kinematics_names,
+            const Options & forced_options)
+    {
+        static_assert(sizeof...(Args_) == impl::TupleSize<Tuple_>::size, "Need as many function arguments as kinematics names!");
+
+        return std::make_shared<ConcreteObservableEntry<Decay_, Args_ ...>>(name, latex,
+                unit,
+                std::function<double (const Decay_ *, const Args_ & ...)>(std::mem_fn(function)),
+                kinematics_names, forced_options,
+                typename ConcreteObservable<Decay_, Args_ ...>::GradientFunction(std::mem_fn(gradient_function)),
+                typename ConcreteObservable<Decay_, Args_ ...>::DifferentiableFunction(std::mem_fn(&Decay_::differentiable)));
+    }
 }
 
 
@@ -0,0 +1,93 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EOS_GUARD_EOS_UTILS_DUAL_PARAMETERS_HH
+#define EOS_GUARD_EOS_UTILS_DUAL_PARAMETERS_HH 1
+
+#include <eos/maths/dual.hh>
+#include <eos/utils/parameters.hh>
+
+#include <vector>
+
+namespace eos
+{
+    /*!
+     * DualParameters reads the values of parameters as dual numbers.
+     *
+     * The gradients are taken with respect to a fixed list of independent parameters;
+     * the i-th gradient component corresponds to the i-th independent parameter.
+     * All other parameters are read as constants.
+     */
+    class DualParameters
+    {
+        private:
+            std::vector<Parameter> _parameters;
+
+            std::vector<Parameter::Id> _ids;
+
+        public:
+            ///@name Basic Functions
+            ///@{
+            /*!
+             * Constructor.
+             *
+             * @param parameters The independent parameters.
+             */
+            explicit DualParameters(const std::vector<Parameter> & parameters) :
+                _parameters(parameters)
+            {
+                _ids.reserve(parameters.size());
+                for (const auto & p : parameters)
+                {
+                    _ids.push_back(p.id());
+                }
+            }
+            ///@}
+
+            ///@name Access
+            ///@{
+            /// Read a parameter's value as a dual number.
+            Dual operator() (const Parameter & parameter) const
+            {
+                const Parameter::Id id = parameter.id();
+                for (auto i = 0u ; i < _ids.size() ; ++i)
+                {
+                    if (_ids[i] == id)
+                        return Dual::variable(parameter.evaluate(), i, _ids.size());
+                }
+
+                return Dual(parameter.evaluate());
+            }
+
+            /// Retrieve the i-th independent parameter.
+            const Parameter & operator[] (const unsigned & i) const
+            {
+                return _parameters[i];
+            }
+
+            /// Retrieve the number of independent parameters.
+            unsigned size() const
+            {
+                return _parameters.size();
+            }
+            ///@}
+    };
+}
+
+#endif
@@ -18,6 +18,7 @@
  * Place, Suite 330, Boston, MA  02111-1307  USA
  */
 
+#include <eos/maths/derivative.hh>
 #include <eos/utils/expression-cacher.hh>
 #include <eos/utils/expression-observable.hh>
 #include <eos/utils/log.hh>
@@ -28,6 +29,7 @@
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <map>
 #include <tuple>
@@ -67,6 +69,12 @@ namespace eos
         // Contains values of all observables
         std::vector<double> predictions;
 
+        // Contains values and gradients of all observables, as of the last call to update_with_gradient()
+        std::vector<Dual> predictions_with_gradient;
+
+        // Contains the parameters with respect to which the above gradients have been computed
+        std::vector<Parameter> gradient_parameters;
+
         Implementation(const Parameters & parameters) :
             parameters(parameters)
         {
@@ -160,6 +168,22 @@ namespace eos
                     return index;
                 }
 
+                // have we encountered this cacheable observable in a different bin before?
+                for (auto c = range.first, c_end = range.second ; c != c_end ; ++c)
+                {
+                    // yes! prepare its bin alongside the other bins...
+                    ObservablePtr binned_observable = cacheable_observable->make_binned_observable(std::get<0>(c->second));
+                    if (! binned_observable)
+                        continue;
+
+                    // ...and add the newly created cached observable
+                    observables.push_back(binned_observable);
+                    predictions.push_back(std::numeric_limits<double>::quiet_NaN());
+                    cached_observables.push_back(std::make_tuple(binned_observable, index));
+
+                    return index;
+                }
+
                 // else add this new cacheable observable
                 observables.push_back(observable);
                 predictions.push_back(std::numeric_limits<double>::quiet_NaN());
@@ -179,6 +203,35 @@ namespace eos
 
             throw InternalError("should not be reached");
         }
+
+        static bool depends_on(const Observable & observable, const Parameter::Id & id)
+        {
+            // observables that do not register their parameters might depend on any parameter
+            if (observable.begin() == observable.end())
+                return true;
+
+            return observable.end() != std::find(observable.begin(), observable.end(), id);
+        }
+
+        static bool depends_on(const Observable & observable, const std::vector<Parameter::Id> & ids)
+        {
+            return std::any_of(ids.cbegin(), ids.cend(), [&observable] (const Parameter::Id & id) { return depends_on(observable, id); });
+        }
+
+        void evaluate(const ObservablePtr & o, const ObservableCache::Id & idx, const std::string & kind)
+        {
+            try
+            {
+                predictions[idx] = o->evaluate();
+            }
+            catch (eos::Exception & e)
+            {
+                Log::instance()->message("ObservableCache::update", ll_error)
+                    << "Exception encountered when evaluating " << kind << " observable '" << o->name() << "[" << o->kinematics().as_string() << "];" << o->options().as_string() << "': "
+                    << e.what();
+                predictions[idx] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
     };
 
     ObservableCache::ObservableCache(const Parameters & parameters) :
@@ -319,6 +372,138 @@ namespace eos
         }
     }
 
+    void
+    ObservableCache::update(const std::vector<Parameter::Id> & ids)
+    {
+        // cacheable observables first, since the cached observables rely on their intermediate results
+        for (const auto & co : _imp->cacheable_observables)
+        {
+            const auto & idx = std::get<1>(co.second);
+            const auto & o   = _imp->observables[idx];
+            if (! Implementation<ObservableCache>::depends_on(*o, ids))
+                continue;
+
+            _imp->evaluate(o, idx, "cacheable");
+        }
+
+        for (const auto & ro : _imp->regular_observables)
+        {
+            const auto & o   = std::get<0>(ro);
+            const auto & idx = std::get<1>(ro);
+            if (! Implementation<ObservableCache>::depends_on(*o, ids))
+                continue;
+
+            _imp->evaluate(o, idx, "regular");
+        }
+
+        // cached observables share the parameters of their cacheable observable
+        for (const auto & co : _imp->cached_observables)
+        {
+            const auto & o   = std::get<0>(co);
+            const auto & idx = std::get<1>(co);
+            if (! Implementation<ObservableCache>::depends_on(*o, ids))
+                continue;
+
+            _imp->evaluate(o, idx, "cached");
+        }
+
+        // expression observables might depend on any of the above
+        for (const auto & eo : _imp->expression_observables)
+        {
+            _imp->evaluate(std::get<0>(eo), std::get<1>(eo), "expression");
+        }
+    }
+
+    void
+    ObservableCache::update_with_gradient(const std::vector<Parameter> & parameters)
+    {
+        using Stencil = deriv::TwoSidedStencil<1u>;
+
+        update();
+
+        const unsigned n = _imp->observables.size();
+        std::vector<Dual> result(n);
+        std::vector<bool> differentiable(n, false);
+        std::vector<std::vector<double>> gradients(n);
+
+        for (auto i = 0u ; i < n ; ++i)
+        {
+            auto o = dynamic_cast<const DifferentiableObservable *>(_imp->observables[i].get());
+            if ((nullptr == o) || (! o->differentiable()))
+                continue;
+
+            result[i] = o->evaluate_with_gradient(parameters);
+            differentiable[i] = true;
+        }
+
+        std::vector<Parameter::Id> perturbed_ids;
+        for (auto j = 0u ; j < parameters.size() ; ++j)
+        {
+            std::vector<unsigned> dependents;
+            for (auto i = 0u ; i < n ; ++i)
+            {
+                if (differentiable[i] || (! Implementation<ObservableCache>::depends_on(*_imp->observables[i], parameters[j].id())))
+                    continue;
+
+                dependents.push_back(i);
+            }
+
+            if (dependents.empty())
+                continue;
+
+            // only the observables that depend on the perturbed parameter are re-evaluated
+            const std::vector<Parameter::Id> ids{ parameters[j].id() };
+            perturbed_ids.push_back(parameters[j].id());
+
+            Parameter p = parameters[j];
+            const double x0 = p.evaluate();
+            const double h = Stencil::step(x0);
+
+            std::array<std::vector<double>, Stencil::offsets.size()> samples;
+            for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+            {
+                p.set(x0 + Stencil::offsets[k] * h);
+                update(ids);
+
+                samples[k].reserve(dependents.size());
+                for (auto i : dependents)
+                {
+                    samples[k].push_back(_imp->predictions[i]);
+                }
+            }
+            p.set(x0);
+
+            for (auto d = 0u ; d < dependents.size() ; ++d)
+            {
+                auto & g = gradients[dependents[d]];
+                g.resize(parameters.size(), 0.0);
+
+                for (auto k = 0u ; k < Stencil::offsets.size() ; ++k)
+                {
+                    g[j] += Stencil::weights[k] * samples[k][d];
+                }
+                g[j] /= Stencil::denominator * h;
+            }
+        }
+
+        // restore the predictions at the original point, again only for those observables that have been perturbed
+        if (! perturbed_ids.empty())
+        {
+            update(perturbed_ids);
+        }
+
+        for (auto i = 0u ; i < n ; ++i)
+        {
+            if (differentiable[i])
+                continue;
+
+            result[i] = Dual(_imp->predictions[i], gradients[i]);
+        }
+
+        _imp->predictions_with_gradient = std::move(result);
+        _imp->gradient_parameters = parameters;
+    }
+
     Parameters
     ObservableCache::parameters() const
     {
@@ -331,6 +516,18 @@ namespace eos
         return _imp->predictions[id];
     }
 
+    const Dual &
+    ObservableCache::prediction_with_gradient(const ObservableCache::Id & id) const
+    {
+        return _imp->predictions_with_gradient[id];
+    }
+
+    const std::vector<Parameter> &
+    ObservableCache::gradient_parameters() const
+    {
+        return _imp->gradient_parameters;
+    }
+
     ObservablePtr
     ObservableCache::observable(const ObservableCache::Id & id) const
     {
@@ -364,7 +561,8 @@ namespace eos
         {
             // cloning cached observables creates independent *cacheable* observables
             // adding them back creates new and independent cached observables
-            result._imp->add((*o)->clone(parameters), *this);
+            // expression observables must refer to the new cache, such that the clone is independent of this cache
+            result._imp->add((*o)->clone(parameters), result);
         }
 
         result.update();
@@ -59,6 +59,30 @@ namespace eos
             /// Update the predictions for all observables.
             void update();
 
+            /*!
+             * Update the predictions for only those observables that depend on any of the given parameters.
+             *
+             * The predictions are evaluated serially in the calling thread, such that this method can be used from
+             * within a job of the ThreadPool. The predictions of all other observables must be up to date.
+             *
+             * @param ids The ids of all parameters that changed since the last update.
+             */
+            void update(const std::vector<Parameter::Id> & ids);
+
+            /*!
+             * Update the predictions for all observables, alongside their gradients.
+             *
+             * Observables that implement DifferentiableObservable provide their gradients
+             * exactly. For all other observables, the gradients are obtained from
+             * five-point central differences. For each parameter, only the observables that
+             * depend on it are re-evaluated, cf. update(const std::vector<Parameter::Id> &).
+             *
+             * @warning The parameters are temporarily modified.
+             *
+             * @param parameters The parameters with respect to which the gradients are computed.
+             */
+            void update_with_gradient(const std::vector<Parameter> & parameters);
+
             /// Retrieve the cache's common Parameters object.
             Parameters parameters() const;
 
@@ -76,6 +100,22 @@ namespace eos
              */
             double operator[] (const ObservableCache::Id & id) const;
 
+            /*!
+             * Retrieve the prediction and its gradient for a given observable from the cache.
+             *
+             * Only valid following a call to update_with_gradient().
+             *
+             * @param id The unique ObservableCache::Id whose associated observable's prediction shall be retrieved.
+             */
+            const Dual & prediction_with_gradient(const ObservableCache::Id & id) const;
+
+            /*!
+             * Retrieve the parameters with respect to which the gradients have been computed.
+             *
+             * Only valid following a call to update_with_gradient().
+             */
+            const std::vector<Parameter> & gradient_parameters() const;
+
             /// Retrieve the number of independent predictions from the cache.
             unsigned size() const;
 
@@ -66,6 +66,12 @@ namespace eos
         return _imp->parameter.evaluate();
     }
 
+    Dual
+    ObservableStub::evaluate_with_gradient(const std::vector<Parameter> & parameters) const
+    {
+        return read(_imp->parameter, parameters);
+    }
+
     Kinematics
     ObservableStub::kinematics()
     {
@@ -28,6 +28,7 @@ namespace eos
 {
     class ObservableStub :
         public Observable,
+        public DifferentiableObservable,
         public PrivateImplementationPattern<ObservableStub>
     {
         public:
@@ -39,6 +40,8 @@ namespace eos
 
             virtual double evaluate() const;
 
+            virtual Dual evaluate_with_gradient(const std::vector<Parameter> & parameters) const;
+
             virtual Kinematics kinematics();
 
             virtual Parameters parameters();
@@ -0,0 +1,284 @@
+/* vim: set sw=4 sts=4 et foldmethod=syntax : */
+
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of the EOS project. EOS is free software;
+ * you can redistribute it and/or modify it under the terms of the GNU General
+ * Public License version 2, as published by the Free Software Foundation.
+ *
+ * EOS is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program; if not, write to the Free Software Foundation, Inc., 59 Temple
+ * Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef EOS_GUARD_EOS_UTILS_PARAMETER_MEMOISER_HH
+#define EOS_GUARD_EOS_UTILS_PARAMETER_MEMOISER_HH 1
+
+#include <eos/utils/condition_variable.hh>
+#include <eos/utils/instantiation_policy.hh>
+#include <eos/utils/lock.hh>
+#include <eos/utils/mutex.hh>
+#include <eos/utils/parameters.hh>
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <optional>
+#include <tuple>
+
+namespace eos
+{
+    namespace impl
+    {
+        // source of unique ids for the instances of ParameterMemoiser; 0 is never used
+        inline std::atomic<unsigned long> parameter_memoiser_ids{ 1ul };
+    }
+
+    /*!
+     * ParameterMemoiser stores the results of a parameter-dependent function for the
+     * present values of a set of Parameters.
+     *
+     * All stored results are discarded as soon as the generation of the parameters
+     * changes, i.e., as soon as the value of any parameter changes. Each distinct set
+     * of arguments is therefore evaluated only once per parameter point. The results
+     * are shared among all threads that use the same instance.
+     *
+     * Lookups first check a small thread-local cache of recently used results, which
+     * requires neither a lock nor any writes to shared memory. Only if this fails, the
+     * shared results are looked up under a lock. Concurrent requests for the same,
+     * not yet available result are coalesced: one thread evaluates the function, and
+     * all other threads wait for its result.
+     */
+    template <typename Result_, typename ... Keys_>
+    class ParameterMemoiser :
+        public InstantiationPolicy<ParameterMemoiser<Result_, Keys_ ...>, NonCopyable>
+    {
+        public:
+            using KeyType = std::tuple<Keys_ ...>;
+
+            /// The maximal number of shared results per parameter point; the oldest results are discarded first.
+            static constexpr unsigned capacity = 1000u;
+
+        private:
+            // the most recently used results of one instance, within one thread
+            struct LocalCache
+            {
+                static constexpr unsigned size = 4u;
+
+                unsigned long id = 0ul;
+
+                unsigned long generation = 0ul;
+
+                std::array<std::optional<std::tuple<KeyType, Result_>>, size> entries;
+
+                unsigned next = 0u;
+            };
+
+            // each thread holds a direct-mapped table of local caches, shared by all instances of this type
+            static constexpr unsigned number_of_local_caches = 8u;
+
+            // a result that is being evaluated by one thread, and that other threads wait for
+            struct Evaluation
+            {
+                bool done = false;
+
+                std::optional<Result_> result;
+
+                std::exception_ptr error;
+            };
+
+            Parameters _parameters;
+
+            const unsigned long _id;
+
+            Mutex * const _mutex;
+
+            ConditionVariable * const _evaluated;
+
+            mutable unsigned long _generation;
+
+            mutable std::map<KeyType, Result_> _memoisations;
+
+            mutable std::deque<KeyType> _order;
+
+            mutable std::map<KeyType, std::shared_ptr<Evaluation>> _evaluations;
+
+            LocalCache & local_cache(const unsigned long & generation) const
+            {
+                static thread_local std::array<LocalCache, number_of_local_caches> local_caches;
+
+                LocalCache & result = local_caches[_id % number_of_local_caches];
+
+                // take over the cache from another instance, or from an outdated parameter point
+                if ((result.id != _id) || (result.generation != generation))
+                {
+                    result.id = _id;
+                    result.generation = generation;
+                    result.entries.fill(std::nullopt);
+                    result.next = 0u;
+                }
+
+                return result;
+            }
+
+            static void insert(LocalCache & cache, const KeyType & key, const Result_ & result)
+            {
+                cache.entries[cache.next].emplace(key, result);
+                cache.next = (cache.next + 1u) % LocalCache::size;
+            }
+
+            // requires that _mutex is locked
+            void store(const KeyType & key, const Result_ & result) const
+            {
+                if (! _memoisations.emplace(key, result).second)
+                    return;
+
+                _order.push_back(key);
+
+                if (_order.size() > capacity)
+                {
+                    _memoisations.erase(_order.front());
+                    _order.pop_front();
+                }
+            }
+
+        public:
+            explicit ParameterMemoiser(const Parameters & parameters) :
+                _parameters(parameters),
+                _id(impl::parameter_memoiser_ids.fetch_add(1ul, std::memory_order_relaxed)),
+                _mutex(new Mutex),
+                _evaluated(new ConditionVariable),
+                _generation(parameters.generation())
+            {
+            }
+
+            ~ParameterMemoiser()
+            {
+                delete _evaluated;
+                delete _mutex;
+            }
+
+            /*!
+             * Retrieve the result of f for the present parameter values, evaluating f only if necessary.
+             *
+             * @param f    The function; it is called as f(keys ...).
+             * @param keys The arguments of f, which identify the result.
+             */
+            template <typename Function_>
+            Result_ operator() (const Function_ & f, const Keys_ & ... keys) const
+            {
+                const unsigned long generation = _parameters.generation();
+                KeyType key(keys ...);
+
+                LocalCache & cache = local_cache(generation);
+                for (const auto & entry : cache.entries)
+                {
+                    if (entry && (std::get<0>(*entry) == key))
+                        return std::get<1>(*entry);
+                }
+
+                std::shared_ptr<Evaluation> evaluation;
+                {
+                    Lock l(*_mutex);
+
+                    if (generation > _generation)
+                    {
+                        _memoisations.clear();
+                        _order.clear();
+                        _evaluations.clear();
+                        _generation = generation;
+                    }
+
+                    // otherwise the parameters have changed since we read their generation; neither use nor store shared results
+                    if (generation == _generation)
+                    {
+                        auto i = _memoisations.find(key);
+                        if (_memoisations.end() != i)
+                        {
+                            insert(cache, key, i->second);
+                            return i->second;
+                        }
+
+                        // is another thread already evaluating f for the same arguments?
+                        auto e = _evaluations.find(key);
+                        if (_evaluations.end() != e)
+                        {
+                            std::shared_ptr<Evaluation> other = e->second;
+                            while (! other->done)
+                            {
+                                _evaluated->wait(*_mutex);
+                            }
+
+                            if (other->error)
+                                std::rethrow_exception(other->error);
+
+                            insert(cache, key, *other->result);
+                            return *other->result;
+                        }
+
+                        evaluation = std::make_shared<Evaluation>();
+                        _evaluations.emplace(key, evaluation);
+                    }
+                }
+
+                if (! evaluation)
+                    return f(keys ...);
+
+                // evaluate without holding the lock, so that other threads can proceed
+                std::optional<Result_> result;
+                std::exception_ptr error;
+                try
+                {
+                    result.emplace(f(keys ...));
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                {
+                    Lock l(*_mutex);
+
+                    // do not store results that might have been obtained from outdated parameter values
+                    if ((generation == _generation) && (! error))
+                        store(key, *result);
+
+                    auto e = _evaluations.find(key);
+                    if ((_evaluations.end() != e) && (e->second == evaluation))
+                        _evaluations.erase(e);
+
+                    evaluation->result = result;
+                    evaluation->error  = error;
+                    evaluation->done   = true;
+
+                    _evaluated->broadcast();
+                }
+
+                if (error)
+                    std::rethrow_exception(error);
+
+                // f might have used the thread-local caches of other instances in the meantime
+                if (generation == _parameters.generation())
+                    insert(local_cache(generation), key, *result);
+
+                return *result;
+            }
+
+            unsigned number_of_memoisations() const
+            {
+                Lock l(*_mutex);
+
+                return _memoisations.size();
+            }
+    };
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <eos/utils/stringify.hh>
 #include <eos/utils/wrapped_forward_iterator-impl.hh>
 
+#include <atomic>
 #include <cmath>
 #include <map>
 #include <random>
@@ -204,6 +205,20 @@ namespace eos
     struct Parameters::Data
     {
         std::vector<Parameter::Data> data;
+
+        // incremented whenever the value of any parameter changes
+        std::atomic<unsigned long> generation;
+
+        Data() :
+            generation(0)
+        {
+        }
+
+        Data(const Data & other) :
+            data(other.data),
+            generation(0)
+        {
+        }
     };
 
     template <>
@@ -338,6 +353,7 @@ namespace eos
                             << "Overriding existing parameter '" << name << "' with central value '" << central << "'";
 
                         parameters_data->data[i->second].value = central;
+                        ++parameters_data->generation;
                         if (has_min)
                         {
                             parameters_data->data[i->second].min = min;
@@ -666,6 +682,7 @@ namespace eos
             throw UnknownParameterError(name);
 
         _imp->parameters_data->data[i->second].value = value;
+        ++_imp->parameters_data->generation;
     }
 
     bool
@@ -678,6 +695,12 @@ namespace eos
         else return true;
     }
 
+    unsigned long
+    Parameters::generation() const
+    {
+        return _imp->parameters_data->generation.load(std::memory_order_acquire);
+    }
+
     Parameters::Iterator
     Parameters::begin() const
     {
@@ -702,6 +725,12 @@ namespace eos
         return _imp->sections.end();
     }
 
+    const void *
+    Parameters::identity() const
+    {
+        return _imp.get();
+    }
+
     bool
     Parameters::operator!= (const Parameters & rhs) const
     {
@@ -772,6 +801,7 @@ namespace eos
     Parameter::operator= (const double & value)
     {
         _parameters_data->data[_index].value = value;
+        ++_parameters_data->generation;
 
         return *this;
     }
@@ -780,6 +810,7 @@ namespace eos
     Parameter::set(const double & value)
     {
         _parameters_data->data[_index].value = value;
+        ++_parameters_data->generation;
     }
 
     void
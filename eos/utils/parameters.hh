@@ -186,6 +186,22 @@ namespace eos
              * @param file  The name of the YAML fie.
              */
             void override_from_file(const std::string & file);
+
+            /*!
+             * Retrieve the generation of the parameter values.
+             *
+             * The generation changes whenever the value of any parameter changes,
+             * and can be used to invalidate results that depend on the parameters.
+             */
+            unsigned long generation() const;
+
+            /*!
+             * Retrieve an opaque value that identifies the underlying implementation.
+             *
+             * All copies of a Parameters object share the same identity. The identities
+             * of two distinct underlying implementations differ as long as both exist.
+             */
+            const void * identity() const;
             ///@}
 
             /*!
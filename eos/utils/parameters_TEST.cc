@@ -19,7 +19,14 @@
  */
 
 #include <test/test.hh>
+#include <eos/utils/parameter-memoiser.hh>
 #include <eos/utils/parameters.hh>
+#include <eos/utils/thread_pool.hh>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace test;
 using namespace eos;
@@ -80,5 +87,94 @@ class ParametersTest :
                 TEST_CHECK_EQUAL(p.has("mass::tau"), true);
                 TEST_CHECK_EQUAL(p.has("mass::boing747"), false);
             }
+
+            // Generation
+            {
+                Parameters original = Parameters::Defaults();
+                Parameters clone = original.clone();
+                Parameter m_c = original["mass::c"];
+
+                const unsigned long generation = original.generation();
+                const unsigned long generation_clone = clone.generation();
+
+                m_c = 1.0;
+                TEST_CHECK(generation != original.generation());
+                TEST_CHECK_EQUAL(generation_clone, clone.generation());
+
+                const unsigned long generation_after_assignment = original.generation();
+                original.set("mass::c", 1.1);
+                TEST_CHECK(generation_after_assignment != original.generation());
+            }
+
+            // ParameterMemoiser
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_c = p["mass::c"];
+                m_c = 1.0;
+
+                unsigned calls = 0;
+                auto f = [&calls, &m_c] (const double & x) { ++calls; return m_c() * x; };
+
+                ParameterMemoiser<double, double> memoiser(p);
+
+                TEST_CHECK_EQUAL(memoiser(f, 2.0), 2.0);
+                TEST_CHECK_EQUAL(memoiser(f, 2.0), 2.0);
+                TEST_CHECK_EQUAL(memoiser(f, 3.0), 3.0);
+                TEST_CHECK_EQUAL(calls, 2u);
+                TEST_CHECK_EQUAL(memoiser.number_of_memoisations(), 2u);
+
+                // a change of any parameter invalidates the memoised results
+                m_c = 2.0;
+                TEST_CHECK_EQUAL(memoiser(f, 2.0), 4.0);
+                TEST_CHECK_EQUAL(calls, 3u);
+                TEST_CHECK_EQUAL(memoiser.number_of_memoisations(), 1u);
+
+                // the oldest results are discarded first once the capacity is exceeded
+                const unsigned capacity = ParameterMemoiser<double, double>::capacity;
+                for (unsigned i = 0 ; i <= capacity ; ++i)
+                {
+                    memoiser(f, 10.0 + i);
+                }
+                TEST_CHECK_EQUAL(memoiser.number_of_memoisations(), capacity);
+                calls = 0;
+                TEST_CHECK_EQUAL(memoiser(f, 2.0), 4.0);
+                TEST_CHECK_EQUAL(memoiser(f, 10.0 + capacity), 2.0 * (10.0 + capacity));
+                TEST_CHECK_EQUAL(calls, 1u);
+            }
+
+            // ParameterMemoiser, concurrent requests for the same result are evaluated only once
+            {
+                Parameters p = Parameters::Defaults();
+                Parameter m_c = p["mass::c"];
+                m_c = 1.0;
+
+                std::atomic<unsigned> calls{ 0u };
+                auto f = [&calls, &m_c] (const double & x)
+                {
+                    ++calls;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                    return m_c() * x;
+                };
+
+                ParameterMemoiser<double, double> memoiser(p);
+
+                std::vector<double> results(16, 0.0);
+                std::vector<Ticket> tickets;
+                for (auto & result : results)
+                {
+                    tickets.push_back(ThreadPool::instance()->enqueue(std::function<void (void)>([&memoiser, &f, &result] () { result = memoiser(f, 2.0); })));
+                }
+
+                for (auto & ticket : tickets)
+                {
+                    ticket.wait();
+                }
+
+                TEST_CHECK_EQUAL(calls.load(), 1u);
+                for (const auto & result : results)
+                {
+                    TEST_CHECK_EQUAL(result, 2.0);
+                }
+            }
         }
 } parameters_test;
@@ -22,8 +22,10 @@
 
 #include "eos/constraint.hh"
 #include "eos/observable.hh"
+#include "eos/observable-batch.hh"
 #include "eos/reference.hh"
 #include "eos/signal-pdf.hh"
+#include "eos/signal-pdf-sampler.hh"
 #include "eos/models/model.hh"
 #include "eos/utils/kinematic.hh"
 #include "eos/utils/log.hh"
@@ -31,11 +33,18 @@
 #include "eos/utils/options.hh"
 #include "eos/utils/qualified-name.hh"
 #include "eos/utils/reference-name.hh"
+#include "eos/utils/stringify.hh"
 #include "eos/utils/units.hh"
+#include "eos/statistics/delayed-acceptance-sampler.hh"
+#include "eos/statistics/fast-slow-sampler.hh"
 #include "eos/statistics/goodness-of-fit.hh"
 #include "eos/statistics/log-likelihood.hh"
 #include "eos/statistics/log-posterior.hh"
 #include "eos/statistics/log-prior.hh"
+#include "eos/statistics/no-u-turn-sampler.hh"
+#include "eos/statistics/numerical-derivatives.hh"
+#include "eos/statistics/posterior-predictive.hh"
+#include "eos/statistics/pseudo-experiments.hh"
 #include "eos/statistics/test-statistic-impl.hh"
 
 #include "eos/rare-b-decays/charm-loops-impl.hh"
@@ -43,6 +52,11 @@
 #include <boost/python.hpp>
 #include <boost/python/raw_function.hpp>
 
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
 using namespace boost::python;
 using namespace eos;
 
@@ -87,6 +101,56 @@ namespace impl
         return object();
     }
 
+    // the results of PseudoExperiments as a table
+    std::string
+    PseudoExperiments_table(const PseudoExperiments & pseudo_experiments)
+    {
+        std::stringstream result;
+        pseudo_experiments.write(result);
+
+        return result.str();
+    }
+
+    // constructor for class PosteriorPredictive from Python lists of observable handles and of parameters
+    PosteriorPredictive *
+    PosteriorPredictive_ctor(const ObservableCache & cache, const list & observables, const list & parameters, const PosteriorPredictive::Config & config)
+    {
+        std::vector<ObservableCache::Id> observable_ids;
+        for (unsigned i = 0 ; i < len(observables) ; ++i)
+        {
+            observable_ids.push_back(extract<ObservableCache::Id>(observables[i]));
+        }
+
+        std::vector<Parameter::Id> parameter_ids;
+        for (unsigned i = 0 ; i < len(parameters) ; ++i)
+        {
+            parameter_ids.push_back(extract<Parameter>(parameters[i])().id());
+        }
+
+        return new PosteriorPredictive(cache, observable_ids, parameter_ids, config);
+    }
+
+    PosteriorPredictive *
+    PosteriorPredictive_default_ctor(const ObservableCache & cache, const list & observables, const list & parameters)
+    {
+        return PosteriorPredictive_ctor(cache, observables, parameters, PosteriorPredictive::Config());
+    }
+
+    // convert an array of samples into a contiguous array of doubles with one column per varied parameter
+    object
+    PosteriorPredictive_samples(const PosteriorPredictive & predictive, const object & samples)
+    {
+        object result = import("numpy").attr("ascontiguousarray")(samples, "float64");
+
+        if ((2 != len(result.attr("shape"))) || (predictive.number_of_parameters() != extract<unsigned>(result.attr("shape")[1])()))
+        {
+            PyErr_SetString(PyExc_ValueError, "the samples must be a two-dimensional array with one column per varied parameter");
+            throw_error_already_set();
+        }
+
+        return result;
+    }
+
     // raw constructor for class Options
     object
     Options_ctor(tuple args, dict kwargs)
@@ -192,9 +256,285 @@ namespace impl
         PyErr_SetString(PyExc_RuntimeError, e.what());
     }
 
+    // the number of native calls that presently run with the GIL released
+    std::atomic<unsigned> gil_released(0);
+
+    // releases the GIL for the lifetime of this object
+    class ScopedGILRelease
+    {
+        private:
+            PyThreadState * _state;
+
+        public:
+            ScopedGILRelease() :
+                _state(PyEval_SaveThread())
+            {
+                ++gil_released;
+            }
+
+            ~ScopedGILRelease()
+            {
+                --gil_released;
+                PyEval_RestoreThread(_state);
+            }
+    };
+
+    // acquires the GIL for the lifetime of this object
+    class ScopedGILAcquire
+    {
+        private:
+            PyGILState_STATE _state;
+
+        public:
+            ScopedGILAcquire() :
+                _state(PyGILState_Ensure())
+            {
+            }
+
+            ~ScopedGILAcquire()
+            {
+                PyGILState_Release(_state);
+            }
+    };
+
     void logging_callback(PyObject * c, const std::string & id, const LogLevel & l, const std::string & m)
     {
-        call<void>(c, id, l, m);
+        // messages can be emitted from any thread while the GIL is released
+        if (0 < gil_released)
+        {
+            ScopedGILAcquire gil;
+            call<void>(c, id, l, m);
+        }
+        else
+        {
+            call<void>(c, id, l, m);
+        }
+    }
+
+    // access to a contiguous array of doubles via the buffer protocol
+    class DoubleBuffer
+    {
+        private:
+            Py_buffer _view;
+
+        public:
+            DoubleBuffer(const object & o, const bool & writable = false)
+            {
+                if (0 != PyObject_GetBuffer(o.ptr(), &_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0)))
+                    throw_error_already_set();
+
+                if ((sizeof(double) != _view.itemsize) || (nullptr == _view.format) || ('d' != _view.format[std::strlen(_view.format) - 1]))
+                {
+                    PyBuffer_Release(&_view);
+                    PyErr_SetString(PyExc_TypeError, "expected an array of double-precision floating point numbers");
+                    throw_error_already_set();
+                }
+            }
+
+            ~DoubleBuffer()
+            {
+                PyBuffer_Release(&_view);
+            }
+
+            double * data() const
+            {
+                return static_cast<double *>(_view.buf);
+            }
+
+            unsigned size() const
+            {
+                return _view.len / sizeof(double);
+            }
+    };
+
+    // collect a dictionary of equally long arrays into a row-major matrix with one column per key; returns the number of rows
+    unsigned
+    columns_to_rows(const object & np, const dict & columns, std::vector<std::string> & names, std::vector<double> & rows)
+    {
+        const list items = columns.items();
+        const unsigned dim = len(items);
+
+        std::vector<object> arrays;
+        unsigned n = 0;
+        for (unsigned j = 0 ; j < dim ; ++j)
+        {
+            names.push_back(extract<std::string>(str(items[j][0])));
+            arrays.push_back(np.attr("ascontiguousarray")(items[j][1], "float64").attr("ravel")());
+
+            const unsigned n_j = len(arrays.back());
+            if ((0 != j) && (n != n_j))
+            {
+                PyErr_SetString(PyExc_ValueError, ("the array for '" + names.back() + "' has a different length than the preceding arrays").c_str());
+                throw_error_already_set();
+            }
+            n = n_j;
+        }
+
+        rows.resize(n * dim);
+        for (unsigned j = 0 ; j < dim ; ++j)
+        {
+            const DoubleBuffer buffer(arrays[j]);
+            for (unsigned i = 0 ; i < n ; ++i)
+            {
+                rows[i * dim + j] = buffer.data()[i];
+            }
+        }
+
+        return n;
+    }
+
+    // evaluate an observable for NumPy arrays of kinematic variables and parameters, with the GIL released
+    object
+    Observable_evaluate_batch(const ObservablePtr & observable, const dict & kinematics, const dict & parameters)
+    {
+        const object np = import("numpy");
+
+        std::vector<std::string> kinematic_variables, parameter_names;
+        std::vector<double> kinematic_points, parameter_points;
+        const unsigned number_of_kinematic_points = columns_to_rows(np, kinematics, kinematic_variables, kinematic_points);
+        const unsigned number_of_parameter_points = columns_to_rows(np, parameters, parameter_names, parameter_points);
+
+        list shape;
+        if (! parameter_names.empty())
+            shape.append(number_of_parameter_points);
+        if (! kinematic_variables.empty())
+            shape.append(number_of_kinematic_points);
+
+        object results = np.attr("empty")(tuple(shape), "float64");
+        {
+            const DoubleBuffer buffer(results, true);
+
+            ScopedGILRelease gil;
+            evaluate_batch(observable, kinematic_variables, kinematic_points.data(), number_of_kinematic_points,
+                    parameter_names, parameter_points.data(), number_of_parameter_points, buffer.data());
+        }
+
+        return results;
+    }
+
+    // predict the observables for a NumPy array of samples, with the GIL released
+    object
+    PosteriorPredictive_predict(PosteriorPredictive & predictive, const object & samples)
+    {
+        const object array = PosteriorPredictive_samples(predictive, samples);
+        const unsigned n = len(array);
+
+        object results = import("numpy").attr("empty")(make_tuple(n, predictive.number_of_observables()), "float64");
+        {
+            const DoubleBuffer input(array), output(results, true);
+
+            ScopedGILRelease gil;
+            predictive.predict(input.data(), n, output.data());
+        }
+
+        return results;
+    }
+
+    // predict the observables for a NumPy array of samples and write them to a .npy file, with the GIL released
+    void
+    PosteriorPredictive_predict_to_file(PosteriorPredictive & predictive, const object & samples, const std::string & path)
+    {
+        const object array = PosteriorPredictive_samples(predictive, samples);
+        const unsigned n = len(array);
+
+        const DoubleBuffer input(array);
+
+        ScopedGILRelease gil;
+        predictive.predict(input.data(), n, path);
+    }
+
+    // the names of the kinematic variables, in the order of the columns of evaluate_batch and of the SignalPDFSampler
+    list
+    SignalPDF_kinematic_variable_names(const SignalPDF & pdf)
+    {
+        list result;
+        for (const auto & d : pdf)
+        {
+            result.append(d.parameter->name());
+        }
+
+        return result;
+    }
+
+    // evaluate the log(PDF) for a NumPy array of kinematic points, with the GIL released
+    object
+    SignalPDF_evaluate_batch(const SignalPDF & pdf, const object & points)
+    {
+        const object np = import("numpy");
+        unsigned dim = 0;
+        for (auto d = pdf.begin() ; d != pdf.end() ; ++d)
+        {
+            ++dim;
+        }
+
+        const object array = np.attr("ascontiguousarray")(points, "float64");
+        if ((2 != len(array.attr("shape"))) || (dim != extract<unsigned>(array.attr("shape")[1])()))
+        {
+            PyErr_SetString(PyExc_ValueError, ("expected a two-dimensional array with " + stringify(dim) + " columns").c_str());
+            throw_error_already_set();
+        }
+        const unsigned n = len(array);
+
+        object results = np.attr("empty")(n, "float64");
+        {
+            const DoubleBuffer input(array), output(results, true);
+
+            ScopedGILRelease gil;
+            pdf.evaluate_batch(input.data(), n, output.data());
+        }
+
+        return results;
+    }
+
+    // draw events into a preallocated NumPy array, with the GIL released
+    void
+    SignalPDFSampler_sample_into(SignalPDFSampler & sampler, const object & events)
+    {
+        if ((2 != len(events.attr("shape"))) || (sampler.dimension() != extract<unsigned>(events.attr("shape")[1])()))
+        {
+            PyErr_SetString(PyExc_ValueError, ("expected a two-dimensional array with " + stringify(sampler.dimension()) + " columns").c_str());
+            throw_error_already_set();
+        }
+        const unsigned n = len(events);
+
+        const DoubleBuffer output(events, true);
+
+        ScopedGILRelease gil;
+        sampler.sample(n, output.data());
+    }
+
+    // draw events into a new NumPy array, with the GIL released
+    object
+    SignalPDFSampler_sample(SignalPDFSampler & sampler, const unsigned & n)
+    {
+        object events = import("numpy").attr("empty")(make_tuple(n, sampler.dimension()), "float64");
+        SignalPDFSampler_sample_into(sampler, events);
+
+        return events;
+    }
+
+    // draw events and write them to a text file, with the GIL released
+    void
+    SignalPDFSampler_sample_to_file(SignalPDFSampler & sampler, const unsigned & n, const std::string & path)
+    {
+        std::ofstream output(path);
+        if (! output)
+        {
+            PyErr_SetString(PyExc_IOError, ("cannot open '" + path + "' for writing").c_str());
+            throw_error_already_set();
+        }
+
+        {
+            ScopedGILRelease gil;
+            sampler.sample(n, output);
+        }
+
+        output.close();
+        if (! output)
+        {
+            PyErr_SetString(PyExc_IOError, ("cannot write to '" + path + "'").c_str());
+            throw_error_already_set();
+        }
     }
 
     void register_log_callback(PyObject * c)
@@ -552,7 +892,7 @@ BOOST_PYTHON_MODULE(_eos)
             :returns: An internal handle to the cached observable. The observable's value can be retrieved using ``cache[handle]``.
             :rtype: int
         )", args("observable"))
-        .def("update", &ObservableCache::update, R"(
+        .def("update", (void (ObservableCache::*)()) &ObservableCache::update, R"(
             Update the cache for the current parameter point.
         )")
         ;
@@ -582,7 +922,7 @@ BOOST_PYTHON_MODULE(_eos)
         .def("add", (void (LogLikelihood::*)(const Constraint &)) &LogLikelihood::add)
         .def("__iter__", range(&LogLikelihood::begin, &LogLikelihood::end))
         .def("observable_cache", &LogLikelihood::observable_cache)
-        .def("evaluate", &LogLikelihood::operator())
+        .def("evaluate", (double (LogLikelihood::*)() const) &LogLikelihood::operator())
         ;
 
     // Constraint
@@ -700,11 +1040,16 @@ BOOST_PYTHON_MODULE(_eos)
         ;
 
     // LogPosterior
+    ::impl::std_vector_to_python_converter<double> converter_log_posterior_gradient;
+    ::impl::std_pair_to_python_converter<double, std::vector<double>> converter_log_posterior_value_and_gradient;
     class_<LogPosterior>("LogPosterior", init<LogLikelihood>())
         .def("add", &LogPosterior::add)
         .def("log_likelihood", &LogPosterior::log_likelihood)
         .def("log_priors", range(&LogPosterior::begin_priors, &LogPosterior::end_priors))
         .def("evaluate", &LogPosterior::evaluate)
+        .def("evaluate_with_gradient", &LogPosterior::evaluate_with_gradient, R"(
+            Returns the value of the log(posterior) and its gradient with respect to the varied parameters.
+        )")
         ;
 
     // test_statistics::ChiSquare
@@ -728,6 +1073,243 @@ BOOST_PYTHON_MODULE(_eos)
         )")
         ;
 
+    // NumericalDerivatives
+    ::impl::std_vector_to_python_converter<std::vector<double>> converter_numerical_derivatives_matrix;
+    class_<NumericalDerivatives>("NumericalDerivatives", R"(
+            Computes the derivatives of the log(posterior) with respect to its varied parameters
+            by means of finite differences. The perturbed points are evaluated in parallel.
+
+            :param log_posterior: The log(posterior) whose derivatives shall be computed.
+            :type log_posterior: eos.LogPosterior
+        )", init<LogPosterior>())
+        .def("gradient", &NumericalDerivatives::gradient, R"(
+            Returns the gradient of the log(posterior) at the current parameter point.
+        )")
+        .def("hessian", &NumericalDerivatives::hessian, R"(
+            Returns the Hessian matrix of the log(posterior) at the current parameter point.
+        )")
+        .def("fisher_matrix", &NumericalDerivatives::fisher_matrix, R"(
+            Returns the observed Fisher information matrix, i.e., the negative Hessian matrix of
+            the log(likelihood), at the current parameter point.
+        )")
+        ;
+
+    // DelayedAcceptanceSampler
+    {
+        using Config = DelayedAcceptanceSampler::Config;
+
+        scope sampler = class_<DelayedAcceptanceSampler>("DelayedAcceptanceSampler", R"(
+                Draws samples from a log(posterior) using a two-stage Metropolis algorithm.
+
+                Each proposal is first screened with a cheap surrogate. Only proposals that pass are
+                evaluated with the full posterior. The stationary distribution is the full posterior.
+
+                :param log_posterior: The log(posterior) from which samples shall be drawn.
+                :type log_posterior: eos.LogPosterior
+                :param surrogate: A cheap approximation of the log(posterior). If omitted, a Gaussian emulator is trained during adapt().
+                :type surrogate: eos.LogPosterior, optional
+                :param config: The configuration of the sampler.
+                :type config: eos.DelayedAcceptanceSampler.Config, optional
+            )", init<LogPosterior>())
+            .def(init<LogPosterior, Config>())
+            .def(init<LogPosterior, LogPosterior>())
+            .def(init<LogPosterior, LogPosterior, Config>())
+            .def("adapt", &DelayedAcceptanceSampler::adapt, R"(
+                Adapts the proposal and, if applicable, trains the emulator in the given number of steps.
+            )")
+            .def("sample", &DelayedAcceptanceSampler::sample, R"(
+                Returns the given number of samples of the varied parameters.
+            )")
+            .def("first_stage_acceptance_rate", &DelayedAcceptanceSampler::first_stage_acceptance_rate)
+            .def("acceptance_rate", &DelayedAcceptanceSampler::acceptance_rate)
+            .def("full_evaluations", &DelayedAcceptanceSampler::full_evaluations)
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the DelayedAcceptanceSampler. All setters return the configuration itself.
+            )")
+            .def("emulator", (bool (Config::*)() const) &Config::emulator)
+            .def("emulator", (Config & (Config::*)(const bool &)) &Config::emulator, return_self<>())
+            .def("seed", (unsigned long (Config::*)() const) &Config::seed)
+            .def("seed", (Config & (Config::*)(const unsigned long &)) &Config::seed, return_self<>())
+            ;
+    }
+
+    // FastSlowSampler
+    ::impl::std_vector_to_python_converter<bool> converter_fast_slow_sampler_fast;
+    {
+        using Config = FastSlowSampler::Config;
+
+        scope sampler = class_<FastSlowSampler>("FastSlowSampler", R"(
+                Draws samples from a log(posterior) using blocked Metropolis updates, one block per prior.
+
+                Blocks whose parameters affect only few observables are considered fast, and are updated
+                several times per sweep. After each proposal, only the affected observables are recomputed.
+
+                :param log_posterior: The log(posterior) from which samples shall be drawn.
+                :type log_posterior: eos.LogPosterior
+                :param config: The configuration of the sampler.
+                :type config: eos.FastSlowSampler.Config, optional
+            )", init<LogPosterior>())
+            .def(init<LogPosterior, Config>())
+            .def("adapt", &FastSlowSampler::adapt, R"(
+                Adapts the proposal scales in the given number of sweeps.
+            )")
+            .def("sample", &FastSlowSampler::sample, R"(
+                Returns the given number of samples of the varied parameters.
+            )")
+            .def("costs", &FastSlowSampler::costs)
+            .def("fast", &FastSlowSampler::fast)
+            .def("acceptance_rates", &FastSlowSampler::acceptance_rates)
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the FastSlowSampler. All setters return the configuration itself.
+            )")
+            .def("oversampling", (unsigned (Config::*)() const) &Config::oversampling)
+            .def("oversampling", (Config & (Config::*)(const unsigned &)) &Config::oversampling, return_self<>())
+            .def("fast_threshold", (double (Config::*)() const) &Config::fast_threshold)
+            .def("fast_threshold", (Config & (Config::*)(const double &)) &Config::fast_threshold, return_self<>())
+            .def("seed", (unsigned long (Config::*)() const) &Config::seed)
+            .def("seed", (Config & (Config::*)(const unsigned long &)) &Config::seed, return_self<>())
+            ;
+    }
+
+    // NoUTurnSampler
+    {
+        using Config = NoUTurnSampler::Config;
+
+        scope sampler = class_<NoUTurnSampler>("NoUTurnSampler", R"(
+                Draws samples from a log(posterior) using the No-U-Turn variant of Hamiltonian Monte Carlo.
+
+                The chain starts at the current values of the posterior's varied parameters.
+
+                :param log_posterior: The log(posterior) from which samples shall be drawn.
+                :type log_posterior: eos.LogPosterior
+                :param config: The configuration of the sampler.
+                :type config: eos.NoUTurnSampler.Config, optional
+            )", init<LogPosterior>())
+            .def(init<LogPosterior, Config>())
+            .def("adapt", &NoUTurnSampler::adapt, R"(
+                Adapts the step size and the mass matrix in the given number of steps.
+            )")
+            .def("sample", &NoUTurnSampler::sample, R"(
+                Returns the given number of samples of the varied parameters.
+            )")
+            .def("step_size", &NoUTurnSampler::step_size)
+            .def("inverse_mass_matrix", &NoUTurnSampler::inverse_mass_matrix)
+            .def("acceptance_rate", &NoUTurnSampler::acceptance_rate)
+            .def("divergences", &NoUTurnSampler::divergences)
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the NoUTurnSampler. All setters return the configuration itself.
+            )")
+            .def("target_acceptance", (double (Config::*)() const) &Config::target_acceptance)
+            .def("target_acceptance", (Config & (Config::*)(const double &)) &Config::target_acceptance, return_self<>())
+            .def("max_tree_depth", (unsigned (Config::*)() const) &Config::max_tree_depth)
+            .def("max_tree_depth", (Config & (Config::*)(const unsigned &)) &Config::max_tree_depth, return_self<>())
+            .def("dense_mass_matrix", (bool (Config::*)() const) &Config::dense_mass_matrix)
+            .def("dense_mass_matrix", (Config & (Config::*)(const bool &)) &Config::dense_mass_matrix, return_self<>())
+            .def("generator_space", (bool (Config::*)() const) &Config::generator_space)
+            .def("generator_space", (Config & (Config::*)(const bool &)) &Config::generator_space, return_self<>())
+            .def("finite_differences", (bool (Config::*)() const) &Config::finite_differences)
+            .def("finite_differences", (Config & (Config::*)(const bool &)) &Config::finite_differences, return_self<>())
+            .def("seed", (unsigned long (Config::*)() const) &Config::seed)
+            .def("seed", (Config & (Config::*)(const unsigned long &)) &Config::seed, return_self<>())
+            ;
+    }
+
+    // PosteriorPredictive
+    {
+        using Config = PosteriorPredictive::Config;
+
+        scope posterior_predictive = class_<PosteriorPredictive>("PosteriorPredictive", R"(
+                Predicts a set of observables for samples of the varied parameters, e.g., samples of a posterior.
+
+                The samples are distributed over the threads of the thread pool, each of which uses its own
+                copy of the observable cache. The GIL is released during the predictions.
+
+                :param cache: The cache that holds the observables.
+                :type cache: eos.ObservableCache
+                :param observables: The handles of the observables to predict, as returned by ``cache.add``.
+                :type observables: list of int
+                :param parameters: The varied parameters, in the order of the columns of the samples.
+                :type parameters: list of eos.Parameter
+                :param config: The configuration.
+                :type config: eos.PosteriorPredictive.Config, optional
+            )", no_init)
+            .def("__init__", make_constructor(&::impl::PosteriorPredictive_default_ctor))
+            .def("__init__", make_constructor(&::impl::PosteriorPredictive_ctor))
+            .def("predict", &::impl::PosteriorPredictive_predict, R"(
+                Predicts the observables for the given samples.
+
+                :param samples: The samples, with one row per sample and one column per varied parameter.
+                :type samples: 2D numpy array
+
+                :return: The predictions, with one row per sample and one column per observable. Failed predictions yield NaN.
+                :rtype: 2D numpy array
+            )", args("self", "samples"))
+            .def("predict_to_file", &::impl::PosteriorPredictive_predict_to_file, R"(
+                Predicts the observables for the given samples, and writes the predictions to a NumPy ``.npy`` file.
+
+                The predictions are evaluated and written in chunks, such that they need not be held in memory at once.
+
+                :param samples: The samples, with one row per sample and one column per varied parameter.
+                :type samples: 2D numpy array
+                :param path: The path of the output file.
+                :type path: str
+            )", args("self", "samples", "path"))
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the PosteriorPredictive. All setters return the configuration itself.
+            )")
+            .def("chunk_size", (unsigned (Config::*)() const) &Config::chunk_size)
+            .def("chunk_size", (Config & (Config::*)(const unsigned &)) &Config::chunk_size, return_self<>())
+            ;
+    }
+
+    // PseudoExperiments
+    {
+        using Config = PseudoExperiments::Config;
+
+        scope pseudo_experiments = class_<PseudoExperiments>("PseudoExperiments", R"(
+                Generates toy data sets for a log(posterior) and refits each of them.
+
+                The toys are generated at the current values of the posterior's varied parameters. For each toy,
+                all measurements are replaced by pseudo measurements, and the posterior is maximised with the
+                Nelder-Mead simplex algorithm. The toys are distributed over the threads of the thread pool.
+
+                :param log_posterior: The log(posterior) for which toys shall be generated.
+                :type log_posterior: eos.LogPosterior
+                :param config: The configuration of the fits.
+                :type config: eos.PseudoExperiments.Config, optional
+            )", init<LogPosterior>())
+            .def(init<LogPosterior, Config>())
+            .def("run", &PseudoExperiments::run, R"(
+                Generates and fits the given number of pseudo experiments.
+            )")
+            .def("generating_point", &PseudoExperiments::generating_point, return_value_policy<copy_const_reference>())
+            .def("table", &::impl::PseudoExperiments_table, R"(
+                Returns the results of all pseudo experiments as a whitespace-separated table, one pseudo experiment per line.
+            )")
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the PseudoExperiments. All setters return the configuration itself.
+            )")
+            .def("max_iterations", (unsigned (Config::*)() const) &Config::max_iterations)
+            .def("max_iterations", (Config & (Config::*)(const unsigned &)) &Config::max_iterations, return_self<>())
+            .def("tolerance", (double (Config::*)() const) &Config::tolerance)
+            .def("tolerance", (Config & (Config::*)(const double &)) &Config::tolerance, return_self<>())
+            .def("step_size", (double (Config::*)() const) &Config::step_size)
+            .def("step_size", (Config & (Config::*)(const double &)) &Config::step_size, return_self<>())
+            .def("seed", (unsigned long (Config::*)() const) &Config::seed)
+            .def("seed", (Config & (Config::*)(const unsigned long &)) &Config::seed, return_self<>())
+            ;
+    }
+
     // }}}
 
     // {{{ eos/
@@ -785,6 +1367,22 @@ BOOST_PYTHON_MODULE(_eos)
             :return: The value of the observable.
             :rtype: float
         )", args("self"))
+        .def("evaluate_batch", &::impl::Observable_evaluate_batch, (arg("self"), arg("kinematics") = dict(), arg("parameters") = dict()), R"(
+            Evaluates the observable for arrays of values of its kinematic variables and, optionally, of its parameters.
+
+            The evaluations are carried out in parallel on independent copies of the observable, with the GIL released.
+            All other parameters and kinematic variables retain their present values. The observable itself is not modified.
+            Evaluations that fail yield NaN, and the failures are reported through the EOS log at the error level.
+
+            :param kinematics: The values of the varied kinematic variables, keyed by their names. All arrays must have the same length.
+            :type kinematics: dict of str to array-like of float, optional
+            :param parameters: The values of the varied parameters, keyed by their names. All arrays must have the same length.
+            :type parameters: dict of str to array-like of float, optional
+
+            :return: The values of the observable, with one row per parameter point and one column per kinematic point.
+                     Dimensions that are not varied are dropped.
+            :rtype: numpy.ndarray
+        )")
         .def("name", &Observable::name, return_value_policy<copy_const_reference>(), R"(
             Returns the name of the observable.
         )")
@@ -883,6 +1481,20 @@ BOOST_PYTHON_MODULE(_eos)
         .def("kinematics", &SignalPDF::kinematics, R"(
             Returns the set of kinematic variables bound to this PDF.
         )")
+        .def("kinematic_variable_names", &::impl::SignalPDF_kinematic_variable_names, R"(
+            Returns the names of the kinematic variables, in the order of the columns used by
+            :meth:`evaluate_batch <eos.SignalPDF.evaluate_batch>` and by :class:`eos.SignalPDFSampler`.
+        )", args("self"))
+        .def("evaluate_batch", &::impl::SignalPDF_evaluate_batch, R"(
+            Evaluates the log(PDF) at several kinematic points at once. The bound kinematic variables are not changed,
+            and the GIL is released during the evaluation.
+
+            :param points: The kinematic points, with one row per point and one column per kinematic variable.
+            :type points: 2D numpy array
+
+            :return: The log(PDF) for each point.
+            :rtype: 1D numpy array
+        )", args("self", "points"))
         ;
 
     // SignalPDFEntry
@@ -898,6 +1510,71 @@ BOOST_PYTHON_MODULE(_eos)
         .def("__iter__", range(&SignalPDFs::begin, &SignalPDFs::end))
         ;
 
+    // SignalPDFSampler
+    {
+        using Config = SignalPDFSampler::Config;
+
+        scope sampler = class_<SignalPDFSampler>("SignalPDFSampler", R"(
+                Draws events from a signal PDF using accept-reject sampling with an adaptive envelope.
+
+                If the expected acceptance efficiency is too small, Metropolis chains are used instead.
+                The events are generated concurrently and only depend on the seed.
+
+                :param pdf: The PDF from which events shall be drawn.
+                :type pdf: eos.SignalPDF
+                :param config: The configuration of the sampler.
+                :type config: eos.SignalPDFSampler.Config, optional
+            )", init<SignalPDFPtr>())
+            .def(init<SignalPDFPtr, Config>())
+            .def("sample", &::impl::SignalPDFSampler_sample, R"(
+                Returns the given number of events. The GIL is released while the events are drawn.
+
+                :param n: The number of events.
+                :type n: int
+
+                :return: The events, with one row per event and one column per kinematic variable, in the order of
+                    :meth:`SignalPDF.kinematic_variable_names <eos.SignalPDF.kinematic_variable_names>`.
+                :rtype: 2D numpy array
+            )", args("self", "n"))
+            .def("sample_into", &::impl::SignalPDFSampler_sample_into, R"(
+                Draws events into a preallocated array, one event per row. The GIL is released while the events are drawn.
+
+                :param events: The array, with one column per kinematic variable.
+                :type events: 2D numpy array of float64, C-contiguous and writable
+            )", args("self", "events"))
+            .def("sample_to_file", &::impl::SignalPDFSampler_sample_to_file, R"(
+                Draws events and writes them to a text file, one event per line. The GIL is released while the events are drawn.
+
+                The events are generated and written in chunks, such that they need not be held in memory at once.
+
+                :param n: The number of events.
+                :type n: int
+                :param path: The path of the output file, which is overwritten if it exists.
+                :type path: str
+            )", args("self", "n", "path"))
+            .def("dimension", &SignalPDFSampler::dimension)
+            .def("markov_chain", &SignalPDFSampler::markov_chain)
+            .def("efficiency", &SignalPDFSampler::efficiency)
+            ;
+
+        class_<Config>("Config", R"(
+                Configuration of the SignalPDFSampler. All setters return the configuration itself.
+            )")
+            .def("scan_points", (unsigned (Config::*)() const) &Config::scan_points)
+            .def("scan_points", (Config & (Config::*)(const unsigned &)) &Config::scan_points, return_self<>())
+            .def("safety_factor", (double (Config::*)() const) &Config::safety_factor)
+            .def("safety_factor", (Config & (Config::*)(const double &)) &Config::safety_factor, return_self<>())
+            .def("min_efficiency", (double (Config::*)() const) &Config::min_efficiency)
+            .def("min_efficiency", (Config & (Config::*)(const double &)) &Config::min_efficiency, return_self<>())
+            .def("burn_in", (unsigned (Config::*)() const) &Config::burn_in)
+            .def("burn_in", (Config & (Config::*)(const unsigned &)) &Config::burn_in, return_self<>())
+            .def("stride", (unsigned (Config::*)() const) &Config::stride)
+            .def("stride", (Config & (Config::*)(const unsigned &)) &Config::stride, return_self<>())
+            .def("seed", (unsigned long (Config::*)() const) &Config::seed)
+            .def("seed", (Config & (Config::*)(const unsigned long &)) &Config::seed, return_self<>())
+            ;
+    }
+
     // Analytic Charm Loops
     def("delta_c7", &agv_2019a::delta_c7);
     def("delta_c7_Qc", &agv_2019a::delta_c7_Qc);
@@ -427,14 +427,10 @@ class Analysis:
             else:
                 return(parameter_samples, weights)
         else:
-            observable_samples = []
-            for parameters in parameter_samples:
-                for p, v in zip(self.varied_parameters, parameters):
-                    p.set(v)
+            varied = { p.name(): parameter_samples[:, i] for i, p in enumerate(self.varied_parameters) }
+            observable_samples = np.array([o.evaluate_batch(parameters=varied) for o in observables]).T
 
-                observable_samples.append([o.evaluate() for o in observables])
-
-            return(parameter_samples, weights, np.array(observable_samples))
+            return(parameter_samples, weights, observable_samples)
 
 
     def sample_pmc(self, log_proposal, step_N=1000, steps=10, final_N=5000, rng=np.random.mtrand,
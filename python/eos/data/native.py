@@ -503,6 +503,30 @@ class Prediction:
         :param weights: Weights on a linear scale as a 1D array of shape (N, ).
         :type weights: 1D numpy array
         """
+        if not samples.shape[1] == len(observables):
+            raise RuntimeError('Shape of samples {} incompatible with number of observables {}'.format(samples.shape, len(observables)))
+
+        if not samples.shape[0] == weights.shape[0]:
+            raise RuntimeError('Shape of weights {} incompatible with shape of samples {}'.format(weights.shape, samples.shape))
+
+        Prediction.create_without_samples(path, observables, weights)
+        _np.save(os.path.join(path, 'samples.npy'), samples)
+
+
+    @staticmethod
+    def create_without_samples(path, observables, weights):
+        """ Write a new Prediction object to disk, except for its samples.
+
+        The samples are expected to be written to the file ``samples.npy`` within the storage location separately,
+        e.g., by :meth:`eos.PosteriorPredictive.predict_to_file`.
+
+        :param path: Path to the storage location, which will be created as a directory.
+        :type path: str
+        :param observables: Observables as a 1D array of shape (O, ).
+        :type observables: list or iterable of eos.Observable
+        :param weights: Weights on a linear scale as a 1D array of shape (N, ).
+        :type weights: 1D numpy array
+        """
         description = {}
         description['version'] = eos.__version__
         description['type'] = 'Prediction'
@@ -511,16 +535,9 @@ class Prediction:
             'kinematics': { k.name(): float(k) for k in o.kinematics() }
         } for o in observables]
 
-        if not samples.shape[1] == len(observables):
-            raise RuntimeError('Shape of samples {} incompatible with number of observables {}'.format(samples.shape, len(observables)))
-
-        if not samples.shape[0] == weights.shape[0]:
-            raise RuntimeError('Shape of weights {} incompatible with shape of samples {}'.format(weights.shape, samples.shape))
-
         os.makedirs(path, exist_ok=True)
         with open(os.path.join(path, 'description.yaml'), 'w') as description_file:
             yaml.dump(description, description_file, default_flow_style=False)
-        _np.save(os.path.join(path, 'samples.npy'), samples)
         _np.save(os.path.join(path, 'weights.npy'), weights)
 
 
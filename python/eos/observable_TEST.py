@@ -18,5 +18,37 @@ class StaticMethodTests(unittest.TestCase):
             eos.Observables._get_obs_entry(invalid_name)
 
 
+class EvaluateBatchTests(unittest.TestCase):
+
+    def test_evaluate_batch(self):
+        "batched evaluation agrees with point-wise evaluation"
+
+        import numpy as np
+
+        parameters = eos.Parameters()
+        kinematics = eos.Kinematics(q2=1.0)
+        options    = eos.Options(**{ 'form-factors': 'BSZ2015', 'l': 'mu', 'model': 'CKM' })
+        obs        = eos.Observable.make('B->Dlnu::dBR/dq2', parameters, kinematics, options)
+
+        q2   = np.linspace(1.0, 10.0, 10)
+        V_cb = np.array([0.040, 0.042])
+
+        values = obs.evaluate_batch(kinematics={ 'q2': q2 })
+        self.assertEqual(values.shape, (10,))
+
+        values = obs.evaluate_batch(kinematics={ 'q2': q2 }, parameters={ 'CKM::abs(V_cb)': V_cb })
+        self.assertEqual(values.shape, (2, 10))
+
+        for j, v in enumerate(V_cb):
+            parameters.set('CKM::abs(V_cb)', v)
+            for i, x in enumerate(q2):
+                kinematics['q2'].set(x)
+                self.assertAlmostEqual(values[j, i] / obs.evaluate(), 1.0, places=12)
+
+        with self.assertRaises(ValueError):
+            obs.evaluate_batch(kinematics={ 'q2': q2, 'q2_min': V_cb })
+
+
+
 if __name__ == '__main__':
     unittest.main(verbosity=5)
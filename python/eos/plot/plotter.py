@@ -520,11 +520,12 @@ class Plotter:
             # create observable
             observable = eos.Observable.make(oname, parameters, kinematics, options)
 
+            # evaluate all points in one batch
             xvalues = np.linspace(self.xlo, self.xhi, self.xsamples + 1)
-            ovalues = np.array([])
-            for xvalue in xvalues:
-                var.set(xvalue)
-                ovalues = np.append(ovalues, observable.evaluate())
+            if item['variable'] in valid_kin_vars:
+                ovalues = observable.evaluate_batch(kinematics={ item['variable']: xvalues })
+            else:
+                ovalues = observable.evaluate_batch(parameters={ item['variable']: xvalues })
 
             self.plotter.ax.plot(xvalues, ovalues, alpha=self.alpha, color=self.color, label=self.label, ls=self.style, lw=self.lw)
 
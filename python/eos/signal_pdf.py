@@ -32,77 +32,48 @@ class SignalPDF(_SignalPDF):
 
         return self.evaluate()
 
-    def sample_mcmc(self, N, stride, pre_N, preruns, cov_scale=0.1, start_point=None, rng=np.random.mtrand):
+    def sample_mcmc(self, N, stride, pre_N, preruns, cov_scale=0.1, start_point=None, rng=np.random.mtrand, path=None):
         """
         Return samples of the kinematic variables and the log(PDF).
 
-        Obtains random samples of the log(PDF) using an adaptive Markov Chain Monte Carlo with PyPMC.
-        A prerun with adaptations is carried out first and its samples are discarded.
+        Obtains random samples with the native :class:`eos.SignalPDFSampler`, which distributes the work over the
+        threads of the thread pool. Events are drawn by accept-reject sampling if its estimated efficiency suffices,
+        and from random-walk Metropolis chains otherwise. The chains adapt their step sizes during a burn-in
+        of ``pre_N * preruns`` steps, whose samples are discarded.
 
         :param N: Number of samples that shall be returned
-        :param stride: Stride, i.e., the number by which the actual amount of samples shall be thinned to return N samples.
+        :param stride: Stride, i.e., the number of Metropolis steps per returned sample.
         :param pre_N: Number of samples in each prerun.
         :param preruns: Number of preruns.
-        :param cov_scale: Scale factor for the initial guess of the covariance matrix.
-        :param start_point: Optional starting point for the chain
-        :type start_point: list-like, optional
-        :param rng: Optional random number generator (must be compatible with the requirements of pypmc.sampler.markov_chain.MarkovChain)
-
-        :return: A tuple of the kinematic variables as array of size N and the log(PDF) as array of size N.
-
-        .. note::
-           This method requires the PyPMC python module, which can be installed from PyPI.
+        :param cov_scale: Unused; the chains adapt their step sizes themselves.
+        :param start_point: Unused; the chains start from points of a uniform scan of the phase space.
+        :param rng: Optional random number generator, which provides the seed of the native sampler.
+        :param path: Optional path of a text file to which the samples are written, one per line, instead of being returned.
+            The columns follow the order of `self.kinematic_variable_names()`.
+        :type path: str, optional
+
+        :return: A tuple of the kinematic variables as array of size N and the log(PDF) as array of size N,
+            or None if `path` is provided. The columns of the kinematic variables follow the order of `self.variables`.
         """
-        import pypmc
-        try:
-            from tqdm.auto import tqdm
-            progressbar = tqdm
-        except ImportError:
-            progressbar = lambda x, **kw: x
-
-        ind_lower = np.array([bound[0].evaluate() for bound in self.bounds])
-        ind_upper = np.array([bound[1].evaluate() for bound in self.bounds])
-        ind = pypmc.tools.indicator.hyperrectangle(ind_lower, ind_upper)
-
-        log_target = pypmc.tools.indicator.merge_function_with_indicator(self.log_pdf, ind, -np.inf)
-
-        # create initial covariance
-        sigma = np.diag([np.square(bound[1].evaluate() - bound[0].evaluate()) / 12 * cov_scale for bound in self.bounds])
-        log_proposal = pypmc.density.gauss.LocalGauss(sigma)
-
-        # create start point, if not provided
-        if start_point is None:
-            u = np.array([rng.uniform(0.0, 1.0) for j in range(0, len(ind_lower))])
-            ubar = 1.0 - u
-            start_point = ubar * ind_upper + u * ind_lower
-
-        # create MC sampler
-        sampler = pypmc.sampler.markov_chain.AdaptiveMarkovChain(log_target, log_proposal, start_point, save_target_values=True, rng=rng)
-
-        # pre run to adapt markov chains
-        for i in progressbar(range(0, preruns), desc="Pre-runs", leave=False):
-            eos.info('Prerun {} out of {}'.format(i, preruns))
-            accept_count = sampler.run(pre_N)
-            accept_rate  = accept_count / pre_N * 100
-            eos.info('Prerun {}: acceptance rate is {:3.0f}%'.format(i, accept_rate))
-            sampler.adapt()
-        sampler.clear()
-
-        # obtain final samples
+        config = eos.SignalPDFSampler.Config().stride(stride).burn_in(pre_N * preruns).seed(int(rng.randint(0, 2**31 - 1)))
+        sampler = eos.SignalPDFSampler(self, config)
+
         eos.info('Main run: started ...')
-        sample_total  = N * stride
-        sample_chunk  = sample_total // 100
-        sample_chunks = [sample_chunk for i in range(0, 99)]
-        sample_chunks.append(sample_total - 99 * sample_chunk)
-        for current_chunk in progressbar(sample_chunks, desc="Main run", leave=False):
-            accept_count = accept_count + sampler.run(current_chunk)
-        accept_rate  = accept_count / (N * stride) * 100
-        eos.info('Main run: acceptance rate is {:3.0f}%'.format(accept_rate))
-
-        parameter_samples = sampler.samples[:][::stride]
-        weights = sampler.target_values[:][::stride, 0]
-
-        return(parameter_samples, weights)
+        if path is not None:
+            sampler.sample_to_file(N, path)
+        else:
+            samples = sampler.sample(N)
+        eos.info('Main run: acceptance rate is {:3.0f}%'.format(sampler.efficiency() * 100))
+
+        if path is not None:
+            return None
+
+        # reorder the columns of the sampler to the order of self.variables
+        names = self.kinematic_variable_names()
+        columns = [names.index(v.name()) for v in self.variables]
+        weights = self.evaluate_batch(samples)
+
+        return(samples[:, columns], weights)
 
     @staticmethod
     def make(name, parameters, kinematics, options):
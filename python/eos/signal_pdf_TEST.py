@@ -0,0 +1,64 @@
+import unittest
+import eos
+import numpy as np
+import os
+import tempfile
+
+class SignalPDFSamplerTests(unittest.TestCase):
+
+    def make_pdf(self):
+        return eos.SignalPDF.make('Test::Legendre1D', eos.Parameters(), eos.Kinematics(z_min=-1.0, z_max=+1.0), eos.Options())
+
+    def test_evaluate_batch(self):
+        "batched evaluation agrees with point-wise evaluation"
+
+        pdf = self.make_pdf()
+        self.assertEqual(pdf.kinematic_variable_names(), ['z'])
+
+        z = np.linspace(-1.0, 1.0, 5)
+        values = pdf.evaluate_batch(z.reshape(-1, 1))
+        self.assertEqual(values.shape, (5,))
+
+        for i, x in enumerate(z):
+            self.assertAlmostEqual(values[i], pdf.log_pdf([x]), places=12)
+
+        with self.assertRaises(ValueError):
+            pdf.evaluate_batch(np.zeros((5, 2)))
+
+    def test_sample(self):
+        "events are drawn into new and preallocated arrays, and into files"
+
+        pdf = self.make_pdf()
+        sampler = eos.SignalPDFSampler(pdf, eos.SignalPDFSampler.Config().seed(42))
+
+        events = sampler.sample(1000)
+        self.assertEqual(events.shape, (1000, 1))
+        self.assertTrue(np.all((-1.0 <= events) & (events <= +1.0)))
+
+        # the events only depend on the seed
+        preallocated = np.empty((1000, 1))
+        eos.SignalPDFSampler(pdf, eos.SignalPDFSampler.Config().seed(42)).sample_into(preallocated)
+        self.assertTrue(np.array_equal(events, preallocated))
+
+        with self.assertRaises(ValueError):
+            sampler.sample_into(np.empty((10, 2)))
+
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, 'events.txt')
+            sampler.sample_to_file(100, path)
+            self.assertEqual(np.loadtxt(path).shape, (100,))
+
+    def test_sample_mcmc(self):
+        "sample_mcmc returns the events and their log(PDF)"
+
+        pdf = self.make_pdf()
+        samples, weights = pdf.sample_mcmc(N=2000, stride=5, pre_N=100, preruns=3, rng=np.random.mtrand.RandomState(42))
+        self.assertEqual(samples.shape, (2000, 1))
+        self.assertEqual(weights.shape, (2000,))
+
+        # the mean of the PDF (9 + 8 z + 9 z^2) / 24 on [-1, +1] is 2/9
+        self.assertAlmostEqual(np.mean(samples), 2.0 / 9.0, delta=0.05)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=5)
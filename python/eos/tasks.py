@@ -49,8 +49,7 @@ _tasks = {}
 
 def task(name, output, mode=lambda **kwargs: 'w'):
     def _task(func):
-        @functools.wraps(func)
-        def task_wrapper(*args, **kwargs):
+        def _arguments(*args, **kwargs):
             # extract default arguments
             _args = {
                 k: v.default
@@ -59,6 +58,14 @@ def task(name, output, mode=lambda **kwargs: 'w'):
             }
             _args.update(zip(func.__code__.co_varnames, args))
             _args.update(kwargs)
+            return _args
+
+        def output_path(*args, **kwargs):
+            return ('{base_directory}/' + output).format(**_arguments(*args, **kwargs))
+
+        @functools.wraps(func)
+        def task_wrapper(*args, **kwargs):
+            _args = _arguments(*args, **kwargs)
             if 'analysis_file' in _args and type(_args['analysis_file']) is str:
                 _args.update({ 'analysis_file': eos.AnalysisFile(_args['analysis_file'])})
             # create output directory
@@ -82,6 +89,7 @@ def task(name, output, mode=lambda **kwargs: 'w'):
                     if iaccordion:
                         iaccordion.selected_index = None
                     return result
+        task_wrapper.output_path = output_path
         _tasks[name] = task_wrapper
         return task_wrapper
     return _task
@@ -404,32 +412,18 @@ def predict_observables(analysis_file:str, posterior:str, prediction:str, base_d
 
     data = eos.data.ImportanceSamples(os.path.join(base_directory, posterior, 'samples'))
 
-    try:
-        from tqdm.auto import tqdm
-        progressbar = tqdm
-    except ImportError:
-        progressbar = lambda x: x
-
+    # the predictions are evaluated in parallel and streamed to disk by the native engine
     parameters = [_parameters[p['name']] for p in data.varied_parameters]
-    observable_samples = []
-    for i, sample in enumerate(progressbar(data.samples[begin:end])):
-        for p, v in zip(parameters, sample):
-            p.set(v)
-        try:
-            cache.update()
-            observable_samples.append([cache[id] for id in observable_ids])
-        except RuntimeError as e:
-            eos.error('skipping prediction for sample {i} due to runtime error ({e}): {s}'.format(i=i, e=e, s=sample))
-            observable_samples.append([_np.nan for _ in observable_ids])
-    observable_samples = _np.array(observable_samples)
+    predictive = eos.PosteriorPredictive(cache, observable_ids, parameters)
 
     output_path = os.path.join(base_directory, posterior, 'pred-{}'.format(prediction))
-    eos.data.Prediction.create(output_path, observables, observable_samples, data.weights[begin:end])
+    eos.data.Prediction.create_without_samples(output_path, observables, data.weights[begin:end])
+    predictive.predict_to_file(data.samples[begin:end], os.path.join(output_path, 'samples.npy'))
 
 
 # Run analysis steps
 @task('run', '')
-def run(analysis_file:str, base_directory:str='./', dry_run:bool=False, executor:str='serial'):
+def run(analysis_file:str, base_directory:str='./', dry_run:bool=False, executor:str='serial', cores:int=None):
     """
     Runs a list of predefined steps recorded in the analysis file.
 
@@ -445,11 +439,15 @@ def run(analysis_file:str, base_directory:str='./', dry_run:bool=False, executor
     :type base_directory: str, optional
     :param dry_run: The flag that disables execution and insteads prints the full information on the tasks that would be run to standard output. Defaults to `False`.
     :type dry_run: bool, optional
-    :param executor: The flag that governs the execution type for the tasks. Currently only supports `serial` execution. Defaults to `serial`.
+    :param executor: The flag that governs the execution type for the tasks. Supports `serial` execution within the present process,
+        and `parallel` execution of independent tasks in separate worker processes. Defaults to `serial`.
     :type executor: str, optional
+    :param cores: The number of cores that the `parallel` executor distributes among its worker processes. Defaults to the value of
+        the EOS_MAX_THREADS environment variable, if set, or else the number of available processors. Ignored by the `serial` executor.
+    :type cores: int, optional
     """
     try:
-        exec = Executor.make(executor, steps=analysis_file.steps(base_directory), dry_run=dry_run)
+        exec = Executor.make(executor, steps=analysis_file.steps(base_directory), dry_run=dry_run, cores=cores)
         exec.run()
         exec.join()
     except Exception as e:
@@ -601,7 +599,7 @@ class Executor:
 
 
 class SerialExecutor(Executor):
-    def __init__(self, steps, dry_run=False):
+    def __init__(self, steps, dry_run=False, cores=None):
         Executor.__init__(self, steps, dry_run)
 
     def run(self):
@@ -615,3 +613,178 @@ class SerialExecutor(Executor):
                 _tasks[task](**arguments)
 
 Executor.register('serial', SerialExecutor)
+
+
+def _run_job(task, arguments, marker):
+    """Runs a single task within a worker process of the ParallelExecutor, and records its completion."""
+    import yaml
+
+    _tasks[task](**arguments)
+
+    with open(marker, 'w') as marker_file:
+        yaml.safe_dump({ 'task': task, 'arguments': arguments }, marker_file, default_flow_style=False)
+
+
+class ParallelExecutor(Executor):
+    """
+    Runs independent tasks concurrently in separate worker processes.
+
+    The tasks of all steps and their iterations form a directed acyclic graph, following the steps' 'depends-on' lists.
+    A task is launched once all tasks of the steps it depends on have completed, e.g., all MCMC chains of a posterior
+    run concurrently once its mode has been found. Each worker process is assigned a share of the core budget, which is
+    passed down to its thread pool through the EOS_MAX_THREADS environment variable.
+
+    Upon success, each task records its arguments in the file '.completed.yaml' within its output directory.
+    Tasks whose record matches their present arguments, and whose dependencies are all completed, are not run again,
+    such that an interrupted run can be resumed. Whenever a task is launched, its own record and the records of all tasks
+    that depend on it, directly or indirectly, are removed, since their outputs become outdated.
+
+    The tasks are launched by run(), and join() waits until all of them have finished.
+    """
+    _marker = '.completed.yaml'
+
+    def __init__(self, steps, dry_run=False, cores=None):
+        Executor.__init__(self, steps, dry_run)
+
+        if cores is None:
+            cores = int(os.environ['EOS_MAX_THREADS']) if 'EOS_MAX_THREADS' in os.environ else os.cpu_count()
+        if cores < 1:
+            raise ValueError(f'Parallel executor requires a positive number of cores, got {cores}')
+        self._cores = cores
+
+        # the worker processes reload the analysis file from its path
+        self._jobs = []
+        for step_name, desc, task, arguments in steps:
+            arguments = dict(arguments)
+            if isinstance(arguments.get('analysis_file'), eos.AnalysisFile):
+                arguments['analysis_file'] = arguments['analysis_file'].analysis_file
+            self._jobs.append({ 'step': step_name, 'task': task, 'arguments': arguments, 'depends-on': set(desc.get('depends-on', [])) })
+
+        for job in self._jobs:
+            job['dependencies'] = { idx for idx, other in enumerate(self._jobs) if other['step'] in job['depends-on'] }
+            job['marker'] = os.path.join(_tasks[job['task']].output_path(**job['arguments']), ParallelExecutor._marker)
+
+        self._running = None
+
+    def _completed(self, job):
+        import yaml
+
+        if not os.path.isfile(job['marker']):
+            return False
+
+        with open(job['marker']) as marker_file:
+            record = yaml.safe_load(marker_file)
+
+        return record == { 'task': job['task'], 'arguments': job['arguments'] }
+
+    def _downstream(self, idx):
+        """Returns the indices of all jobs that depend on the given job, directly or indirectly."""
+        result = set()
+        queue  = [idx]
+        while queue:
+            current = queue.pop()
+            for other, job in enumerate(self._jobs):
+                if current in job['dependencies'] and other not in result:
+                    result.add(other)
+                    queue.append(other)
+
+        return result
+
+    def _launch(self, job, threads):
+        # the environment is inherited by the worker process upon start
+        previous = os.environ.get('EOS_MAX_THREADS')
+        os.environ['EOS_MAX_THREADS'] = str(threads)
+        try:
+            process = self._context.Process(target=_run_job, args=(job['task'], job['arguments'], job['marker']))
+            process.start()
+        finally:
+            if previous is None:
+                del os.environ['EOS_MAX_THREADS']
+            else:
+                os.environ['EOS_MAX_THREADS'] = previous
+
+        eos.info(f'Started task "{job["task"]}" of step "{job["step"]}" with {threads} thread(s): {job["arguments"]}')
+        return process
+
+    def _schedule(self):
+        # tasks that depend on a failed task cannot be run
+        skipped = True
+        while skipped:
+            skipped = False
+            for idx in list(self._pending):
+                if self._jobs[idx]['dependencies'] & self._failed:
+                    eos.error(f'Skipping task "{self._jobs[idx]["task"]}" of step "{self._jobs[idx]["step"]}" due to failed dependencies')
+                    self._pending.remove(idx)
+                    self._failed.add(idx)
+                    skipped = True
+
+        # share the free cores among the tasks that are ready to run
+        ready = [idx for idx in self._pending if self._jobs[idx]['dependencies'] <= self._completed_jobs]
+        while ready and self._free > 0:
+            idx = ready.pop(0)
+            self._pending.remove(idx)
+
+            # the outputs of this task and of all downstream tasks become outdated
+            for other in { idx } | self._downstream(idx):
+                if os.path.isfile(self._jobs[other]['marker']):
+                    os.remove(self._jobs[other]['marker'])
+
+            threads = max(1, self._free // (len(ready) + 1))
+            process = self._launch(self._jobs[idx], threads)
+            self._running[process.sentinel] = (idx, process, threads)
+            self._free -= threads
+
+    def run(self):
+        import multiprocessing
+
+        # a task is only completed if all of its dependencies are completed as well
+        completed = { idx for idx, job in enumerate(self._jobs) if self._completed(job) }
+        outdated  = { idx for idx in completed if not self._jobs[idx]['dependencies'] <= completed }
+        while outdated:
+            completed -= outdated
+            outdated = { idx for idx in completed if not self._jobs[idx]['dependencies'] <= completed }
+
+        self._completed_jobs = completed
+        self._pending        = [idx for idx in range(len(self._jobs)) if idx not in completed]
+        self._failed         = set()
+        self._running        = {}
+        self._free           = self._cores
+
+        if self._dry_run:
+            for idx, job in enumerate(self._jobs):
+                status = ' # completed' if idx in completed else ''
+                print(f'eos-analysis {job["task"]} {job["arguments"]}{status}')
+            self._pending = []
+            return
+
+        for idx in sorted(completed):
+            eos.info(f'Skipping completed task "{self._jobs[idx]["task"]}" of step "{self._jobs[idx]["step"]}": {self._jobs[idx]["arguments"]}')
+
+        # use fresh interpreters, such that each worker creates its own thread pool of the assigned size
+        self._context = multiprocessing.get_context('spawn')
+        self._schedule()
+
+    def join(self):
+        from multiprocessing.connection import wait
+
+        if self._running is None:
+            self.run()
+
+        while self._running:
+            for sentinel in wait(list(self._running.keys())):
+                idx, process, threads = self._running.pop(sentinel)
+                process.join()
+                self._free += threads
+
+                if 0 == process.exitcode:
+                    self._completed_jobs.add(idx)
+                else:
+                    eos.error(f'Task "{self._jobs[idx]["task"]}" of step "{self._jobs[idx]["step"]}" failed with exit code {process.exitcode}')
+                    self._failed.add(idx)
+
+            self._schedule()
+
+        if self._failed:
+            raise RuntimeError(f'Parallel executor encountered {len(self._failed)} failed or skipped task(s)')
+
+Executor.register('parallel', ParallelExecutor)
@@ -0,0 +1,88 @@
+import unittest
+import eos
+import os
+import tempfile
+
+# The parallel executor runs each task in a fresh interpreter, which imports this file again
+# as its main module. Hence the stub task must be registered at the module level.
+@eos.tasks.task('test-stub', '{label}')
+def stub(label:str, base_directory:str='./', fail:bool=False):
+    with open(os.path.join(base_directory, 'order'), 'a') as order:
+        order.write(f'{label}\n')
+
+    if fail:
+        raise RuntimeError(f'Stub task {label} failed')
+
+
+class ParallelExecutorTests(unittest.TestCase):
+
+    def make_steps(self, base_directory, fail_b=False):
+        # A -> B -> C, and D independent of all others
+        def step(label, depends_on=[], **kwargs):
+            return (label, { 'depends-on': depends_on }, 'test-stub', dict(label=label, base_directory=base_directory, **kwargs))
+
+        return [
+            step('a'),
+            step('b', ['a'], **({ 'fail': True } if fail_b else {})),
+            step('c', ['b']),
+            step('d'),
+        ]
+
+    def run_steps(self, base_directory, **kwargs):
+        order = os.path.join(base_directory, 'order')
+        if os.path.isfile(order):
+            os.remove(order)
+
+        executor = eos.tasks.Executor.make('parallel', steps=self.make_steps(base_directory, **kwargs), dry_run=False, cores=2)
+        try:
+            executor.run()
+            executor.join()
+        finally:
+            if os.path.isfile(order):
+                with open(order) as f:
+                    self.order = f.read().split()
+            else:
+                self.order = []
+
+        return self.order
+
+    def remove_marker(self, base_directory, label):
+        os.remove(os.path.join(base_directory, label, '.completed.yaml'))
+
+    def test_resume(self):
+        "only outdated tasks and the tasks depending on them are run again"
+
+        with tempfile.TemporaryDirectory() as base_directory:
+            # all tasks run in the order of their dependencies
+            order = self.run_steps(base_directory)
+            self.assertEqual(sorted(order), ['a', 'b', 'c', 'd'])
+            self.assertLess(order.index('a'), order.index('b'))
+            self.assertLess(order.index('b'), order.index('c'))
+
+            # completed tasks are not run again
+            self.assertEqual(self.run_steps(base_directory), [])
+
+            # tasks depending on an outdated task are run again
+            self.remove_marker(base_directory, 'a')
+            self.assertEqual(self.run_steps(base_directory), ['a', 'b', 'c'])
+
+            self.remove_marker(base_directory, 'b')
+            self.assertEqual(self.run_steps(base_directory), ['b', 'c'])
+
+    def test_failure(self):
+        "tasks depending on a failed task are skipped"
+
+        with tempfile.TemporaryDirectory() as base_directory:
+            self.run_steps(base_directory)
+
+            # the changed arguments of B require it to run again
+            with self.assertRaises(RuntimeError):
+                self.run_steps(base_directory, fail_b=True)
+            self.assertEqual(self.order, ['b'])
+
+            # B and C are run again once B succeeds
+            self.assertEqual(self.run_steps(base_directory), ['b', 'c'])
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=5)